@@ -0,0 +1,29 @@
+# Locate the LZ4 compression library. LZ4 is optional, when it is missing the
+# frame server falls back to raw frames for links that ask for LZ4.
+#
+# Sets:
+#   LZ4_FOUND
+#   LZ4_NOT_FOUND_MESSAGE
+#
+# Creates imported target:
+#   LZ4::lz4
+
+find_path(LZ4_INCLUDE_DIR NAMES lz4.h)
+find_library(LZ4_LIBRARY NAMES lz4 liblz4)
+
+if (LZ4_INCLUDE_DIR AND LZ4_LIBRARY)
+  if (NOT TARGET LZ4::lz4)
+    add_library(LZ4::lz4 UNKNOWN IMPORTED)
+    set_target_properties(LZ4::lz4 PROPERTIES
+      IMPORTED_LOCATION "${LZ4_LIBRARY}"
+      INTERFACE_INCLUDE_DIRECTORIES "${LZ4_INCLUDE_DIR}"
+    )
+  endif()
+
+  set(LZ4_FOUND TRUE)
+else()
+  set(LZ4_FOUND FALSE)
+  set(LZ4_NOT_FOUND_MESSAGE "LZ4 headers or library not found")
+endif()
+
+mark_as_advanced(LZ4_INCLUDE_DIR LZ4_LIBRARY)
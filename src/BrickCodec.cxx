@@ -0,0 +1,405 @@
+// ============================================================================
+// BrickCodec.cxx - Implementation of the brick compression functions
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * BrickCodec.cxx: created.
+// * BrickCodec.cxx: empty raw bricks no longer pass null to memcpy.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header -------------------------------------------------------------
+#include "BrickCodec.h"
+
+// "C" system headers ---------------------------------------------------------
+
+// Standard Library headers ---------------------------------------------------
+#include <cstring>
+
+// External libraries headers -------------------------------------------------
+#if defined(QTVTK_HAVE_LZ4)
+#include <lz4.h>
+#endif
+
+
+// ============================================================================
+// Local helpers section
+// ============================================================================
+
+namespace {
+
+// Replaces each element by its difference to the same component of the
+// previous voxel. Unsigned arithmetic wraps, so this is exact for any type.
+template <typename Word>
+void deltaEncode(
+    const void* data,
+    std::size_t count,
+    int components,
+    std::uint8_t* residuals
+    )
+{
+    const auto* bytes = static_cast<const std::uint8_t*>(data);
+    const std::size_t stride = static_cast<std::size_t>(components);
+    for (std::size_t i = 0; i < count; ++i) {
+        Word value;
+        std::memcpy(&value, bytes + i * sizeof(Word), sizeof(Word));
+        if (i >= stride) {
+            Word previous;
+            std::memcpy(
+                &previous,
+                bytes + (i - stride) * sizeof(Word),
+                sizeof(Word)
+                );
+            value = static_cast<Word>(value - previous);
+        }
+        std::memcpy(residuals + i * sizeof(Word), &value, sizeof(Word));
+    }
+}
+
+template <typename Word>
+void deltaDecode(
+    const std::uint8_t* residuals,
+    std::size_t count,
+    int components,
+    void* data
+    )
+{
+    auto* bytes = static_cast<std::uint8_t*>(data);
+    const std::size_t stride = static_cast<std::size_t>(components);
+    for (std::size_t i = 0; i < count; ++i) {
+        Word value;
+        std::memcpy(&value, residuals + i * sizeof(Word), sizeof(Word));
+        if (i >= stride) {
+            Word previous;
+            std::memcpy(
+                &previous,
+                bytes + (i - stride) * sizeof(Word),
+                sizeof(Word)
+                );
+            value = static_cast<Word>(value + previous);
+        }
+        std::memcpy(bytes + i * sizeof(Word), &value, sizeof(Word));
+    }
+}
+
+bool delta(
+    bool encode,
+    const void* input,
+    std::size_t count,
+    int element_size,
+    int components,
+    void* output
+    )
+{
+    switch (element_size) {
+    case 1:
+        encode
+            ? deltaEncode<std::uint8_t>(
+                input, count, components, static_cast<std::uint8_t*>(output))
+            : deltaDecode<std::uint8_t>(
+                static_cast<const std::uint8_t*>(input), count, components,
+                output);
+        return true;
+    case 2:
+        encode
+            ? deltaEncode<std::uint16_t>(
+                input, count, components, static_cast<std::uint8_t*>(output))
+            : deltaDecode<std::uint16_t>(
+                static_cast<const std::uint8_t*>(input), count, components,
+                output);
+        return true;
+    case 4:
+        encode
+            ? deltaEncode<std::uint32_t>(
+                input, count, components, static_cast<std::uint8_t*>(output))
+            : deltaDecode<std::uint32_t>(
+                static_cast<const std::uint8_t*>(input), count, components,
+                output);
+        return true;
+    case 8:
+        encode
+            ? deltaEncode<std::uint64_t>(
+                input, count, components, static_cast<std::uint8_t*>(output))
+            : deltaDecode<std::uint64_t>(
+                static_cast<const std::uint8_t*>(input), count, components,
+                output);
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Groups byte b of every element together (plane b), and back
+void splitPlanes(
+    const std::uint8_t* input,
+    std::size_t count,
+    int element_size,
+    std::uint8_t* planes
+    )
+{
+    for (int b = 0; b < element_size; ++b) {
+        std::uint8_t* plane = planes + b * count;
+        for (std::size_t i = 0; i < count; ++i) {
+            plane[i] = input[i * element_size + b];
+        }
+    }
+}
+
+void joinPlanes(
+    const std::uint8_t* planes,
+    std::size_t count,
+    int element_size,
+    std::uint8_t* output
+    )
+{
+    for (int b = 0; b < element_size; ++b) {
+        const std::uint8_t* plane = planes + b * count;
+        for (std::size_t i = 0; i < count; ++i) {
+            output[i * element_size + b] = plane[i];
+        }
+    }
+}
+
+// PackBits: a header byte h in 0..127 is followed by h + 1 literal bytes,
+// h in -127..-1 by one byte repeated 1 - h times
+void packBits(
+    const std::uint8_t* input,
+    std::size_t size,
+    std::vector<std::uint8_t>& output
+    )
+{
+    const std::size_t kMaxRun = 128;
+    std::size_t i = 0;
+    while (i < size) {
+        std::size_t run = 1;
+        while (i + run < size && run < kMaxRun && input[i + run] == input[i]) {
+            ++run;
+        }
+        if (run >= 3) {
+            output.push_back(static_cast<std::uint8_t>(1 - int(run)));
+            output.push_back(input[i]);
+            i += run;
+            continue;
+        }
+
+        const std::size_t start = i;
+        while (i < size && i - start < kMaxRun) {
+            if (i + 2 < size
+                && input[i] == input[i + 1]
+                && input[i] == input[i + 2]) {
+                break;
+            }
+            ++i;
+        }
+        output.push_back(static_cast<std::uint8_t>(i - start - 1));
+        output.insert(output.end(), input + start, input + i);
+    }
+}
+
+bool unpackBits(
+    const std::uint8_t* input,
+    std::size_t size,
+    std::uint8_t* output,
+    std::size_t expected
+    )
+{
+    std::size_t in = 0;
+    std::size_t out = 0;
+    while (in < size) {
+        const int header = static_cast<std::int8_t>(input[in++]);
+        if (header >= 0) {
+            const std::size_t length = std::size_t(header) + 1;
+            if (in + length > size || out + length > expected) {
+                return false;
+            }
+            std::memcpy(output + out, input + in, length);
+            in += length;
+            out += length;
+        } else if (header != -128) {
+            const std::size_t length = std::size_t(1 - header);
+            if (in >= size || out + length > expected) {
+                return false;
+            }
+            std::memset(output + out, input[in++], length);
+            out += length;
+        }
+    }
+
+    return out == expected;
+}
+
+}  // namespace
+
+
+// ============================================================================
+// Function Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// encodeBrick
+// ----------------------------------------------------------------------------
+//
+// Description: See BrickCodec.h
+//
+// ----------------------------------------------------------------------------
+BrickCodec encodeBrick(
+    const void* data,
+    std::size_t count,
+    int element_size,
+    int components,
+    std::vector<std::uint8_t>& payload
+    )
+{
+    const std::size_t size = count * std::size_t(element_size);
+    const auto* raw = static_cast<const std::uint8_t*>(data);
+
+    std::vector<std::uint8_t> residuals(size);
+    std::vector<std::uint8_t> planes(size);
+    if (size > 0
+        && delta(true, data, count, element_size, components,
+                 residuals.data())) {
+        splitPlanes(residuals.data(), count, element_size, planes.data());
+
+        payload.clear();
+#if defined(QTVTK_HAVE_LZ4)
+        payload.resize(
+            static_cast<std::size_t>(LZ4_compressBound(static_cast<int>(size)))
+            );
+        const int written = LZ4_compress_default(
+            reinterpret_cast<const char*>(planes.data()),
+            reinterpret_cast<char*>(payload.data()),
+            static_cast<int>(size),
+            static_cast<int>(payload.size())
+            );
+        if (written > 0 && std::size_t(written) < size) {
+            payload.resize(static_cast<std::size_t>(written));
+            payload.shrink_to_fit();
+            return BrickCodec::DeltaLz4;
+        }
+#else
+        payload.reserve(size / 4);
+        packBits(planes.data(), size, payload);
+        if (payload.size() < size) {
+            payload.shrink_to_fit();
+            return BrickCodec::DeltaRle;
+        }
+#endif
+    }
+
+    payload.assign(raw, raw + size);
+    return BrickCodec::Raw;
+}
+
+// ----------------------------------------------------------------------------
+// decodeBrick
+// ----------------------------------------------------------------------------
+//
+// Description: See BrickCodec.h
+//
+// ----------------------------------------------------------------------------
+bool decodeBrick(
+    BrickCodec codec,
+    const std::uint8_t* payload,
+    std::size_t size,
+    std::size_t count,
+    int element_size,
+    int components,
+    void* data
+    )
+{
+    const std::size_t expected = count * std::size_t(element_size);
+    if (codec == BrickCodec::Raw) {
+        if (size != expected) {
+            return false;
+        }
+        // Empty bricks may come with null pointers, which memcpy rejects
+        if (size > 0) {
+            std::memcpy(data, payload, size);
+        }
+        return true;
+    }
+
+    std::vector<std::uint8_t> planes(expected);
+    if (codec == BrickCodec::DeltaRle) {
+        if (!unpackBits(payload, size, planes.data(), expected)) {
+            return false;
+        }
+    } else if (codec == BrickCodec::DeltaLz4) {
+#if defined(QTVTK_HAVE_LZ4)
+        const int read = LZ4_decompress_safe(
+            reinterpret_cast<const char*>(payload),
+            reinterpret_cast<char*>(planes.data()),
+            static_cast<int>(size),
+            static_cast<int>(expected)
+            );
+        if (read < 0 || std::size_t(read) != expected) {
+            return false;
+        }
+#else
+        return false;
+#endif
+    } else {
+        return false;
+    }
+
+    std::vector<std::uint8_t> residuals(expected);
+    joinPlanes(planes.data(), count, element_size, residuals.data());
+    return delta(
+        false, residuals.data(), count, element_size, components, data
+        );
+}
+
+// ----------------------------------------------------------------------------
+// brickCodecName
+// ----------------------------------------------------------------------------
+//
+// Description: Returns the name of a codec
+//
+// Inputs:
+// - codec: The codec
+//
+// Outputs: None
+//
+// Returns: "raw", "delta+rle" or "delta+lz4"
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+const char* brickCodecName(BrickCodec codec)
+{
+    switch (codec) {
+    case BrickCodec::Raw:
+        return "raw";
+    case BrickCodec::DeltaRle:
+        return "delta+rle";
+    case BrickCodec::DeltaLz4:
+        return "delta+lz4";
+    }
+    return "unknown";
+}
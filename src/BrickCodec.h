@@ -0,0 +1,136 @@
+// ============================================================================
+// BrickCodec.h - Lossless compression of blocks of scalar data
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * BrickCodec.h: created.
+//
+// ============================================================================
+
+
+#ifndef BrickCodec_H
+#define BrickCodec_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// "C" system headers
+
+// Standard Library headers
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+// ============================================================================
+// Enumerations Section
+// ============================================================================
+
+// How a brick is stored. The values are part of on-disk formats, do not
+// renumber them.
+enum class BrickCodec : std::uint8_t {
+    Raw = 0,       // Copied as is
+    DeltaRle = 1,  // Delta coding, byte planes, PackBits run lengths
+    DeltaLz4 = 2   // Delta coding, byte planes, LZ4
+};
+
+
+// ============================================================================
+// Function Declarations Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// encodeBrick
+// ----------------------------------------------------------------------------
+//
+// Description: Compresses count elements of element_size bytes each. Each
+//              element is replaced by its difference to the element
+//              components positions earlier (same component of the previous
+//              voxel), using wrap-around integer arithmetic on the element
+//              bits, so the coding is lossless for every scalar type. The
+//              residuals are split into byte planes, which turns the mostly
+//              zero high bytes of smooth data into long runs, and the planes
+//              are compressed with LZ4 when available, with PackBits run
+//              length coding otherwise. If that does not pay off the brick
+//              is stored raw.
+//
+// Inputs:
+// - data: The elements
+// - count: Number of elements
+// - element_size: Size of one element in bytes (1, 2, 4 or 8)
+// - components: Interleaved components per voxel
+//
+// Outputs:
+// - payload: The encoded brick
+//
+// Returns: The codec that was used
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+BrickCodec encodeBrick(
+    const void* data,
+    std::size_t count,
+    int element_size,
+    int components,
+    std::vector<std::uint8_t>& payload
+    );
+
+// ----------------------------------------------------------------------------
+// decodeBrick
+// ----------------------------------------------------------------------------
+//
+// Description: Reverses encodeBrick
+//
+// Inputs:
+// - codec: Codec returned by encodeBrick
+// - payload: The encoded brick
+// - size: Size of the encoded brick in bytes
+// - count: Number of elements
+// - element_size: Size of one element in bytes
+// - components: Interleaved components per voxel
+//
+// Outputs:
+// - data: Buffer for count elements
+//
+// Returns: false if the payload is corrupt or the codec is not available
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool decodeBrick(
+    BrickCodec codec,
+    const std::uint8_t* payload,
+    std::size_t size,
+    std::size_t count,
+    int element_size,
+    int components,
+    void* data
+    );
+
+// Returns the name of a codec, e.g. "delta+lz4"
+const char* brickCodecName(BrickCodec codec);
+
+#endif  // BrickCodec_H
@@ -0,0 +1,199 @@
+// ============================================================================
+// BrickedImageSource.cxx - Implementation of the BrickedImageSource class
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * BrickedImageSource.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header -------------------------------------------------------------
+#include "BrickedImageSource.h"
+
+// "C" system headers ---------------------------------------------------------
+
+// Standard Library headers ---------------------------------------------------
+#include <utility>
+
+// External libraries headers -------------------------------------------------
+
+// VTK headers
+#include <vtkDataObject.h>
+#include <vtkInformation.h>
+#include <vtkInformationVector.h>
+#include <vtkObjectFactory.h>
+#include <vtkStreamingDemandDrivenPipeline.h>
+
+
+vtkStandardNewMacro(BrickedImageSource);
+
+
+// ============================================================================
+// Constructor/Destructor Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// BrickedImageSource::BrickedImageSource
+// ----------------------------------------------------------------------------
+//
+// Description: Constructor. The source has no inputs.
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+BrickedImageSource::BrickedImageSource()
+{
+    this->SetNumberOfInputPorts(0);
+}
+
+
+// ============================================================================
+// Public Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// BrickedImageSource::SetVolume
+// ----------------------------------------------------------------------------
+//
+// Description: Sets the volume to read
+//
+// Inputs:
+// - volume: The bricked volume
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Marks the source modified
+//
+// ----------------------------------------------------------------------------
+void BrickedImageSource::SetVolume(std::shared_ptr<BrickedVolume> volume)
+{
+    if (this->volume != volume) {
+        this->volume = std::move(volume);
+        this->Modified();
+    }
+}
+
+
+// ============================================================================
+// Protected Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// BrickedImageSource::RequestInformation
+// ----------------------------------------------------------------------------
+//
+// Description: Advertises extent, geometry and scalar type of the volume,
+//              and that any sub-extent can be produced
+//
+// Inputs:
+// - request, input_vector: Unused
+//
+// Outputs:
+// - output_vector: Output information
+//
+// Returns: 1 on success, 0 without a volume
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+int BrickedImageSource::RequestInformation(
+    vtkInformation* vtkNotUsed(request),
+    vtkInformationVector** vtkNotUsed(input_vector),
+    vtkInformationVector* output_vector
+    )
+{
+    if (!this->volume) {
+        vtkErrorMacro("No volume set");
+        return 0;
+    }
+
+    vtkInformation* info = output_vector->GetInformationObject(0);
+    info->Set(
+        vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(),
+        this->volume->extent(),
+        6
+        );
+    info->Set(vtkDataObject::ORIGIN(), this->volume->origin(), 3);
+    info->Set(vtkDataObject::SPACING(), this->volume->spacing(), 3);
+    info->Set(vtkAlgorithm::CAN_PRODUCE_SUB_EXTENT(), 1);
+    vtkDataObject::SetPointDataActiveScalarInfo(
+        info,
+        this->volume->scalarType(),
+        this->volume->components()
+        );
+
+    return 1;
+}
+
+// ----------------------------------------------------------------------------
+// BrickedImageSource::RequestData
+// ----------------------------------------------------------------------------
+//
+// Description: Decodes the update extent into the output image
+//
+// Inputs:
+// - request, input_vector: Unused
+//
+// Outputs:
+// - output_vector: Output information holding the image
+//
+// Returns: 1 on success, 0 if the region could not be decoded
+//
+// Side Effects: Updates the brick cache of the volume
+//
+// ----------------------------------------------------------------------------
+int BrickedImageSource::RequestData(
+    vtkInformation* vtkNotUsed(request),
+    vtkInformationVector** vtkNotUsed(input_vector),
+    vtkInformationVector* output_vector
+    )
+{
+    vtkInformation* info = output_vector->GetInformationObject(0);
+    vtkImageData* output = vtkImageData::GetData(info);
+    if (!this->volume || output == nullptr) {
+        return 0;
+    }
+
+    int extent[6];
+    info->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), extent);
+    if (!this->volume->extractRegion(extent, output)) {
+        vtkErrorMacro("Could not decode the requested extent");
+        return 0;
+    }
+
+    return 1;
+}
@@ -0,0 +1,107 @@
+// ============================================================================
+// BrickedImageSource.h - VTK pipeline source reading a BrickedVolume
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * BrickedImageSource.h: created.
+//
+// ============================================================================
+
+
+#ifndef BrickedImageSource_H
+#define BrickedImageSource_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Standard Library headers
+#include <memory>
+
+// External libraries headers
+#include <vtkImageAlgorithm.h>
+
+// Project headers
+#include "BrickedVolume.h"
+
+
+// ============================================================================
+// Class Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// BrickedImageSource
+// ----------------------------------------------------------------------------
+//
+// Description: Exposes a BrickedVolume to a VTK pipeline. The whole extent
+//              is advertised in RequestInformation, and RequestData decodes
+//              only the update extent, so streaming consumers (slice
+//              mappers, reslicers, vtkImageDataStreamer) never materialize
+//              the full volume.
+//
+// Properties:
+// - volume: The bricked volume, shared with its owner
+//
+// Methods:
+// - SetVolume: Sets the volume and marks the source modified
+// - GetVolume: Returns the volume
+//
+// Example usage:
+//   auto source = vtkSmartPointer<BrickedImageSource>::New();
+//   source->SetVolume(volume);
+//   slice_mapper->SetInputConnection(source->GetOutputPort());
+//
+// ----------------------------------------------------------------------------
+class BrickedImageSource : public vtkImageAlgorithm
+{
+public:
+    static BrickedImageSource* New();
+    vtkTypeMacro(BrickedImageSource, vtkImageAlgorithm);
+
+    void SetVolume(std::shared_ptr<BrickedVolume> volume);
+    std::shared_ptr<BrickedVolume> GetVolume() const { return this->volume; }
+
+protected:
+    BrickedImageSource();
+    ~BrickedImageSource() override = default;
+
+    int RequestInformation(
+        vtkInformation* request,
+        vtkInformationVector** input_vector,
+        vtkInformationVector* output_vector
+        ) override;
+    int RequestData(
+        vtkInformation* request,
+        vtkInformationVector** input_vector,
+        vtkInformationVector* output_vector
+        ) override;
+
+private:
+    BrickedImageSource(const BrickedImageSource&) = delete;
+    void operator=(const BrickedImageSource&) = delete;
+
+    std::shared_ptr<BrickedVolume> volume;
+};
+
+#endif  // BrickedImageSource_H
@@ -0,0 +1,855 @@
+// ============================================================================
+// BrickedVolume.cxx - Implementation of the BrickedVolume class
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * BrickedVolume.cxx: created.
+// * BrickedVolume.cxx: added readBrick, decoding without the cache.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header -------------------------------------------------------------
+#include "BrickedVolume.h"
+
+// "C" system headers ---------------------------------------------------------
+
+// Standard Library headers ---------------------------------------------------
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <limits>
+
+// External libraries headers -------------------------------------------------
+
+// VTK headers
+#include <vtkDataArray.h>
+#include <vtkInformation.h>
+#include <vtkPointData.h>
+#include <vtkSMPTools.h>
+#include <vtkStreamingDemandDrivenPipeline.h>
+
+
+// ============================================================================
+// BrickCache Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// BrickCache::BrickCache
+// ----------------------------------------------------------------------------
+//
+// Description: Constructor
+//
+// Inputs:
+// - capacity: Maximum size of the cached bricks in bytes
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+BrickCache::BrickCache(std::size_t capacity)
+    : capacity_bytes(capacity),
+      used_bytes(0)
+{
+}
+
+// ----------------------------------------------------------------------------
+// BrickCache::find
+// ----------------------------------------------------------------------------
+//
+// Description: Looks a brick up and marks it as most recently used
+//
+// Inputs:
+// - index: Brick index
+//
+// Outputs: None
+//
+// Returns: The decoded brick, null if not cached
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+BrickCache::Brick BrickCache::find(std::size_t index)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    auto found = this->lookup.find(index);
+    if (found == this->lookup.end()) {
+        return nullptr;
+    }
+    this->bricks.splice(this->bricks.begin(), this->bricks, found->second);
+
+    return found->second->second;
+}
+
+// ----------------------------------------------------------------------------
+// BrickCache::insert
+// ----------------------------------------------------------------------------
+//
+// Description: Adds a decoded brick. If another thread inserted the same
+//              brick meanwhile, the existing one is kept.
+//
+// Inputs:
+// - index: Brick index
+// - brick: The decoded brick
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Evicts the least recently used bricks beyond the capacity
+//
+// ----------------------------------------------------------------------------
+void BrickCache::insert(std::size_t index, Brick brick)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    if (!brick || this->lookup.count(index) != 0) {
+        return;
+    }
+
+    this->used_bytes += brick->size();
+    this->bricks.emplace_front(index, std::move(brick));
+    this->lookup[index] = this->bricks.begin();
+    this->trimLocked();
+}
+
+// ----------------------------------------------------------------------------
+// BrickCache::clear
+// ----------------------------------------------------------------------------
+//
+// Description: Drops all cached bricks
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void BrickCache::clear()
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->bricks.clear();
+    this->lookup.clear();
+    this->used_bytes = 0;
+}
+
+// ----------------------------------------------------------------------------
+// BrickCache::setCapacity
+// ----------------------------------------------------------------------------
+//
+// Description: Changes the capacity
+//
+// Inputs:
+// - capacity: Maximum size of the cached bricks in bytes
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Evicts bricks beyond the new capacity
+//
+// ----------------------------------------------------------------------------
+void BrickCache::setCapacity(std::size_t capacity)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->capacity_bytes = capacity;
+    this->trimLocked();
+}
+
+// ----------------------------------------------------------------------------
+// BrickCache::size
+// ----------------------------------------------------------------------------
+//
+// Description: Returns the size of the cached bricks
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: Size in bytes
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+std::size_t BrickCache::size() const
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->used_bytes;
+}
+
+// ----------------------------------------------------------------------------
+// BrickCache::capacity
+// ----------------------------------------------------------------------------
+//
+// Description: Returns the capacity
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: Capacity in bytes
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+std::size_t BrickCache::capacity() const
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->capacity_bytes;
+}
+
+// ----------------------------------------------------------------------------
+// BrickCache::trimLocked
+// ----------------------------------------------------------------------------
+//
+// Description: Evicts least recently used bricks until the cache fits its
+//              capacity. The newest brick always stays. The caller holds the
+//              mutex.
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void BrickCache::trimLocked()
+{
+    while (this->used_bytes > this->capacity_bytes
+           && this->bricks.size() > 1) {
+        const Entry& oldest = this->bricks.back();
+        this->used_bytes -= oldest.second->size();
+        this->lookup.erase(oldest.first);
+        this->bricks.pop_back();
+    }
+}
+
+
+// ============================================================================
+// BrickedVolume Constructor Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// BrickedVolume::BrickedVolume
+// ----------------------------------------------------------------------------
+//
+// Description: Constructor. Use fromSource or fromImage.
+//
+// Inputs:
+// - brick_size: Edge length of a brick in voxels
+// - cache_bytes: Capacity of the brick cache
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+BrickedVolume::BrickedVolume(int brick_size, std::size_t cache_bytes)
+    : whole_extent{0, -1, 0, -1, 0, -1},
+      volume_origin{0.0, 0.0, 0.0},
+      volume_spacing{1.0, 1.0, 1.0},
+      scalar_type(VTK_VOID),
+      scalar_components(0),
+      element_size(0),
+      brick_size(std::max(1, brick_size)),
+      brick_counts{0, 0, 0},
+      scalar_range{0.0, 0.0},
+      brick_cache(cache_bytes)
+{
+}
+
+
+// ============================================================================
+// BrickedVolume Public Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// BrickedVolume::fromSource
+// ----------------------------------------------------------------------------
+//
+// Description: Builds a bricked volume from an image algorithm (typically a
+//              vtkImageReader2). The source is updated one slab of bricks at
+//              a time, so readers that support sub-extents never hold more
+//              than one slab in memory.
+//
+// Inputs:
+// - source: Image algorithm producing the volume on output port 0
+// - brick_size: Edge length of a brick in voxels
+// - cache_bytes: Capacity of the brick cache
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: The volume, null on failure
+//
+// Side Effects: Updates the source and releases its output data
+//
+// ----------------------------------------------------------------------------
+std::shared_ptr<BrickedVolume> BrickedVolume::fromSource(
+    vtkAlgorithm* source,
+    int brick_size,
+    std::size_t cache_bytes,
+    std::string* error
+    )
+{
+    if (source == nullptr) {
+        return nullptr;
+    }
+
+    source->UpdateInformation();
+    int whole[6];
+    source->GetOutputInformation(0)->Get(
+        vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(),
+        whole
+        );
+    if (whole[1] < whole[0] || whole[3] < whole[2] || whole[5] < whole[4]) {
+        if (error != nullptr) {
+            *error = "The source produces an empty volume";
+        }
+        return nullptr;
+    }
+
+    std::shared_ptr<BrickedVolume> volume(
+        new BrickedVolume(brick_size, cache_bytes)
+        );
+    const int step = volume->brick_size;
+    for (int z = whole[4], brick_z = 0; z <= whole[5]; z += step, ++brick_z) {
+        int slab[6] = {
+            whole[0], whole[1], whole[2], whole[3],
+            z, std::min(z + step - 1, whole[5])
+        };
+        source->UpdateExtent(slab);
+
+        auto image = vtkImageData::SafeDownCast(
+            source->GetOutputDataObject(0)
+            );
+        if (image == nullptr
+            || image->GetPointData()->GetScalars() == nullptr
+            || (brick_z == 0 && !volume->setup(image, whole))) {
+            if (error != nullptr) {
+                *error = "The source does not produce scalar image data";
+            }
+            return nullptr;
+        }
+        const int* produced = image->GetExtent();
+        if (produced[4] > slab[4] || produced[5] < slab[5]
+            || produced[0] > whole[0] || produced[1] < whole[1]
+            || produced[2] > whole[2] || produced[3] < whole[3]) {
+            if (error != nullptr) {
+                *error = "The source did not produce the requested extent";
+            }
+            return nullptr;
+        }
+        volume->compressSlab(image, brick_z);
+    }
+    source->GetOutputDataObject(0)->ReleaseData();
+
+    return volume;
+}
+
+// ----------------------------------------------------------------------------
+// BrickedVolume::fromImage
+// ----------------------------------------------------------------------------
+//
+// Description: Builds a bricked volume from an image already in memory
+//
+// Inputs:
+// - image: The volume
+// - brick_size: Edge length of a brick in voxels
+// - cache_bytes: Capacity of the brick cache
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: The volume, null on failure
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+std::shared_ptr<BrickedVolume> BrickedVolume::fromImage(
+    vtkImageData* image,
+    int brick_size,
+    std::size_t cache_bytes,
+    std::string* error
+    )
+{
+    std::shared_ptr<BrickedVolume> volume(
+        new BrickedVolume(brick_size, cache_bytes)
+        );
+    if (image == nullptr
+        || image->GetPointData()->GetScalars() == nullptr
+        || !volume->setup(image, image->GetExtent())) {
+        if (error != nullptr) {
+            *error = "The image has no scalars";
+        }
+        return nullptr;
+    }
+
+    for (int brick_z = 0; brick_z < volume->brick_counts[2]; ++brick_z) {
+        volume->compressSlab(image, brick_z);
+    }
+
+    return volume;
+}
+
+// ----------------------------------------------------------------------------
+// BrickedVolume::extractRegion
+// ----------------------------------------------------------------------------
+//
+// Description: Fills an image with a region of the volume. Only the bricks
+//              that intersect the region are decoded (or taken from the
+//              cache), in parallel.
+//
+// Inputs:
+// - region: Extent to extract, clamped to the whole extent
+//
+// Outputs:
+// - output: Receives extent, geometry and scalars of the region
+//
+// Returns: false if the region is empty or a brick could not be decoded
+//
+// Side Effects: Updates the brick cache
+//
+// ----------------------------------------------------------------------------
+bool BrickedVolume::extractRegion(const int region[6], vtkImageData* output)
+{
+    int clamped[6];
+    for (int axis = 0; axis < 3; ++axis) {
+        clamped[2 * axis] = std::max(
+            region[2 * axis], this->whole_extent[2 * axis]
+            );
+        clamped[2 * axis + 1] = std::min(
+            region[2 * axis + 1], this->whole_extent[2 * axis + 1]
+            );
+        if (clamped[2 * axis] > clamped[2 * axis + 1]) {
+            return false;
+        }
+    }
+
+    output->SetExtent(clamped);
+    output->SetOrigin(this->volume_origin);
+    output->SetSpacing(this->volume_spacing);
+    output->AllocateScalars(this->scalar_type, this->scalar_components);
+    auto* target = static_cast<std::uint8_t*>(output->GetScalarPointer());
+
+    // Bricks touched by the region
+    int first[3];
+    int last[3];
+    for (int axis = 0; axis < 3; ++axis) {
+        first[axis] = (clamped[2 * axis] - this->whole_extent[2 * axis])
+            / this->brick_size;
+        last[axis] = (clamped[2 * axis + 1] - this->whole_extent[2 * axis])
+            / this->brick_size;
+    }
+    std::vector<std::size_t> touched;
+    for (int z = first[2]; z <= last[2]; ++z) {
+        for (int y = first[1]; y <= last[1]; ++y) {
+            for (int x = first[0]; x <= last[0]; ++x) {
+                touched.push_back(
+                    (std::size_t(z) * this->brick_counts[1] + y)
+                    * this->brick_counts[0] + x
+                    );
+            }
+        }
+    }
+
+    const std::size_t voxel = std::size_t(this->element_size)
+        * this->scalar_components;
+    const std::size_t out_nx = std::size_t(clamped[1] - clamped[0] + 1);
+    const std::size_t out_ny = std::size_t(clamped[3] - clamped[2] + 1);
+    std::atomic<bool> failed(false);
+
+    vtkSMPTools::For(0, static_cast<vtkIdType>(touched.size()),
+        [&](vtkIdType begin, vtkIdType end) {
+            for (vtkIdType t = begin; t < end; ++t) {
+                const std::size_t index = touched[t];
+                BrickCache::Brick decoded = this->decodedBrick(index);
+                if (!decoded) {
+                    failed = true;
+                    continue;
+                }
+
+                int brick[6];
+                this->brickExtent(index, brick);
+                const std::size_t brick_nx = std::size_t(brick[1] - brick[0])
+                    + 1;
+                const std::size_t brick_ny = std::size_t(brick[3] - brick[2])
+                    + 1;
+
+                const int x0 = std::max(brick[0], clamped[0]);
+                const int x1 = std::min(brick[1], clamped[1]);
+                const std::size_t row = std::size_t(x1 - x0 + 1) * voxel;
+                for (int z = std::max(brick[4], clamped[4]);
+                     z <= std::min(brick[5], clamped[5]);
+                     ++z) {
+                    for (int y = std::max(brick[2], clamped[2]);
+                         y <= std::min(brick[3], clamped[3]);
+                         ++y) {
+                        const std::size_t source =
+                            ((std::size_t(z - brick[4]) * brick_ny
+                              + std::size_t(y - brick[2])) * brick_nx
+                             + std::size_t(x0 - brick[0])) * voxel;
+                        const std::size_t destination =
+                            ((std::size_t(z - clamped[4]) * out_ny
+                              + std::size_t(y - clamped[2])) * out_nx
+                             + std::size_t(x0 - clamped[0])) * voxel;
+                        std::memcpy(
+                            target + destination,
+                            decoded->data() + source,
+                            row
+                            );
+                    }
+                }
+            }
+        });
+
+    return !failed;
+}
+
+// ----------------------------------------------------------------------------
+// BrickedVolume::readBrick
+// ----------------------------------------------------------------------------
+//
+// Description: Decodes one brick into a buffer of the caller. Passes over
+//              the whole volume use it so they do not flush the bricks of
+//              the slices being shown out of the cache.
+//
+// Inputs:
+// - index: Brick index, below brickCount()
+//
+// Outputs:
+// - voxels: The decoded voxels of the brick, x fastest
+// - extent: Extent of the brick
+//
+// Returns: false if the index is out of range or decoding failed
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool BrickedVolume::readBrick(
+    std::size_t index,
+    std::vector<std::uint8_t>& voxels,
+    int extent[6]
+    ) const
+{
+    if (index >= this->bricks.size()) {
+        return false;
+    }
+
+    this->brickExtent(index, extent);
+    const std::size_t count =
+        std::size_t(extent[1] - extent[0] + 1)
+        * std::size_t(extent[3] - extent[2] + 1)
+        * std::size_t(extent[5] - extent[4] + 1)
+        * this->scalar_components;
+    voxels.resize(count * this->element_size);
+
+    const StoredBrick& stored = this->bricks[index];
+    return decodeBrick(
+        stored.codec,
+        stored.payload.data(),
+        stored.payload.size(),
+        count,
+        this->element_size,
+        this->scalar_components,
+        voxels.data()
+        );
+}
+
+// ----------------------------------------------------------------------------
+// BrickedVolume::compressedBytes
+// ----------------------------------------------------------------------------
+//
+// Description: Returns the memory taken by the compressed bricks
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: Size in bytes
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+std::size_t BrickedVolume::compressedBytes() const
+{
+    std::size_t total = 0;
+    for (const auto& brick : this->bricks) {
+        total += brick.payload.size();
+    }
+    return total;
+}
+
+// ----------------------------------------------------------------------------
+// BrickedVolume::uncompressedBytes
+// ----------------------------------------------------------------------------
+//
+// Description: Returns the memory the volume would take as a vtkImageData
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: Size in bytes
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+std::size_t BrickedVolume::uncompressedBytes() const
+{
+    std::size_t voxels = 1;
+    for (int axis = 0; axis < 3; ++axis) {
+        voxels *= std::size_t(
+            this->whole_extent[2 * axis + 1] - this->whole_extent[2 * axis] + 1
+            );
+    }
+    return voxels * std::size_t(this->element_size) * this->scalar_components;
+}
+
+
+// ============================================================================
+// BrickedVolume Private Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// BrickedVolume::setup
+// ----------------------------------------------------------------------------
+//
+// Description: Takes scalar type and geometry from the first slab and sizes
+//              the brick table
+//
+// Inputs:
+// - image: First slab (or the whole image)
+// - whole: Whole extent of the volume
+//
+// Outputs: None
+//
+// Returns: false if the scalar type is not supported
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool BrickedVolume::setup(vtkImageData* image, const int whole[6])
+{
+    vtkDataArray* scalars = image->GetPointData()->GetScalars();
+    this->scalar_type = scalars->GetDataType();
+    this->scalar_components = scalars->GetNumberOfComponents();
+    this->element_size = scalars->GetDataTypeSize();
+    if (this->element_size != 1 && this->element_size != 2
+        && this->element_size != 4 && this->element_size != 8) {
+        return false;
+    }
+
+    std::copy(whole, whole + 6, this->whole_extent);
+    image->GetOrigin(this->volume_origin);
+    image->GetSpacing(this->volume_spacing);
+    for (int axis = 0; axis < 3; ++axis) {
+        const int voxels = whole[2 * axis + 1] - whole[2 * axis] + 1;
+        this->brick_counts[axis] =
+            (voxels + this->brick_size - 1) / this->brick_size;
+    }
+    this->bricks.assign(
+        std::size_t(this->brick_counts[0]) * this->brick_counts[1]
+        * this->brick_counts[2],
+        StoredBrick()
+        );
+    this->scalar_range[0] = std::numeric_limits<double>::max();
+    this->scalar_range[1] = std::numeric_limits<double>::lowest();
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// BrickedVolume::compressSlab
+// ----------------------------------------------------------------------------
+//
+// Description: Compresses the bricks of one slab in parallel
+//
+// Inputs:
+// - slab: Image containing at least the voxels of the slab
+// - brick_z: Brick index of the slab along z
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Widens the scalar range
+//
+// ----------------------------------------------------------------------------
+void BrickedVolume::compressSlab(vtkImageData* slab, int brick_z)
+{
+    const int* extent = slab->GetExtent();
+    const std::size_t voxel = std::size_t(this->element_size)
+        * this->scalar_components;
+    const std::size_t slab_nx = std::size_t(extent[1] - extent[0] + 1);
+    const std::size_t slab_ny = std::size_t(extent[3] - extent[2] + 1);
+    const auto* source = static_cast<const std::uint8_t*>(
+        slab->GetScalarPointer()
+        );
+    const std::size_t bricks_per_slab =
+        std::size_t(this->brick_counts[0]) * this->brick_counts[1];
+    const std::size_t offset = std::size_t(brick_z) * bricks_per_slab;
+
+    vtkSMPTools::For(0, static_cast<vtkIdType>(bricks_per_slab),
+        [&](vtkIdType begin, vtkIdType end) {
+            std::vector<std::uint8_t> gathered;
+            for (vtkIdType b = begin; b < end; ++b) {
+                int brick[6];
+                this->brickExtent(offset + b, brick);
+                const std::size_t nx = std::size_t(brick[1] - brick[0] + 1);
+                const std::size_t ny = std::size_t(brick[3] - brick[2] + 1);
+                const std::size_t nz = std::size_t(brick[5] - brick[4] + 1);
+
+                gathered.resize(nx * ny * nz * voxel);
+                std::uint8_t* out = gathered.data();
+                for (int z = brick[4]; z <= brick[5]; ++z) {
+                    for (int y = brick[2]; y <= brick[3]; ++y) {
+                        const std::size_t start =
+                            ((std::size_t(z - extent[4]) * slab_ny
+                              + std::size_t(y - extent[2])) * slab_nx
+                             + std::size_t(brick[0] - extent[0])) * voxel;
+                        std::memcpy(out, source + start, nx * voxel);
+                        out += nx * voxel;
+                    }
+                }
+
+                StoredBrick& stored = this->bricks[offset + b];
+                stored.codec = encodeBrick(
+                    gathered.data(),
+                    nx * ny * nz * this->scalar_components,
+                    this->element_size,
+                    this->scalar_components,
+                    stored.payload
+                    );
+            }
+        });
+
+    double range[2];
+    slab->GetPointData()->GetScalars()->GetRange(range, 0);
+    this->scalar_range[0] = std::min(this->scalar_range[0], range[0]);
+    this->scalar_range[1] = std::max(this->scalar_range[1], range[1]);
+}
+
+// ----------------------------------------------------------------------------
+// BrickedVolume::brickExtent
+// ----------------------------------------------------------------------------
+//
+// Description: Returns the voxel extent covered by a brick. Bricks on the
+//              high faces of the volume can be smaller than brick_size.
+//
+// Inputs:
+// - index: Brick index
+//
+// Outputs:
+// - extent: Extent of the brick
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void BrickedVolume::brickExtent(std::size_t index, int extent[6]) const
+{
+    const int position[3] = {
+        static_cast<int>(index % this->brick_counts[0]),
+        static_cast<int>((index / this->brick_counts[0])
+                         % this->brick_counts[1]),
+        static_cast<int>(index / (std::size_t(this->brick_counts[0])
+                                  * this->brick_counts[1]))
+    };
+    for (int axis = 0; axis < 3; ++axis) {
+        extent[2 * axis] = this->whole_extent[2 * axis]
+            + position[axis] * this->brick_size;
+        extent[2 * axis + 1] = std::min(
+            extent[2 * axis] + this->brick_size - 1,
+            this->whole_extent[2 * axis + 1]
+            );
+    }
+}
+
+// ----------------------------------------------------------------------------
+// BrickedVolume::decodedBrick
+// ----------------------------------------------------------------------------
+//
+// Description: Returns a decoded brick, from the cache if possible
+//
+// Inputs:
+// - index: Brick index
+//
+// Outputs: None
+//
+// Returns: The decoded voxels of the brick, null if decoding failed
+//
+// Side Effects: Inserts the brick into the cache
+//
+// ----------------------------------------------------------------------------
+BrickCache::Brick BrickedVolume::decodedBrick(std::size_t index)
+{
+    BrickCache::Brick cached = this->brick_cache.find(index);
+    if (cached) {
+        return cached;
+    }
+
+    int extent[6];
+    this->brickExtent(index, extent);
+    const std::size_t count =
+        std::size_t(extent[1] - extent[0] + 1)
+        * std::size_t(extent[3] - extent[2] + 1)
+        * std::size_t(extent[5] - extent[4] + 1)
+        * this->scalar_components;
+
+    auto decoded = std::make_shared<std::vector<std::uint8_t>>(
+        count * this->element_size
+        );
+    const StoredBrick& stored = this->bricks[index];
+    if (!decodeBrick(
+            stored.codec,
+            stored.payload.data(),
+            stored.payload.size(),
+            count,
+            this->element_size,
+            this->scalar_components,
+            decoded->data()
+            )) {
+        return nullptr;
+    }
+
+    BrickCache::Brick brick = std::move(decoded);
+    this->brick_cache.insert(index, brick);
+
+    return brick;
+}
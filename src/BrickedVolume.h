@@ -0,0 +1,217 @@
+// ============================================================================
+// BrickedVolume.h - Volumes kept as compressed bricks in memory
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * BrickedVolume.h: created.
+// * BrickedVolume.h: added readBrick, decoding without the cache.
+//
+// ============================================================================
+
+
+#ifndef BrickedVolume_H
+#define BrickedVolume_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// "C" system headers
+
+// Standard Library headers
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// External libraries headers
+#include <vtkAlgorithm.h>
+#include <vtkImageData.h>
+
+// Project headers
+#include "BrickCodec.h"
+
+
+// ============================================================================
+// Class Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// BrickCache
+// ----------------------------------------------------------------------------
+//
+// Description: Bounded least recently used cache of decoded bricks. Bricks
+//              are handed out as shared pointers, so a brick evicted while
+//              a reader still copies from it stays valid until released.
+//              Thread safe; decoding happens outside the lock.
+//
+// Properties:
+// - capacity: Maximum size of the cached bricks in bytes
+// - bricks: Cached bricks, most recently used first
+//
+// Methods:
+// - find: Returns a cached brick and marks it as used
+// - insert: Adds a brick, evicting old ones beyond the capacity
+// - clear: Drops all bricks
+// - setCapacity: Changes the capacity
+// - size: Returns the size of the cached bricks in bytes
+//
+// ----------------------------------------------------------------------------
+class BrickCache
+{
+public:
+    using Brick = std::shared_ptr<const std::vector<std::uint8_t>>;
+
+    explicit BrickCache(std::size_t capacity);
+
+    Brick find(std::size_t index);
+    void insert(std::size_t index, Brick brick);
+    void clear();
+    void setCapacity(std::size_t capacity);
+    std::size_t size() const;
+    std::size_t capacity() const;
+
+private:
+    void trimLocked();
+
+    using Entry = std::pair<std::size_t, Brick>;
+
+    mutable std::mutex mutex;
+    std::list<Entry> bricks;
+    std::unordered_map<std::size_t, std::list<Entry>::iterator> lookup;
+    std::size_t capacity_bytes;
+    std::size_t used_bytes;
+};
+
+// ----------------------------------------------------------------------------
+// BrickedVolume
+// ----------------------------------------------------------------------------
+//
+// Description: A volume split into cubic bricks (32 voxels a side by
+//              default), each compressed on its own with BrickCodec.
+//              Building streams the source in slabs one brick thick, so a
+//              volume larger than memory can be converted as long as one
+//              slab fits, and bricks of a slab are compressed in parallel.
+//              Regions are extracted by decoding only the bricks they touch,
+//              through a bounded BrickCache.
+//
+// Properties:
+// - extent: Whole extent of the volume
+// - origin, spacing: Geometry of the volume
+// - scalar_type: VTK scalar type
+// - components: Scalar components per voxel
+// - brick_size: Edge length of a brick in voxels
+// - bricks: Codec and payload of every brick, x fastest
+// - cache: Decoded bricks
+//
+// Methods:
+// - fromSource: Builds a volume from an image algorithm, slab by slab
+// - fromImage: Builds a volume from an image in memory
+// - extractRegion: Fills an image with a sub-extent of the volume
+// - readBrick: Decodes one brick without going through the cache
+// - compressedBytes: Returns the size of the compressed bricks
+// - uncompressedBytes: Returns the size of the volume when decoded
+// - scalarRange: Returns the range of the first component
+// - cache: Returns the brick cache
+//
+// Example usage:
+//   auto volume = BrickedVolume::fromSource(reader, 32, 256 << 20, &error);
+//   auto slice = vtkSmartPointer<vtkImageData>::New();
+//   int extent[6] = {0, 511, 0, 511, 100, 100};
+//   volume->extractRegion(extent, slice);
+//
+// ----------------------------------------------------------------------------
+class BrickedVolume
+{
+public:
+    static constexpr int kDefaultBrickSize = 32;
+    static constexpr std::size_t kDefaultCacheBytes = 256u << 20;
+
+    static std::shared_ptr<BrickedVolume> fromSource(
+        vtkAlgorithm* source,
+        int brick_size = kDefaultBrickSize,
+        std::size_t cache_bytes = kDefaultCacheBytes,
+        std::string* error = nullptr
+        );
+    static std::shared_ptr<BrickedVolume> fromImage(
+        vtkImageData* image,
+        int brick_size = kDefaultBrickSize,
+        std::size_t cache_bytes = kDefaultCacheBytes,
+        std::string* error = nullptr
+        );
+
+    BrickedVolume(const BrickedVolume&) = delete;
+    BrickedVolume& operator=(const BrickedVolume&) = delete;
+
+    bool extractRegion(const int region[6], vtkImageData* output);
+    bool readBrick(
+        std::size_t index,
+        std::vector<std::uint8_t>& voxels,
+        int extent[6]
+        ) const;  // Thread safe, for whole-volume passes
+
+    const int* extent() const { return this->whole_extent; }
+    const double* origin() const { return this->volume_origin; }
+    const double* spacing() const { return this->volume_spacing; }
+    int scalarType() const { return this->scalar_type; }
+    int components() const { return this->scalar_components; }
+    int brickSize() const { return this->brick_size; }
+    std::size_t brickCount() const { return this->bricks.size(); }
+    std::size_t compressedBytes() const;
+    std::size_t uncompressedBytes() const;
+    const double* scalarRange() const { return this->scalar_range; }
+    BrickCache& cache() { return this->brick_cache; }
+
+private:
+    struct StoredBrick {
+        BrickCodec codec = BrickCodec::Raw;
+        std::vector<std::uint8_t> payload;
+    };
+
+    BrickedVolume(int brick_size, std::size_t cache_bytes);
+
+    bool setup(vtkImageData* image, const int whole_extent[6]);
+    void compressSlab(vtkImageData* slab, int brick_z);
+    void brickExtent(std::size_t index, int extent[6]) const;
+    BrickCache::Brick decodedBrick(std::size_t index);
+
+    int whole_extent[6];
+    double volume_origin[3];
+    double volume_spacing[3];
+    int scalar_type;
+    int scalar_components;
+    int element_size;
+    int brick_size;
+    int brick_counts[3];
+    double scalar_range[2];
+
+    std::vector<StoredBrick> bricks;
+    BrickCache brick_cache;
+};
+
+#endif  // BrickedVolume_H
@@ -0,0 +1,554 @@
+// ============================================================================
+// BvhCuller.cxx - Implementation of the BvhCuller class
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * BvhCuller.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header -------------------------------------------------------------
+#include "BvhCuller.h"
+
+// "C" system headers ---------------------------------------------------------
+
+// Standard Library headers ---------------------------------------------------
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+// External libraries headers -------------------------------------------------
+
+// VTK headers
+#include <vtkCamera.h>
+#include <vtkMath.h>
+#include <vtkObjectFactory.h>
+#include <vtkRenderer.h>
+
+
+vtkStandardNewMacro(BvhCuller);
+
+
+// ============================================================================
+// Local helpers section
+// ============================================================================
+
+namespace {
+
+// Props projecting to fewer pixels than this are culled by default
+const double kDefaultMinimumPixels = 2.0;
+
+double boxCenter(const double bounds[6], int axis)
+{
+    return 0.5 * (bounds[2 * axis] + bounds[2 * axis + 1]);
+}
+
+double boxDiagonal(const double bounds[6])
+{
+    const double dx = bounds[1] - bounds[0];
+    const double dy = bounds[3] - bounds[2];
+    const double dz = bounds[5] - bounds[4];
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
+}
+
+// Distance from a point to the nearest point of a box, 0 inside it
+double boxDistance(const double bounds[6], const double point[3])
+{
+    double squared = 0.0;
+    for (int axis = 0; axis < 3; ++axis) {
+        const double below = bounds[2 * axis] - point[axis];
+        const double above = point[axis] - bounds[2 * axis + 1];
+        const double gap = std::max(0.0, std::max(below, above));
+        squared += gap * gap;
+    }
+    return std::sqrt(squared);
+}
+
+}  // namespace
+
+
+// ============================================================================
+// Constructor/Destructor Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// BvhCuller::BvhCuller
+// ----------------------------------------------------------------------------
+//
+// Description: Constructor
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+BvhCuller::BvhCuller()
+    : dirty(false),
+      minimum_pixels(kDefaultMinimumPixels),
+      frame(0)
+{
+}
+
+
+// ============================================================================
+// Public Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// BvhCuller::AddProp
+// ----------------------------------------------------------------------------
+//
+// Description: Registers a prop for hierarchical culling. The prop must
+//              still be added to the renderer.
+//
+// Inputs:
+// - prop: The prop
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: The hierarchy is rebuilt on the next frame
+//
+// ----------------------------------------------------------------------------
+void BvhCuller::AddProp(vtkProp3D* prop)
+{
+    if (prop == nullptr || this->prop_index.count(prop) != 0) {
+        return;
+    }
+
+    this->prop_index[prop] = this->props.size();
+    this->props.emplace_back(prop);
+    this->dirty = true;
+}
+
+// ----------------------------------------------------------------------------
+// BvhCuller::RemoveProp
+// ----------------------------------------------------------------------------
+//
+// Description: Stops culling a prop hierarchically
+//
+// Inputs:
+// - prop: The prop
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: The hierarchy is rebuilt on the next frame
+//
+// ----------------------------------------------------------------------------
+void BvhCuller::RemoveProp(vtkProp3D* prop)
+{
+    auto found = this->prop_index.find(prop);
+    if (found == this->prop_index.end()) {
+        return;
+    }
+
+    // Cleared entries are dropped by the next rebuild
+    this->props[found->second] = nullptr;
+    this->prop_index.erase(found);
+    this->dirty = true;
+}
+
+// ----------------------------------------------------------------------------
+// BvhCuller::RemoveAllProps
+// ----------------------------------------------------------------------------
+//
+// Description: Forgets all registered props
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void BvhCuller::RemoveAllProps()
+{
+    this->props.clear();
+    this->prop_index.clear();
+    this->dirty = true;
+}
+
+// ----------------------------------------------------------------------------
+// BvhCuller::BoundsModified
+// ----------------------------------------------------------------------------
+//
+// Description: Marks the cached bounds stale, e.g. after parts moved
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: The hierarchy is rebuilt on the next frame
+//
+// ----------------------------------------------------------------------------
+void BvhCuller::BoundsModified()
+{
+    this->dirty = true;
+}
+
+// ----------------------------------------------------------------------------
+// BvhCuller::SetMinimumPixelSize
+// ----------------------------------------------------------------------------
+//
+// Description: Sets the screen-size threshold. Props whose bounding box
+//              projects to fewer pixels are not drawn.
+//
+// Inputs:
+// - pixels: Minimum projected size in pixels, 0 disables size culling
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void BvhCuller::SetMinimumPixelSize(double pixels)
+{
+    this->minimum_pixels = std::max(0.0, pixels);
+    this->Modified();
+}
+
+// ----------------------------------------------------------------------------
+// BvhCuller::DescribeLastStats
+// ----------------------------------------------------------------------------
+//
+// Description: Returns the counts of the last pass for status lines
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: E.g. "1520 drawn, 30112 outside view, 8368 too small"
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+std::string BvhCuller::DescribeLastStats() const
+{
+    char text[96];
+    std::snprintf(
+        text,
+        sizeof(text),
+        "%zu drawn, %zu outside view, %zu too small",
+        this->stats.drawn,
+        this->stats.frustum_culled,
+        this->stats.size_culled
+        );
+    return text;
+}
+
+// ----------------------------------------------------------------------------
+// BvhCuller::Cull
+// ----------------------------------------------------------------------------
+//
+// Description: Removes the registered props that are outside the frustum or
+//              too small on screen from the renderer's prop list
+//
+// Inputs:
+// - renderer: The renderer being rendered
+// - prop_list: Props the renderer is about to draw
+// - list_length: Number of props in the list
+// - initialized: Whether an earlier culler set render time multipliers
+//
+// Outputs:
+// - prop_list, list_length: The props to draw
+//
+// Returns: Total render time multiplier of the props to draw
+//
+// Side Effects: Rebuilds the hierarchy if props or bounds changed
+//
+// ----------------------------------------------------------------------------
+double BvhCuller::Cull(
+    vtkRenderer* renderer,
+    vtkProp** prop_list,
+    int& list_length,
+    int& initialized
+    )
+{
+    ++this->frame;
+    if (this->dirty) {
+        this->rebuild();
+    }
+
+    this->stats = CullStats();
+    this->stats.managed = this->order.size() + this->unbounded.size();
+
+    vtkCamera* camera = renderer->GetActiveCamera();
+    if (!this->nodes.empty() && camera != nullptr) {
+        View view;
+        camera->GetFrustumPlanes(renderer->GetTiledAspectRatio(), view.planes);
+        camera->GetPosition(view.position);
+        const double height = std::max(1, renderer->GetSize()[1]);
+        if (camera->GetParallelProjection()) {
+            view.pixels_per_unit =
+                height / (2.0 * std::max(camera->GetParallelScale(), 1e-12));
+        } else {
+            view.pixels_per_radian =
+                height / vtkMath::RadiansFromDegrees(camera->GetViewAngle());
+        }
+        this->visit(0, view, false);
+    } else {
+        for (int index : this->order) {
+            this->visible_frame[index] = this->frame;
+        }
+    }
+    for (int index : this->unbounded) {
+        this->visible_frame[index] = this->frame;
+    }
+
+    int kept = 0;
+    double total = 0.0;
+    for (int i = 0; i < list_length; ++i) {
+        vtkProp* prop = prop_list[i];
+        auto found = this->prop_index.find(prop);
+        if (found != this->prop_index.end()
+            && this->visible_frame[found->second] != this->frame) {
+            continue;
+        }
+        prop_list[kept++] = prop;
+        total += initialized ? prop->GetRenderTimeMultiplier() : 1.0;
+    }
+    list_length = kept;
+    this->stats.drawn = static_cast<std::size_t>(kept);
+
+    return total;
+}
+
+
+// ============================================================================
+// Private Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// BvhCuller::rebuild
+// ----------------------------------------------------------------------------
+//
+// Description: Drops deleted props, re-reads all bounds and rebuilds the
+//              hierarchy
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void BvhCuller::rebuild()
+{
+    std::vector<vtkWeakPointer<vtkProp3D>> alive;
+    alive.reserve(this->props.size());
+    this->prop_index.clear();
+    for (const auto& prop : this->props) {
+        if (prop != nullptr) {
+            this->prop_index[prop.GetPointer()] = alive.size();
+            alive.push_back(prop);
+        }
+    }
+    this->props.swap(alive);
+
+    const std::size_t count = this->props.size();
+    this->prop_bounds.assign(6 * count, 0.0);
+    this->visible_frame.assign(count, 0);
+    this->order.clear();
+    this->unbounded.clear();
+    for (std::size_t i = 0; i < count; ++i) {
+        const double* bounds = this->props[i]->GetBounds();
+        if (bounds == nullptr || bounds[0] > bounds[1]) {
+            this->unbounded.push_back(static_cast<int>(i));
+            continue;
+        }
+        std::copy(bounds, bounds + 6, &this->prop_bounds[6 * i]);
+        this->order.push_back(static_cast<int>(i));
+    }
+
+    this->nodes.clear();
+    this->nodes.reserve(2 * this->order.size());
+    if (!this->order.empty()) {
+        this->build(0, static_cast<int>(this->order.size()));
+    }
+    this->dirty = false;
+}
+
+// ----------------------------------------------------------------------------
+// BvhCuller::build
+// ----------------------------------------------------------------------------
+//
+// Description: Builds the subtree of a range of props by splitting at the
+//              median centroid along the longest axis. Leaves hold one prop.
+//
+// Inputs:
+// - first: First index into order
+// - count: Number of props
+//
+// Outputs: None
+//
+// Returns: Index of the subtree root
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+int BvhCuller::build(int first, int count)
+{
+    const int index = static_cast<int>(this->nodes.size());
+    this->nodes.emplace_back();
+
+    Node node;
+    node.first = first;
+    node.count = count;
+    double centroids[6] = {
+        VTK_DOUBLE_MAX, VTK_DOUBLE_MIN, VTK_DOUBLE_MAX,
+        VTK_DOUBLE_MIN, VTK_DOUBLE_MAX, VTK_DOUBLE_MIN
+    };
+    node.bounds[0] = node.bounds[2] = node.bounds[4] = VTK_DOUBLE_MAX;
+    node.bounds[1] = node.bounds[3] = node.bounds[5] = VTK_DOUBLE_MIN;
+    for (int i = first; i < first + count; ++i) {
+        const double* bounds = &this->prop_bounds[6 * this->order[i]];
+        for (int axis = 0; axis < 3; ++axis) {
+            node.bounds[2 * axis] =
+                std::min(node.bounds[2 * axis], bounds[2 * axis]);
+            node.bounds[2 * axis + 1] =
+                std::max(node.bounds[2 * axis + 1], bounds[2 * axis + 1]);
+            const double center = boxCenter(bounds, axis);
+            centroids[2 * axis] = std::min(centroids[2 * axis], center);
+            centroids[2 * axis + 1] =
+                std::max(centroids[2 * axis + 1], center);
+        }
+    }
+
+    if (count > 1) {
+        int axis = 0;
+        for (int a = 1; a < 3; ++a) {
+            if (centroids[2 * a + 1] - centroids[2 * a]
+                > centroids[2 * axis + 1] - centroids[2 * axis]) {
+                axis = a;
+            }
+        }
+        const int half = count / 2;
+        const std::vector<double>& bounds = this->prop_bounds;
+        std::nth_element(
+            this->order.begin() + first,
+            this->order.begin() + first + half,
+            this->order.begin() + first + count,
+            [&bounds, axis](int a, int b) {
+                return boxCenter(&bounds[6 * a], axis)
+                    < boxCenter(&bounds[6 * b], axis);
+            }
+            );
+        node.left = this->build(first, half);
+        node.right = this->build(first + half, count - half);
+    }
+
+    this->nodes[index] = node;
+    return index;
+}
+
+// ----------------------------------------------------------------------------
+// BvhCuller::visit
+// ----------------------------------------------------------------------------
+//
+// Description: Culls a subtree. Subtrees completely inside the frustum skip
+//              the plane tests; the size test uses the distance to the
+//              nearest point of the box, so a subtree too small on screen
+//              has no child large enough to be drawn.
+//
+// Inputs:
+// - index: Subtree root
+// - view: Frustum and projection of the camera
+// - inside: The parent is completely inside the frustum
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Marks the accepted props and updates the statistics
+//
+// ----------------------------------------------------------------------------
+void BvhCuller::visit(int index, const View& view, bool inside)
+{
+    const Node& node = this->nodes[index];
+    ++this->stats.nodes_visited;
+
+    if (!inside) {
+        inside = true;
+        for (int p = 0; p < 6; ++p) {
+            const double* plane = &view.planes[4 * p];
+            double nearest = plane[3];
+            double farthest = plane[3];
+            for (int axis = 0; axis < 3; ++axis) {
+                const double low = plane[axis] * node.bounds[2 * axis];
+                const double high = plane[axis] * node.bounds[2 * axis + 1];
+                nearest += std::min(low, high);
+                farthest += std::max(low, high);
+            }
+            if (farthest < 0.0) {
+                this->stats.frustum_culled += node.count;
+                return;
+            }
+            if (nearest < 0.0) {
+                inside = false;
+            }
+        }
+    }
+
+    if (this->minimum_pixels > 0.0) {
+        const double diagonal = boxDiagonal(node.bounds);
+        double pixels = diagonal * view.pixels_per_unit;
+        if (view.pixels_per_unit == 0.0) {
+            const double distance = boxDistance(node.bounds, view.position);
+            pixels = distance > 0.0
+                ? diagonal / distance * view.pixels_per_radian
+                : this->minimum_pixels;
+        }
+        if (pixels < this->minimum_pixels) {
+            this->stats.size_culled += node.count;
+            return;
+        }
+    }
+
+    if (node.left < 0) {
+        this->visible_frame[this->order[node.first]] = this->frame;
+        return;
+    }
+    this->visit(node.left, view, inside);
+    this->visit(node.right, view, inside);
+}
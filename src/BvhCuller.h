@@ -0,0 +1,181 @@
+// ============================================================================
+// BvhCuller.h - Hierarchical frustum and screen-size culling of props
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * BvhCuller.h: created.
+//
+// ============================================================================
+
+
+#ifndef BvhCuller_H
+#define BvhCuller_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Standard Library headers
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// External libraries headers
+#include <vtkCuller.h>
+#include <vtkProp3D.h>
+#include <vtkWeakPointer.h>
+
+
+// ============================================================================
+// Structure Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// CullStats
+// ----------------------------------------------------------------------------
+//
+// Description: Outcome of the last culling pass
+//
+// Properties:
+// - managed: Props held in the hierarchy
+// - frustum_culled: Managed props outside the view frustum
+// - size_culled: Managed props smaller than the minimum pixel size
+// - drawn: Props handed to the renderer, managed or not
+// - nodes_visited: Hierarchy nodes tested
+//
+// ----------------------------------------------------------------------------
+struct CullStats {
+    std::size_t managed = 0;
+    std::size_t frustum_culled = 0;
+    std::size_t size_culled = 0;
+    std::size_t drawn = 0;
+    std::size_t nodes_visited = 0;
+};
+
+
+// ============================================================================
+// Class Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// BvhCuller
+// ----------------------------------------------------------------------------
+//
+// Description: A vtkCuller that keeps the props registered with it in a
+//              bounding volume hierarchy and, each frame, walks the
+//              hierarchy against the camera frustum and a minimum projected
+//              size. Whole subtrees outside the frustum or too small on
+//              screen are rejected with one test, and bounds are cached, so
+//              the cost grows with the visible part of the scene instead of
+//              with every prop's GetBounds like vtkFrustumCoverageCuller.
+//              Props not registered are passed through untouched. Props
+//              that move must be followed by BoundsModified().
+//
+// Properties:
+// - props: Registered props, held weakly
+// - nodes: The hierarchy, rebuilt lazily when props or bounds change
+// - minimum_pixels: Props projecting to fewer pixels are culled
+//
+// Methods:
+// - AddProp / RemoveProp / RemoveAllProps: Manage the registered props
+// - BoundsModified: Marks cached bounds stale
+// - SetMinimumPixelSize: Sets the screen-size threshold, 0 disables it
+// - GetLastStats: Returns the counts of the last pass
+// - Cull: vtkCuller interface, called by the renderer every frame
+//
+// Example usage:
+//   auto culler = vtkSmartPointer<BvhCuller>::New();
+//   renderer->GetCullers()->RemoveAllItems();
+//   renderer->AddCuller(culler);
+//   for (auto& part : parts) {
+//       renderer->AddActor(part);
+//       culler->AddProp(part);
+//   }
+//
+// ----------------------------------------------------------------------------
+class BvhCuller : public vtkCuller
+{
+public:
+    static BvhCuller* New();
+    vtkTypeMacro(BvhCuller, vtkCuller);
+
+    void AddProp(vtkProp3D* prop);
+    void RemoveProp(vtkProp3D* prop);
+    void RemoveAllProps();
+    void BoundsModified();
+
+    void SetMinimumPixelSize(double pixels);
+    double GetMinimumPixelSize() const { return this->minimum_pixels; }
+    const CullStats& GetLastStats() const { return this->stats; }
+    std::string DescribeLastStats() const;
+
+    double Cull(
+        vtkRenderer* renderer,
+        vtkProp** prop_list,
+        int& list_length,
+        int& initialized
+        ) override;
+
+protected:
+    BvhCuller();
+    ~BvhCuller() override = default;
+
+private:
+    BvhCuller(const BvhCuller&) = delete;
+    void operator=(const BvhCuller&) = delete;
+
+    struct Node {
+        double bounds[6];
+        int first = 0;  // Index into order
+        int count = 0;  // Props below the node
+        int left = -1;  // Children, -1 for leaves
+        int right = -1;
+    };
+
+    struct View {
+        double planes[24];  // Inward facing frustum planes
+        double position[3];
+        double pixels_per_radian = 0.0;  // Perspective projection
+        double pixels_per_unit = 0.0;  // Parallel projection
+    };
+
+    void rebuild();
+    int build(int first, int count);
+    void visit(int node, const View& view, bool inside);
+
+    std::vector<vtkWeakPointer<vtkProp3D>> props;
+    std::vector<double> prop_bounds;  // 6 per prop
+    std::unordered_map<vtkProp*, std::size_t> prop_index;
+    std::vector<std::uint64_t> visible_frame;  // Frame a prop was accepted
+    std::vector<int> order;  // Prop indices, grouped by leaf
+    std::vector<int> unbounded;  // Props without valid bounds
+    std::vector<Node> nodes;
+    bool dirty;
+    double minimum_pixels;
+    std::uint64_t frame;
+    CullStats stats;
+};
+
+#endif  // BvhCuller_H
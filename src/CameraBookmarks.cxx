@@ -0,0 +1,987 @@
+// ============================================================================
+// CameraBookmarks.cxx - Camera bookmarks, session files and transitions
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * CameraBookmarks.cxx: created.
+// * CameraBookmarks.cxx: motion proxies are built on a worker thread.
+// * CameraBookmarks.cxx: session files are read with the statement helpers
+//   of ScriptSyntax.cxx.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header -------------------------------------------------------------
+#include "CameraBookmarks.h"
+#include "ScriptSyntax.h"
+
+// Standard Library headers ---------------------------------------------------
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <future>
+#include <iomanip>
+#include <sstream>
+
+// External libraries headers -------------------------------------------------
+
+// VTK headers
+#include <vtkCellArray.h>
+#include <vtkMath.h>
+#include <vtkMatrix4x4.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+#include <vtkPolyDataMapper.h>
+#include <vtkQuadricClustering.h>
+
+
+// ============================================================================
+// Local helpers section
+// ============================================================================
+
+namespace {
+
+double lerp(double a, double b, double t)
+{
+    return a + (b - a) * t;
+}
+
+// Interpolates positive values geometrically, so zooming in and out look
+// alike; falls back to a straight line otherwise
+double lerpScale(double a, double b, double t)
+{
+    if (a > 0.0 && b > 0.0) {
+        return a * std::pow(b / a, t);
+    }
+    return lerp(a, b, t);
+}
+
+// Turns unit vector a towards unit vector b on a great circle. Opposite
+// vectors turn about an axis perpendicular to a, taken from hint.
+void slerp(
+    const double a[3],
+    const double b[3],
+    double t,
+    const double hint[3],
+    double result[3]
+    )
+{
+    const double cosine = std::max(-1.0, std::min(1.0, vtkMath::Dot(a, b)));
+    if (cosine > 0.9999) {
+        for (int i = 0; i < 3; ++i) {
+            result[i] = lerp(a[i], b[i], t);
+        }
+        vtkMath::Normalize(result);
+        return;
+    }
+
+    if (cosine < -0.9999) {
+        double axis[3] = {hint[0], hint[1], hint[2]};
+        const double along = vtkMath::Dot(axis, a);
+        for (int i = 0; i < 3; ++i) {
+            axis[i] -= along * a[i];
+        }
+        if (vtkMath::Normalize(axis) < 1e-6) {
+            const double other[3] = {
+                std::fabs(a[0]) < 0.9 ? 1.0 : 0.0,
+                std::fabs(a[0]) < 0.9 ? 0.0 : 1.0,
+                0.0
+            };
+            vtkMath::Cross(a, other, axis);
+            vtkMath::Normalize(axis);
+        }
+        const double angle = vtkMath::Pi() * t;
+        for (int i = 0; i < 3; ++i) {
+            result[i] = std::cos(angle) * a[i] + std::sin(angle) * axis[i];
+        }
+        return;
+    }
+
+    const double angle = std::acos(cosine);
+    const double wa = std::sin((1.0 - t) * angle) / std::sin(angle);
+    const double wb = std::sin(t * angle) / std::sin(angle);
+    for (int i = 0; i < 3; ++i) {
+        result[i] = wa * a[i] + wb * b[i];
+    }
+    vtkMath::Normalize(result);
+}
+
+// Parses size comma separated numbers into values
+bool parseValues(const std::string& text, std::size_t size, double* values)
+{
+    std::vector<double> numbers;
+    if (!parseNumbers(text, size, &numbers)) {
+        return false;
+    }
+    std::copy(numbers.begin(), numbers.end(), values);
+    return true;
+}
+
+// Writes size numbers comma separated, precise enough to read back the
+// same doubles
+std::string formatNumbers(const double* values, std::size_t size)
+{
+    std::ostringstream text;
+    text << std::setprecision(17);
+    for (std::size_t i = 0; i < size; ++i) {
+        text << (i > 0 ? "," : "") << values[i];
+    }
+    return text.str();
+}
+
+// Copies the geometry of mesh for a worker thread. The points are copied and
+// the cell arrays shared: the mesh may get new arrays meanwhile, but arrays
+// are not edited in place.
+vtkSmartPointer<vtkPolyData> isolateMesh(vtkPolyData* mesh)
+{
+    auto copy = vtkSmartPointer<vtkPolyData>::New();
+    auto points = vtkSmartPointer<vtkPoints>::New();
+    points->DeepCopy(mesh->GetPoints());
+    copy->SetPoints(points);
+    copy->SetVerts(mesh->GetVerts());
+    copy->SetLines(mesh->GetLines());
+    copy->SetPolys(mesh->GetPolys());
+    copy->SetStrips(mesh->GetStrips());
+    return copy;
+}
+
+// Decimates mesh with quadric clustering on a grid of divisions cells a side
+vtkSmartPointer<vtkPolyData> decimateMesh(
+    vtkSmartPointer<vtkPolyData> mesh,
+    int divisions
+    )
+{
+    auto clustering = vtkSmartPointer<vtkQuadricClustering>::New();
+    clustering->SetInputData(mesh);
+    clustering->SetNumberOfDivisions(divisions, divisions, divisions);
+    clustering->Update();
+    return clustering->GetOutput();
+}
+
+}  // namespace
+
+
+// ============================================================================
+// Function Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// captureCamera
+// ----------------------------------------------------------------------------
+//
+// Description: Returns the state of a camera
+//
+// Inputs:
+// - camera: The camera
+//
+// Outputs: None
+//
+// Returns: The state
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+CameraState captureCamera(vtkCamera* camera)
+{
+    CameraState state;
+    camera->GetPosition(state.position);
+    camera->GetFocalPoint(state.focal_point);
+    camera->GetViewUp(state.view_up);
+    state.view_angle = camera->GetViewAngle();
+    state.parallel = camera->GetParallelProjection() != 0;
+    state.parallel_scale = camera->GetParallelScale();
+    camera->GetClippingRange(state.clipping_range);
+    camera->GetWindowCenter(state.window_center);
+
+    return state;
+}
+
+// ----------------------------------------------------------------------------
+// applyCamera
+// ----------------------------------------------------------------------------
+//
+// Description: Sets every field of a state on a camera
+//
+// Inputs:
+// - state: The state
+//
+// Outputs:
+// - camera: The camera
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void applyCamera(const CameraState& state, vtkCamera* camera)
+{
+    camera->SetPosition(state.position);
+    camera->SetFocalPoint(state.focal_point);
+    camera->SetViewUp(state.view_up);
+    camera->SetViewAngle(state.view_angle);
+    camera->SetParallelProjection(state.parallel ? 1 : 0);
+    camera->SetParallelScale(state.parallel_scale);
+    camera->SetClippingRange(state.clipping_range);
+    camera->SetWindowCenter(state.window_center[0], state.window_center[1]);
+}
+
+// ----------------------------------------------------------------------------
+// interpolateCamera
+// ----------------------------------------------------------------------------
+//
+// Description: Returns the view part of the way between two views (see the
+//              declaration)
+//
+// Inputs:
+// - from, to: The views
+// - t: Fraction of the way, clamped to 0 to 1
+//
+// Outputs: None
+//
+// Returns: The view
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+CameraState interpolateCamera(
+    const CameraState& from,
+    const CameraState& to,
+    double t
+    )
+{
+    t = std::max(0.0, std::min(1.0, t));
+    CameraState state = t < 0.5 ? from : to;
+
+    double from_direction[3];
+    double to_direction[3];
+    for (int i = 0; i < 3; ++i) {
+        state.focal_point[i] = lerp(from.focal_point[i], to.focal_point[i], t);
+        from_direction[i] = from.position[i] - from.focal_point[i];
+        to_direction[i] = to.position[i] - to.focal_point[i];
+    }
+    const double from_distance = vtkMath::Normalize(from_direction);
+    const double to_distance = vtkMath::Normalize(to_direction);
+
+    double direction[3] = {0.0, 0.0, 1.0};
+    if (from_distance > 0.0 && to_distance > 0.0) {
+        slerp(from_direction, to_direction, t, from.view_up, direction);
+        const double distance = lerpScale(from_distance, to_distance, t);
+        for (int i = 0; i < 3; ++i) {
+            state.position[i] = state.focal_point[i] + distance * direction[i];
+        }
+    } else {
+        for (int i = 0; i < 3; ++i) {
+            state.position[i] = lerp(from.position[i], to.position[i], t);
+        }
+    }
+
+    // Turn the view up along, then make it orthogonal to the new direction
+    double from_up[3] = {from.view_up[0], from.view_up[1], from.view_up[2]};
+    double to_up[3] = {to.view_up[0], to.view_up[1], to.view_up[2]};
+    double up[3];
+    if (vtkMath::Normalize(from_up) > 0.0 && vtkMath::Normalize(to_up) > 0.0) {
+        slerp(from_up, to_up, t, direction, up);
+        const double along = vtkMath::Dot(up, direction);
+        for (int i = 0; i < 3; ++i) {
+            up[i] -= along * direction[i];
+        }
+        if (vtkMath::Normalize(up) > 1e-6) {
+            std::copy(up, up + 3, state.view_up);
+        }
+    }
+
+    state.view_angle = lerp(from.view_angle, to.view_angle, t);
+    state.parallel_scale = lerpScale(
+        from.parallel_scale,
+        to.parallel_scale,
+        t
+        );
+    for (int i = 0; i < 2; ++i) {
+        state.clipping_range[i] = lerp(
+            from.clipping_range[i],
+            to.clipping_range[i],
+            t
+            );
+        state.window_center[i] = lerp(
+            from.window_center[i],
+            to.window_center[i],
+            t
+            );
+    }
+
+    return state;
+}
+
+
+// ============================================================================
+// CameraBookmarks Public Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// CameraBookmarks::set
+// ----------------------------------------------------------------------------
+//
+// Description: Adds a bookmark. A bookmark bound to the same key is
+//              replaced in place; unbound bookmarks are always appended.
+//
+// Inputs:
+// - bookmark: The bookmark
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void CameraBookmarks::set(const CameraBookmark& bookmark)
+{
+    for (CameraBookmark& existing : this->bookmarks) {
+        if (bookmark.key != 0 && existing.key == bookmark.key) {
+            existing = bookmark;
+            return;
+        }
+    }
+    this->bookmarks.push_back(bookmark);
+}
+
+// ----------------------------------------------------------------------------
+// CameraBookmarks::find
+// ----------------------------------------------------------------------------
+//
+// Description: Returns the bookmark bound to a key
+//
+// Inputs:
+// - key: The key
+//
+// Outputs: None
+//
+// Returns: The bookmark, or null if no bookmark is bound to the key
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+const CameraBookmark* CameraBookmarks::find(char key) const
+{
+    if (key == 0) {
+        return nullptr;
+    }
+    for (const CameraBookmark& bookmark : this->bookmarks) {
+        if (bookmark.key == key) {
+            return &bookmark;
+        }
+    }
+    return nullptr;
+}
+
+// ----------------------------------------------------------------------------
+// CameraBookmarks::remove
+// ----------------------------------------------------------------------------
+//
+// Description: Removes the bookmark bound to a key
+//
+// Inputs:
+// - key: The key
+//
+// Outputs: None
+//
+// Returns: Whether a bookmark was removed
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool CameraBookmarks::remove(char key)
+{
+    const auto found = std::find_if(
+        this->bookmarks.begin(),
+        this->bookmarks.end(),
+        [key](const CameraBookmark& bookmark) {
+            return key != 0 && bookmark.key == key;
+        }
+        );
+    if (found == this->bookmarks.end()) {
+        return false;
+    }
+    this->bookmarks.erase(found);
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// CameraBookmarks::load
+// ----------------------------------------------------------------------------
+//
+// Description: Reads the bookmarks of a session file
+//
+// Inputs:
+// - path: The session file
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool CameraBookmarks::load(const std::string& path, std::string* error)
+{
+    std::ifstream file(path);
+    if (!file) {
+        if (error) {
+            *error = "cannot open " + path;
+        }
+        return false;
+    }
+
+    std::stringstream text;
+    text << file.rdbuf();
+
+    return this->parse(text.str(), path, error);
+}
+
+// ----------------------------------------------------------------------------
+// CameraBookmarks::save
+// ----------------------------------------------------------------------------
+//
+// Description: Writes the bookmarks to a session file
+//
+// Inputs:
+// - path: The session file
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: Replaces the file
+//
+// ----------------------------------------------------------------------------
+bool CameraBookmarks::save(const std::string& path, std::string* error) const
+{
+    std::ofstream file(path);
+    file << this->text();
+    file.close();
+    if (!file) {
+        if (error) {
+            *error = "cannot write " + path;
+        }
+        return false;
+    }
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// CameraBookmarks::parse
+// ----------------------------------------------------------------------------
+//
+// Description: Parses session file text. A bookmark bound to a key already
+//              bound earlier in the text replaces the earlier one.
+//
+// Inputs:
+// - text: The session file text
+// - origin: Name of the text in error messages
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool CameraBookmarks::parse(
+    const std::string& text,
+    const std::string& origin,
+    std::string* error
+    )
+{
+    CameraBookmarks parsed;
+    std::stringstream stream(text);
+    std::string line;
+    int number = 0;
+    const auto fail = [&](const std::string& message) {
+        if (error) {
+            *error = origin + ":" + std::to_string(number) + ": " + message;
+        }
+        return false;
+    };
+
+    while (std::getline(stream, line)) {
+        ++number;
+        std::vector<std::string> words;
+        if (!tokenizeStatement(line, &words)) {
+            return fail("unterminated quote");
+        }
+        if (words.empty()) {
+            continue;
+        }
+        if (words[0] != "bookmark") {
+            return fail("unknown statement " + words[0]);
+        }
+        if (words.size() < 2 || words[1].find('=') != std::string::npos) {
+            return fail("bookmark needs a name");
+        }
+
+        CameraBookmark bookmark;
+        bookmark.name = words[1];
+        CameraState& camera = bookmark.camera;
+        for (std::size_t i = 2; i < words.size(); ++i) {
+            const std::size_t equals = words[i].find('=');
+            if (equals == std::string::npos || equals == 0) {
+                return fail("expected key=value, got " + words[i]);
+            }
+            const std::string key = words[i].substr(0, equals);
+            const std::string value = words[i].substr(equals + 1);
+
+            double parallel = 0.0;
+            bool valid = true;
+            if (key == "key") {
+                valid = value.size() == 1;
+                bookmark.key = valid ? value[0] : 0;
+            } else if (key == "position") {
+                valid = parseValues(value, 3, camera.position);
+            } else if (key == "focal_point") {
+                valid = parseValues(value, 3, camera.focal_point);
+            } else if (key == "view_up") {
+                valid = parseValues(value, 3, camera.view_up);
+            } else if (key == "view_angle") {
+                valid = parseValues(value, 1, &camera.view_angle);
+            } else if (key == "parallel") {
+                valid = parseValues(value, 1, &parallel);
+                camera.parallel = parallel != 0.0;
+            } else if (key == "parallel_scale") {
+                valid = parseValues(value, 1, &camera.parallel_scale);
+            } else if (key == "clipping_range") {
+                valid = parseValues(value, 2, camera.clipping_range);
+            } else if (key == "window_center") {
+                valid = parseValues(value, 2, camera.window_center);
+            } else {
+                return fail("unknown bookmark parameter " + key);
+            }
+            if (!valid) {
+                return fail("bad value " + value + " of " + key);
+            }
+        }
+        parsed.set(bookmark);
+    }
+
+    this->bookmarks = std::move(parsed.bookmarks);
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// CameraBookmarks::text
+// ----------------------------------------------------------------------------
+//
+// Description: Returns the bookmarks as session file text
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: The text, one statement per bookmark
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+std::string CameraBookmarks::text() const
+{
+    std::ostringstream text;
+    text << "# Camera bookmarks\n";
+    for (const CameraBookmark& bookmark : this->bookmarks) {
+        std::string name = bookmark.name;
+        name.erase(std::remove(name.begin(), name.end(), '"'), name.end());
+
+        const CameraState& camera = bookmark.camera;
+        text << "bookmark \"" << name << "\"";
+        if (bookmark.key != 0) {
+            text << " key=" << bookmark.key;
+        }
+        text << " position=" << formatNumbers(camera.position, 3)
+            << " focal_point=" << formatNumbers(camera.focal_point, 3)
+            << " view_up=" << formatNumbers(camera.view_up, 3)
+            << " view_angle=" << formatNumbers(&camera.view_angle, 1)
+            << " parallel=" << (camera.parallel ? "on" : "off")
+            << " parallel_scale="
+            << formatNumbers(&camera.parallel_scale, 1)
+            << " clipping_range=" << formatNumbers(camera.clipping_range, 2)
+            << " window_center=" << formatNumbers(camera.window_center, 2)
+            << "\n";
+    }
+    return text.str();
+}
+
+
+// ============================================================================
+// CameraTransition Public Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// CameraTransition::start
+// ----------------------------------------------------------------------------
+//
+// Description: Starts moving a camera from its current view to a target
+//              view, replacing a transition in progress
+//
+// Inputs:
+// - camera: The camera
+// - target: The target view
+// - seconds: Length of the transition, 0 to jump on the first step
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void CameraTransition::start(
+    vtkCamera* camera,
+    const CameraState& target,
+    double seconds
+    )
+{
+    this->camera = camera;
+    this->from = captureCamera(camera);
+    this->to = target;
+    this->started = Clock::now();
+    this->duration = std::max(0.0, seconds);
+    this->running = true;
+}
+
+// ----------------------------------------------------------------------------
+// CameraTransition::step
+// ----------------------------------------------------------------------------
+//
+// Description: Sets the camera to the view of the current time, eased so
+//              the motion starts and stops smoothly
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: true while moving, false once the target is set (and when no
+//          transition runs)
+//
+// Side Effects: Modifies the camera
+//
+// ----------------------------------------------------------------------------
+bool CameraTransition::step()
+{
+    if (!this->running || !this->camera) {
+        this->running = false;
+        return false;
+    }
+
+    const double elapsed = std::chrono::duration<double>(
+        Clock::now() - this->started).count();
+    const double t = this->duration > 0.0 ? elapsed / this->duration : 1.0;
+    if (t >= 1.0) {
+        applyCamera(this->to, this->camera);
+        this->running = false;
+        return false;
+    }
+
+    const double eased = t * t * (3.0 - 2.0 * t);
+    applyCamera(interpolateCamera(this->from, this->to, eased), this->camera);
+    return true;
+}
+
+
+// ============================================================================
+// MotionProxies Constructor/Destructor Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// MotionProxies::~MotionProxies
+// ----------------------------------------------------------------------------
+//
+// Description: Destructor
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Shows the actors again, waits for running builds and removes
+//               the proxies from the renderer
+//
+// ----------------------------------------------------------------------------
+MotionProxies::~MotionProxies()
+{
+    this->setMoving(false);
+    this->removeProxies();
+}
+
+
+// ============================================================================
+// MotionProxies Public Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// MotionProxies::setActors
+// ----------------------------------------------------------------------------
+//
+// Description: Sets the actors that are replaced by proxies while moving
+//              and starts building the proxies missing or out of date.
+//              Proxies of actors still in the list are kept.
+//
+// Inputs:
+// - renderer: Renderer of the actors
+// - actors: The actors
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Ends the motion; removes the proxies of other actors
+//
+// ----------------------------------------------------------------------------
+void MotionProxies::setActors(
+    vtkRenderer* renderer,
+    const std::vector<vtkSmartPointer<vtkActor>>& actors
+    )
+{
+    this->setMoving(false);
+    if (renderer != this->renderer) {
+        this->removeProxies();
+        this->renderer = renderer;
+    }
+
+    std::vector<Proxy> kept;
+    for (const auto& actor : actors) {
+        const auto found = std::find_if(
+            this->proxies.begin(),
+            this->proxies.end(),
+            [&actor](const Proxy& proxy) { return proxy.actor == actor; }
+            );
+        if (found != this->proxies.end()) {
+            kept.push_back(std::move(*found));
+        } else {
+            Proxy proxy;
+            proxy.actor = actor;
+            kept.push_back(std::move(proxy));
+        }
+    }
+    this->removeProxies();
+    this->proxies = std::move(kept);
+
+    this->collectBuilds();
+    this->startBuilds();
+}
+
+// ----------------------------------------------------------------------------
+// MotionProxies::setMoving
+// ----------------------------------------------------------------------------
+//
+// Description: Shows the ready proxies of the visible, large meshes in place
+//              of their actors, or shows the actors again. Meshes whose
+//              proxy is missing or out of date are drawn in full, and their
+//              proxy is built in the background for the next motion.
+//
+// Inputs:
+// - enabled: Whether the camera is moving
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Changes the visibility of the actors
+//
+// ----------------------------------------------------------------------------
+void MotionProxies::setMoving(bool enabled)
+{
+    if (enabled == this->moving) {
+        return;
+    }
+    this->moving = enabled;
+
+    if (!enabled) {
+        for (Proxy& proxy : this->proxies) {
+            if (proxy.hidden) {
+                if (proxy.actor) {
+                    proxy.actor->VisibilityOn();
+                }
+                proxy.proxy->VisibilityOff();
+                proxy.hidden = false;
+            }
+        }
+        return;
+    }
+
+    if (!this->renderer) {
+        return;
+    }
+    this->collectBuilds();
+    this->startBuilds();
+    for (Proxy& proxy : this->proxies) {
+        vtkActor* actor = proxy.actor;
+        if (actor == nullptr || !actor->GetVisibility() || !proxy.proxy) {
+            continue;
+        }
+        auto mapper = vtkPolyDataMapper::SafeDownCast(actor->GetMapper());
+        vtkPolyData* mesh = mapper ? mapper->GetInput() : nullptr;
+        if (mesh == nullptr || proxy.built != mesh->GetMTime()) {
+            continue;
+        }
+
+        auto pose = vtkSmartPointer<vtkMatrix4x4>::New();
+        pose->DeepCopy(actor->GetMatrix());
+        proxy.proxy->SetUserMatrix(pose);
+        proxy.proxy->SetProperty(actor->GetProperty());
+        proxy.proxy->VisibilityOn();
+        actor->VisibilityOff();
+        proxy.hidden = true;
+    }
+}
+
+
+// ============================================================================
+// MotionProxies Private Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// MotionProxies::startBuilds
+// ----------------------------------------------------------------------------
+//
+// Description: Starts a worker thread decimating every large mesh whose
+//              proxy is missing or out of date and that is not being built
+//              already
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Copies the points of the meshes built
+//
+// ----------------------------------------------------------------------------
+void MotionProxies::startBuilds()
+{
+    for (Proxy& proxy : this->proxies) {
+        vtkActor* actor = proxy.actor;
+        auto mapper = actor
+            ? vtkPolyDataMapper::SafeDownCast(actor->GetMapper())
+            : nullptr;
+        vtkPolyData* mesh = mapper ? mapper->GetInput() : nullptr;
+        if (mesh == nullptr || mesh->GetNumberOfCells() < kMinimumCells) {
+            continue;
+        }
+        // A running build is dropped by collectBuilds if it is out of date,
+        // and the proxy is built again on the next call
+        const vtkMTimeType time = mesh->GetMTime();
+        if (proxy.pending.valid() || (proxy.proxy && proxy.built == time)) {
+            continue;
+        }
+
+        vtkSmartPointer<vtkPolyData> input = isolateMesh(mesh);
+        proxy.pending = std::async(std::launch::async, [input]() {
+            return decimateMesh(input, kDivisions);
+        });
+        proxy.pending_time = time;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// MotionProxies::collectBuilds
+// ----------------------------------------------------------------------------
+//
+// Description: Turns the builds that finished into proxy actors, drawing
+//              with a copy of the mapper settings of their actor. Builds of
+//              meshes that changed meanwhile are dropped.
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Adds the new proxy actors to the renderer, hidden
+//
+// ----------------------------------------------------------------------------
+void MotionProxies::collectBuilds()
+{
+    for (Proxy& proxy : this->proxies) {
+        if (!proxy.pending.valid()
+            || proxy.pending.wait_for(std::chrono::seconds(0))
+                != std::future_status::ready) {
+            continue;
+        }
+        vtkSmartPointer<vtkPolyData> output = proxy.pending.get();
+
+        vtkActor* actor = proxy.actor;
+        auto mapper = actor
+            ? vtkPolyDataMapper::SafeDownCast(actor->GetMapper())
+            : nullptr;
+        vtkPolyData* mesh = mapper ? mapper->GetInput() : nullptr;
+        if (!output || mesh == nullptr || !this->renderer
+            || mesh->GetMTime() != proxy.pending_time) {
+            continue;
+        }
+
+        auto proxy_mapper = vtkSmartPointer<vtkPolyDataMapper>::New();
+        proxy_mapper->ShallowCopy(mapper);
+        proxy_mapper->SetInputData(output);
+        if (!proxy.proxy) {
+            proxy.proxy = vtkSmartPointer<vtkActor>::New();
+            proxy.proxy->VisibilityOff();
+            this->renderer->AddActor(proxy.proxy);
+        }
+        proxy.proxy->SetMapper(proxy_mapper);
+        proxy.built = proxy.pending_time;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// MotionProxies::removeProxies
+// ----------------------------------------------------------------------------
+//
+// Description: Removes the proxy actors from the renderer and forgets them
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Waits for the builds still running
+//
+// ----------------------------------------------------------------------------
+void MotionProxies::removeProxies()
+{
+    for (const Proxy& proxy : this->proxies) {
+        if (proxy.proxy && this->renderer) {
+            this->renderer->RemoveActor(proxy.proxy);
+        }
+    }
+    this->proxies.clear();
+}
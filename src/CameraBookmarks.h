@@ -0,0 +1,323 @@
+// ============================================================================
+// CameraBookmarks.h - Camera bookmarks, session files and transitions
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * CameraBookmarks.h: created.
+// * CameraBookmarks.h: motion proxies are built on a worker thread.
+//
+// ============================================================================
+
+
+#ifndef CameraBookmarks_H
+#define CameraBookmarks_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Standard Library headers
+#include <chrono>
+#include <future>
+#include <string>
+#include <vector>
+
+// External libraries headers
+#include <vtkActor.h>
+#include <vtkCamera.h>
+#include <vtkPolyData.h>
+#include <vtkRenderer.h>
+#include <vtkSmartPointer.h>
+#include <vtkType.h>
+#include <vtkWeakPointer.h>
+
+
+// ============================================================================
+// Structure Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// CameraState
+// ----------------------------------------------------------------------------
+//
+// Description: Everything a vtkCamera needs to reproduce a view. Restoring
+//              it sets camera fields only, so it costs one render and no
+//              pipeline update.
+//
+// Properties:
+// - position, focal_point, view_up: Placement of the camera
+// - view_angle: Perspective view angle, in degrees
+// - parallel: Whether the projection is parallel
+// - parallel_scale: Half the view height of parallel projections
+// - clipping_range: Near and far clipping distances
+// - window_center: Center of the window in viewport coordinates
+//
+// ----------------------------------------------------------------------------
+struct CameraState {
+    double position[3] = {0.0, 0.0, 1.0};
+    double focal_point[3] = {0.0, 0.0, 0.0};
+    double view_up[3] = {0.0, 1.0, 0.0};
+    double view_angle = 30.0;
+    bool parallel = false;
+    double parallel_scale = 1.0;
+    double clipping_range[2] = {0.01, 1000.01};
+    double window_center[2] = {0.0, 0.0};
+};
+
+// ----------------------------------------------------------------------------
+// CameraBookmark
+// ----------------------------------------------------------------------------
+//
+// Description: A named view
+//
+// Properties:
+// - name: Name shown to the user
+// - key: Key restoring the bookmark, 0 for none
+// - camera: The view
+//
+// ----------------------------------------------------------------------------
+struct CameraBookmark {
+    std::string name;
+    char key = 0;
+    CameraState camera;
+};
+
+
+// ============================================================================
+// Function Declarations Section
+// ============================================================================
+
+// Returns the state of a camera
+CameraState captureCamera(vtkCamera* camera);
+
+// Sets every field of the state on the camera
+void applyCamera(const CameraState& state, vtkCamera* camera);
+
+// Returns the view a fraction t (0 to 1) of the way from one state to
+// another: the focal point moves in a straight line, the direction of
+// projection and the view up turn on great circles and the distance
+// changes geometrically, so the camera swings around the scene instead of
+// cutting through it.
+CameraState interpolateCamera(
+    const CameraState& from,
+    const CameraState& to,
+    double t
+    );
+
+
+// ============================================================================
+// Class Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// CameraBookmarks
+// ----------------------------------------------------------------------------
+//
+// Description: An ordered list of camera bookmarks, stored in session files
+//              of one statement per bookmark, in the syntax of scene files
+//              (see SceneScript). The parameters are those of the scene
+//              file camera statement, plus key, clipping_range and
+//              window_center; '#' starts a comment.
+//
+//                bookmark "Front" key=1 position=0,0,10 focal_point=0,0,0
+//                    view_up=0,1,0 view_angle=30 parallel=off
+//                    parallel_scale=1 clipping_range=8,12 window_center=0,0
+//
+//              (one line in the file). Missing parameters keep the
+//              CameraState defaults.
+//
+// Properties:
+// - bookmarks: The bookmarks, in the order they were added
+//
+// Methods:
+// - set: Adds a bookmark, replacing the one with the same key
+// - find: Returns the bookmark of a key
+// - remove: Removes the bookmark of a key
+// - all: Returns the bookmarks
+// - clear: Removes every bookmark
+// - load, save: Reads and writes a session file
+// - parse, text: Reads and writes session file text
+//
+// Example usage:
+//   CameraBookmarks bookmarks;
+//   bookmarks.set({"Front", '1', captureCamera(camera)});
+//   bookmarks.save("views.bookmarks");
+//
+// ----------------------------------------------------------------------------
+class CameraBookmarks
+{
+public:
+    void set(const CameraBookmark& bookmark);  // Appended if the key is new
+    const CameraBookmark* find(char key) const;  // Null if unbound
+    bool remove(char key);
+    const std::vector<CameraBookmark>& all() const { return this->bookmarks; }
+    void clear() { this->bookmarks.clear(); }
+
+    bool load(const std::string& path, std::string* error = nullptr);
+    bool save(const std::string& path, std::string* error = nullptr) const;
+    bool parse(
+        const std::string& text,
+        const std::string& origin,
+        std::string* error = nullptr
+        );  // Replaces the bookmarks only on success
+    std::string text() const;
+
+private:
+    std::vector<CameraBookmark> bookmarks;
+};
+
+// ----------------------------------------------------------------------------
+// CameraTransition
+// ----------------------------------------------------------------------------
+//
+// Description: Moves a camera to a target view over a fixed time with
+//              interpolateCamera, eased in and out. The caller steps it
+//              from a timer and renders after every step; the last step
+//              sets the target exactly, including its clipping range.
+//
+// Properties:
+// - camera: The camera moved
+// - from, to: Start and target views
+// - started: Start time
+// - duration: Length of the transition, in seconds
+// - running: Whether a transition is in progress
+//
+// Methods:
+// - start: Starts moving the camera to a view
+// - step: Sets the camera for the current time
+// - stop: Leaves the camera where it is
+// - isRunning: Returns whether a transition is in progress
+//
+// Example usage:
+//   CameraTransition transition;
+//   transition.start(renderer->GetActiveCamera(), bookmark.camera);
+//   while (transition.step()) {
+//       renderer->ResetCameraClippingRange();
+//       window->Render();
+//   }
+//   window->Render();
+//
+// ----------------------------------------------------------------------------
+class CameraTransition
+{
+public:
+    static constexpr double kDefaultSeconds = 0.6;
+
+    void start(
+        vtkCamera* camera,
+        const CameraState& target,
+        double seconds = kDefaultSeconds
+        );
+    bool step();  // Returns false once the target is reached
+    void stop() { this->running = false; }
+    bool isRunning() const { return this->running; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    vtkWeakPointer<vtkCamera> camera;
+    CameraState from;
+    CameraState to;
+    Clock::time_point started;
+    double duration = kDefaultSeconds;
+    bool running = false;
+};
+
+// ----------------------------------------------------------------------------
+// MotionProxies
+// ----------------------------------------------------------------------------
+//
+// Description: Decimated stand-ins for large meshes while the camera is in
+//              motion. Meshes of at least kMinimumCells cells get a proxy
+//              actor drawing a vtkQuadricClustering of the mesh on a grid
+//              of kDivisions cells a side, with the property and pose of
+//              the actor. Proxies are built on a worker thread as soon as
+//              the actors are set, and rebuilt there when a mesh changes, so
+//              starting a motion never runs a filter: a mesh whose proxy is
+//              not ready yet is drawn in full. Both actors stay in the
+//              renderer, so switching between them is a visibility change
+//              and neither re-uploads its geometry. The builds read the
+//              cell arrays of the meshes, which may be replaced but not
+//              edited in place while a build runs.
+//
+// Properties:
+// - renderer: Renderer the proxies are added to
+// - proxies: The actors and their proxies
+// - moving: Whether the proxies are shown
+//
+// Methods:
+// - setActors: Sets the actors that may be replaced while moving and
+//   starts building their proxies
+// - setMoving: Shows the ready proxies, or the actors again
+// - isMoving: Returns whether the proxies are shown
+//
+// Example usage:
+//   MotionProxies proxies;
+//   proxies.setActors(renderer, mesh_actors);
+//   proxies.setMoving(true);
+//   // ... render the transition
+//   proxies.setMoving(false);
+//
+// ----------------------------------------------------------------------------
+class MotionProxies
+{
+public:
+    static constexpr vtkIdType kMinimumCells = 200000;
+    static constexpr int kDivisions = 96;
+
+    // Constructor/Destructor
+    MotionProxies() = default;
+    ~MotionProxies();
+
+    MotionProxies(const MotionProxies&) = delete;
+    MotionProxies& operator=(const MotionProxies&) = delete;
+
+    void setActors(
+        vtkRenderer* renderer,
+        const std::vector<vtkSmartPointer<vtkActor>>& actors
+        );
+    void setMoving(bool enabled);
+    bool isMoving() const { return this->moving; }
+
+private:
+    struct Proxy {
+        vtkWeakPointer<vtkActor> actor;
+        vtkSmartPointer<vtkActor> proxy;  // Null until a build finished
+        vtkMTimeType built = 0;  // Modification time of the mesh proxied
+        std::future<vtkSmartPointer<vtkPolyData>> pending;  // Running build
+        vtkMTimeType pending_time = 0;  // Mesh time of the running build
+        bool hidden = false;  // Whether the actor was hidden for the proxy
+    };
+
+    void startBuilds();  // For meshes without an up to date proxy
+    void collectBuilds();  // Turns finished builds into proxy actors
+    void removeProxies();
+
+    vtkWeakPointer<vtkRenderer> renderer;
+    std::vector<Proxy> proxies;
+    bool moving = false;
+};
+
+#endif  // CameraBookmarks_H
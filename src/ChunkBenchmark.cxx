@@ -0,0 +1,425 @@
+// ============================================================================
+// ChunkBenchmark - Random sub-volume read latency of chunked volume files
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// Reads randomly placed cubic sub-volumes from chunked volume files through
+// the ChunkedVolumeReader and prints the latency distribution (median, 90th
+// and 99th percentile, worst) and the throughput of each file, next to the
+// time a full read of the volume takes. Without an input file a smooth
+// 16-bit phantom is synthesized and written raw and compressed with every
+// requested chunk size, so the table shows what chunk size and compression
+// cost per region. Files are read right after being written, from the page
+// cache, so the numbers are decoding and copying, not disk, latency.
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * ChunkBenchmark.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header
+#include "ChunkedVolume.h"
+
+// "C" system headers
+
+// Standard Library headers
+#include <algorithm>   // required by max, sort
+#include <chrono>      // required by steady_clock
+#include <cmath>       // required by sin, cos
+#include <cstdint>     // required by uint16_t
+#include <cstdlib>     // required by EXIT_SUCCESS, EXIT_FAILURE
+#include <filesystem>  // Used for testing directory and file status
+#include <iomanip>     // required by setw
+#include <iostream>    // required by cin, cout, ...
+#include <random>      // required by mt19937
+#include <string>      // self explanatory ...
+#include <vector>      // self explanatory ...
+
+// External libraries headers
+#include <clipp.hpp>  // command line arguments parsing
+#include <vtkDataArray.h>
+#include <vtkImageData.h>
+#include <vtkPointData.h>
+#include <vtkSmartPointer.h>
+#include <vtkType.h>
+
+
+// ============================================================================
+// Define namespace aliases
+// ============================================================================
+
+namespace fs = std::filesystem;
+
+
+// ============================================================================
+// Global constants section
+// ============================================================================
+
+const std::string kAppName = "QtVTKChunkBench";
+const std::string kVersionString = "0.1";
+const std::string kYearString = "yyyy";
+const std::string kAuthorName = "Ljubomir Kurij";
+const std::string kAuthorEmail = "ljubomir_kurij@protonmail.com";
+const std::string kAppDoc = "\
+Measures the latency of reading random sub-volumes from chunked volume\n\
+files, for several chunk sizes with and without compression.\n\n\
+Mandatory arguments to long options are mandatory for short options too.\n";
+const std::string kLicense = "\
+License GPLv3+: GNU GPL version 3 or later <http://gnu.org/licenses/gpl.html>\n\
+This is free software: you are free to change and redistribute it.\n\
+There is NO WARRANTY, to the extent permitted by law.\n";
+
+
+// ============================================================================
+// Global variables section
+// ============================================================================
+
+static std::string exec_name = kAppName;
+
+
+// ============================================================================
+// Utility function prototypes
+// ============================================================================
+
+vtkSmartPointer<vtkImageData> makePhantom(int);
+bool measureFile(const std::string&, const std::string&, int, int, int);
+void printShortHelp(std::string = kAppName);
+void printVersionInfo();
+void showHelp(
+        const clipp::group&,
+        const std::string = kAppName,
+        const std::string = kAppDoc
+    );
+
+
+// ============================================================================
+// App's main function body
+// ============================================================================
+
+int main(int argc, char* argv[])
+{
+    // Determine the exec name under wich program is beeing executed
+    fs::path exec_path {argv[0]};
+    exec_name = exec_path.filename().string();
+
+    // Define structures to store command line options arguments and validators
+    struct CLIArguments {
+        bool show_help;
+        bool show_version;
+        std::string input;
+        int  volume_size;
+        std::vector<int> chunk_sizes;
+        int  region_size;
+        int  reads;
+        int  seed;
+    };
+
+    CLIArguments user_options {
+        false, false, "", 256, {}, 64, 200, 1
+    };
+
+    // Unsupported options aggregator.
+    std::vector<std::string> unknown_options;
+
+    // Option filters definitions
+    auto istarget = clipp::match::prefix_not("-");
+
+    // Set command line options
+    auto cli = (
+        (
+            clipp::option("-h", "--help").set(user_options.show_help)
+                .doc("show this help message and exit"),
+            clipp::option("-V", "--version").set(user_options.show_version)
+                .doc("print program version")
+        ).doc("general options:"),
+        (
+            (
+                clipp::option("-i", "--input")
+                & clipp::value(istarget, "file", user_options.input)
+            ) % "chunked volume file to measure instead of a phantom",
+            (
+                clipp::option("--volume-size")
+                & clipp::integer("voxels", user_options.volume_size)
+            ) % "edge of the synthesized phantom (default: 256)",
+            (
+                clipp::option("--chunk-sizes")
+                & clipp::integers("voxels", user_options.chunk_sizes)
+            ) % "chunk sizes of the phantom files (default: 32 64 128)",
+            (
+                clipp::option("--region-size")
+                & clipp::integer("voxels", user_options.region_size)
+            ) % "edge of the sub-volumes read (default: 64)",
+            (
+                clipp::option("-n", "--reads")
+                & clipp::integer("count", user_options.reads)
+            ) % "sub-volumes read per file (default: 200)",
+            (
+                clipp::option("--seed")
+                & clipp::integer("n", user_options.seed)
+            ) % "seed of the region positions (default: 1)"
+        ).doc("benchmark options:"),
+        clipp::any_other(unknown_options)
+    );
+
+    // Parse command line options
+    if (!clipp::parse(argc, argv, cli) || !unknown_options.empty()) {
+        std::cerr << "Unknown options: ";
+        for (const auto& opt : unknown_options) {
+            std::cerr << opt << " ";
+        }
+        std::cerr << "\n";
+        printShortHelp(exec_name);
+
+        return EXIT_FAILURE;
+    }
+    if (user_options.show_help) {
+        showHelp(cli, exec_name);
+
+        return EXIT_SUCCESS;
+    }
+    if (user_options.show_version) {
+        printVersionInfo();
+
+        return EXIT_SUCCESS;
+    }
+
+    const int region_size = std::max(1, user_options.region_size);
+    const int reads = std::max(1, user_options.reads);
+    std::cout << std::setw(8) << "chunk" << std::setw(12) << "codec"
+        << std::setw(8) << "ratio" << std::setw(10) << "p50 ms"
+        << std::setw(10) << "p90 ms" << std::setw(10) << "p99 ms"
+        << std::setw(10) << "max ms" << std::setw(10) << "MB/s"
+        << std::setw(11) << "full ms" << "\n";
+
+    if (!user_options.input.empty()) {
+        return measureFile(
+            user_options.input, "file", region_size, reads,
+            user_options.seed
+            ) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    std::vector<int> chunk_sizes = user_options.chunk_sizes;
+    if (chunk_sizes.empty()) {
+        chunk_sizes = {32, 64, 128};
+    }
+    vtkSmartPointer<vtkImageData> phantom =
+        makePhantom(std::max(1, user_options.volume_size));
+
+    std::error_code code;
+    const fs::path directory = fs::temp_directory_path(code)
+        / ("qtvtk_chunk_bench_" + std::to_string(
+            std::chrono::steady_clock::now().time_since_epoch().count()
+            ));
+    fs::create_directories(directory, code);
+    if (code) {
+        std::cerr << exec_name << ": cannot create " << directory.string()
+            << "\n";
+
+        return EXIT_FAILURE;
+    }
+
+    bool success = true;
+    for (int chunk_size : chunk_sizes) {
+        for (bool compress : {false, true}) {
+            ChunkedWriteOptions options;
+            options.chunk_size = std::max(1, chunk_size);
+            options.compress = compress;
+            const std::string path = (directory / (
+                "chunks_" + std::to_string(options.chunk_size)
+                + (compress ? "_compressed" : "_raw") + ".qvc"
+                )).string();
+            std::string error;
+            if (!writeChunkedVolume(phantom, path, options, nullptr, &error)) {
+                std::cerr << exec_name << ": " << error << "\n";
+                success = false;
+                break;
+            }
+            success = measureFile(
+                path,
+                compress ? "compressed" : "raw",
+                region_size,
+                reads,
+                user_options.seed
+                ) && success;
+            fs::remove(path, code);
+        }
+    }
+    fs::remove_all(directory, code);
+
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+
+// ============================================================================
+// Function definitions
+// ============================================================================
+
+vtkSmartPointer<vtkImageData> makePhantom(int size) {
+    // Smooth 16-bit structures with a little noise, like a CT scan
+    auto image = vtkSmartPointer<vtkImageData>::New();
+    image->SetDimensions(size, size, size);
+    image->AllocateScalars(VTK_UNSIGNED_SHORT, 1);
+    auto* voxels = static_cast<std::uint16_t*>(image->GetScalarPointer());
+
+    std::mt19937 noise(7);
+    std::uniform_int_distribution<int> jitter(-8, 8);
+    std::size_t index = 0;
+    for (int z = 0; z < size; ++z) {
+        for (int y = 0; y < size; ++y) {
+            for (int x = 0; x < size; ++x, ++index) {
+                const double value = 1200.0
+                    + 600.0 * std::sin(x * 0.05) * std::cos(y * 0.04)
+                    + 300.0 * std::sin(z * 0.03 + x * 0.01)
+                    + jitter(noise);
+                voxels[index] = static_cast<std::uint16_t>(
+                    std::max(0.0, value)
+                    );
+            }
+        }
+    }
+
+    return image;
+}
+
+
+bool measureFile(
+        const std::string& path,
+        const std::string& label,
+        int region_size,
+        int reads,
+        int seed
+        ) {
+    using Clock = std::chrono::steady_clock;
+
+    ChunkedVolumeReader reader;
+    if (!reader.open(path)) {
+        std::cerr << exec_name << ": " << reader.lastError() << "\n";
+
+        return false;
+    }
+
+    // The same region positions for every file of a run
+    const int* extent = reader.extent();
+    std::mt19937 positions(static_cast<unsigned>(seed));
+    std::vector<double> latencies;
+    std::uint64_t bytes = 0;
+    auto region_image = vtkSmartPointer<vtkImageData>::New();
+    std::string error;
+    for (int read = 0; read < reads; ++read) {
+        int region[6];
+        for (int axis = 0; axis < 3; ++axis) {
+            const int low = extent[2 * axis];
+            const int high = std::max(
+                low,
+                extent[2 * axis + 1] - region_size + 1
+                );
+            region[2 * axis] =
+                std::uniform_int_distribution<int>(low, high)(positions);
+            region[2 * axis + 1] = region[2 * axis] + region_size - 1;
+        }
+
+        const auto started = Clock::now();
+        if (!reader.readRegion(region, region_image, &error)) {
+            std::cerr << exec_name << ": " << error << "\n";
+
+            return false;
+        }
+        latencies.push_back(std::chrono::duration<double, std::milli>(
+            Clock::now() - started).count());
+        vtkDataArray* scalars = region_image->GetPointData()->GetScalars();
+        bytes += std::uint64_t(scalars->GetNumberOfValues())
+            * scalars->GetDataTypeSize();
+    }
+
+    const auto full_started = Clock::now();
+    auto full_image = vtkSmartPointer<vtkImageData>::New();
+    if (!reader.readRegion(extent, full_image, &error)) {
+        std::cerr << exec_name << ": " << error << "\n";
+
+        return false;
+    }
+    const double full_ms = std::chrono::duration<double, std::milli>(
+        Clock::now() - full_started).count();
+
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&latencies](double fraction) {
+        const std::size_t rank = static_cast<std::size_t>(
+            fraction * double(latencies.size() - 1) + 0.5
+            );
+        return latencies[rank];
+    };
+    double total_ms = 0.0;
+    for (double latency : latencies) {
+        total_ms += latency;
+    }
+
+    std::cout << std::setw(8) << reader.chunkSize()
+        << std::setw(12) << label
+        << std::setw(8) << std::fixed << std::setprecision(2)
+        << double(reader.storedBytes())
+            / double(std::max<std::uint64_t>(reader.uncompressedBytes(), 1))
+        << std::setw(10) << std::setprecision(3) << percentile(0.5)
+        << std::setw(10) << percentile(0.9)
+        << std::setw(10) << percentile(0.99)
+        << std::setw(10) << latencies.back()
+        << std::setw(10) << std::setprecision(1)
+        << double(bytes) / 1e6 / std::max(total_ms / 1000.0, 1e-9)
+        << std::setw(11) << full_ms << "\n";
+
+    return true;
+}
+
+
+inline void printShortHelp(std::string exec_name) {
+    std::cout << "Try '" << exec_name << " --help' for more information.\n";
+}
+
+
+void printVersionInfo() {
+    std::cout << kAppName << " " << kVersionString << " Copyright (C) "
+        << kYearString << " " << kAuthorName << "\n"
+        << kLicense;
+}
+
+
+void showHelp(
+        const clipp::group& group,
+        const std::string exec_name,
+        const std::string doc
+        ) {
+    auto fmt = clipp::doc_formatting {}.first_column(0).last_column(79);
+    clipp::man_page man;
+
+    man.prepend_section(
+        "USAGE", clipp::usage_lines(group, exec_name, fmt).str()
+        );
+    man.append_section("", doc);
+    man.append_section("", clipp::documentation(group, fmt).str());
+    man.append_section("", "Report bugs to <" + kAuthorEmail + ">.");
+
+    std::cout << man;
+}
@@ -0,0 +1,1178 @@
+// ============================================================================
+// ChunkedVolume.cxx - Chunked on-disk volume format
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * ChunkedVolume.cxx: created.
+// * ChunkedVolume.cxx: added compressed chunks, streamed writing and the
+//   memory-mapped ChunkedVolumeReader.
+// * ChunkedVolume.cxx: kept the writeChunkedVolume overload taking a chunk
+//   size, for source compatibility.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header -------------------------------------------------------------
+#include "ChunkedVolume.h"
+
+// "C" system headers ---------------------------------------------------------
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Standard Library headers ---------------------------------------------------
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+
+// External libraries headers -------------------------------------------------
+
+// VTK headers
+#include <vtkDataArray.h>
+#include <vtkPointData.h>
+#include <vtkSMPTools.h>
+#include <vtkStreamingDemandDrivenPipeline.h>
+
+
+// ============================================================================
+// Local helpers section
+// ============================================================================
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+std::size_t extentVoxels(const int extent[6])
+{
+    return std::size_t(extent[1] - extent[0] + 1)
+        * std::size_t(extent[3] - extent[2] + 1)
+        * std::size_t(extent[5] - extent[4] + 1);
+}
+
+// Copies the voxels of a chunk out of an image, x fastest
+void gatherChunk(
+    const std::uint8_t* image,
+    const int image_extent[6],
+    const int chunk[6],
+    std::size_t voxel_size,
+    std::vector<std::uint8_t>& voxels
+    )
+{
+    const std::size_t row = std::size_t(chunk[1] - chunk[0] + 1) * voxel_size;
+    const std::size_t image_row =
+        std::size_t(image_extent[1] - image_extent[0] + 1) * voxel_size;
+    const std::size_t image_slice =
+        std::size_t(image_extent[3] - image_extent[2] + 1) * image_row;
+    voxels.resize(extentVoxels(chunk) * voxel_size);
+
+    std::uint8_t* target = voxels.data();
+    for (int z = chunk[4]; z <= chunk[5]; ++z) {
+        for (int y = chunk[2]; y <= chunk[3]; ++y) {
+            const std::uint8_t* source = image
+                + std::size_t(z - image_extent[4]) * image_slice
+                + std::size_t(y - image_extent[2]) * image_row
+                + std::size_t(chunk[0] - image_extent[0]) * voxel_size;
+            std::memcpy(target, source, row);
+            target += row;
+        }
+    }
+}
+
+// Copies the part of a chunk inside an image's extent into the image, the
+// reverse of gatherChunk
+void scatterChunk(
+    const std::uint8_t* voxels,
+    const int chunk[6],
+    std::uint8_t* image,
+    const int image_extent[6],
+    std::size_t voxel_size
+    )
+{
+    int overlap[6];
+    for (int axis = 0; axis < 3; ++axis) {
+        overlap[2 * axis] = std::max(chunk[2 * axis], image_extent[2 * axis]);
+        overlap[2 * axis + 1] = std::min(
+            chunk[2 * axis + 1],
+            image_extent[2 * axis + 1]
+            );
+        if (overlap[2 * axis + 1] < overlap[2 * axis]) {
+            return;
+        }
+    }
+
+    const std::size_t row =
+        std::size_t(overlap[1] - overlap[0] + 1) * voxel_size;
+    const std::size_t chunk_row =
+        std::size_t(chunk[1] - chunk[0] + 1) * voxel_size;
+    const std::size_t chunk_slice =
+        std::size_t(chunk[3] - chunk[2] + 1) * chunk_row;
+    const std::size_t image_row =
+        std::size_t(image_extent[1] - image_extent[0] + 1) * voxel_size;
+    const std::size_t image_slice =
+        std::size_t(image_extent[3] - image_extent[2] + 1) * image_row;
+    for (int z = overlap[4]; z <= overlap[5]; ++z) {
+        for (int y = overlap[2]; y <= overlap[3]; ++y) {
+            const std::uint8_t* source = voxels
+                + std::size_t(z - chunk[4]) * chunk_slice
+                + std::size_t(y - chunk[2]) * chunk_row
+                + std::size_t(overlap[0] - chunk[0]) * voxel_size;
+            std::uint8_t* target = image
+                + std::size_t(z - image_extent[4]) * image_slice
+                + std::size_t(y - image_extent[2]) * image_row
+                + std::size_t(overlap[0] - image_extent[0]) * voxel_size;
+            std::memcpy(target, source, row);
+        }
+    }
+}
+
+// Writes a chunked volume file one slab of chunks at a time: the header is
+// written first as a placeholder, the payloads in chunk order, and the
+// index and the final header at the end.
+class ChunkWriter
+{
+public:
+    ChunkWriter(const std::string& path, const ChunkedWriteOptions& options)
+        : path(path),
+          chunk_size(std::max(1, options.chunk_size)),
+          compress(options.compress)
+    {}
+
+    // Takes scalar type and geometry from the image, the extent from whole
+    bool begin(vtkImageData* image, const int whole[6], std::string* error)
+    {
+        vtkDataArray* scalars = image != nullptr
+            ? image->GetPointData()->GetScalars()
+            : nullptr;
+        if (scalars == nullptr) {
+            if (error != nullptr) {
+                *error = "The image has no scalars to write";
+            }
+            return false;
+        }
+        this->element_size = scalars->GetDataTypeSize();
+        if (this->element_size != 1 && this->element_size != 2
+            && this->element_size != 4 && this->element_size != 8) {
+            if (error != nullptr) {
+                *error = "Unsupported scalar type";
+            }
+            return false;
+        }
+
+        this->header = {};
+        std::memcpy(
+            this->header.magic,
+            kChunkedVolumeMagic,
+            sizeof(this->header.magic)
+            );
+        this->header.version = kChunkedVolumeVersion;
+        this->header.scalar_type = scalars->GetDataType();
+        this->header.components = scalars->GetNumberOfComponents();
+        this->header.chunk_size = this->chunk_size;
+        for (int axis = 0; axis < 3; ++axis) {
+            this->header.extent[2 * axis] = whole[2 * axis];
+            this->header.extent[2 * axis + 1] = whole[2 * axis + 1];
+            this->counts[axis] =
+                (whole[2 * axis + 1] - whole[2 * axis] + this->chunk_size)
+                / this->chunk_size;
+        }
+        image->GetOrigin(this->header.origin);
+        image->GetSpacing(this->header.spacing);
+        this->header.chunk_count =
+            std::uint64_t(this->counts[0]) * this->counts[1] * this->counts[2];
+        this->voxel_size =
+            std::size_t(this->element_size) * this->header.components;
+
+        this->file.open(this->path, std::ios::binary | std::ios::trunc);
+        if (!this->file) {
+            if (error != nullptr) {
+                *error = "Cannot create '" + this->path + "'";
+            }
+            return false;
+        }
+        this->file.write(
+            reinterpret_cast<const char*>(&this->header),
+            sizeof(this->header)
+            );
+        this->offset = sizeof(this->header);
+        this->index.assign(this->header.chunk_count, ChunkIndexEntry());
+        const std::size_t slab_chunks =
+            std::size_t(this->counts[0]) * this->counts[1];
+        this->gathered.resize(slab_chunks);
+        this->encoded.resize(slab_chunks);
+        this->codecs.resize(slab_chunks);
+
+        return true;
+    }
+
+    int slabCount() const { return this->counts[2]; }
+
+    // Gathers and encodes the chunks of a slab in parallel from an image
+    // covering it, then appends them to the file in chunk order
+    bool writeSlab(vtkImageData* image, int chunk_z, std::string* error)
+    {
+        vtkDataArray* scalars = image->GetPointData()->GetScalars();
+        if (scalars == nullptr
+            || scalars->GetDataType() != this->header.scalar_type
+            || scalars->GetNumberOfComponents() != this->header.components) {
+            if (error != nullptr) {
+                *error = "The scalars changed while the volume was written";
+            }
+            return false;
+        }
+        const auto* voxels = static_cast<const std::uint8_t*>(
+            scalars->GetVoidPointer(0)
+            );
+        int image_extent[6];
+        image->GetExtent(image_extent);
+
+        const std::size_t slab_chunks = this->gathered.size();
+        vtkSMPTools::For(0, static_cast<vtkIdType>(slab_chunks), 1,
+            [&](vtkIdType begin, vtkIdType end) {
+                for (vtkIdType chunk = begin; chunk < end; ++chunk) {
+                    const int position[3] = {
+                        static_cast<int>(chunk % this->counts[0]),
+                        static_cast<int>(chunk / this->counts[0]),
+                        chunk_z
+                    };
+                    int bounds[6];
+                    for (int axis = 0; axis < 3; ++axis) {
+                        bounds[2 * axis] = this->header.extent[2 * axis]
+                            + position[axis] * this->chunk_size;
+                        bounds[2 * axis + 1] = std::min(
+                            bounds[2 * axis] + this->chunk_size - 1,
+                            this->header.extent[2 * axis + 1]
+                            );
+                    }
+                    std::vector<std::uint8_t>& raw = this->gathered[chunk];
+                    gatherChunk(
+                        voxels, image_extent, bounds, this->voxel_size, raw
+                        );
+                    this->codecs[chunk] = !this->compress
+                        ? BrickCodec::Raw
+                        : encodeBrick(
+                            raw.data(),
+                            raw.size() / this->element_size,
+                            this->element_size,
+                            this->header.components,
+                            this->encoded[chunk]
+                            );
+                }
+            });
+
+        for (std::size_t chunk = 0; chunk < slab_chunks; ++chunk) {
+            const std::vector<std::uint8_t>& payload =
+                this->codecs[chunk] == BrickCodec::Raw
+                    ? this->gathered[chunk]
+                    : this->encoded[chunk];
+            ChunkIndexEntry& entry =
+                this->index[chunk_z * slab_chunks + chunk];
+            entry.offset = this->offset;
+            entry.size = payload.size();
+            entry.codec = static_cast<std::uint8_t>(this->codecs[chunk]);
+            this->file.write(
+                reinterpret_cast<const char*>(payload.data()),
+                static_cast<std::streamsize>(entry.size)
+                );
+            this->offset += entry.size;
+            this->raw_bytes += this->gathered[chunk].size();
+        }
+        if (!this->file) {
+            if (error != nullptr) {
+                *error = "Cannot write '" + this->path + "'";
+            }
+            return false;
+        }
+
+        return true;
+    }
+
+    // Appends the index and rewrites the header
+    bool finish(ChunkedWriteStats* stats, std::string* error)
+    {
+        this->header.index_offset = this->offset;
+        this->file.write(
+            reinterpret_cast<const char*>(this->index.data()),
+            static_cast<std::streamsize>(
+                this->index.size() * sizeof(ChunkIndexEntry)
+                )
+            );
+        this->file.seekp(0);
+        this->file.write(
+            reinterpret_cast<const char*>(&this->header),
+            sizeof(this->header)
+            );
+        this->file.close();
+        if (!this->file) {
+            if (error != nullptr) {
+                *error = "Cannot write '" + this->path + "'";
+            }
+            return false;
+        }
+
+        if (stats != nullptr) {
+            stats->chunks = this->header.chunk_count;
+            stats->raw_bytes = this->raw_bytes;
+            stats->stored_bytes = this->offset - sizeof(this->header);
+        }
+        return true;
+    }
+
+private:
+    std::string path;
+    int chunk_size;
+    bool compress;
+    int element_size = 0;
+    std::size_t voxel_size = 0;
+    int counts[3] = {0, 0, 0};
+    ChunkedVolumeHeader header = {};
+    std::ofstream file;
+    std::uint64_t offset = 0;
+    std::uint64_t raw_bytes = 0;
+    std::vector<ChunkIndexEntry> index;
+    std::vector<std::vector<std::uint8_t>> gathered;
+    std::vector<std::vector<std::uint8_t>> encoded;
+    std::vector<BrickCodec> codecs;
+};
+
+}  // namespace
+
+
+// ============================================================================
+// Function Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// writeChunkedVolume
+// ----------------------------------------------------------------------------
+//
+// Description: Writes an image as a chunked volume file, one slab of chunks
+//              at a time so at most one slab is copied at once
+//
+// Inputs:
+// - image: The image
+// - path: Output file
+// - options: Chunk size (at least 1) and compression
+//
+// Outputs:
+// - stats: What was written, if not null
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: Creates or replaces the file
+//
+// ----------------------------------------------------------------------------
+bool writeChunkedVolume(
+    vtkImageData* image,
+    const std::string& path,
+    const ChunkedWriteOptions& options,
+    ChunkedWriteStats* stats,
+    std::string* error
+    )
+{
+    const auto started = Clock::now();
+    if (image == nullptr) {
+        if (error != nullptr) {
+            *error = "No image to write";
+        }
+        return false;
+    }
+    ChunkWriter writer(path, options);
+    if (!writer.begin(image, image->GetExtent(), error)) {
+        return false;
+    }
+    for (int chunk_z = 0; chunk_z < writer.slabCount(); ++chunk_z) {
+        if (!writer.writeSlab(image, chunk_z, error)) {
+            return false;
+        }
+    }
+    if (!writer.finish(stats, error)) {
+        return false;
+    }
+
+    if (stats != nullptr) {
+        stats->seconds = std::chrono::duration<double>(
+            Clock::now() - started).count();
+    }
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// writeChunkedVolume
+// ----------------------------------------------------------------------------
+//
+// Description: Writes an image as a chunked volume file of raw chunks, as
+//              before compression was added
+//
+// Inputs:
+// - image: The image
+// - path: Output file
+// - chunk_size: Edge length of a chunk in voxels (at least 1)
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: Creates or replaces the file
+//
+// ----------------------------------------------------------------------------
+bool writeChunkedVolume(
+    vtkImageData* image,
+    const std::string& path,
+    int chunk_size,
+    std::string* error
+    )
+{
+    ChunkedWriteOptions options;
+    options.chunk_size = chunk_size;
+    options.compress = false;
+    return writeChunkedVolume(image, path, options, nullptr, error);
+}
+
+// ----------------------------------------------------------------------------
+// writeChunkedVolume
+// ----------------------------------------------------------------------------
+//
+// Description: Writes the output of a pipeline as a chunked volume file,
+//              updating the source for one slab of chunks at a time
+//
+// Inputs:
+// - source: Algorithm producing the volume on output port 0
+// - path: Output file
+// - options: Chunk size (at least 1) and compression
+//
+// Outputs:
+// - stats: What was written, if not null
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: Updates the source, creates or replaces the file. The
+//               source's output data is released at the end.
+//
+// ----------------------------------------------------------------------------
+bool writeChunkedVolume(
+    vtkAlgorithm* source,
+    const std::string& path,
+    const ChunkedWriteOptions& options,
+    ChunkedWriteStats* stats,
+    std::string* error
+    )
+{
+    if (source == nullptr) {
+        if (error != nullptr) {
+            *error = "No source to write";
+        }
+        return false;
+    }
+
+    const auto started = Clock::now();
+    source->UpdateInformation();
+    int whole[6];
+    source->GetOutputInformation(0)->Get(
+        vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(),
+        whole
+        );
+    if (whole[1] < whole[0] || whole[3] < whole[2] || whole[5] < whole[4]) {
+        if (error != nullptr) {
+            *error = "The source produces an empty volume";
+        }
+        return false;
+    }
+
+    // The slab extents only depend on the whole extent and the chunk size
+    ChunkWriter writer(path, options);
+    const int chunk_size = std::max(1, options.chunk_size);
+    const int slabs = (whole[5] - whole[4] + chunk_size) / chunk_size;
+    for (int chunk_z = 0; chunk_z < slabs; ++chunk_z) {
+        int slab[6] = {
+            whole[0], whole[1], whole[2], whole[3],
+            whole[4] + chunk_z * chunk_size,
+            std::min(whole[4] + (chunk_z + 1) * chunk_size - 1, whole[5])
+        };
+        source->UpdateExtent(slab);
+
+        auto image = vtkImageData::SafeDownCast(
+            source->GetOutputDataObject(0)
+            );
+        if (image == nullptr) {
+            if (error != nullptr) {
+                *error = "The source does not produce image data";
+            }
+            return false;
+        }
+        if (chunk_z == 0 && !writer.begin(image, whole, error)) {
+            return false;
+        }
+        const int* produced = image->GetExtent();
+        if (produced[4] > slab[4] || produced[5] < slab[5]
+            || produced[0] > whole[0] || produced[1] < whole[1]
+            || produced[2] > whole[2] || produced[3] < whole[3]) {
+            if (error != nullptr) {
+                *error = "The source did not produce the requested extent";
+            }
+            return false;
+        }
+        if (!writer.writeSlab(image, chunk_z, error)) {
+            return false;
+        }
+    }
+    source->GetOutputDataObject(0)->ReleaseData();
+    if (!writer.finish(stats, error)) {
+        return false;
+    }
+
+    if (stats != nullptr) {
+        stats->seconds = std::chrono::duration<double>(
+            Clock::now() - started).count();
+    }
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// isChunkedVolumeFile
+// ----------------------------------------------------------------------------
+//
+// Description: Checks the magic at the start of a file
+//
+// Inputs:
+// - path: The file
+//
+// Outputs: None
+//
+// Returns: true if the file starts with kChunkedVolumeMagic
+//
+// Side Effects: Reads the first bytes of the file
+//
+// ----------------------------------------------------------------------------
+bool isChunkedVolumeFile(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    char magic[sizeof(kChunkedVolumeMagic)];
+    return file.read(magic, sizeof(magic))
+        && std::memcmp(magic, kChunkedVolumeMagic, sizeof(magic)) == 0;
+}
+
+
+// ============================================================================
+// Constructor/Destructor Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// ChunkedVolumeReader::ChunkedVolumeReader
+// ----------------------------------------------------------------------------
+//
+// Description: Constructor. No file is open.
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+ChunkedVolumeReader::ChunkedVolumeReader()
+    : header(),
+      counts{0, 0, 0},
+      voxel_size(0),
+      mapping(nullptr),
+      mapping_size(0),
+#if defined(_WIN32)
+      file_handle(nullptr),
+      file_mapping(nullptr)
+#else
+      descriptor(-1)
+#endif
+{}
+
+// ----------------------------------------------------------------------------
+// ChunkedVolumeReader::~ChunkedVolumeReader
+// ----------------------------------------------------------------------------
+//
+// Description: Destructor. Unmaps the file.
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+ChunkedVolumeReader::~ChunkedVolumeReader()
+{
+    this->close();
+}
+
+
+// ============================================================================
+// Public Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// ChunkedVolumeReader::open
+// ----------------------------------------------------------------------------
+//
+// Description: Maps a chunked volume file read-only and validates its header
+//              and index. The mapping is advised for random access, so the
+//              operating system does not read ahead past the chunks asked
+//              for.
+//
+// Inputs:
+// - path: The file
+//
+// Outputs: None
+//
+// Returns: true on success, false otherwise (see lastError)
+//
+// Side Effects: Closes the previously open file
+//
+// ----------------------------------------------------------------------------
+bool ChunkedVolumeReader::open(const std::string& path)
+{
+    this->close();
+    this->error.clear();
+
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(
+        path.c_str(),
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_FLAG_RANDOM_ACCESS,
+        nullptr
+        );
+    if (file == INVALID_HANDLE_VALUE) {
+        this->error = "Cannot open '" + path + "'";
+        return false;
+    }
+    this->file_handle = file;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        this->error = "'" + path + "' is empty";
+        this->close();
+        return false;
+    }
+    this->mapping_size = static_cast<std::size_t>(size.QuadPart);
+    this->file_mapping = CreateFileMappingA(
+        file,
+        nullptr,
+        PAGE_READONLY,
+        0,
+        0,
+        nullptr
+        );
+    const void* view = this->file_mapping != nullptr
+        ? MapViewOfFile(this->file_mapping, FILE_MAP_READ, 0, 0, 0)
+        : nullptr;
+    if (view == nullptr) {
+        this->error = "Cannot map '" + path + "'";
+        this->close();
+        return false;
+    }
+    this->mapping = static_cast<const std::uint8_t*>(view);
+#else
+    this->descriptor = ::open(path.c_str(), O_RDONLY);
+    if (this->descriptor < 0) {
+        this->error = "Cannot open '" + path + "': " + std::strerror(errno);
+        return false;
+    }
+    struct stat status;
+    if (fstat(this->descriptor, &status) != 0 || status.st_size == 0) {
+        this->error = "'" + path + "' is empty";
+        this->close();
+        return false;
+    }
+    this->mapping_size = static_cast<std::size_t>(status.st_size);
+    void* view = mmap(
+        nullptr,
+        this->mapping_size,
+        PROT_READ,
+        MAP_SHARED,
+        this->descriptor,
+        0
+        );
+    if (view == MAP_FAILED) {
+        this->error = "Cannot map '" + path + "': " + std::strerror(errno);
+        this->close();
+        return false;
+    }
+    madvise(view, this->mapping_size, MADV_RANDOM);
+    this->mapping = static_cast<const std::uint8_t*>(view);
+#endif
+
+    this->file_path = path;
+    if (!this->validate()) {
+        this->error = "'" + path + "' " + this->error;
+        this->close();
+        return false;
+    }
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// ChunkedVolumeReader::close
+// ----------------------------------------------------------------------------
+//
+// Description: Unmaps the file. Images read before stay valid, they never
+//              point into the mapping.
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void ChunkedVolumeReader::close()
+{
+#if defined(_WIN32)
+    if (this->mapping != nullptr) {
+        UnmapViewOfFile(this->mapping);
+    }
+    if (this->file_mapping != nullptr) {
+        CloseHandle(this->file_mapping);
+        this->file_mapping = nullptr;
+    }
+    if (this->file_handle != nullptr) {
+        CloseHandle(this->file_handle);
+        this->file_handle = nullptr;
+    }
+#else
+    if (this->mapping != nullptr) {
+        munmap(const_cast<std::uint8_t*>(this->mapping), this->mapping_size);
+    }
+    if (this->descriptor >= 0) {
+        ::close(this->descriptor);
+        this->descriptor = -1;
+    }
+#endif
+    this->mapping = nullptr;
+    this->mapping_size = 0;
+    this->file_path.clear();
+    this->index.clear();
+}
+
+// ----------------------------------------------------------------------------
+// ChunkedVolumeReader::uncompressedBytes
+// ----------------------------------------------------------------------------
+//
+// Description: Returns the size of the voxels of the volume
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: Size in bytes, 0 without a file
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+std::uint64_t ChunkedVolumeReader::uncompressedBytes() const
+{
+    return this->isOpen()
+        ? std::uint64_t(extentVoxels(this->header.extent)) * this->voxel_size
+        : 0;
+}
+
+// ----------------------------------------------------------------------------
+// ChunkedVolumeReader::storedBytes
+// ----------------------------------------------------------------------------
+//
+// Description: Returns the size of the chunk payloads in the file
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: Size in bytes, 0 without a file
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+std::uint64_t ChunkedVolumeReader::storedBytes() const
+{
+    std::uint64_t bytes = 0;
+    for (const ChunkIndexEntry& entry : this->index) {
+        bytes += entry.size;
+    }
+    return bytes;
+}
+
+// ----------------------------------------------------------------------------
+// ChunkedVolumeReader::readRegion
+// ----------------------------------------------------------------------------
+//
+// Description: Decodes a sub-volume. Only the chunks overlapping the region
+//              are read; they are decoded in parallel, each into a buffer
+//              of its own thread (raw chunks are scattered straight from
+//              the mapping), and their overlap is copied into the output.
+//
+// Inputs:
+// - region: Extent to read, clamped to the extent of the volume
+//
+// Outputs:
+// - output: Gets the clamped extent, the geometry of the volume and newly
+//           allocated scalars
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false if no file is open, the region misses
+//          the volume or a chunk is corrupt
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool ChunkedVolumeReader::readRegion(
+    const int region[6],
+    vtkImageData* output,
+    std::string* error
+    ) const
+{
+    if (!this->isOpen() || output == nullptr) {
+        if (error != nullptr) {
+            *error = "No chunked volume is open";
+        }
+        return false;
+    }
+
+    const int* whole = this->header.extent;
+    const int size = this->header.chunk_size;
+    int clamped[6];
+    int first[3];
+    int last[3];
+    for (int axis = 0; axis < 3; ++axis) {
+        clamped[2 * axis] = std::max(region[2 * axis], whole[2 * axis]);
+        clamped[2 * axis + 1] = std::min(
+            region[2 * axis + 1],
+            whole[2 * axis + 1]
+            );
+        if (clamped[2 * axis + 1] < clamped[2 * axis]) {
+            if (error != nullptr) {
+                *error = "The region is outside the volume";
+            }
+            return false;
+        }
+        first[axis] = (clamped[2 * axis] - whole[2 * axis]) / size;
+        last[axis] = (clamped[2 * axis + 1] - whole[2 * axis]) / size;
+    }
+
+    output->SetExtent(clamped);
+    output->SetOrigin(this->header.origin[0], this->header.origin[1],
+        this->header.origin[2]);
+    output->SetSpacing(this->header.spacing[0], this->header.spacing[1],
+        this->header.spacing[2]);
+    output->AllocateScalars(this->header.scalar_type, this->header.components);
+    auto* voxels = static_cast<std::uint8_t*>(
+        output->GetPointData()->GetScalars()->GetVoidPointer(0)
+        );
+
+    std::vector<std::size_t> touched;
+    for (int z = first[2]; z <= last[2]; ++z) {
+        for (int y = first[1]; y <= last[1]; ++y) {
+            for (int x = first[0]; x <= last[0]; ++x) {
+                touched.push_back(
+                    (std::size_t(z) * this->counts[1] + y) * this->counts[0]
+                    + x
+                    );
+            }
+        }
+    }
+
+    std::atomic<bool> failed(false);
+    vtkSMPTools::For(0, static_cast<vtkIdType>(touched.size()), 1,
+        [&](vtkIdType begin, vtkIdType end) {
+            std::vector<std::uint8_t> decoded;
+            for (vtkIdType i = begin; i < end && !failed; ++i) {
+                const std::size_t chunk = touched[i];
+                const ChunkIndexEntry& entry = this->index[chunk];
+                int bounds[6];
+                this->chunkExtent(chunk, bounds);
+
+                const std::uint8_t* source = this->mapping + entry.offset;
+                if (static_cast<BrickCodec>(entry.codec) != BrickCodec::Raw) {
+                    decoded.resize(extentVoxels(bounds) * this->voxel_size);
+                    if (!this->decodeChunk(chunk, decoded.data())) {
+                        failed = true;
+                        break;
+                    }
+                    source = decoded.data();
+                }
+                scatterChunk(
+                    source, bounds, voxels, clamped, this->voxel_size
+                    );
+            }
+        });
+    if (failed) {
+        if (error != nullptr) {
+            *error = "'" + this->file_path + "' has a corrupt chunk";
+        }
+        return false;
+    }
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// ChunkedVolumeReader::readChunk
+// ----------------------------------------------------------------------------
+//
+// Description: Decodes one chunk
+//
+// Inputs:
+// - chunk: Index of the chunk, x fastest
+//
+// Outputs:
+// - voxels: The voxels of the chunk, x fastest
+// - chunk_extent: Extent of the chunk
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false for a bad index or a corrupt chunk
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool ChunkedVolumeReader::readChunk(
+    std::size_t chunk,
+    std::vector<std::uint8_t>& voxels,
+    int chunk_extent[6],
+    std::string* error
+    ) const
+{
+    if (chunk >= this->index.size()) {
+        if (error != nullptr) {
+            *error = "No chunk " + std::to_string(chunk);
+        }
+        return false;
+    }
+
+    this->chunkExtent(chunk, chunk_extent);
+    voxels.resize(extentVoxels(chunk_extent) * this->voxel_size);
+    if (!this->decodeChunk(chunk, voxels.data())) {
+        if (error != nullptr) {
+            *error = "'" + this->file_path + "' has a corrupt chunk";
+        }
+        return false;
+    }
+
+    return true;
+}
+
+
+// ============================================================================
+// Private Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// ChunkedVolumeReader::validate
+// ----------------------------------------------------------------------------
+//
+// Description: Checks the header and that every index entry lies between
+//              the header and the index, so reads never leave the mapping
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: true if the file is usable, false otherwise (see error)
+//
+// Side Effects: Copies the header and the index
+//
+// ----------------------------------------------------------------------------
+bool ChunkedVolumeReader::validate()
+{
+    if (this->mapping_size < sizeof(ChunkedVolumeHeader)) {
+        this->error = "is too short";
+        return false;
+    }
+    std::memcpy(&this->header, this->mapping, sizeof(this->header));
+    if (std::memcmp(
+            this->header.magic,
+            kChunkedVolumeMagic,
+            sizeof(kChunkedVolumeMagic)
+            ) != 0) {
+        this->error = "is not a chunked volume";
+        return false;
+    }
+    if (this->header.version != kChunkedVolumeVersion) {
+        this->error = "has unsupported version "
+            + std::to_string(this->header.version);
+        return false;
+    }
+
+    const int element_size =
+        vtkDataArray::GetDataTypeSize(this->header.scalar_type);
+    bool valid = (element_size == 1 || element_size == 2
+            || element_size == 4 || element_size == 8)
+        && this->header.components > 0
+        && this->header.chunk_size > 0;
+    std::uint64_t chunk_count = 1;
+    for (int axis = 0; axis < 3 && valid; ++axis) {
+        const int* range = this->header.extent + 2 * axis;
+        valid = range[1] >= range[0];
+        if (valid) {
+            this->counts[axis] = static_cast<int>(
+                (std::int64_t(range[1]) - range[0] + this->header.chunk_size)
+                / this->header.chunk_size
+                );
+            chunk_count *= std::uint64_t(this->counts[axis]);
+        }
+    }
+    if (!valid || chunk_count != this->header.chunk_count) {
+        this->error = "has an invalid header";
+        return false;
+    }
+    this->voxel_size = std::size_t(element_size) * this->header.components;
+
+    const std::uint64_t index_offset = this->header.index_offset;
+    if (index_offset < sizeof(ChunkedVolumeHeader)
+        || index_offset > this->mapping_size
+        || chunk_count
+            > (this->mapping_size - index_offset) / sizeof(ChunkIndexEntry)) {
+        this->error = "is truncated";
+        return false;
+    }
+    this->index.resize(chunk_count);
+    std::memcpy(
+        this->index.data(),
+        this->mapping + index_offset,
+        this->index.size() * sizeof(ChunkIndexEntry)
+        );
+
+    for (std::size_t chunk = 0; chunk < this->index.size(); ++chunk) {
+        const ChunkIndexEntry& entry = this->index[chunk];
+        int bounds[6];
+        this->chunkExtent(chunk, bounds);
+        if (entry.offset < sizeof(ChunkedVolumeHeader)
+            || entry.offset > index_offset
+            || entry.size > index_offset - entry.offset
+            || entry.codec > static_cast<std::uint8_t>(BrickCodec::DeltaLz4)
+            || (entry.codec == static_cast<std::uint8_t>(BrickCodec::Raw)
+                && entry.size != extentVoxels(bounds) * this->voxel_size)) {
+            this->error = "has an invalid index entry for chunk "
+                + std::to_string(chunk);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// ChunkedVolumeReader::chunkExtent
+// ----------------------------------------------------------------------------
+//
+// Description: Computes the extent of a chunk from its index
+//
+// Inputs:
+// - chunk: Index of the chunk, x fastest
+//
+// Outputs:
+// - chunk_extent: Extent of the chunk, clipped to the volume
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void ChunkedVolumeReader::chunkExtent(
+    std::size_t chunk,
+    int chunk_extent[6]
+    ) const
+{
+    const std::size_t slab = std::size_t(this->counts[0]) * this->counts[1];
+    const int position[3] = {
+        static_cast<int>(chunk % this->counts[0]),
+        static_cast<int>(chunk % slab / this->counts[0]),
+        static_cast<int>(chunk / slab)
+    };
+    const int size = this->header.chunk_size;
+    for (int axis = 0; axis < 3; ++axis) {
+        chunk_extent[2 * axis] =
+            this->header.extent[2 * axis] + position[axis] * size;
+        chunk_extent[2 * axis + 1] = std::min(
+            chunk_extent[2 * axis] + size - 1,
+            this->header.extent[2 * axis + 1]
+            );
+    }
+}
+
+// ----------------------------------------------------------------------------
+// ChunkedVolumeReader::decodeChunk
+// ----------------------------------------------------------------------------
+//
+// Description: Decodes a chunk from the mapping
+//
+// Inputs:
+// - chunk: Index of the chunk
+//
+// Outputs:
+// - voxels: Buffer for the voxels of the chunk
+//
+// Returns: false if the payload is corrupt or its codec not available
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool ChunkedVolumeReader::decodeChunk(
+    std::size_t chunk,
+    std::uint8_t* voxels
+    ) const
+{
+    const ChunkIndexEntry& entry = this->index[chunk];
+    int bounds[6];
+    this->chunkExtent(chunk, bounds);
+    const int element_size =
+        vtkDataArray::GetDataTypeSize(this->header.scalar_type);
+
+    return decodeBrick(
+        static_cast<BrickCodec>(entry.codec),
+        this->mapping + entry.offset,
+        static_cast<std::size_t>(entry.size),
+        extentVoxels(bounds) * this->header.components,
+        element_size,
+        this->header.components,
+        voxels
+        );
+}
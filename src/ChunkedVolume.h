@@ -0,0 +1,397 @@
+// ============================================================================
+// ChunkedVolume.h - Chunked on-disk volume format
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * ChunkedVolume.h: created.
+// * ChunkedVolume.h: added compressed chunks, streamed writing and the
+//   memory-mapped ChunkedVolumeReader.
+// * ChunkedVolume.h: kept the writeChunkedVolume overload taking a chunk
+//   size, for source compatibility.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// A chunked volume file holds one volume split into cubic chunks, so a
+// reader can fetch any region by reading only the chunks it touches:
+//
+//   ChunkedVolumeHeader            at offset 0
+//   chunk payloads                 in chunk order, x fastest
+//   ChunkIndexEntry[chunk_count]   at index_offset
+//
+// Chunks on the high faces of the volume can be smaller than chunk_size;
+// their voxels are packed without padding, x fastest, components
+// interleaved, and then encoded with the BrickCodec of their index entry.
+// Integers and doubles are in host byte order.
+//
+// ============================================================================
+
+
+#ifndef ChunkedVolume_H
+#define ChunkedVolume_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Standard Library headers
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// External libraries headers
+#include <vtkAlgorithm.h>
+#include <vtkImageData.h>
+
+// Project headers
+#include "BrickCodec.h"
+
+
+// ============================================================================
+// Global constants section
+// ============================================================================
+
+constexpr char kChunkedVolumeMagic[8] = {
+    'Q', 'V', 'T', 'K', 'C', 'H', 'K', '1'
+};
+constexpr std::uint32_t kChunkedVolumeVersion = 1;
+constexpr int kDefaultChunkSize = 64;
+
+
+// ============================================================================
+// Structure Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// ChunkedVolumeHeader
+// ----------------------------------------------------------------------------
+//
+// Description: Starts every chunked volume file
+//
+// Properties:
+// - magic: Must equal kChunkedVolumeMagic
+// - version: Format version, kChunkedVolumeVersion
+// - scalar_type: VTK scalar type
+// - components: Scalar components per voxel
+// - chunk_size: Edge length of a chunk in voxels
+// - extent: Whole extent of the volume
+// - origin, spacing: Geometry of the volume
+// - chunk_count: Number of chunks
+// - index_offset: Offset of the chunk index from the start of the file
+//
+// ----------------------------------------------------------------------------
+struct ChunkedVolumeHeader {
+    char          magic[8];
+    std::uint32_t version;
+    std::int32_t  scalar_type;
+    std::int32_t  components;
+    std::int32_t  chunk_size;
+    std::int32_t  extent[6];
+    double        origin[3];
+    double        spacing[3];
+    std::uint64_t chunk_count;
+    std::uint64_t index_offset;
+};
+
+static_assert(sizeof(ChunkedVolumeHeader) == 112, "unexpected padding");
+
+// ----------------------------------------------------------------------------
+// ChunkIndexEntry
+// ----------------------------------------------------------------------------
+//
+// Description: Where a chunk is stored and how
+//
+// Properties:
+// - offset: Offset of the payload from the start of the file
+// - size: Size of the payload in bytes
+// - codec: A BrickCodec
+// - reserved: Zero
+//
+// ----------------------------------------------------------------------------
+struct ChunkIndexEntry {
+    std::uint64_t offset;
+    std::uint64_t size;
+    std::uint8_t  codec;
+    std::uint8_t  reserved[7];
+};
+
+static_assert(sizeof(ChunkIndexEntry) == 24, "unexpected padding");
+
+
+// ----------------------------------------------------------------------------
+// ChunkedWriteOptions
+// ----------------------------------------------------------------------------
+//
+// Description: How writeChunkedVolume stores a volume
+//
+// Properties:
+// - chunk_size: Edge length of a chunk in voxels
+// - compress: Whether chunks are encoded with encodeBrick; chunks that do
+//             not compress are stored raw either way
+//
+// ----------------------------------------------------------------------------
+struct ChunkedWriteOptions {
+    int chunk_size = kDefaultChunkSize;
+    bool compress = true;
+};
+
+// ----------------------------------------------------------------------------
+// ChunkedWriteStats
+// ----------------------------------------------------------------------------
+//
+// Description: What writeChunkedVolume did
+//
+// Properties:
+// - chunks: Chunks written
+// - raw_bytes: Size of the voxels
+// - stored_bytes: Size of the chunk payloads in the file
+// - seconds: Wall clock time of the write
+//
+// ----------------------------------------------------------------------------
+struct ChunkedWriteStats {
+    std::uint64_t chunks = 0;
+    std::uint64_t raw_bytes = 0;
+    std::uint64_t stored_bytes = 0;
+    double seconds = 0.0;
+};
+
+
+// ============================================================================
+// Function Declarations Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// writeChunkedVolume
+// ----------------------------------------------------------------------------
+//
+// Description: Writes an image as a chunked volume file. Chunks are
+//              gathered and encoded one slab of chunks at a time, in
+//              parallel, and written in chunk order.
+//
+// Inputs:
+// - image: The image
+// - path: Output file
+// - options: Chunk size and compression
+//
+// Outputs:
+// - stats: What was written, if not null
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: Creates or replaces the file
+//
+// ----------------------------------------------------------------------------
+bool writeChunkedVolume(
+    vtkImageData* image,
+    const std::string& path,
+    const ChunkedWriteOptions& options = ChunkedWriteOptions(),
+    ChunkedWriteStats* stats = nullptr,
+    std::string* error = nullptr
+    );
+
+// ----------------------------------------------------------------------------
+// writeChunkedVolume
+// ----------------------------------------------------------------------------
+//
+// Description: Writes an image as a chunked volume file of raw chunks. The
+//              signature of QTVTK_CORE_VERSION 1.0, kept so existing callers
+//              build unchanged; new code passes ChunkedWriteOptions.
+//
+// Inputs:
+// - image: The image
+// - path: Output file
+// - chunk_size: Edge length of a chunk in voxels
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: Creates or replaces the file
+//
+// ----------------------------------------------------------------------------
+bool writeChunkedVolume(
+    vtkImageData* image,
+    const std::string& path,
+    int chunk_size,
+    std::string* error = nullptr
+    );
+
+// ----------------------------------------------------------------------------
+// writeChunkedVolume
+// ----------------------------------------------------------------------------
+//
+// Description: Writes the output of a pipeline as a chunked volume file,
+//              requesting one slab of chunks at a time from the source
+//              (like BrickedVolume::fromSource), so a volume larger than
+//              memory can be converted from any streaming reader
+//
+// Inputs:
+// - source: Algorithm producing the volume on output port 0
+// - path: Output file
+// - options: Chunk size and compression
+//
+// Outputs:
+// - stats: What was written, if not null
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: Updates the source, creates or replaces the file
+//
+// ----------------------------------------------------------------------------
+bool writeChunkedVolume(
+    vtkAlgorithm* source,
+    const std::string& path,
+    const ChunkedWriteOptions& options = ChunkedWriteOptions(),
+    ChunkedWriteStats* stats = nullptr,
+    std::string* error = nullptr
+    );
+
+// Returns whether a file starts with the chunked volume magic
+bool isChunkedVolumeFile(const std::string& path);
+
+
+// ============================================================================
+// Class Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// ChunkedVolumeReader
+// ----------------------------------------------------------------------------
+//
+// Description: Random access to a chunked volume file. The file is mapped
+//              read-only and its header and index are validated once;
+//              reading a region then touches only the chunks it overlaps,
+//              which are decoded in parallel straight from the mapping and
+//              scattered into the output. Raw chunks are copied without an
+//              intermediate buffer. Nothing is cached beyond what the
+//              operating system keeps of the mapping, so a reader costs
+//              little more than its index. Reads do not modify the reader
+//              and may run concurrently.
+//
+// Properties:
+// - file_path: The open file
+// - header: Copy of the file header
+// - index: Copy of the chunk index
+// - counts: Chunks along each axis
+// - voxel_size: Bytes per voxel
+// - mapping, mapping_size: The mapped file
+// - file_mapping / descriptor: Platform mapping handles
+// - error: Description of the last failure to open
+//
+// Methods:
+// - open: Maps and validates a file
+// - close: Unmaps the file
+// - extent, origin, spacing, scalarType, components, chunkSize,
+//   chunkCount, chunkEntry: Describe the volume
+// - uncompressedBytes, storedBytes: Size of the voxels and of the payloads
+// - readRegion: Decodes a sub-volume into an image
+// - readChunk: Decodes one chunk
+// - lastError: Returns why open failed
+//
+// Example usage:
+//   ChunkedVolumeReader reader;
+//   if (!reader.open("head.qvc")) {
+//       std::cerr << reader.lastError() << "\n";
+//   }
+//   const int region[6] = {0, 127, 0, 127, 40, 40};
+//   auto slice = vtkSmartPointer<vtkImageData>::New();
+//   reader.readRegion(region, slice);
+//
+// ----------------------------------------------------------------------------
+class ChunkedVolumeReader
+{
+public:
+    // Constructor/Destructor
+    ChunkedVolumeReader();
+    ~ChunkedVolumeReader();
+
+    ChunkedVolumeReader(const ChunkedVolumeReader&) = delete;
+    ChunkedVolumeReader& operator=(const ChunkedVolumeReader&) = delete;
+
+    bool open(const std::string& path);  // Closes the previous file
+    void close();
+    bool isOpen() const { return this->mapping != nullptr; }
+    const std::string& path() const { return this->file_path; }
+
+    const int* extent() const { return this->header.extent; }
+    const double* origin() const { return this->header.origin; }
+    const double* spacing() const { return this->header.spacing; }
+    int scalarType() const { return this->header.scalar_type; }
+    int components() const { return this->header.components; }
+    int chunkSize() const { return this->header.chunk_size; }
+    std::size_t chunkCount() const { return this->index.size(); }
+    const ChunkIndexEntry& chunkEntry(std::size_t chunk) const
+    {
+        return this->index[chunk];
+    }
+    std::uint64_t uncompressedBytes() const;
+    std::uint64_t storedBytes() const;
+
+    // The region is clamped to the extent; false if nothing is left of it
+    bool readRegion(
+        const int region[6],
+        vtkImageData* output,
+        std::string* error = nullptr
+        ) const;
+    bool readChunk(
+        std::size_t chunk,
+        std::vector<std::uint8_t>& voxels,
+        int chunk_extent[6],
+        std::string* error = nullptr
+        ) const;
+
+    const std::string& lastError() const { return this->error; }
+
+private:
+    bool validate();  // Checks the header and every index entry
+    void chunkExtent(std::size_t chunk, int chunk_extent[6]) const;
+    bool decodeChunk(std::size_t chunk, std::uint8_t* voxels) const;
+
+    std::string file_path;
+    ChunkedVolumeHeader header;
+    std::vector<ChunkIndexEntry> index;
+    int counts[3];
+    std::size_t voxel_size;
+
+    // Platform mapping handles
+    const std::uint8_t* mapping;
+    std::size_t mapping_size;
+#if defined(_WIN32)
+    void* file_handle;
+    void* file_mapping;
+#else
+    int descriptor;
+#endif
+
+    std::string error;
+};
+
+#endif  // ChunkedVolume_H
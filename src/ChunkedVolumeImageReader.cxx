@@ -0,0 +1,252 @@
+// ============================================================================
+// ChunkedVolumeImageReader.cxx - Implementation of ChunkedVolumeImageReader
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * ChunkedVolumeImageReader.cxx: created.
+// * ChunkedVolumeImageReader.cxx: added createVolumeReader.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header -------------------------------------------------------------
+#include "ChunkedVolumeImageReader.h"
+
+// "C" system headers ---------------------------------------------------------
+
+// Standard Library headers ---------------------------------------------------
+#include <algorithm>
+#include <cctype>
+#include <mutex>
+#include <string>
+
+// External libraries headers -------------------------------------------------
+
+// VTK headers
+#include <vtkDICOMImageReader.h>
+#include <vtkDataArray.h>
+#include <vtkErrorCode.h>
+#include <vtkImageData.h>
+#include <vtkImageReader2Factory.h>
+#include <vtkInformation.h>
+#include <vtkNew.h>
+#include <vtkNrrdReader.h>
+#include <vtkObjectFactory.h>
+#include <vtkPointData.h>
+#include <vtkStreamingDemandDrivenPipeline.h>
+
+
+vtkStandardNewMacro(ChunkedVolumeImageReader);
+
+
+// ============================================================================
+// Function Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// createVolumeReader
+// ----------------------------------------------------------------------------
+//
+// Description: Picks the reader of a volume image file. vtkImageReader2Factory
+//              knows neither NRRD nor DICOM, so those are chosen by the file
+//              extension; everything else goes to the factory, with chunked
+//              volume files registered.
+//
+// Inputs:
+// - path: The file
+//
+// Outputs: None
+//
+// Returns: The reader, without its file name set, or null if no reader
+//          reads the file
+//
+// Side Effects: Registers ChunkedVolumeImageReader with the factory
+//
+// ----------------------------------------------------------------------------
+vtkSmartPointer<vtkImageReader2> createVolumeReader(const std::string& path)
+{
+    const std::size_t dot = path.find_last_of('.');
+    std::string extension = dot == std::string::npos
+        ? std::string()
+        : path.substr(dot + 1);
+    std::transform(
+        extension.begin(),
+        extension.end(),
+        extension.begin(),
+        [](unsigned char c) { return static_cast<char>(std::tolower(c)); }
+        );
+
+    vtkSmartPointer<vtkImageReader2> reader;
+    if (extension == "nrrd" || extension == "nhdr") {
+        reader = vtkSmartPointer<vtkNrrdReader>::New();
+    } else if (extension == "dcm") {
+        reader = vtkSmartPointer<vtkDICOMImageReader>::New();
+    } else {
+        ChunkedVolumeImageReader::RegisterWithFactory();
+        reader.TakeReference(
+            vtkImageReader2Factory::CreateImageReader2(path.c_str())
+            );
+    }
+
+    return reader;
+}
+
+
+// ============================================================================
+// Public Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// ChunkedVolumeImageReader::RegisterWithFactory
+// ----------------------------------------------------------------------------
+//
+// Description: Registers the reader with vtkImageReader2Factory, so
+//              CreateImageReader2 returns one for chunked volume files.
+//              Safe to call more than once and from any thread.
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Adds a reader to the factory's list
+//
+// ----------------------------------------------------------------------------
+void ChunkedVolumeImageReader::RegisterWithFactory()
+{
+    static std::once_flag registered;
+    std::call_once(registered, []() {
+        vtkNew<ChunkedVolumeImageReader> reader;
+        vtkImageReader2Factory::RegisterReader(reader);
+    });
+}
+
+// ----------------------------------------------------------------------------
+// ChunkedVolumeImageReader::CanReadFile
+// ----------------------------------------------------------------------------
+//
+// Description: Tells the factory whether a file is a chunked volume
+//
+// Inputs:
+// - file_name: The file
+//
+// Outputs: None
+//
+// Returns: 3 (certainly) if the file starts with the chunked volume magic,
+//          0 otherwise
+//
+// Side Effects: Reads the first bytes of the file
+//
+// ----------------------------------------------------------------------------
+int ChunkedVolumeImageReader::CanReadFile(const char* file_name)
+{
+    return file_name != nullptr && isChunkedVolumeFile(file_name) ? 3 : 0;
+}
+
+
+// ============================================================================
+// Protected Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// ChunkedVolumeImageReader::ExecuteInformation
+// ----------------------------------------------------------------------------
+//
+// Description: Maps the file and publishes its extent, geometry and scalar
+//              type, which vtkImageReader2 passes down the pipeline along
+//              with the ability to produce any sub-extent. The file is
+//              mapped again on every call, so a rewritten file is picked up.
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Sets the error code if the file cannot be opened
+//
+// ----------------------------------------------------------------------------
+void ChunkedVolumeImageReader::ExecuteInformation()
+{
+    if (this->FileName == nullptr || !this->file.open(this->FileName)) {
+        vtkErrorMacro(<< (this->FileName == nullptr
+            ? std::string("No file name set")
+            : this->file.lastError()));
+        this->SetErrorCode(vtkErrorCode::FileFormatError);
+        return;
+    }
+
+    const int* extent = this->file.extent();
+    this->SetDataExtent(
+        extent[0], extent[1], extent[2], extent[3], extent[4], extent[5]
+        );
+    const double* origin = this->file.origin();
+    this->SetDataOrigin(origin[0], origin[1], origin[2]);
+    const double* spacing = this->file.spacing();
+    this->SetDataSpacing(spacing[0], spacing[1], spacing[2]);
+    this->SetDataScalarType(this->file.scalarType());
+    this->SetNumberOfScalarComponents(this->file.components());
+    this->SetFileDimensionality(3);
+}
+
+// ----------------------------------------------------------------------------
+// ChunkedVolumeImageReader::ExecuteDataWithInformation
+// ----------------------------------------------------------------------------
+//
+// Description: Decodes the update extent into the output image
+//
+// Inputs:
+// - out_info: Output information holding the update extent
+//
+// Outputs:
+// - output: The image
+//
+// Returns: None
+//
+// Side Effects: Sets the error code if a chunk cannot be decoded
+//
+// ----------------------------------------------------------------------------
+void ChunkedVolumeImageReader::ExecuteDataWithInformation(
+    vtkDataObject* output,
+    vtkInformation* out_info
+    )
+{
+    vtkImageData* image = vtkImageData::SafeDownCast(output);
+    int extent[6];
+    out_info->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), extent);
+
+    std::string reason;
+    if (image == nullptr || !this->file.readRegion(extent, image, &reason)) {
+        vtkErrorMacro(<< reason);
+        this->SetErrorCode(vtkErrorCode::FileFormatError);
+        return;
+    }
+    image->GetPointData()->GetScalars()->SetName("ImageFile");
+}
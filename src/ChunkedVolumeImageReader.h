@@ -0,0 +1,129 @@
+// ============================================================================
+// ChunkedVolumeImageReader.h - VTK reader of chunked volume files
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * ChunkedVolumeImageReader.h: created.
+// * ChunkedVolumeImageReader.h: added createVolumeReader.
+//
+// ============================================================================
+
+
+#ifndef ChunkedVolumeImageReader_H
+#define ChunkedVolumeImageReader_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Standard Library headers
+#include <string>
+
+// External libraries headers
+#include <vtkImageReader2.h>
+#include <vtkSmartPointer.h>
+
+// Project headers
+#include "ChunkedVolume.h"
+
+
+// ============================================================================
+// Function Declarations Section
+// ============================================================================
+
+// Returns a reader for a volume image file, without its file name set:
+// vtkNrrdReader for .nrrd and .nhdr, vtkDICOMImageReader for single .dcm
+// files and whatever vtkImageReader2Factory finds for anything else
+// (MetaImage, TIFF, chunked volumes, ...). Null if nothing reads the file.
+vtkSmartPointer<vtkImageReader2> createVolumeReader(const std::string& path);
+
+
+// ============================================================================
+// Class Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// ChunkedVolumeImageReader
+// ----------------------------------------------------------------------------
+//
+// Description: Reads chunked volume files (.qvc) through the IOImage reader
+//              interface, so they open wherever vtkImageReader2Factory is
+//              used. The file is mapped by a ChunkedVolumeReader when the
+//              pipeline asks for information, and RequestData decodes only
+//              the chunks of the update extent: a slice mapper with
+//              streaming on, or BrickedVolume::fromSource reading slab by
+//              slab, never decompresses the whole file.
+//
+// Properties:
+// - file: The mapped file
+//
+// Methods:
+// - RegisterWithFactory: Adds the reader to vtkImageReader2Factory, once
+// - CanReadFile: Checks the magic of a file
+// - GetFileExtensions, GetDescriptiveName: Describe the format
+//
+// Example usage:
+//   ChunkedVolumeImageReader::RegisterWithFactory();
+//   vtkSmartPointer<vtkImageReader2> reader;
+//   reader.TakeReference(
+//       vtkImageReader2Factory::CreateImageReader2("head.qvc")
+//       );
+//   reader->SetFileName("head.qvc");
+//   slice_mapper->SetInputConnection(reader->GetOutputPort());
+//
+// ----------------------------------------------------------------------------
+class ChunkedVolumeImageReader : public vtkImageReader2
+{
+public:
+    static ChunkedVolumeImageReader* New();
+    vtkTypeMacro(ChunkedVolumeImageReader, vtkImageReader2);
+
+    static void RegisterWithFactory();
+
+    int CanReadFile(const char* file_name) override;
+    const char* GetFileExtensions() override { return ".qvc"; }
+    const char* GetDescriptiveName() override
+    {
+        return "QtVTKFramework chunked volume";
+    }
+
+protected:
+    ChunkedVolumeImageReader() = default;
+    ~ChunkedVolumeImageReader() override = default;
+
+    void ExecuteInformation() override;
+    void ExecuteDataWithInformation(
+        vtkDataObject* output,
+        vtkInformation* out_info
+        ) override;
+
+private:
+    ChunkedVolumeImageReader(const ChunkedVolumeImageReader&) = delete;
+    void operator=(const ChunkedVolumeImageReader&) = delete;
+
+    ChunkedVolumeReader file;
+};
+
+#endif  // ChunkedVolumeImageReader_H
@@ -0,0 +1,228 @@
+// ============================================================================
+// EventDispatcher.cxx - Implementation of the EventDispatcher class
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * EventDispatcher.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header -------------------------------------------------------------
+#include "EventDispatcher.h"
+
+// "C" system headers ---------------------------------------------------------
+
+// Standard Library headers ---------------------------------------------------
+#include <utility>
+
+
+// ============================================================================
+// Constructor/Destructor Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// EventDispatcher::EventDispatcher
+// ----------------------------------------------------------------------------
+//
+// Description: Constructor
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+EventDispatcher::EventDispatcher()
+    : next_id(1)
+{
+}
+
+// ----------------------------------------------------------------------------
+// EventDispatcher::~EventDispatcher
+// ----------------------------------------------------------------------------
+//
+// Description: Destructor
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Removes all observers this dispatcher added
+//
+// ----------------------------------------------------------------------------
+EventDispatcher::~EventDispatcher()
+{
+    this->disconnectAll();
+}
+
+
+// ============================================================================
+// Public Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// EventDispatcher::connect
+// ----------------------------------------------------------------------------
+//
+// Description: Calls the handler every time the subject fires the event
+//
+// Inputs:
+// - subject: The VTK object to observe
+// - event: The event id, e.g. vtkCommand::EndEvent
+// - handler: The callable to run
+// - priority: Observer priority, higher runs first
+//
+// Outputs: None
+//
+// Returns: Connection id for disconnect, 0 if subject is null
+//
+// Side Effects: Adds an observer to the subject
+//
+// ----------------------------------------------------------------------------
+unsigned long EventDispatcher::connect(
+    vtkObject* subject,
+    unsigned long event,
+    Handler handler,
+    float priority
+    )
+{
+    if (subject == nullptr || !handler) {
+        return 0;
+    }
+
+    Connection connection;
+    connection.subject = subject;
+    connection.handler = std::make_unique<Handler>(std::move(handler));
+    connection.command = vtkSmartPointer<vtkCallbackCommand>::New();
+    connection.command->SetCallback(&EventDispatcher::forward);
+    connection.command->SetClientData(connection.handler.get());
+    connection.tag = subject->AddObserver(
+        event,
+        connection.command,
+        priority
+        );
+
+    const unsigned long id = this->next_id++;
+    this->connections.emplace(id, std::move(connection));
+
+    return id;
+}
+
+// ----------------------------------------------------------------------------
+// EventDispatcher::disconnect
+// ----------------------------------------------------------------------------
+//
+// Description: Removes one connection
+//
+// Inputs:
+// - id: Connection id returned by connect
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Removes the observer from the subject, if it is still alive
+//
+// ----------------------------------------------------------------------------
+void EventDispatcher::disconnect(unsigned long id)
+{
+    auto found = this->connections.find(id);
+    if (found == this->connections.end()) {
+        return;
+    }
+
+    if (found->second.subject != nullptr) {
+        found->second.subject->RemoveObserver(found->second.tag);
+    }
+    this->connections.erase(found);
+}
+
+// ----------------------------------------------------------------------------
+// EventDispatcher::disconnectAll
+// ----------------------------------------------------------------------------
+//
+// Description: Removes all connections
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Removes the observers from the subjects still alive
+//
+// ----------------------------------------------------------------------------
+void EventDispatcher::disconnectAll()
+{
+    for (auto& entry : this->connections) {
+        if (entry.second.subject != nullptr) {
+            entry.second.subject->RemoveObserver(entry.second.tag);
+        }
+    }
+    this->connections.clear();
+}
+
+
+// ============================================================================
+// Private Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// EventDispatcher::forward
+// ----------------------------------------------------------------------------
+//
+// Description: vtkCallbackCommand trampoline, calls the stored handler
+//
+// Inputs:
+// - caller: The object that fired the event
+// - event: The event id
+// - client_data: The Handler of the connection
+// - call_data: Event specific data, unused
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void EventDispatcher::forward(
+    vtkObject* caller,
+    unsigned long event,
+    void* client_data,
+    void* /* call_data */
+    )
+{
+    (*static_cast<Handler*>(client_data))(caller, event);
+}
@@ -0,0 +1,126 @@
+// ============================================================================
+// EventDispatcher.h - Routes VTK events to C++ callables
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * EventDispatcher.h: created.
+//
+// ============================================================================
+
+
+#ifndef EventDispatcher_H
+#define EventDispatcher_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// "C" system headers
+
+// Standard Library headers
+#include <functional>
+#include <map>
+#include <memory>
+
+// External libraries headers
+#include <vtkCallbackCommand.h>
+#include <vtkObject.h>
+#include <vtkSmartPointer.h>
+#include <vtkWeakPointer.h>
+
+
+// ============================================================================
+// Class Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// EventDispatcher
+// ----------------------------------------------------------------------------
+//
+// Description: Connects VTK events (renderer EndEvent, interactor events and
+//              so on) to std::function handlers. It is the non-Qt
+//              counterpart of vtkEventQtSlotConnect: the GUI and headless
+//              tools use the same dispatch code. Handlers run synchronously
+//              on the thread that fires the event. All observers are removed
+//              when the dispatcher is destroyed, subjects that die first are
+//              skipped.
+//
+// Properties:
+// - connections: Active connections, keyed by connection id
+// - next_id: Id handed out by the next connect call
+//
+// Methods:
+// - connect: Calls a handler whenever the subject fires the event
+// - disconnect: Removes one connection
+// - disconnectAll: Removes all connections
+//
+// Example usage:
+//   EventDispatcher dispatcher;
+//   dispatcher.connect(
+//       renderer, vtkCommand::EndEvent,
+//       [](vtkObject*, unsigned long) { std::cout << "rendered\n"; }
+//       );
+//
+// ----------------------------------------------------------------------------
+class EventDispatcher
+{
+public:
+    using Handler = std::function<void(vtkObject* caller, unsigned long)>;
+
+    // Constructor/Destructor
+    EventDispatcher();
+    ~EventDispatcher();
+
+    EventDispatcher(const EventDispatcher&) = delete;
+    EventDispatcher& operator=(const EventDispatcher&) = delete;
+
+    unsigned long connect(
+        vtkObject* subject,
+        unsigned long event,
+        Handler handler,
+        float priority = 0.0f
+        );  // Returns the connection id
+    void disconnect(unsigned long id);
+    void disconnectAll();
+
+private:
+    struct Connection {
+        vtkWeakPointer<vtkObject> subject;
+        unsigned long tag = 0;
+        vtkSmartPointer<vtkCallbackCommand> command;
+        std::unique_ptr<Handler> handler;  // Stable address for client data
+    };
+
+    static void forward(
+        vtkObject* caller,
+        unsigned long event,
+        void* client_data,
+        void* call_data
+        );
+
+    std::map<unsigned long, Connection> connections;
+    unsigned long next_id;
+};
+
+#endif  // EventDispatcher_H
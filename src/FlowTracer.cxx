@@ -0,0 +1,880 @@
+// ============================================================================
+// FlowTracer.cxx - Parallel streamline tracing through vector volumes
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * FlowTracer.cxx: created.
+// * FlowTracer.cxx: the index mapping takes the extent and the direction
+//   matrix of the field into account.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header -------------------------------------------------------------
+#include "FlowTracer.h"
+
+// Standard Library headers ---------------------------------------------------
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+// External libraries headers -------------------------------------------------
+
+// VTK headers
+#include <vtkCellArray.h>
+#include <vtkDoubleArray.h>
+#include <vtkFloatArray.h>
+#include <vtkIdTypeArray.h>
+#include <vtkMatrix3x3.h>
+#include <vtkPointData.h>
+#include <vtkProperty.h>
+#include <vtkSMPTools.h>
+
+
+// ============================================================================
+// Local helpers section
+// ============================================================================
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Line width of the tubes, in pixels
+const float kTubeWidth = 3.0f;
+
+// A traced line, xyz interleaved
+struct Line {
+    std::vector<float> points;
+    std::vector<float> velocities;
+    std::vector<float> speeds;
+
+    vtkIdType size() const
+    {
+        return static_cast<vtkIdType>(this->speeds.size());
+    }
+};
+
+// Integrates lines through a vector field stored as T. Positions are
+// continuous voxel indices counted from the first voxel stored, whatever
+// the extent starts at; the field is in world units, so it is turned into
+// the image axes and divided by the spacing before it is followed.
+template <typename T>
+class LineIntegrator
+{
+public:
+    LineIntegrator(
+        vtkImageData* field,
+        const T* values,
+        int components,
+        const TraceOptions& options
+        )
+        : values(values), components(components), options(options)
+    {
+        field->GetDimensions(this->dims);
+        field->GetOrigin(this->origin);
+        field->GetSpacing(this->spacing);
+        const int* extent = field->GetExtent();
+        for (int a = 0; a < 3; ++a) {
+            this->start[a] = extent[2 * a];
+        }
+        const double* direction = field->GetDirectionMatrix()->GetData();
+        std::copy(direction, direction + 9, this->to_world);
+        vtkMatrix3x3::Invert(this->to_world, this->to_image);
+    }
+
+    void worldToIndex(const double world[3], double index[3]) const
+    {
+        const double offset[3] = {
+            world[0] - this->origin[0],
+            world[1] - this->origin[1],
+            world[2] - this->origin[2]
+        };
+        double local[3];
+        rotate(this->to_image, offset, local);
+        for (int a = 0; a < 3; ++a) {
+            index[a] = this->spacing[a] != 0.0
+                ? local[a] / this->spacing[a] - this->start[a]
+                : 0.0;
+        }
+    }
+
+    // Traces a line through a seed, upstream first if asked
+    void trace(const double seed[3], Line& line) const
+    {
+        double velocity[3];
+        double direction[3];
+        double speed = 0.0;
+        if (!this->sample(seed, velocity, direction, &speed)) {
+            return;
+        }
+
+        if (this->options.backward) {
+            this->follow(seed, -this->options.step, line);
+            std::reverse(line.speeds.begin(), line.speeds.end());
+            reverseTuples(line.points);
+            reverseTuples(line.velocities);
+        }
+        this->append(seed, velocity, speed, line);
+        this->follow(seed, this->options.step, line);
+    }
+
+private:
+    // Multiplies a vector by a row-major 3x3 matrix
+    static void rotate(
+        const double matrix[9],
+        const double in[3],
+        double out[3]
+        )
+    {
+        for (int r = 0; r < 3; ++r) {
+            out[r] = matrix[3 * r] * in[0]
+                + matrix[3 * r + 1] * in[1]
+                + matrix[3 * r + 2] * in[2];
+        }
+    }
+
+    static void reverseTuples(std::vector<float>& tuples)
+    {
+        const std::size_t count = tuples.size() / 3;
+        for (std::size_t i = 0; i < count / 2; ++i) {
+            for (int c = 0; c < 3; ++c) {
+                std::swap(tuples[3 * i + c], tuples[3 * (count - 1 - i) + c]);
+            }
+        }
+    }
+
+    // Fourth order Runge-Kutta steps of constant length, until the line
+    // leaves the volume, stalls or runs out of steps
+    void follow(const double seed[3], double step, Line& line) const
+    {
+        double p[3] = {seed[0], seed[1], seed[2]};
+        double k1[3], k2[3], k3[3], k4[3], q[3];
+        double velocity[3];
+        double speed = 0.0;
+        for (int i = 0; i < this->options.max_steps; ++i) {
+            if (!this->sample(p, velocity, k1, &speed)) {
+                return;
+            }
+            for (int a = 0; a < 3; ++a) {
+                q[a] = p[a] + 0.5 * step * k1[a];
+            }
+            if (!this->sample(q, velocity, k2, &speed)) {
+                return;
+            }
+            for (int a = 0; a < 3; ++a) {
+                q[a] = p[a] + 0.5 * step * k2[a];
+            }
+            if (!this->sample(q, velocity, k3, &speed)) {
+                return;
+            }
+            for (int a = 0; a < 3; ++a) {
+                q[a] = p[a] + step * k3[a];
+            }
+            if (!this->sample(q, velocity, k4, &speed)) {
+                return;
+            }
+            for (int a = 0; a < 3; ++a) {
+                p[a] += step * (k1[a] + 2.0 * k2[a] + 2.0 * k3[a] + k4[a])
+                    / 6.0;
+            }
+            if (!this->sample(p, velocity, k1, &speed)) {
+                return;
+            }
+            this->append(p, velocity, speed, line);
+        }
+    }
+
+    void append(
+        const double index[3],
+        const double velocity[3],
+        double speed,
+        Line& line
+        ) const
+    {
+        double local[3];
+        for (int a = 0; a < 3; ++a) {
+            local[a] = (index[a] + this->start[a]) * this->spacing[a];
+        }
+        double world[3];
+        rotate(this->to_world, local, world);
+        for (int a = 0; a < 3; ++a) {
+            line.points.push_back(static_cast<float>(
+                this->origin[a] + world[a]
+                ));
+            line.velocities.push_back(static_cast<float>(velocity[a]));
+        }
+        line.speeds.push_back(static_cast<float>(speed));
+    }
+
+    // Trilinear field at a continuous index, and the unit direction to
+    // follow in index space. false outside the volume or below the
+    // terminal speed.
+    bool sample(
+        const double index[3],
+        double velocity[3],
+        double direction[3],
+        double* speed
+        ) const
+    {
+        int base[3];
+        double fraction[3];
+        for (int a = 0; a < 3; ++a) {
+            const double last = this->dims[a] - 1;
+            if (!(index[a] >= 0.0 && index[a] <= last)) {
+                return false;
+            }
+            base[a] = std::min(
+                static_cast<int>(index[a]),
+                std::max(this->dims[a] - 2, 0)
+                );
+            fraction[a] = index[a] - base[a];
+        }
+
+        velocity[0] = velocity[1] = velocity[2] = 0.0;
+        for (int corner = 0; corner < 8; ++corner) {
+            double weight = 1.0;
+            vtkIdType offset = 0;
+            vtkIdType stride = 1;
+            for (int a = 0; a < 3; ++a) {
+                const int up = (corner >> a) & 1;
+                weight *= up ? fraction[a] : 1.0 - fraction[a];
+                offset += (base[a] + up) * stride;
+                stride *= this->dims[a];
+            }
+            // Flat axes have no second sample
+            if (weight == 0.0) {
+                continue;
+            }
+            const T* value = this->values + offset * this->components;
+            for (int c = 0; c < 3; ++c) {
+                velocity[c] += weight * static_cast<double>(value[c]);
+            }
+        }
+
+        *speed = std::sqrt(
+            velocity[0] * velocity[0]
+            + velocity[1] * velocity[1]
+            + velocity[2] * velocity[2]
+            );
+        if (!(*speed > this->options.terminal_speed)) {
+            return false;
+        }
+
+        double along[3];
+        rotate(this->to_image, velocity, along);
+        double length = 0.0;
+        for (int a = 0; a < 3; ++a) {
+            direction[a] = this->spacing[a] != 0.0
+                ? along[a] / this->spacing[a]
+                : 0.0;
+            length += direction[a] * direction[a];
+        }
+        length = std::sqrt(length);
+        if (length == 0.0) {
+            return false;
+        }
+        for (int a = 0; a < 3; ++a) {
+            direction[a] /= length;
+        }
+
+        return true;
+    }
+
+    const T* values;
+    int components;
+    const TraceOptions& options;
+    int dims[3];
+    int start[3];  // First index of the extent
+    double origin[3];
+    double spacing[3];
+    double to_world[9];  // Direction matrix, image axes to world
+    double to_image[9];  // Its inverse
+};
+
+// Traces every seed into its own line, seeds spread over cores
+template <typename T>
+bool traceLines(
+    vtkImageData* field,
+    vtkDataArray* vectors,
+    vtkPoints* seeds,
+    const TraceOptions& options,
+    const std::atomic<bool>* cancel,
+    std::vector<Line>& lines
+    )
+{
+    const LineIntegrator<T> integrator(
+        field,
+        static_cast<const T*>(vectors->GetVoidPointer(0)),
+        vectors->GetNumberOfComponents(),
+        options
+        );
+
+    vtkSMPTools::For(
+        0,
+        static_cast<vtkIdType>(lines.size()),
+        std::max<vtkIdType>(1, options.grain),
+        [&](vtkIdType begin, vtkIdType end) {
+            for (vtkIdType s = begin; s < end; ++s) {
+                if (cancel != nullptr && *cancel) {
+                    return;
+                }
+                double world[3];
+                double index[3];
+                seeds->GetPoint(s, world);
+                integrator.worldToIndex(world, index);
+                integrator.trace(index, lines[s]);
+            }
+        }
+        );
+
+    return cancel == nullptr || !*cancel;
+}
+
+}  // namespace
+
+
+// ============================================================================
+// Function Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// flowVectors
+// ----------------------------------------------------------------------------
+//
+// Description: Returns the vectors a volume is traced through
+//
+// Inputs:
+// - field: The volume
+//
+// Outputs: None
+//
+// Returns: The active point vectors, else the first point array of 3
+//          components, null if there is none
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+vtkDataArray* flowVectors(vtkImageData* field)
+{
+    if (field == nullptr) {
+        return nullptr;
+    }
+
+    vtkPointData* point_data = field->GetPointData();
+    if (point_data->GetVectors() != nullptr) {
+        return point_data->GetVectors();
+    }
+    for (int i = 0; i < point_data->GetNumberOfArrays(); ++i) {
+        vtkDataArray* array = point_data->GetArray(i);
+        if (array != nullptr && array->GetNumberOfComponents() == 3) {
+            return array;
+        }
+    }
+
+    return nullptr;
+}
+
+// ----------------------------------------------------------------------------
+// traceStreamlines
+// ----------------------------------------------------------------------------
+//
+// Description: Traces streamlines from seed points, in parallel
+//
+// Inputs:
+// - field: Volume with a vector field
+// - seeds: Start points, in world coordinates
+// - options: Trace settings
+// - cancel: Stops the trace between seeds when raised, may be null
+//
+// Outputs:
+// - stats: What was done, if not null
+//
+// Returns: The lines, with "Speed" and "Velocity" point arrays
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+vtkSmartPointer<vtkPolyData> traceStreamlines(
+    vtkImageData* field,
+    vtkPoints* seeds,
+    const TraceOptions& options,
+    TraceStats* stats,
+    const std::atomic<bool>* cancel
+    )
+{
+    const auto started = Clock::now();
+    auto output = vtkSmartPointer<vtkPolyData>::New();
+    TraceStats counts;
+    counts.seeds = seeds != nullptr
+        ? static_cast<std::size_t>(seeds->GetNumberOfPoints())
+        : 0;
+
+    vtkDataArray* vectors = flowVectors(field);
+    if (vectors == nullptr || counts.seeds == 0) {
+        counts.complete = vectors != nullptr;
+        if (stats != nullptr) {
+            *stats = counts;
+        }
+        return output;
+    }
+
+    // Vectors of other types are converted once rather than per sample
+    std::vector<Line> lines(counts.seeds);
+    bool traced = false;
+    if (vectors->GetDataType() == VTK_DOUBLE) {
+        traced = traceLines<double>(
+            field, vectors, seeds, options, cancel, lines
+            );
+    } else if (vectors->GetDataType() == VTK_FLOAT) {
+        traced = traceLines<float>(
+            field, vectors, seeds, options, cancel, lines
+            );
+    } else {
+        auto converted = vtkSmartPointer<vtkFloatArray>::New();
+        converted->DeepCopy(vectors);
+        traced = traceLines<float>(
+            field, converted, seeds, options, cancel, lines
+            );
+    }
+    if (!traced) {
+        if (stats != nullptr) {
+            *stats = counts;
+        }
+        return output;
+    }
+
+    // Lines of a single point are dropped; the rest are gathered in seed
+    // order, each one copied by its own task
+    std::vector<vtkIdType> point_offsets(lines.size() + 1, 0);
+    std::vector<vtkIdType> cell_offsets(lines.size() + 1, 0);
+    for (std::size_t i = 0; i < lines.size(); ++i) {
+        const vtkIdType size = lines[i].size() > 1 ? lines[i].size() : 0;
+        point_offsets[i + 1] = point_offsets[i] + size;
+        cell_offsets[i + 1] = cell_offsets[i] + (size > 0 ? 1 : 0);
+    }
+    const vtkIdType point_count = point_offsets.back();
+    const vtkIdType cell_count = cell_offsets.back();
+
+    auto coordinates = vtkSmartPointer<vtkFloatArray>::New();
+    coordinates->SetNumberOfComponents(3);
+    coordinates->SetNumberOfTuples(point_count);
+    auto velocities = vtkSmartPointer<vtkFloatArray>::New();
+    velocities->SetName("Velocity");
+    velocities->SetNumberOfComponents(3);
+    velocities->SetNumberOfTuples(point_count);
+    auto speeds = vtkSmartPointer<vtkFloatArray>::New();
+    speeds->SetName("Speed");
+    speeds->SetNumberOfTuples(point_count);
+    auto offsets = vtkSmartPointer<vtkIdTypeArray>::New();
+    offsets->SetNumberOfValues(cell_count + 1);
+    auto connectivity = vtkSmartPointer<vtkIdTypeArray>::New();
+    connectivity->SetNumberOfValues(point_count);
+
+    float* xyz = coordinates->GetPointer(0);
+    float* velocity_values = velocities->GetPointer(0);
+    float* speed_values = speeds->GetPointer(0);
+    vtkIdType* offset_values = offsets->GetPointer(0);
+    vtkIdType* connectivity_values = connectivity->GetPointer(0);
+
+    vtkSMPTools::For(
+        0,
+        static_cast<vtkIdType>(lines.size()),
+        std::max<vtkIdType>(1, options.grain),
+        [&](vtkIdType begin, vtkIdType end) {
+            for (vtkIdType i = begin; i < end; ++i) {
+                const vtkIdType first = point_offsets[i];
+                const vtkIdType size = point_offsets[i + 1] - first;
+                if (size == 0) {
+                    continue;
+                }
+                const Line& line = lines[i];
+                std::copy(
+                    line.points.begin(), line.points.end(), xyz + 3 * first
+                    );
+                std::copy(
+                    line.velocities.begin(),
+                    line.velocities.end(),
+                    velocity_values + 3 * first
+                    );
+                std::copy(
+                    line.speeds.begin(),
+                    line.speeds.end(),
+                    speed_values + first
+                    );
+                offset_values[cell_offsets[i]] = first;
+                for (vtkIdType p = 0; p < size; ++p) {
+                    connectivity_values[first + p] = first + p;
+                }
+            }
+        }
+        );
+    offset_values[cell_count] = point_count;
+
+    auto points = vtkSmartPointer<vtkPoints>::New();
+    points->SetData(coordinates);
+    output->SetPoints(points);
+    auto cells = vtkSmartPointer<vtkCellArray>::New();
+    cells->SetData(offsets, connectivity);
+    output->SetLines(cells);
+    output->GetPointData()->SetScalars(speeds);
+    output->GetPointData()->SetVectors(velocities);
+
+    counts.lines = static_cast<std::size_t>(cell_count);
+    counts.points = point_count;
+    counts.complete = true;
+    counts.seconds = std::chrono::duration<double>(
+        Clock::now() - started).count();
+    if (stats != nullptr) {
+        *stats = counts;
+    }
+
+    return output;
+}
+
+
+// ============================================================================
+// Constructor/Destructor Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// StreamlineEngine::~StreamlineEngine
+// ----------------------------------------------------------------------------
+//
+// Description: Destructor
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Cancels the running trace and waits for it
+//
+// ----------------------------------------------------------------------------
+StreamlineEngine::~StreamlineEngine()
+{
+    this->cancel();
+}
+
+// ----------------------------------------------------------------------------
+// FlowDisplay::FlowDisplay
+// ----------------------------------------------------------------------------
+//
+// Description: Constructor. Lines are colored by speed and shown as tubes.
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+FlowDisplay::FlowDisplay()
+{
+    this->lines = vtkSmartPointer<vtkPolyData>::New();
+
+    this->line_mapper = vtkSmartPointer<vtkPolyDataMapper>::New();
+    this->line_mapper->SetInputData(this->lines);
+    this->line_mapper->ScalarVisibilityOn();
+
+    // Glyphs are instanced on the GPU, oriented by the velocity
+    this->glyph_points = vtkSmartPointer<vtkMaskPoints>::New();
+    this->glyph_points->SetInputData(this->lines);
+    this->glyph_points->SetOnRatio(8);
+    this->glyph_points->RandomModeOff();
+    this->glyph_points->GenerateVerticesOff();
+    this->glyph_mapper = vtkSmartPointer<vtkGlyph3DMapper>::New();
+    this->glyph_mapper->SetInputConnection(
+        this->glyph_points->GetOutputPort()
+        );
+    this->glyph_mapper->OrientOn();
+    this->glyph_mapper->SetOrientationArray("Velocity");
+    this->glyph_mapper->SetScaleModeToNoDataScaling();
+    this->glyph_mapper->ScalarVisibilityOn();
+
+    this->flow_actor = vtkSmartPointer<vtkActor>::New();
+    this->flow_actor->SetMapper(this->line_mapper);
+    this->flow_actor->GetProperty()->SetLineWidth(kTubeWidth);
+    this->flow_actor->GetProperty()->RenderLinesAsTubesOn();
+}
+
+
+// ============================================================================
+// Public Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// StreamlineEngine::trace
+// ----------------------------------------------------------------------------
+//
+// Description: Starts tracing streamlines on the background thread, after
+//              cancelling the trace running
+//
+// Inputs:
+// - field: Volume with a vector field, kept alive until the trace ends
+// - seeds: Start points, copied
+// - options: Trace settings
+// - done: Receives the lines of a trace that was not cancelled, on the
+//         background thread
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Starts the background thread
+//
+// ----------------------------------------------------------------------------
+void StreamlineEngine::trace(
+    vtkImageData* field,
+    vtkPoints* seeds,
+    const TraceOptions& options,
+    TraceDone done
+    )
+{
+    this->cancel();
+    if (field == nullptr || seeds == nullptr) {
+        return;
+    }
+
+    vtkSmartPointer<vtkImageData> held(field);
+    auto copied = vtkSmartPointer<vtkPoints>::New();
+    copied->DeepCopy(seeds);
+    this->worker = std::thread([this, held, copied, options, done]() {
+        TraceStats stats;
+        vtkSmartPointer<vtkPolyData> lines = traceStreamlines(
+            held,
+            copied,
+            options,
+            &stats,
+            &this->cancelled
+            );
+        if (stats.complete && !this->cancelled && done) {
+            done(lines, stats);
+        }
+    });
+}
+
+// ----------------------------------------------------------------------------
+// StreamlineEngine::cancel
+// ----------------------------------------------------------------------------
+//
+// Description: Stops the running trace, if any, and waits for it. It
+//              reports nothing.
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Joins the background thread
+//
+// ----------------------------------------------------------------------------
+void StreamlineEngine::cancel()
+{
+    if (this->worker.joinable()) {
+        this->cancelled = true;
+        this->worker.join();
+    }
+    this->cancelled = false;
+}
+
+// ----------------------------------------------------------------------------
+// FlowDisplay::setLines
+// ----------------------------------------------------------------------------
+//
+// Description: Shows streamlines, colored over their speed range
+//
+// Inputs:
+// - streamlines: Lines from traceStreamlines, null to show none
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Shares the arrays of the lines
+//
+// ----------------------------------------------------------------------------
+void FlowDisplay::setLines(vtkPolyData* streamlines)
+{
+    if (streamlines == nullptr) {
+        this->lines->Initialize();
+        return;
+    }
+
+    this->lines->ShallowCopy(streamlines);
+    double range[2] = {0.0, 1.0};
+    if (vtkDataArray* speeds = this->lines->GetPointData()->GetScalars()) {
+        speeds->GetRange(range);
+    }
+    this->line_mapper->SetScalarRange(range);
+    this->glyph_mapper->SetScalarRange(range);
+}
+
+// ----------------------------------------------------------------------------
+// FlowDisplay::setStyle
+// ----------------------------------------------------------------------------
+//
+// Description: Shows the lines as tubes or as glyphs. Glyphs need a glyph
+//              source; without one the tubes stay.
+//
+// Inputs:
+// - style: The style
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Swaps the mapper of the actor
+//
+// ----------------------------------------------------------------------------
+void FlowDisplay::setStyle(FlowStyle style)
+{
+    this->flow_style = style;
+    const bool glyphs = style == FlowStyle::Cones
+        && this->glyph_mapper->GetSource() != nullptr;
+    if (glyphs) {
+        this->flow_actor->SetMapper(this->glyph_mapper);
+    } else {
+        this->flow_actor->SetMapper(this->line_mapper);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// FlowDisplay::setGlyphSource
+// ----------------------------------------------------------------------------
+//
+// Description: Sets the glyph instanced along the lines. It should point
+//              along +x, as vtkConeSource does; it is scaled so its longest
+//              side is the glyph length.
+//
+// Inputs:
+// - glyph: The glyph geometry, shared
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void FlowDisplay::setGlyphSource(vtkPolyData* glyph)
+{
+    this->glyph_mapper->SetSourceData(glyph);
+    this->updateGlyphScale();
+    this->setStyle(this->flow_style);
+}
+
+// ----------------------------------------------------------------------------
+// FlowDisplay::setGlyphLength
+// ----------------------------------------------------------------------------
+//
+// Description: Sets the length of the glyphs
+//
+// Inputs:
+// - length: Length in world units
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void FlowDisplay::setGlyphLength(double length)
+{
+    this->glyph_length = length;
+    this->updateGlyphScale();
+}
+
+// ----------------------------------------------------------------------------
+// FlowDisplay::setGlyphStride
+// ----------------------------------------------------------------------------
+//
+// Description: Sets how many line points there are from one glyph to the
+//              next
+//
+// Inputs:
+// - stride: Points between glyphs, at least 1
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void FlowDisplay::setGlyphStride(int stride)
+{
+    this->glyph_points->SetOnRatio(std::max(1, stride));
+}
+
+
+// ============================================================================
+// Private Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// FlowDisplay::updateGlyphScale
+// ----------------------------------------------------------------------------
+//
+// Description: Scales the glyph source to the glyph length
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void FlowDisplay::updateGlyphScale()
+{
+    vtkPolyData* glyph = vtkPolyData::SafeDownCast(
+        this->glyph_mapper->GetSource()
+        );
+    if (glyph == nullptr || glyph->GetNumberOfPoints() == 0) {
+        return;
+    }
+
+    const double* bounds = glyph->GetBounds();
+    const double size = std::max({
+        bounds[1] - bounds[0],
+        bounds[3] - bounds[2],
+        bounds[5] - bounds[4]
+        });
+    if (size > 0.0) {
+        this->glyph_mapper->SetScaleFactor(this->glyph_length / size);
+    }
+}
@@ -0,0 +1,282 @@
+// ============================================================================
+// FlowTracer.h - Parallel streamline tracing through vector volumes
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * FlowTracer.h: created.
+//
+// ============================================================================
+
+
+#ifndef FlowTracer_H
+#define FlowTracer_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Standard Library headers
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <thread>
+
+// External libraries headers
+#include <vtkActor.h>
+#include <vtkDataArray.h>
+#include <vtkGlyph3DMapper.h>
+#include <vtkImageData.h>
+#include <vtkMaskPoints.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+#include <vtkPolyDataMapper.h>
+#include <vtkSmartPointer.h>
+#include <vtkType.h>
+
+
+// ============================================================================
+// Enumerations Section
+// ============================================================================
+
+// How streamlines are drawn
+enum class FlowStyle {
+    Tubes,  // Lines drawn as shaded tubes by the GPU
+    Cones  // Cones instanced along the lines, pointing downstream
+};
+
+
+// ============================================================================
+// Structure Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// TraceOptions
+// ----------------------------------------------------------------------------
+//
+// Description: Settings of a streamline trace
+//
+// Properties:
+// - step: Integration step, in voxels
+// - max_steps: Steps traced from a seed in each direction
+// - terminal_speed: Lines stop where the field is slower
+// - backward: Whether lines are also traced upstream of their seed
+// - grain: Seeds per task. Lines differ wildly in length, so tasks are
+//          kept small for the threads to balance.
+//
+// ----------------------------------------------------------------------------
+struct TraceOptions {
+    double step = 0.5;
+    int max_steps = 1000;
+    double terminal_speed = 1e-9;
+    bool backward = true;
+    vtkIdType grain = 16;
+};
+
+// What a trace did
+struct TraceStats {
+    std::size_t seeds = 0;
+    std::size_t lines = 0;  // Lines of two points or more
+    vtkIdType points = 0;
+    double seconds = 0.0;
+    bool complete = false;  // false if cancelled
+};
+
+
+// ============================================================================
+// Function Declarations Section
+// ============================================================================
+
+// Returns the vectors a volume is traced through: its active point vectors,
+// else its first point array of 3 components, null if it has none
+vtkDataArray* flowVectors(vtkImageData* field);
+
+// ----------------------------------------------------------------------------
+// traceStreamlines
+// ----------------------------------------------------------------------------
+//
+// Description: Traces streamlines from seed points through the vectors of
+//              a volume. Every seed is integrated on its own with fourth
+//              order Runge-Kutta steps of constant length along the
+//              direction of the trilinearly interpolated field, until it
+//              leaves the volume, the field drops below the terminal speed
+//              or max_steps is reached. Seeds are spread over cores with
+//              vtkSMPTools in small tasks; each task writes only the lines
+//              of its own seeds, so nothing is shared or locked, and the
+//              lines are gathered in seed order, so results do not depend
+//              on the thread count. Float and double vectors are read in
+//              place, other types are converted to float once. The
+//              orientation of the volume is ignored.
+//
+// Inputs:
+// - field: Volume with a vector field (see flowVectors)
+// - seeds: Start points, in world coordinates
+// - options: Trace settings
+// - cancel: Stops the trace between seeds when raised, may be null
+//
+// Outputs:
+// - stats: What was done, if not null
+//
+// Returns: One polyline per seed that moved, with the field magnitude as
+//          "Speed" (active scalars) and the field as "Velocity" (active
+//          vectors); empty if the field has no vectors or the trace was
+//          cancelled
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+vtkSmartPointer<vtkPolyData> traceStreamlines(
+    vtkImageData* field,
+    vtkPoints* seeds,
+    const TraceOptions& options = TraceOptions(),
+    TraceStats* stats = nullptr,
+    const std::atomic<bool>* cancel = nullptr
+    );
+
+
+// ============================================================================
+// Class Definitions Section
+// ============================================================================
+
+// Receives the lines and statistics of a finished trace, on the thread that
+// traced them
+using TraceDone = std::function<void(
+    vtkSmartPointer<vtkPolyData> lines,
+    const TraceStats& stats
+    )>;
+
+// ----------------------------------------------------------------------------
+// StreamlineEngine
+// ----------------------------------------------------------------------------
+//
+// Description: Traces streamlines on a background thread, one trace at a
+//              time. Starting a trace cancels the one running, so seeds
+//              dragged around never wait for the lines of where they were.
+//              A cancelled trace reports nothing.
+//
+// Properties:
+// - worker: The thread of the running trace
+// - cancelled: Raised to stop the running trace
+//
+// Methods:
+// - trace: Starts a trace
+// - cancel: Stops the running trace and waits for it
+//
+// Example usage:
+//   StreamlineEngine engine;
+//   engine.trace(field, seeds, TraceOptions(), [](
+//           vtkSmartPointer<vtkPolyData> lines, const TraceStats& stats) {
+//       std::cout << stats.lines << " lines\n";
+//   });
+//
+// ----------------------------------------------------------------------------
+class StreamlineEngine
+{
+public:
+    // Constructor/Destructor
+    StreamlineEngine() = default;
+    ~StreamlineEngine();
+
+    StreamlineEngine(const StreamlineEngine&) = delete;
+    StreamlineEngine& operator=(const StreamlineEngine&) = delete;
+
+    void trace(
+        vtkImageData* field,
+        vtkPoints* seeds,
+        const TraceOptions& options,
+        TraceDone done
+        );  // Seeds are copied, the field is kept alive until done
+    void cancel();
+
+private:
+    std::thread worker;
+    std::atomic<bool> cancelled{false};
+};
+
+// ----------------------------------------------------------------------------
+// FlowDisplay
+// ----------------------------------------------------------------------------
+//
+// Description: Shows streamlines colored by speed, either as lines the GPU
+//              draws as tubes (no tube geometry is built) or as a glyph,
+//              normally the cone of the scene, instanced by
+//              vtkGlyph3DMapper at every few points of the lines and
+//              oriented along the flow.
+//
+// Properties:
+// - lines: The streamlines shown
+// - line_mapper: Mapper of the tubes
+// - glyph_points: Every glyph_stride-th point of the lines
+// - glyph_mapper: Mapper of the glyphs
+// - flow_actor: The actor, with the mapper of the style
+// - flow_style: Style shown
+// - glyph_length: Length of a glyph, in world units
+//
+// Methods:
+// - setLines: Shows streamlines
+// - setStyle, style: Sets and returns the style
+// - setGlyphSource: Sets the instanced glyph, pointing along +x
+// - setGlyphLength: Sets the length of the glyphs
+// - setGlyphStride: Sets the points between glyphs
+// - actor: Returns the actor showing the lines
+//
+// Example usage:
+//   FlowDisplay display;
+//   display.setGlyphSource(cone);
+//   display.setStyle(FlowStyle::Cones);
+//   display.setLines(traceStreamlines(field, seeds));
+//   renderer->AddActor(display.actor());
+//
+// ----------------------------------------------------------------------------
+class FlowDisplay
+{
+public:
+    // Constructor/Destructor
+    FlowDisplay();
+    ~FlowDisplay() = default;
+
+    FlowDisplay(const FlowDisplay&) = delete;
+    FlowDisplay& operator=(const FlowDisplay&) = delete;
+
+    void setLines(vtkPolyData* streamlines);  // null clears
+    void setStyle(FlowStyle style);
+    FlowStyle style() const { return this->flow_style; }
+    void setGlyphSource(vtkPolyData* glyph);
+    void setGlyphLength(double length);
+    void setGlyphStride(int stride);
+    vtkActor* actor() const { return this->flow_actor; }
+
+private:
+    void updateGlyphScale();
+
+    vtkSmartPointer<vtkPolyData> lines;
+    vtkSmartPointer<vtkPolyDataMapper> line_mapper;
+    vtkSmartPointer<vtkMaskPoints> glyph_points;
+    vtkSmartPointer<vtkGlyph3DMapper> glyph_mapper;
+    vtkSmartPointer<vtkActor> flow_actor;
+    FlowStyle flow_style = FlowStyle::Tubes;
+    double glyph_length = 1.0;
+};
+
+#endif  // FlowTracer_H
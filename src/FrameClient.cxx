@@ -0,0 +1,424 @@
+// ============================================================================
+// FrameClient - Reference client for the QtVTKFramework frame server
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// Connects to a server started with `QtVTKFramework --serve <port>`, orbits
+// the camera in fixed steps and receives one frame per step. Frame rate,
+// payload sizes and command-to-frame latency are reported at the end, and
+// frames can optionally be written to disk.
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * FrameClient.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header
+#include "FrameProtocol.h"
+#include "Socket.h"
+
+// "C" system headers
+
+// Standard Library headers
+#include <algorithm>   // required by max
+#include <chrono>      // required by steady_clock
+#include <cstdlib>     // required by EXIT_SUCCESS, EXIT_FAILURE
+#include <cstring>     // required by memcmp
+#include <filesystem>  // Used for testing directory and file status
+#include <fstream>     // required by ofstream
+#include <iostream>    // required by cin, cout, ...
+#include <sstream>     // required by ostringstream
+#include <string>      // self explanatory ...
+#include <vector>      // self explanatory ...
+
+// External libraries headers
+#include <clipp.hpp>  // command line arguments parsing
+#if defined(QTVTK_HAVE_LZ4)
+#include <lz4.h>
+#endif
+
+
+// ============================================================================
+// Define namespace aliases
+// ============================================================================
+
+namespace fs = std::filesystem;
+
+
+// ============================================================================
+// Global constants section
+// ============================================================================
+
+const std::string kAppName = "QtVTKFrameClient";
+const std::string kVersionString = "0.1";
+const std::string kYearString = "yyyy";
+const std::string kAuthorName = "Ljubomir Kurij";
+const std::string kAuthorEmail = "ljubomir_kurij@protonmail.com";
+const std::string kAppDoc = "\
+Reference client for the QtVTKFramework frame server. Orbits the camera of\n\
+the served scene and reports the achieved frame rate and latency.\n\n\
+Mandatory arguments to long options are mandatory for short options too.\n";
+const std::string kLicense = "\
+License GPLv3+: GNU GPL version 3 or later <http://gnu.org/licenses/gpl.html>\n\
+This is free software: you are free to change and redistribute it.\n\
+There is NO WARRANTY, to the extent permitted by law.\n";
+
+
+// ============================================================================
+// Global variables section
+// ============================================================================
+
+static std::string exec_name = kAppName;
+
+
+// ============================================================================
+// Utility function prototypes
+// ============================================================================
+
+void printShortHelp(std::string = kAppName);
+void printVersionInfo();
+void showHelp(
+        const clipp::group&,
+        const std::string = kAppName,
+        const std::string = kAppDoc
+    );
+bool writeFrame(
+        const fs::path&,
+        const FrameHeader&,
+        const std::vector<unsigned char>&
+    );
+
+
+// ============================================================================
+// App's main function body
+// ============================================================================
+
+int main(int argc, char* argv[])
+{
+    // Determine the exec name under wich program is beeing executed
+    fs::path exec_path {argv[0]};
+    exec_name = exec_path.filename().string();
+
+    // Define structures to store command line options arguments and validators
+    struct CLIArguments {
+        bool        show_help;
+        bool        show_version;
+        std::string host;
+        int         port;
+        std::string socket_path;
+        std::string encoding;
+        int         quality;
+        int         frames;
+        double      step;
+        std::string output_dir;
+    };
+
+    CLIArguments user_options {
+        false, false, "127.0.0.1", 8000, "", "jpeg", 85, 100, 3.6, ""
+    };
+
+    // Unsupported options aggregator.
+    std::vector<std::string> unknown_options;
+
+    // Option filters definitions
+    auto istarget = clipp::match::prefix_not("-");
+
+    // Set command line options
+    auto cli = (
+        (
+            clipp::option("-h", "--help").set(user_options.show_help)
+                .doc("show this help message and exit"),
+            clipp::option("-V", "--version").set(user_options.show_version)
+                .doc("print program version")
+        ).doc("general options:"),
+        (
+            (
+                clipp::option("--host")
+                & clipp::value(istarget, "host", user_options.host)
+            ) % "server host (default: 127.0.0.1)",
+            (
+                clipp::option("-p", "--port")
+                & clipp::integer("port", user_options.port)
+            ) % "server TCP port (default: 8000)",
+            (
+                clipp::option("--socket")
+                & clipp::value(istarget, "path", user_options.socket_path)
+            ) % "connect to a Unix domain socket instead of TCP",
+            (
+                clipp::option("-e", "--encoding")
+                & clipp::value(istarget, "name", user_options.encoding)
+            ) % "frame encoding: jpeg, png, raw or lz4 (default: jpeg)",
+            (
+                clipp::option("-q", "--quality")
+                & clipp::integer("0-100", user_options.quality)
+            ) % "JPEG quality (default: 85)",
+            (
+                clipp::option("-n", "--frames")
+                & clipp::integer("count", user_options.frames)
+            ) % "number of frames to request (default: 100)",
+            (
+                clipp::option("--step")
+                & clipp::number("degrees", user_options.step)
+            ) % "camera azimuth step per frame (default: 3.6)",
+            (
+                clipp::option("-o", "--output-dir")
+                & clipp::value(istarget, "dir", user_options.output_dir)
+            ) % "write received frames to this directory"
+        ).doc("client options:"),
+        clipp::any_other(unknown_options)
+    );
+
+    // Parse command line options
+    if (!clipp::parse(argc, argv, cli) || !unknown_options.empty()) {
+        std::cerr << "Unknown options: ";
+        for (const auto& opt : unknown_options) {
+            std::cerr << opt << " ";
+        }
+        std::cerr << "\n";
+        printShortHelp(exec_name);
+
+        return EXIT_FAILURE;
+    }
+    if (user_options.show_help) {
+        showHelp(cli, exec_name);
+
+        return EXIT_SUCCESS;
+    }
+    if (user_options.show_version) {
+        printVersionInfo();
+
+        return EXIT_SUCCESS;
+    }
+
+    FrameEncoding encoding;
+    if (!parseFrameEncoding(user_options.encoding, encoding)) {
+        std::cerr << exec_name << ": unknown encoding '"
+            << user_options.encoding << "'\n";
+
+        return EXIT_FAILURE;
+    }
+    if (!user_options.output_dir.empty()) {
+        fs::create_directories(user_options.output_dir);
+    }
+
+    // Connect to the server
+    std::string error;
+    Socket link = user_options.socket_path.empty()
+        ? Socket::connectTcp(
+            user_options.host,
+            static_cast<std::uint16_t>(user_options.port),
+            &error
+            )
+        : Socket::connectLocal(user_options.socket_path, &error);
+    if (!link.isValid()) {
+        std::cerr << exec_name << ": " << error << "\n";
+
+        return EXIT_FAILURE;
+    }
+
+    std::ostringstream setup;
+    setup << "ENCODING " << frameEncodingName(encoding) << " "
+        << user_options.quality << "\nFRAME\n";
+    link.sendAll(setup.str().data(), setup.str().size());
+
+    // Lockstep loop: one camera step, one frame
+    using Clock = std::chrono::steady_clock;
+    const auto started = Clock::now();
+    auto requested = started;
+    double latency_sum = 0.0;
+    double latency_max = 0.0;
+    std::uint64_t payload_bytes = 0;
+    std::uint64_t raw_bytes = 0;
+    std::uint64_t last_id = 0;
+    std::uint64_t skipped = 0;
+    int received = 0;
+    std::vector<unsigned char> payload;
+
+    while (received < user_options.frames) {
+        FrameHeader header;
+        if (!link.receiveAll(&header, sizeof(header))
+            || std::memcmp(header.magic, kFrameMagic, 4) != 0) {
+            std::cerr << exec_name << ": lost connection to the server\n";
+
+            return EXIT_FAILURE;
+        }
+        payload.resize(header.payload_size);
+        if (!link.receiveAll(payload.data(), payload.size())) {
+            std::cerr << exec_name << ": lost connection to the server\n";
+
+            return EXIT_FAILURE;
+        }
+
+        const double latency = std::chrono::duration<double, std::milli>(
+            Clock::now() - requested
+            ).count();
+        latency_sum += latency;
+        latency_max = std::max(latency_max, latency);
+        payload_bytes += header.payload_size;
+        raw_bytes += header.raw_size;
+        if (last_id != 0 && header.frame_id > last_id + 1) {
+            skipped += header.frame_id - last_id - 1;
+        }
+        last_id = header.frame_id;
+
+        if (!user_options.output_dir.empty()) {
+            std::ostringstream name;
+            name << "frame" << header.frame_id;
+            writeFrame(
+                fs::path(user_options.output_dir) / name.str(),
+                header,
+                payload
+                );
+        }
+
+        ++received;
+        if (received < user_options.frames) {
+            const std::string command = "AZIMUTH "
+                + std::to_string(user_options.step) + "\n";
+            requested = Clock::now();
+            link.sendAll(command.data(), command.size());
+        }
+    }
+
+    const std::string quit = "QUIT\n";
+    link.sendAll(quit.data(), quit.size());
+
+    const double elapsed = std::chrono::duration<double>(
+        Clock::now() - started
+        ).count();
+    std::cout << "Frames received:  " << received << "\n"
+        << "Frames skipped:   " << skipped << "\n"
+        << "Frame rate:       " << received / elapsed << " fps\n"
+        << "Mean latency:     " << latency_sum / received << " ms\n"
+        << "Max latency:      " << latency_max << " ms\n"
+        << "Mean payload:     " << payload_bytes / received << " bytes\n"
+        << "Compression:      "
+        << static_cast<double>(raw_bytes) / payload_bytes << ":1\n";
+
+    return EXIT_SUCCESS;
+}
+
+
+// ============================================================================
+// Function definitions
+// ============================================================================
+
+inline void printShortHelp(std::string exec_name) {
+    std::cout << "Try '" << exec_name << " --help' for more information.\n";
+}
+
+
+void printVersionInfo() {
+    std::cout << kAppName << " " << kVersionString << " Copyright (C) "
+        << kYearString << " " << kAuthorName << "\n"
+        << kLicense;
+}
+
+
+void showHelp(
+        const clipp::group& group,
+        const std::string exec_name,
+        const std::string doc
+        ) {
+    auto fmt = clipp::doc_formatting {}.first_column(0).last_column(79);
+    clipp::man_page man;
+
+    man.prepend_section(
+        "USAGE", clipp::usage_lines(group, exec_name, fmt).str()
+        );
+    man.append_section("", doc);
+    man.append_section("", clipp::documentation(group, fmt).str());
+    man.append_section("", "Report bugs to <" + kAuthorEmail + ">.");
+
+    std::cout << man;
+}
+
+
+// Writes a received frame. Encoded images are stored as they are, raw and
+// LZ4 frames are converted to binary PPM (top to bottom rows).
+bool writeFrame(
+        const fs::path& stem,
+        const FrameHeader& header,
+        const std::vector<unsigned char>& payload
+        ) {
+    const auto encoding = static_cast<FrameEncoding>(header.encoding);
+    if (encoding == FrameEncoding::Jpeg || encoding == FrameEncoding::Png) {
+        fs::path file = stem;
+        file += (encoding == FrameEncoding::Jpeg) ? ".jpg" : ".png";
+        std::ofstream out(file, std::ios::binary);
+        out.write(
+            reinterpret_cast<const char*>(payload.data()),
+            static_cast<std::streamsize>(payload.size())
+            );
+        return static_cast<bool>(out);
+    }
+
+    const std::vector<unsigned char>* pixels = &payload;
+    std::vector<unsigned char> decoded;
+    if (encoding == FrameEncoding::Lz4) {
+#if defined(QTVTK_HAVE_LZ4)
+        decoded.resize(header.raw_size);
+        const int size = LZ4_decompress_safe(
+            reinterpret_cast<const char*>(payload.data()),
+            reinterpret_cast<char*>(decoded.data()),
+            static_cast<int>(payload.size()),
+            static_cast<int>(decoded.size())
+            );
+        if (size != static_cast<int>(header.raw_size)) {
+            return false;
+        }
+        pixels = &decoded;
+#else
+        fs::path file = stem;
+        file += ".lz4";
+        std::ofstream out(file, std::ios::binary);
+        out.write(
+            reinterpret_cast<const char*>(payload.data()),
+            static_cast<std::streamsize>(payload.size())
+            );
+        return static_cast<bool>(out);
+#endif
+    }
+
+    if (pixels->size() < std::size_t(header.width) * header.height * 3) {
+        return false;
+    }
+
+    fs::path file = stem;
+    file += ".ppm";
+    std::ofstream out(file, std::ios::binary);
+    out << "P6\n" << header.width << " " << header.height << "\n255\n";
+    const std::size_t row = std::size_t(header.width) * 3;
+    for (std::uint32_t y = header.height; y > 0; --y) {
+        out.write(
+            reinterpret_cast<const char*>(pixels->data() + (y - 1) * row),
+            static_cast<std::streamsize>(row)
+            );
+    }
+
+    return static_cast<bool>(out);
+}
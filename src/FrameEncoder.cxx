@@ -0,0 +1,263 @@
+// ============================================================================
+// FrameEncoder.cxx - Implementation of the FrameEncoder class
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * FrameEncoder.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header -------------------------------------------------------------
+#include "FrameEncoder.h"
+
+// "C" system headers ---------------------------------------------------------
+
+// Standard Library headers ---------------------------------------------------
+#include <algorithm>
+
+// External libraries headers -------------------------------------------------
+#if defined(QTVTK_HAVE_LZ4)
+#include <lz4.h>
+#endif
+
+// VTK headers
+#include <vtkPointData.h>
+
+
+// ============================================================================
+// Local helpers section
+// ============================================================================
+
+namespace {
+
+// vtkJPEGWriter and vtkPNGWriter share the memory output interface but not
+// a base class that declares it
+template <typename Writer>
+bool writeToMemory(
+    Writer* writer,
+    vtkImageData* image,
+    std::vector<unsigned char>& payload
+    )
+{
+    writer->SetInputData(image);
+    writer->WriteToMemoryOn();
+    writer->Write();
+
+    vtkUnsignedCharArray* result = writer->GetResult();
+    if (result == nullptr) {
+        return false;
+    }
+    const unsigned char* bytes = result->GetPointer(0);
+    payload.assign(bytes, bytes + result->GetNumberOfValues());
+
+    return true;
+}
+
+}  // namespace
+
+
+// ============================================================================
+// Constructor/Destructor Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// FrameEncoder::FrameEncoder
+// ----------------------------------------------------------------------------
+//
+// Description: Constructor
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+FrameEncoder::FrameEncoder()
+{
+    this->pixels = vtkSmartPointer<vtkUnsignedCharArray>::New();
+    this->pixels->SetNumberOfComponents(3);
+    this->image = vtkSmartPointer<vtkImageData>::New();
+    this->image->GetPointData()->SetScalars(this->pixels);
+    this->jpeg_writer = vtkSmartPointer<vtkJPEGWriter>::New();
+    this->png_writer = vtkSmartPointer<vtkPNGWriter>::New();
+}
+
+
+// ============================================================================
+// Public Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// FrameEncoder::encode
+// ----------------------------------------------------------------------------
+//
+// Description: Encodes a frame. Raw payloads are the frame bytes themselves
+//              and are not copied, LZ4 payloads use the LZ4 block format.
+//
+// Inputs:
+// - frame: The frame to encode
+// - requested: Encoding asked for by the link
+// - quality: JPEG quality in the range 0-100, ignored otherwise
+//
+// Outputs:
+// - encoded: View of the payload. The encoding is raw if LZ4 was requested
+//            but is not available in this build.
+//
+// Returns: false if encoding failed
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool FrameEncoder::encode(
+    const RawFrame& frame,
+    FrameEncoding requested,
+    int quality,
+    EncodedFrame& encoded
+    )
+{
+    bool success = true;
+    encoded.encoding = requested;
+
+    switch (requested) {
+        case FrameEncoding::Jpeg:
+            this->wrapFrame(frame);
+            this->jpeg_writer->SetQuality(std::clamp(quality, 0, 100));
+            this->jpeg_writer->ProgressiveOff();
+            success = writeToMemory(
+                this->jpeg_writer.Get(),
+                this->image,
+                this->buffer
+                );
+            break;
+
+        case FrameEncoding::Png:
+            this->wrapFrame(frame);
+            // Favour speed, frames are short lived
+            this->png_writer->SetCompressionLevel(1);
+            success = writeToMemory(
+                this->png_writer.Get(),
+                this->image,
+                this->buffer
+                );
+            break;
+
+#if defined(QTVTK_HAVE_LZ4)
+        case FrameEncoding::Lz4:
+        {
+            const int source_size = static_cast<int>(frame.rgb.size());
+            this->buffer.resize(
+                static_cast<std::size_t>(LZ4_compressBound(source_size))
+                );
+            const int written = LZ4_compress_default(
+                reinterpret_cast<const char*>(frame.rgb.data()),
+                reinterpret_cast<char*>(this->buffer.data()),
+                source_size,
+                static_cast<int>(this->buffer.size())
+                );
+            success = written > 0;
+            this->buffer.resize(
+                success ? static_cast<std::size_t>(written) : 0
+                );
+            break;
+        }
+#endif
+
+        default:
+            encoded.encoding = FrameEncoding::Raw;
+            encoded.data = frame.rgb.data();
+            encoded.size = frame.rgb.size();
+            return true;
+    }
+
+    encoded.data = this->buffer.data();
+    encoded.size = this->buffer.size();
+
+    return success;
+}
+
+// ----------------------------------------------------------------------------
+// FrameEncoder::lz4Available
+// ----------------------------------------------------------------------------
+//
+// Description: Tells whether this build was linked against LZ4
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: true if LZ4 payloads can be produced
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool FrameEncoder::lz4Available()
+{
+#if defined(QTVTK_HAVE_LZ4)
+    return true;
+#else
+    return false;
+#endif
+}
+
+
+// ============================================================================
+// Private Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// FrameEncoder::wrapFrame
+// ----------------------------------------------------------------------------
+//
+// Description: Points the internal image data at the frame pixels. The
+//              writers only read the scalars, so the frame is not copied.
+//
+// Inputs:
+// - frame: The frame to wrap
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Bumps the MTime of the internal image data
+//
+// ----------------------------------------------------------------------------
+void FrameEncoder::wrapFrame(const RawFrame& frame)
+{
+    this->image->SetDimensions(frame.width, frame.height, 1);
+    this->pixels->SetArray(
+        const_cast<unsigned char*>(frame.rgb.data()),
+        static_cast<vtkIdType>(frame.rgb.size()),
+        1
+        );
+    this->pixels->Modified();
+    this->image->Modified();
+}
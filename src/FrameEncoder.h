@@ -0,0 +1,159 @@
+// ============================================================================
+// FrameEncoder.h - Encodes rendered frames for streaming
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * FrameEncoder.h: created.
+//
+// ============================================================================
+
+
+#ifndef FrameEncoder_H
+#define FrameEncoder_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// "C" system headers
+
+// Standard Library headers
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// External libraries headers
+#include <vtkImageData.h>
+#include <vtkJPEGWriter.h>
+#include <vtkPNGWriter.h>
+#include <vtkSmartPointer.h>
+#include <vtkUnsignedCharArray.h>
+
+// Project headers
+#include "FrameProtocol.h"
+
+
+// ============================================================================
+// Structure Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// RawFrame
+// ----------------------------------------------------------------------------
+//
+// Description: An unencoded RGB frame as read back from the render window
+//
+// Properties:
+// - id: Sequence number of the frame
+// - width: Frame width in pixels
+// - height: Frame height in pixels
+// - rgb: Tightly packed RGB rows, bottom to top
+//
+// ----------------------------------------------------------------------------
+struct RawFrame {
+    std::uint64_t id;
+    int width;
+    int height;
+    std::vector<unsigned char> rgb;
+};
+
+// ----------------------------------------------------------------------------
+// EncodedFrame
+// ----------------------------------------------------------------------------
+//
+// Description: A view of an encoded payload. It points either into the
+//              encoder's own buffer or, for raw frames, into the frame itself,
+//              and stays valid until the next encode call.
+//
+// Properties:
+// - encoding: Encoding actually used
+// - data: First payload byte
+// - size: Number of payload bytes
+//
+// ----------------------------------------------------------------------------
+struct EncodedFrame {
+    FrameEncoding encoding;
+    const unsigned char* data;
+    std::size_t size;
+};
+
+
+// ============================================================================
+// Class Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// FrameEncoder
+// ----------------------------------------------------------------------------
+//
+// Description: Turns a RawFrame into a payload in the requested encoding. An
+//              encoder keeps its VTK writers between frames, so every worker
+//              thread should own one instance and reuse it.
+//
+// Properties:
+// - image: Image data wrapping the frame pixels without copying
+// - pixels: Scalars of image, pointed at the frame buffer
+// - jpeg_writer: Writer used for JPEG payloads
+// - png_writer: Writer used for PNG payloads
+// - buffer: Storage for the most recent encoded payload
+//
+// Methods:
+// - encode: Encodes one frame
+// - lz4Available: Tells whether the build includes LZ4 support
+//
+// Example usage:
+//   FrameEncoder encoder;
+//   EncodedFrame encoded;
+//   if (encoder.encode(frame, FrameEncoding::Jpeg, 85, encoded)) {
+//       link.sendAll(encoded.data, encoded.size);
+//   }
+//
+// ----------------------------------------------------------------------------
+class FrameEncoder
+{
+public:
+    // Constructor/Destructor
+    FrameEncoder();
+    ~FrameEncoder() {}
+
+    bool encode(
+        const RawFrame& frame,
+        FrameEncoding requested,
+        int quality,
+        EncodedFrame& encoded
+        );  // Encodes a frame, falling back to raw if LZ4 is unavailable
+
+    static bool lz4Available();
+
+private:
+    void wrapFrame(const RawFrame& frame);  // Points image at the frame
+
+    vtkSmartPointer<vtkImageData> image;
+    vtkSmartPointer<vtkUnsignedCharArray> pixels;
+    vtkSmartPointer<vtkJPEGWriter> jpeg_writer;
+    vtkSmartPointer<vtkPNGWriter> png_writer;
+    std::vector<unsigned char> buffer;
+};
+
+#endif  // FrameEncoder_H
@@ -0,0 +1,343 @@
+// ============================================================================
+// FramePacer.cxx - Mouse move compression and fixed-rate interaction ticks
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * FramePacer.cxx: created.
+// * FramePacer.cxx: only moves with a button held start a latency
+//   measurement, hover moves usually render nothing.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header -------------------------------------------------------------
+#include "FramePacer.h"
+
+// Standard Library headers ---------------------------------------------------
+#include <algorithm>
+#include <cmath>
+
+// External libraries headers -------------------------------------------------
+
+// VTK headers
+#include <vtkCommand.h>
+
+// Qt headers
+#include <QCoreApplication>
+#include <QMouseEvent>
+
+
+// ============================================================================
+// Constructor/Destructor Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// FramePacer::FramePacer
+// ----------------------------------------------------------------------------
+//
+// Description: Constructor. Pacing starts at kDefaultRate.
+//
+// Inputs:
+// - view: The widget showing the render window
+// - window: The render window, whose frames end the latency measurements
+// - parent: Owner of the pacer
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Installs the pacer as an event filter of the view
+//
+// ----------------------------------------------------------------------------
+FramePacer::FramePacer(
+    QWidget* view,
+    vtkRenderWindow* window,
+    QObject* parent
+    )
+    : QObject(parent), view(view)
+{
+    this->tick = new QTimer(this);
+    this->tick->setTimerType(Qt::PreciseTimer);
+    this->setRate(kDefaultRate);
+    connect(this->tick, &QTimer::timeout, this, &FramePacer::onTick);
+
+    this->events.connect(
+        window,
+        vtkCommand::EndEvent,
+        [this](vtkObject*, unsigned long) { this->frameRendered(); }
+        );
+    view->installEventFilter(this);
+}
+
+
+// ============================================================================
+// Public Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// FramePacer::setRate
+// ----------------------------------------------------------------------------
+//
+// Description: Sets the rate held mouse moves are delivered at
+//
+// Inputs:
+// - hz: Ticks per second, 0 to pass every event through unpaced
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Delivers the held move when pacing is disabled
+//
+// ----------------------------------------------------------------------------
+void FramePacer::setRate(double hz)
+{
+    this->tick_rate = std::max(0.0, hz);
+    if (this->tick_rate <= 0.0) {
+        this->deliver();
+        this->tick->stop();
+        return;
+    }
+
+    this->tick->setInterval(std::max(
+        1,
+        static_cast<int>(std::lround(1000.0 / this->tick_rate))
+        ));
+}
+
+// ----------------------------------------------------------------------------
+// FramePacer::stats
+// ----------------------------------------------------------------------------
+//
+// Description: Returns the counters and the latency of the recent frames
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: The statistics
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+FramePacerStats FramePacer::stats() const
+{
+    FramePacerStats result = this->counters;
+    result.samples = this->latencies.size();
+    if (this->latencies.empty()) {
+        return result;
+    }
+
+    double sum = 0.0;
+    for (double latency : this->latencies) {
+        sum += latency;
+        result.latency_max = std::max(result.latency_max, latency);
+    }
+    result.latency_mean = sum / this->latencies.size();
+
+    return result;
+}
+
+
+// ============================================================================
+// Protected Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// FramePacer::eventFilter
+// ----------------------------------------------------------------------------
+//
+// Description: Holds and merges the mouse moves of the view, and delivers
+//              the held move before any other input event
+//
+// Inputs:
+// - watched: The object the event is for
+// - event: The event
+//
+// Outputs: None
+//
+// Returns: true for the moves held back, false to let the event through
+//
+// Side Effects: Starts the tick after a quiet period
+//
+// ----------------------------------------------------------------------------
+bool FramePacer::eventFilter(QObject* watched, QEvent* event)
+{
+    if (watched != this->view || this->delivering) {
+        return QObject::eventFilter(watched, event);
+    }
+
+    switch (event->type()) {
+    case QEvent::MouseMove: {
+        ++this->counters.moves_received;
+        const auto* move = static_cast<QMouseEvent*>(event);
+        if (this->tick_rate <= 0.0) {
+            // Unpaced drags still get their latency measured
+            ++this->counters.moves_delivered;
+            if (!this->frame_pending && move->buttons() != Qt::NoButton) {
+                this->frame_input = Clock::now();
+                this->frame_pending = true;
+            }
+            break;
+        }
+
+        if (!this->pending) {
+            this->pending_since = Clock::now();
+            this->pending = true;
+        }
+        this->pending_position = move->localPos();
+        this->pending_window = move->windowPos();
+        this->pending_screen = move->screenPos();
+        this->pending_buttons = move->buttons();
+        this->pending_modifiers = move->modifiers();
+
+        // After a quiet period there is no frame to wait for
+        if (!this->tick->isActive()) {
+            this->deliver();
+            this->tick->start();
+        }
+        return true;
+    }
+    case QEvent::MouseButtonPress:
+    case QEvent::MouseButtonRelease:
+    case QEvent::MouseButtonDblClick:
+    case QEvent::Wheel:
+    case QEvent::KeyPress:
+    case QEvent::KeyRelease:
+        this->deliver();
+        break;
+    default:
+        break;
+    }
+
+    return QObject::eventFilter(watched, event);
+}
+
+
+// ============================================================================
+// Private Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// FramePacer::deliver
+// ----------------------------------------------------------------------------
+//
+// Description: Sends the held move, if any, to the view. The latency of the
+//              next frame is measured from the oldest drag not yet shown;
+//              moves without a button held do not count, as the
+//              interactor usually renders nothing for them.
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: The interactor handles the move, and usually renders
+//
+// ----------------------------------------------------------------------------
+void FramePacer::deliver()
+{
+    if (!this->pending || !this->view) {
+        return;
+    }
+    this->pending = false;
+
+    if (!this->frame_pending && this->pending_buttons != Qt::NoButton) {
+        this->frame_input = this->pending_since;
+        this->frame_pending = true;
+    }
+    ++this->counters.moves_delivered;
+
+    QMouseEvent move(
+        QEvent::MouseMove,
+        this->pending_position,
+        this->pending_window,
+        this->pending_screen,
+        Qt::NoButton,
+        this->pending_buttons,
+        this->pending_modifiers
+        );
+    this->delivering = true;
+    QCoreApplication::sendEvent(this->view, &move);
+    this->delivering = false;
+}
+
+// ----------------------------------------------------------------------------
+// FramePacer::onTick
+// ----------------------------------------------------------------------------
+//
+// Description: Delivers the held move, or stops the tick when the mouse
+//              has been still for a whole tick
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void FramePacer::onTick()
+{
+    if (this->pending) {
+        this->deliver();
+    } else {
+        this->tick->stop();
+    }
+}
+
+// ----------------------------------------------------------------------------
+// FramePacer::frameRendered
+// ----------------------------------------------------------------------------
+//
+// Description: Ends the latency measurement of the input the frame shows
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Drops the oldest latency beyond kLatencySamples
+//
+// ----------------------------------------------------------------------------
+void FramePacer::frameRendered()
+{
+    if (!this->frame_pending) {
+        return;
+    }
+    this->frame_pending = false;
+
+    this->latencies.push_back(std::chrono::duration<double, std::milli>(
+        Clock::now() - this->frame_input).count());
+    if (this->latencies.size() > kLatencySamples) {
+        this->latencies.pop_front();
+    }
+}
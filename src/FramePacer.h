@@ -0,0 +1,183 @@
+// ============================================================================
+// FramePacer.h - Mouse move compression and fixed-rate interaction ticks
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * FramePacer.h: created.
+// * FramePacer.h: latency is measured for drags only.
+//
+// ============================================================================
+
+
+#ifndef FramePacer_H
+#define FramePacer_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Standard Library headers
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+
+// External libraries headers
+#include <QEvent>
+#include <QObject>
+#include <QPointF>
+#include <QPointer>
+#include <QTimer>
+#include <QWidget>
+#include <vtkRenderWindow.h>
+
+// Project headers
+#include "EventDispatcher.h"
+
+
+// ============================================================================
+// Structure Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// FramePacerStats
+// ----------------------------------------------------------------------------
+//
+// Description: What the pacer did, and the input-to-frame latency: the time
+//              from the oldest mouse move merged into a delivery to the end
+//              of the frame it caused
+//
+// Properties:
+// - moves_received: Mouse moves Qt delivered to the view
+// - moves_delivered: Mouse moves passed on to the interactor
+// - latency_mean, latency_max: Over the last kLatencySamples frames, in ms
+// - samples: Frames the latency was measured on
+//
+// ----------------------------------------------------------------------------
+struct FramePacerStats {
+    std::uint64_t moves_received = 0;
+    std::uint64_t moves_delivered = 0;
+    double latency_mean = 0.0;
+    double latency_max = 0.0;
+    std::size_t samples = 0;
+};
+
+
+// ============================================================================
+// Class Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// FramePacer
+// ----------------------------------------------------------------------------
+//
+// Description: Event filter of a VTK view widget that stops high rate mice
+//              from rendering more frames than can be shown. Mouse moves are
+//              held back and merged, keeping only the last position, and
+//              passed to the interactor on a fixed-rate tick of its own (not
+//              tied to vsync), so a drag moves the camera and renders at
+//              most once per tick. A move arriving after a quiet period is
+//              passed on at once and starts the tick, which stops again once
+//              a tick finds nothing to deliver. Presses, releases, wheel and
+//              key events deliver the held move first, so the interactor
+//              sees events in order. The latency from a drag (a move with
+//              a button held) to the end of the rendered frame is measured
+//              on the render window.
+//
+// Properties:
+// - view: The widget filtered
+// - tick: Fixed-rate timer delivering held moves
+// - events: Connection to the EndEvent of the render window
+// - pending: Whether a move is held
+// - pending_position, pending_window, pending_screen: Where it happened
+// - pending_buttons, pending_modifiers: Buttons and modifiers held
+// - pending_since: Arrival of the oldest move merged into the held one
+// - frame_pending, frame_input: Whether a delivered drag waits for its
+//                                frame, and when that drag arrived
+// - delivering: Set while the filter sends a held move to the widget
+// - latencies: Recent latencies, in ms
+// - counters: Counters
+//
+// Methods:
+// - setRate: Sets the tick rate, 0 disables pacing
+// - rate: Returns the tick rate
+// - stats: Returns the counters and the latency
+//
+// Example usage:
+//   auto pacer = new FramePacer(view, view->renderWindow(), this);
+//   pacer->setRate(60.0);
+//
+// ----------------------------------------------------------------------------
+class FramePacer : public QObject
+{
+  Q_OBJECT
+public:
+    static constexpr double kDefaultRate = 60.0;  // Ticks per second
+    static constexpr std::size_t kLatencySamples = 120;
+
+    // Constructor/Destructor
+    FramePacer(
+        QWidget* view,
+        vtkRenderWindow* window,
+        QObject* parent = nullptr
+        );
+    ~FramePacer() override = default;
+
+    void setRate(double hz);  // 0 passes every event through
+    double rate() const { return this->tick_rate; }
+    FramePacerStats stats() const;
+
+protected:
+    bool eventFilter(QObject* watched, QEvent* event) override;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    void deliver();  // Sends the held move to the view
+    void onTick();
+    void frameRendered();
+
+    QPointer<QWidget> view;
+    QPointer<QTimer> tick;
+    EventDispatcher events;
+    double tick_rate = kDefaultRate;
+
+    bool pending = false;
+    QPointF pending_position;
+    QPointF pending_window;
+    QPointF pending_screen;
+    Qt::MouseButtons pending_buttons;
+    Qt::KeyboardModifiers pending_modifiers;
+    Clock::time_point pending_since;
+
+    bool frame_pending = false;
+    Clock::time_point frame_input;
+    bool delivering = false;
+
+    std::deque<double> latencies;
+    FramePacerStats counters;
+};
+
+#endif  // FramePacer_H
@@ -0,0 +1,152 @@
+// ============================================================================
+// FrameProtocol.h - Wire format shared by the frame server and its clients
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * FrameProtocol.h: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// The client talks to the server with newline terminated text commands:
+//
+//   ENCODING <jpeg|png|raw|lz4> [quality]  Selects the encoding of this link
+//   AZIMUTH <degrees>                      Rotates the camera about view up
+//   ELEVATION <degrees>                    Rotates the camera about the
+//                                          cross of view plane normal and
+//                                          view up
+//   ROLL <degrees>                         Rotates the camera about the
+//                                          direction of projection
+//   ZOOM <factor>                          Dollies the camera
+//   RESET                                  Resets the camera
+//   FRAME                                  Asks for a fresh frame
+//   QUIT                                   Closes the link
+//
+// The server answers with binary frames, each a FrameHeader followed by
+// payload_size bytes of payload. Raw payloads are tightly packed RGB rows
+// ordered bottom to top, as VTK stores them. LZ4 payloads decompress to the
+// same layout, raw_size bytes long. Integers are in host byte order; the
+// protocol is meant for local links only.
+//
+// ============================================================================
+
+
+#ifndef FrameProtocol_H
+#define FrameProtocol_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// "C" system headers
+
+// Standard Library headers
+#include <cstdint>
+#include <string>
+
+
+// ============================================================================
+// Global constants section
+// ============================================================================
+
+constexpr char kFrameMagic[4] = {'Q', 'V', 'F', '1'};
+
+
+// ============================================================================
+// Type Definitions Section
+// ============================================================================
+
+enum class FrameEncoding : std::uint32_t {
+    Raw = 0,
+    Lz4 = 1,
+    Png = 2,
+    Jpeg = 3
+};
+
+// ----------------------------------------------------------------------------
+// FrameHeader
+// ----------------------------------------------------------------------------
+//
+// Description: Precedes every frame sent by the server
+//
+// Properties:
+// - magic: Must equal kFrameMagic
+// - encoding: Encoding actually used for the payload (a FrameEncoding)
+// - width: Frame width in pixels
+// - height: Frame height in pixels
+// - frame_id: Sequence number of the rendered frame. Gaps mean frames were
+//             dropped for this link because it could not keep up.
+// - raw_size: Size of the decoded RGB payload in bytes
+// - payload_size: Number of payload bytes following the header
+//
+// ----------------------------------------------------------------------------
+struct FrameHeader {
+    char          magic[4];
+    std::uint32_t encoding;
+    std::uint32_t width;
+    std::uint32_t height;
+    std::uint64_t frame_id;
+    std::uint32_t raw_size;
+    std::uint32_t payload_size;
+};
+
+
+// ============================================================================
+// Inline functions section
+// ============================================================================
+
+inline const char* frameEncodingName(FrameEncoding encoding)
+{
+    switch (encoding) {
+        case FrameEncoding::Lz4:
+            return "lz4";
+        case FrameEncoding::Png:
+            return "png";
+        case FrameEncoding::Jpeg:
+            return "jpeg";
+        default:
+            return "raw";
+    }
+}
+
+inline bool parseFrameEncoding(const std::string& name, FrameEncoding& out)
+{
+    if (name == "raw") {
+        out = FrameEncoding::Raw;
+    } else if (name == "lz4") {
+        out = FrameEncoding::Lz4;
+    } else if (name == "png") {
+        out = FrameEncoding::Png;
+    } else if (name == "jpeg" || name == "jpg") {
+        out = FrameEncoding::Jpeg;
+    } else {
+        return false;
+    }
+
+    return true;
+}
+
+#endif  // FrameProtocol_H
@@ -0,0 +1,607 @@
+// ============================================================================
+// FrameRateController.cxx - Implementation of the FrameRateController class
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * FrameRateController.cxx: created.
+// * FrameRateController.cxx: interactions are taken from the desired update
+//   rate of the render window, so every style and widget is seen.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header -------------------------------------------------------------
+#include "FrameRateController.h"
+
+// "C" system headers ---------------------------------------------------------
+
+// Standard Library headers ---------------------------------------------------
+#include <algorithm>
+
+// External libraries headers -------------------------------------------------
+
+// VTK headers
+#include <vtkCommand.h>
+#include <vtkFixedPointVolumeRayCastMapper.h>
+#include <vtkGPUVolumeRayCastMapper.h>
+#include <vtkVolume.h>
+#include <vtkVolumeCollection.h>
+
+
+// ============================================================================
+// Local helpers section
+// ============================================================================
+
+namespace {
+
+// Weight of the newest frame in the smoothed frame time
+const double kSmoothing = 0.3;
+
+// Frames slower than budget * kSlowFactor count as too slow, frames faster
+// than budget * kFastFactor as fast enough to raise the quality again
+const double kSlowFactor = 1.1;
+const double kFastFactor = 0.5;
+
+// Volume image sample distance per quality level, 0 keeps the original
+const double kImageSampleDistance[FrameRateController::kLevelCount] = {
+    0.0, 0.0, 2.0, 4.0
+};
+
+// vtkGPUVolumeRayCastMapper and vtkFixedPointVolumeRayCastMapper have the
+// same sample distance API without sharing a base class that declares it
+template <typename Mapper>
+bool setImageSampleDistance(
+    vtkAbstractVolumeMapper* abstract_mapper,
+    double distance,
+    bool auto_adjust
+    )
+{
+    auto mapper = Mapper::SafeDownCast(abstract_mapper);
+    if (mapper == nullptr) {
+        return false;
+    }
+    mapper->SetAutoAdjustSampleDistances(auto_adjust ? 1 : 0);
+    mapper->SetImageSampleDistance(distance);
+    return true;
+}
+
+template <typename Mapper>
+bool getImageSampleDistance(
+    vtkAbstractVolumeMapper* abstract_mapper,
+    double& distance,
+    bool& auto_adjust
+    )
+{
+    auto mapper = Mapper::SafeDownCast(abstract_mapper);
+    if (mapper == nullptr) {
+        return false;
+    }
+    auto_adjust = mapper->GetAutoAdjustSampleDistances() != 0;
+    distance = mapper->GetImageSampleDistance();
+    return true;
+}
+
+}  // namespace
+
+
+// ============================================================================
+// Constructor/Destructor Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// FrameRateController::FrameRateController
+// ----------------------------------------------------------------------------
+//
+// Description: Constructor. The default target is 30 frames per second.
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+FrameRateController::FrameRateController()
+    : target_fps(30.0),
+      level(0),
+      interaction_level(0),
+      slow_frames(0),
+      fast_frames(0),
+      interacting(false),
+      frame_seconds(0.0),
+      multi_samples(0),
+      desired_update_rate(0.0)
+{
+}
+
+// ----------------------------------------------------------------------------
+// FrameRateController::~FrameRateController
+// ----------------------------------------------------------------------------
+//
+// Description: Destructor
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Restores full quality
+//
+// ----------------------------------------------------------------------------
+FrameRateController::~FrameRateController()
+{
+    this->detach();
+}
+
+
+// ============================================================================
+// Public Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// FrameRateController::attach
+// ----------------------------------------------------------------------------
+//
+// Description: Starts measuring the renderer and controlling the quality of
+//              its render window during interaction
+//
+// Inputs:
+// - renderer: Renderer to measure, its render window is controlled too
+// - interactor: Interactor of the render window
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Sets the desired update rate of the interactor to the
+//               target frame rate
+//
+// ----------------------------------------------------------------------------
+void FrameRateController::attach(
+    vtkRenderer* renderer,
+    vtkRenderWindowInteractor* interactor
+    )
+{
+    this->detach();
+    if (renderer == nullptr || interactor == nullptr) {
+        return;
+    }
+
+    this->renderer = renderer;
+    this->render_window = renderer->GetRenderWindow();
+    this->interactor = interactor;
+    this->multi_samples = this->render_window != nullptr
+        ? this->render_window->GetMultiSamples()
+        : 0;
+    this->desired_update_rate = interactor->GetDesiredUpdateRate();
+    interactor->SetDesiredUpdateRate(this->target_fps);
+
+    this->events.connect(
+        renderer,
+        vtkCommand::StartEvent,
+        [this](vtkObject*, unsigned long) { this->onRenderStart(); }
+        );
+    this->events.connect(
+        renderer,
+        vtkCommand::EndEvent,
+        [this](vtkObject*, unsigned long) { this->onRenderEnd(); }
+        );
+
+    // Interactor styles and widgets alike start an interaction by raising
+    // the desired update rate of the render window to the one of the
+    // interactor, and end it by lowering it to the still update rate. This
+    // sees every style, also after a style switch changes it, and every
+    // widget. The rate is set before the first and the still render.
+    if (this->render_window != nullptr) {
+        this->events.connect(
+            this->render_window,
+            vtkCommand::ModifiedEvent,
+            [this](vtkObject*, unsigned long) { this->onWindowModified(); }
+            );
+    }
+}
+
+// ----------------------------------------------------------------------------
+// FrameRateController::detach
+// ----------------------------------------------------------------------------
+//
+// Description: Stops controlling the renderer
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Restores full quality and the original desired update rate
+//
+// ----------------------------------------------------------------------------
+void FrameRateController::detach()
+{
+    this->events.disconnectAll();
+    if (this->renderer == nullptr) {
+        return;
+    }
+
+    this->applyLevel(0);
+    if (this->interactor != nullptr) {
+        this->interactor->SetDesiredUpdateRate(this->desired_update_rate);
+    }
+    this->renderer = nullptr;
+    this->render_window = nullptr;
+    this->interactor = nullptr;
+    this->interacting = false;
+    this->interaction_level = 0;
+}
+
+// ----------------------------------------------------------------------------
+// FrameRateController::setTargetFrameRate
+// ----------------------------------------------------------------------------
+//
+// Description: Sets the frame rate to hold during interaction
+//
+// Inputs:
+// - fps: Frames per second, values below 1 are raised to 1
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Updates the desired update rate of the interactor
+//
+// ----------------------------------------------------------------------------
+void FrameRateController::setTargetFrameRate(double fps)
+{
+    this->target_fps = std::max(1.0, fps);
+    this->interaction_level = 0;
+    if (this->interactor != nullptr) {
+        this->interactor->SetDesiredUpdateRate(this->target_fps);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// FrameRateController::framesPerSecond
+// ----------------------------------------------------------------------------
+//
+// Description: Returns the frame rate the renderer could sustain, derived
+//              from the smoothed frame time
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: Frames per second, 0 before the first frame
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+double FrameRateController::framesPerSecond() const
+{
+    return this->frame_seconds > 0.0 ? 1.0 / this->frame_seconds : 0.0;
+}
+
+
+// ============================================================================
+// Private Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// FrameRateController::onRenderStart
+// ----------------------------------------------------------------------------
+//
+// Description: Remembers when the renderer started rendering
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void FrameRateController::onRenderStart()
+{
+    this->render_started = std::chrono::steady_clock::now();
+}
+
+// ----------------------------------------------------------------------------
+// FrameRateController::onRenderEnd
+// ----------------------------------------------------------------------------
+//
+// Description: Updates the smoothed frame time and, while interacting,
+//              lowers or raises the quality level
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: May change render window and volume mapper settings
+//
+// ----------------------------------------------------------------------------
+void FrameRateController::onRenderEnd()
+{
+    const double elapsed = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - this->render_started
+        ).count();
+    this->frame_seconds = this->frame_seconds > 0.0
+        ? (1.0 - kSmoothing) * this->frame_seconds + kSmoothing * elapsed
+        : elapsed;
+
+    if (!this->interacting) {
+        return;
+    }
+
+    const double budget = 1.0 / this->target_fps;
+    if (this->frame_seconds > budget * kSlowFactor) {
+        this->fast_frames = 0;
+        if (++this->slow_frames >= kSettleFrames
+            && this->level < kLevelCount - 1) {
+            this->applyLevel(this->level + 1);
+        }
+    } else if (this->frame_seconds < budget * kFastFactor) {
+        this->slow_frames = 0;
+        if (++this->fast_frames >= kSettleFrames && this->level > 0) {
+            this->applyLevel(this->level - 1);
+        }
+    } else {
+        this->slow_frames = 0;
+        this->fast_frames = 0;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// FrameRateController::onWindowModified
+// ----------------------------------------------------------------------------
+//
+// Description: Starts or ends the interaction when the desired update rate
+//              of the render window moves above or back to the still update
+//              rate of the interactor
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: May change render window and volume mapper settings
+//
+// ----------------------------------------------------------------------------
+void FrameRateController::onWindowModified()
+{
+    if (this->render_window == nullptr || this->interactor == nullptr) {
+        return;
+    }
+
+    const bool moving = this->render_window->GetDesiredUpdateRate()
+        > this->interactor->GetStillUpdateRate();
+    if (moving && !this->interacting) {
+        this->onInteractionStart();
+    } else if (!moving && this->interacting) {
+        this->onInteractionEnd();
+    }
+}
+
+// ----------------------------------------------------------------------------
+// FrameRateController::onInteractionStart
+// ----------------------------------------------------------------------------
+//
+// Description: Saves the full quality settings and switches to the level
+//              the previous interaction ended with
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: May change render window and volume mapper settings
+//
+// ----------------------------------------------------------------------------
+void FrameRateController::onInteractionStart()
+{
+    this->interacting = true;
+    this->saveVolumeSettings();
+    this->applyLevel(this->interaction_level);
+}
+
+// ----------------------------------------------------------------------------
+// FrameRateController::onInteractionEnd
+// ----------------------------------------------------------------------------
+//
+// Description: Restores full quality for the still render
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Restores render window and volume mapper settings
+//
+// ----------------------------------------------------------------------------
+void FrameRateController::onInteractionEnd()
+{
+    this->interacting = false;
+    this->interaction_level = this->level;
+    this->applyLevel(0);
+}
+
+// ----------------------------------------------------------------------------
+// FrameRateController::applyLevel
+// ----------------------------------------------------------------------------
+//
+// Description: Switches to a quality level
+//
+// Inputs:
+// - new_level: Quality level, 0 is full quality
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Changes render window, interactor and volume mapper settings
+//
+// ----------------------------------------------------------------------------
+void FrameRateController::applyLevel(int new_level)
+{
+    new_level = std::clamp(new_level, 0, kLevelCount - 1);
+    this->slow_frames = 0;
+    this->fast_frames = 0;
+    if (new_level == this->level && new_level != 0) {
+        return;
+    }
+    this->level = new_level;
+
+    if (this->render_window != nullptr) {
+        this->render_window->SetMultiSamples(
+            new_level == 0 ? this->multi_samples : 0
+            );
+    }
+
+    // Props with levels of detail pick them from the allocated render time
+    const double update_rate = new_level == kLevelCount - 1
+        ? 2.0 * this->target_fps
+        : this->target_fps;
+    if (this->interactor != nullptr) {
+        this->interactor->SetDesiredUpdateRate(update_rate);
+    }
+    if (this->interacting && this->render_window != nullptr) {
+        this->render_window->SetDesiredUpdateRate(update_rate);
+    }
+
+    if (kImageSampleDistance[new_level] == 0.0) {
+        this->restoreVolumeSettings();
+        return;
+    }
+    for (const auto& settings : this->volumes) {
+        if (settings.mapper == nullptr) {
+            continue;
+        }
+        const double distance = std::max(
+            settings.image_sample_distance,
+            kImageSampleDistance[new_level]
+            );
+        setImageSampleDistance<vtkGPUVolumeRayCastMapper>(
+            settings.mapper, distance, false
+            )
+            || setImageSampleDistance<vtkFixedPointVolumeRayCastMapper>(
+                settings.mapper, distance, false
+                );
+    }
+}
+
+// ----------------------------------------------------------------------------
+// FrameRateController::saveVolumeSettings
+// ----------------------------------------------------------------------------
+//
+// Description: Records the sample distance settings of every volume of the
+//              renderer. Volumes can come and go, so this is done at the
+//              start of each interaction.
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void FrameRateController::saveVolumeSettings()
+{
+    this->volumes.clear();
+    if (this->renderer == nullptr) {
+        return;
+    }
+
+    vtkVolumeCollection* collection = this->renderer->GetVolumes();
+    vtkCollectionSimpleIterator iterator;
+    collection->InitTraversal(iterator);
+    while (vtkVolume* volume = collection->GetNextVolume(iterator)) {
+        VolumeSettings settings;
+        settings.mapper = volume->GetMapper();
+        if (settings.mapper == nullptr) {
+            continue;
+        }
+        const bool known =
+            getImageSampleDistance<vtkGPUVolumeRayCastMapper>(
+                settings.mapper,
+                settings.image_sample_distance,
+                settings.auto_adjust
+                )
+            || getImageSampleDistance<vtkFixedPointVolumeRayCastMapper>(
+                settings.mapper,
+                settings.image_sample_distance,
+                settings.auto_adjust
+                );
+        if (known) {
+            this->volumes.push_back(settings);
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// FrameRateController::restoreVolumeSettings
+// ----------------------------------------------------------------------------
+//
+// Description: Puts back the sample distance settings saved at the start of
+//              the interaction
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void FrameRateController::restoreVolumeSettings()
+{
+    for (const auto& settings : this->volumes) {
+        if (settings.mapper == nullptr) {
+            continue;
+        }
+        setImageSampleDistance<vtkGPUVolumeRayCastMapper>(
+            settings.mapper,
+            settings.image_sample_distance,
+            settings.auto_adjust
+            )
+            || setImageSampleDistance<vtkFixedPointVolumeRayCastMapper>(
+                settings.mapper,
+                settings.image_sample_distance,
+                settings.auto_adjust
+                );
+    }
+}
@@ -0,0 +1,164 @@
+// ============================================================================
+// FrameRateController.h - Trades image quality for a steady frame rate
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * FrameRateController.h: created.
+// * FrameRateController.h: interactions follow the desired update rate of
+//   the render window.
+//
+// ============================================================================
+
+
+#ifndef FrameRateController_H
+#define FrameRateController_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// "C" system headers
+
+// Standard Library headers
+#include <chrono>
+#include <vector>
+
+// External libraries headers
+#include <vtkAbstractVolumeMapper.h>
+#include <vtkRenderWindow.h>
+#include <vtkRenderWindowInteractor.h>
+#include <vtkRenderer.h>
+#include <vtkWeakPointer.h>
+
+// Project headers
+#include "EventDispatcher.h"
+
+
+// ============================================================================
+// Class Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// FrameRateController
+// ----------------------------------------------------------------------------
+//
+// Description: Holds a target frame rate while the user interacts. Frame
+//              times are measured between the StartEvent and EndEvent of the
+//              renderer and smoothed. While interacting, the controller steps
+//              through quality levels:
+//
+//                0  full quality
+//                1  multisampling off
+//                2  as 1, volume image sample distance 2
+//                3  as 2, volume image sample distance 4 and twice the
+//                   desired update rate, so LOD props pick coarser levels
+//
+//              A level changes only after kSettleFrames frames in a row are
+//              too slow (or clearly fast enough), so it does not oscillate.
+//              When the interaction ends the full quality settings are put
+//              back before the interactor style renders the still frame. The
+//              level reached is kept as the starting point of the next
+//              interaction. An interaction is seen by the desired update
+//              rate of the render window, which interactor styles and
+//              widgets raise while they interact, so it works with any
+//              style and also for widgets.
+//
+// Properties:
+// - target_fps: Frame rate to hold while interacting
+// - level: Current quality level
+// - frame_seconds: Smoothed frame time
+// - interacting: Whether an interaction is in progress
+//
+// Methods:
+// - attach: Starts controlling a renderer and its interactor
+// - detach: Stops controlling and restores full quality
+// - setTargetFrameRate: Sets the frame rate to hold
+// - framesPerSecond: Returns the measured frame rate
+// - qualityLevel: Returns the current quality level
+//
+// Example usage:
+//   FrameRateController controller;
+//   controller.setTargetFrameRate(30.0);
+//   controller.attach(renderer, interactor);
+//
+// ----------------------------------------------------------------------------
+class FrameRateController
+{
+public:
+    static constexpr int kLevelCount = 4;
+    static constexpr int kSettleFrames = 3;
+
+    // Constructor/Destructor
+    FrameRateController();
+    ~FrameRateController();
+
+    FrameRateController(const FrameRateController&) = delete;
+    FrameRateController& operator=(const FrameRateController&) = delete;
+
+    void attach(vtkRenderer* renderer, vtkRenderWindowInteractor* interactor);
+    void detach();
+    void setTargetFrameRate(double fps);
+
+    double targetFrameRate() const { return this->target_fps; }
+    double framesPerSecond() const;
+    int qualityLevel() const { return this->level; }
+    bool isInteracting() const { return this->interacting; }
+
+private:
+    struct VolumeSettings {
+        vtkWeakPointer<vtkAbstractVolumeMapper> mapper;
+        double image_sample_distance = 1.0;
+        bool auto_adjust = true;
+    };
+
+    void onRenderStart();
+    void onRenderEnd();
+    void onWindowModified();  // Follows the desired update rate
+    void onInteractionStart();
+    void onInteractionEnd();
+    void applyLevel(int new_level);
+    void saveVolumeSettings();
+    void restoreVolumeSettings();
+
+    vtkWeakPointer<vtkRenderer> renderer;
+    vtkWeakPointer<vtkRenderWindow> render_window;
+    vtkWeakPointer<vtkRenderWindowInteractor> interactor;
+    EventDispatcher events;
+
+    double target_fps;
+    int level;
+    int interaction_level;  // Level to start the next interaction with
+    int slow_frames;
+    int fast_frames;
+    bool interacting;
+    double frame_seconds;
+    std::chrono::steady_clock::time_point render_started;
+
+    // Full quality settings, restored when the interaction ends
+    int multi_samples;
+    double desired_update_rate;
+    std::vector<VolumeSettings> volumes;
+};
+
+#endif  // FrameRateController_H
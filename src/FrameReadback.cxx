@@ -0,0 +1,404 @@
+// ============================================================================
+// FrameReadback.cxx - Offscreen frames read back into pooled, reusable buffers
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * FrameReadback.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header -------------------------------------------------------------
+#include "FrameReadback.h"
+
+// Standard Library headers ---------------------------------------------------
+#include <algorithm>
+#include <utility>
+
+// External libraries headers -------------------------------------------------
+
+// VTK headers
+#include <vtkSystemIncludes.h>
+
+
+// ============================================================================
+// Local helpers section
+// ============================================================================
+
+namespace {
+
+// Resizes a pooled vector, counting the resizes that had to allocate
+template <typename T>
+void fitBuffer(std::vector<T>& buffer, std::size_t size, std::uint64_t& grown)
+{
+    if (buffer.capacity() < size) {
+        ++grown;
+    }
+    buffer.resize(size);
+}
+
+// Points the readback array at the buffer, so the window reads in place
+template <typename Array, typename T>
+void wrapBuffer(Array* readback, std::vector<T>& buffer, int components)
+{
+    readback->SetNumberOfComponents(components);
+    readback->SetArray(
+        buffer.data(),
+        static_cast<vtkIdType>(buffer.size()),
+        1
+        );
+}
+
+// Copies what the window read if it did not read in place; it reallocates
+// the array when the size does not match, e.g. while the window is resized
+template <typename Array, typename T>
+void keepReadback(Array* readback, std::vector<T>& buffer)
+{
+    const T* data = readback->GetPointer(0);
+    if (data == buffer.data()) {
+        return;
+    }
+    const std::size_t count = std::min<std::size_t>(
+        buffer.size(),
+        static_cast<std::size_t>(readback->GetNumberOfValues())
+        );
+    std::copy(data, data + count, buffer.begin());
+}
+
+}  // namespace
+
+
+// ============================================================================
+// FrameBufferPool Constructor/Destructor Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// FrameBufferPool::FrameBufferPool
+// ----------------------------------------------------------------------------
+//
+// Description: Constructor. No buffer is created before it is needed.
+//
+// Inputs:
+// - capacity: Most buffers that exist at once, at least 1
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+FrameBufferPool::FrameBufferPool(std::size_t capacity)
+    : state(std::make_shared<State>())
+{
+    this->state->capacity = std::max<std::size_t>(1, capacity);
+}
+
+
+// ============================================================================
+// FrameBufferPool Public Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// FrameBufferPool::acquire
+// ----------------------------------------------------------------------------
+//
+// Description: Hands out a free buffer, or creates one if the pool is below
+//              its capacity, sized for a frame
+//
+// Inputs:
+// - width, height: Frame size in pixels
+// - with_depth: Whether the depth buffer is read too
+//
+// Outputs: None
+//
+// Returns: The buffer, or null when every buffer is in use
+//
+// Side Effects: Buffers grow, and are never shrunk
+//
+// ----------------------------------------------------------------------------
+std::shared_ptr<FrameBuffer> FrameBufferPool::acquire(
+    int width,
+    int height,
+    bool with_depth
+    )
+{
+    const std::size_t pixels = static_cast<std::size_t>(std::max(0, width))
+        * static_cast<std::size_t>(std::max(0, height));
+
+    std::unique_ptr<FrameBuffer> buffer;
+    std::uint64_t grown = 0;
+    {
+        std::lock_guard<std::mutex> lock(this->state->mutex);
+        if (!this->state->free.empty()) {
+            buffer = std::move(this->state->free.back());
+            this->state->free.pop_back();
+        } else if (this->state->created < this->state->capacity) {
+            buffer = std::make_unique<FrameBuffer>();
+            ++this->state->created;
+        } else {
+            return nullptr;
+        }
+        ++this->state->in_use;
+    }
+
+    // Sized outside the lock, the buffer belongs to the caller now
+    fitBuffer(buffer->rgba, 4 * pixels, grown);
+    if (with_depth) {
+        fitBuffer(buffer->depth, pixels, grown);
+    }
+    if (grown > 0) {
+        std::lock_guard<std::mutex> lock(this->state->mutex);
+        this->state->allocations += grown;
+    }
+
+    std::weak_ptr<State> owner = this->state;
+    return std::shared_ptr<FrameBuffer>(
+        buffer.release(),
+        [owner](FrameBuffer* returned) {
+            std::unique_ptr<FrameBuffer> kept(returned);
+            if (auto pool = owner.lock()) {
+                std::lock_guard<std::mutex> lock(pool->mutex);
+                pool->free.push_back(std::move(kept));
+                --pool->in_use;
+            }
+        }
+        );
+}
+
+// ----------------------------------------------------------------------------
+// FrameBufferPool::capacity
+// ----------------------------------------------------------------------------
+//
+// Description: Returns the most buffers that exist at once
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: The capacity
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+std::size_t FrameBufferPool::capacity() const
+{
+    return this->state->capacity;
+}
+
+// ----------------------------------------------------------------------------
+// FrameBufferPool::inUse
+// ----------------------------------------------------------------------------
+//
+// Description: Returns the buffers handed out and not yet returned
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: The buffers in use
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+std::size_t FrameBufferPool::inUse() const
+{
+    std::lock_guard<std::mutex> lock(this->state->mutex);
+    return this->state->in_use;
+}
+
+// ----------------------------------------------------------------------------
+// FrameBufferPool::allocations
+// ----------------------------------------------------------------------------
+//
+// Description: Returns how often a buffer had to grow. It stops counting
+//              once every buffer has reached the frame size.
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: The allocations
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+std::uint64_t FrameBufferPool::allocations() const
+{
+    std::lock_guard<std::mutex> lock(this->state->mutex);
+    return this->state->allocations;
+}
+
+
+// ============================================================================
+// FrameReadback Constructor/Destructor Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// FrameReadback::FrameReadback
+// ----------------------------------------------------------------------------
+//
+// Description: Constructor
+//
+// Inputs:
+// - window: The window to read, onscreen or offscreen
+// - buffers: Buffers of the pool, the most views held at once
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+FrameReadback::FrameReadback(vtkRenderWindow* window, std::size_t buffers)
+    : window(window), buffers(buffers)
+{
+    this->color_readback = vtkSmartPointer<vtkUnsignedCharArray>::New();
+    this->depth_readback = vtkSmartPointer<vtkFloatArray>::New();
+}
+
+
+// ============================================================================
+// FrameReadback Public Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// FrameReadback::render
+// ----------------------------------------------------------------------------
+//
+// Description: Renders the window and reads the frame (see read)
+//
+// Inputs:
+// - with_depth: Whether to read the depth buffer too
+//
+// Outputs:
+// - frame: The frame, replacing the view it held
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: Renders the window
+//
+// ----------------------------------------------------------------------------
+bool FrameReadback::render(
+    FrameView* frame,
+    bool with_depth,
+    std::string* error
+    )
+{
+    this->window->Render();
+    return this->read(frame, with_depth, error);
+}
+
+// ----------------------------------------------------------------------------
+// FrameReadback::read
+// ----------------------------------------------------------------------------
+//
+// Description: Reads the frame last rendered into a pooled buffer. The
+//              view the frame held is released first, so a caller reading
+//              into the same view in a loop needs a single buffer.
+//
+// Inputs:
+// - with_depth: Whether to read the depth buffer too
+//
+// Outputs:
+// - frame: The frame, replacing the view it held
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false when the window has no size or every
+//          buffer of the pool is held by other views
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool FrameReadback::read(
+    FrameView* frame,
+    bool with_depth,
+    std::string* error
+    )
+{
+    frame->release();
+
+    const int* size = this->window->GetSize();
+    const int width = size[0];
+    const int height = size[1];
+    if (width <= 0 || height <= 0) {
+        if (error) {
+            *error = "The render window has no size";
+        }
+        return false;
+    }
+
+    std::shared_ptr<FrameBuffer> buffer = this->buffers.acquire(
+        width,
+        height,
+        with_depth
+        );
+    if (!buffer) {
+        if (error) {
+            *error = "All " + std::to_string(this->buffers.capacity())
+                + " frame buffers are held by earlier frames";
+        }
+        return false;
+    }
+
+    wrapBuffer(this->color_readback.Get(), buffer->rgba, 4);
+    if (this->window->GetRGBACharPixelData(
+            0, 0, width - 1, height - 1, 0, this->color_readback
+            ) != VTK_OK) {
+        if (error) {
+            *error = "Cannot read the pixels of the render window";
+        }
+        return false;
+    }
+    keepReadback(this->color_readback.Get(), buffer->rgba);
+
+    if (with_depth) {
+        wrapBuffer(this->depth_readback.Get(), buffer->depth, 1);
+        if (this->window->GetZbufferData(
+                0, 0, width - 1, height - 1, this->depth_readback
+                ) != VTK_OK) {
+            if (error) {
+                *error = "Cannot read the depth buffer of the render window";
+            }
+            return false;
+        }
+        keepReadback(this->depth_readback.Get(), buffer->depth);
+    }
+
+    frame->rgba = buffer->rgba.data();
+    frame->depth = with_depth ? buffer->depth.data() : nullptr;
+    frame->width = width;
+    frame->height = height;
+    frame->id = ++this->frame_count;
+    frame->buffer = std::move(buffer);
+
+    return true;
+}
@@ -0,0 +1,241 @@
+// ============================================================================
+// FrameReadback.h - Offscreen frames read back into pooled, reusable buffers
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * FrameReadback.h: created.
+//
+// ============================================================================
+
+
+#ifndef FrameReadback_H
+#define FrameReadback_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Standard Library headers
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// External libraries headers
+#include <vtkFloatArray.h>
+#include <vtkRenderWindow.h>
+#include <vtkSmartPointer.h>
+#include <vtkUnsignedCharArray.h>
+
+
+// ============================================================================
+// Structure Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// FrameBuffer
+// ----------------------------------------------------------------------------
+//
+// Description: Storage of one frame in a FrameBufferPool. The vectors only
+//              grow, so a buffer reused at the same size never allocates.
+//
+// Properties:
+// - rgba: Color, 4 bytes per pixel
+// - depth: Depth, one float per pixel, empty if never read
+//
+// ----------------------------------------------------------------------------
+struct FrameBuffer {
+    std::vector<unsigned char> rgba;
+    std::vector<float> depth;
+};
+
+// ----------------------------------------------------------------------------
+// FrameView
+// ----------------------------------------------------------------------------
+//
+// Description: A rendered frame, as pointers into a pooled FrameBuffer.
+//              While the view (or a copy of it) exists the buffer stays out
+//              of the pool; releasing the last copy, on any thread, hands it
+//              back. Rows run bottom to top, as OpenGL reads them.
+//
+// Properties:
+// - rgba: width * height RGBA pixels, null for an empty view
+// - depth: width * height depth values in the range 0 (near) to 1 (far),
+//          null if depth was not read
+// - width, height: Frame size in pixels
+// - id: Number of the frame, counted by its FrameReadback from 1
+// - buffer: Keeps the buffer out of the pool
+//
+// ----------------------------------------------------------------------------
+struct FrameView {
+    const unsigned char* rgba = nullptr;
+    const float* depth = nullptr;
+    int width = 0;
+    int height = 0;
+    std::uint64_t id = 0;
+    std::shared_ptr<const FrameBuffer> buffer;
+
+    bool empty() const { return this->rgba == nullptr; }
+    void release() { *this = FrameView(); }  // Hands the buffer back
+};
+
+
+// ============================================================================
+// Class Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// FrameBufferPool
+// ----------------------------------------------------------------------------
+//
+// Description: A bounded, thread-safe pool of FrameBuffers. Buffers are
+//              created on demand up to the capacity and then reused; a
+//              buffer handed out returns to the pool when the last
+//              shared_ptr to it goes, even if the pool is gone by then
+//              (the buffer is then freed).
+//
+// Properties:
+// - state: Free buffers and counters, shared with the buffers handed out
+//
+// Methods:
+// - acquire: Hands out a buffer sized for a frame
+// - capacity: Returns the most buffers that exist at once
+// - inUse: Returns the buffers handed out and not yet returned
+// - allocations: Returns how often a buffer had to grow
+//
+// Example usage:
+//   FrameBufferPool pool(2);
+//   std::shared_ptr<FrameBuffer> buffer = pool.acquire(640, 480, false);
+//
+// ----------------------------------------------------------------------------
+class FrameBufferPool
+{
+public:
+    // Constructor/Destructor
+    explicit FrameBufferPool(std::size_t capacity);
+    ~FrameBufferPool() = default;
+
+    FrameBufferPool(const FrameBufferPool&) = delete;
+    FrameBufferPool& operator=(const FrameBufferPool&) = delete;
+
+    std::shared_ptr<FrameBuffer> acquire(
+        int width,
+        int height,
+        bool with_depth
+        );  // Null when every buffer is in use
+    std::size_t capacity() const;
+    std::size_t inUse() const;
+    std::uint64_t allocations() const;
+
+private:
+    struct State {
+        mutable std::mutex mutex;
+        std::vector<std::unique_ptr<FrameBuffer>> free;
+        std::size_t capacity = 0;
+        std::size_t created = 0;
+        std::size_t in_use = 0;
+        std::uint64_t allocations = 0;
+    };
+
+    std::shared_ptr<State> state;
+};
+
+// ----------------------------------------------------------------------------
+// FrameReadback
+// ----------------------------------------------------------------------------
+//
+// Description: Renders a window and reads its pixels, and optionally its
+//              depth buffer, straight into a pooled FrameBuffer: the VTK
+//              arrays the window reads into wrap the buffer's memory, so
+//              there is no per-frame allocation and no copy between the
+//              read and the consumer. The window is usually the offscreen
+//              window of an OffscreenScene, built like the main window's
+//              scene; the view of the main window works as well. Render and
+//              read on the thread that owns the window's context; views can
+//              be handed to and released on any thread.
+//
+// Properties:
+// - window: The window read
+// - buffers: The pool the views point into
+// - color_readback, depth_readback: Arrays wrapping the buffer being read
+// - frame_count: Frames read
+//
+// Methods:
+// - render: Renders the window and reads the frame
+// - read: Reads the frame last rendered
+// - pool: Returns the buffer pool
+// - frames: Returns the number of frames read
+//
+// Example usage:
+//   OffscreenScene scene(1280, 720);
+//   scene.setScene(SceneDescription());
+//   FrameReadback readback(scene.renderWindow());
+//   FrameView frame;
+//   if (readback.render(&frame, true)) {
+//       consume(frame.rgba, frame.depth, frame.width, frame.height);
+//   }
+//   frame.release();
+//
+// ----------------------------------------------------------------------------
+class FrameReadback
+{
+public:
+    // Views a consumer may hold at once while new frames are read
+    static constexpr std::size_t kDefaultBuffers = 3;
+
+    // Constructor/Destructor
+    explicit FrameReadback(
+        vtkRenderWindow* window,
+        std::size_t buffers = kDefaultBuffers
+        );
+    ~FrameReadback() = default;
+
+    FrameReadback(const FrameReadback&) = delete;
+    FrameReadback& operator=(const FrameReadback&) = delete;
+
+    bool render(
+        FrameView* frame,
+        bool with_depth = false,
+        std::string* error = nullptr
+        );
+    bool read(
+        FrameView* frame,
+        bool with_depth = false,
+        std::string* error = nullptr
+        );
+    FrameBufferPool& pool() { return this->buffers; }
+    std::uint64_t frames() const { return this->frame_count; }
+
+private:
+    vtkSmartPointer<vtkRenderWindow> window;
+    FrameBufferPool buffers;
+    vtkSmartPointer<vtkUnsignedCharArray> color_readback;
+    vtkSmartPointer<vtkFloatArray> depth_readback;
+    std::uint64_t frame_count = 0;
+};
+
+#endif  // FrameReadback_H
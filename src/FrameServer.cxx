@@ -0,0 +1,697 @@
+// ============================================================================
+// FrameServer.cxx - Implementation of the FrameServer class
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * FrameServer.cxx: created.
+// * FrameServer.cxx: links are reported through FrameServerOptions::log
+//   instead of the standard streams.
+// * FrameServer.cxx: only a socket file this server created is removed.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header -------------------------------------------------------------
+#include "FrameServer.h"
+
+// "C" system headers ---------------------------------------------------------
+
+// Standard Library headers ---------------------------------------------------
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <utility>
+
+// External libraries headers -------------------------------------------------
+
+// VTK headers
+#include <vtkCamera.h>
+
+// Project headers
+#include "Scene.h"
+
+
+// ============================================================================
+// Local helpers section
+// ============================================================================
+
+namespace {
+
+// How long the render thread sleeps when nothing happens, so it can notice
+// the stop flag
+const std::chrono::milliseconds kIdleWait(100);
+
+const int kDefaultJpegQuality = 85;
+
+}  // namespace
+
+
+// ============================================================================
+// Link Definition Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// FrameServer::Link
+// ----------------------------------------------------------------------------
+//
+// Description: State of one connected client
+//
+// Properties:
+// - id: Link number, for log messages
+// - socket: Connection to the client
+// - encoding: Encoding requested by the client
+// - quality: JPEG quality requested by the client
+// - mutex: Guards pending and closed
+// - ready: Signalled when a frame is pending or the link closes
+// - pending: Newest frame not yet picked up by the sender
+// - closed: Set once either side of the link gives up
+// - sent: Number of frames sent
+// - dropped: Number of frames replaced before they could be sent
+// - reader: Thread reading commands
+// - sender: Thread encoding and sending frames
+//
+// ----------------------------------------------------------------------------
+struct FrameServer::Link {
+    std::uint64_t id = 0;
+    Socket socket;
+    std::atomic<FrameEncoding> encoding {FrameEncoding::Jpeg};
+    std::atomic<int> quality {kDefaultJpegQuality};
+
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::shared_ptr<const RawFrame> pending;
+    bool closed = false;
+
+    std::atomic<std::uint64_t> sent {0};
+    std::atomic<std::uint64_t> dropped {0};
+
+    std::thread reader;
+    std::thread sender;
+
+    // Marks the link closed and wakes up both of its threads
+    void close()
+    {
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->closed = true;
+        }
+        this->ready.notify_all();
+        this->socket.shutdown();
+    }
+
+    bool isClosed()
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->closed;
+    }
+};
+
+
+// ============================================================================
+// Constructor/Destructor Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// FrameServer::FrameServer
+// ----------------------------------------------------------------------------
+//
+// Description: Constructor. Sets up the offscreen render window and the
+//              demo scene.
+//
+// Inputs:
+// - options: Server configuration
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+FrameServer::FrameServer(const FrameServerOptions& options)
+    : options(options),
+      frame_counter(0),
+      stopping(false),
+      link_counter(0),
+      created_socket(false)
+{
+    this->scene = std::make_unique<OffscreenScene>(
+        this->options.width,
+        this->options.height
+        );
+    this->scene->setScene(SceneDescription());
+}
+
+// ----------------------------------------------------------------------------
+// FrameServer::~FrameServer
+// ----------------------------------------------------------------------------
+//
+// Description: Destructor
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Closes all links and joins all threads
+//
+// ----------------------------------------------------------------------------
+FrameServer::~FrameServer()
+{
+    this->shutdown();
+}
+
+
+// ============================================================================
+// Public Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// FrameServer::start
+// ----------------------------------------------------------------------------
+//
+// Description: Opens the listening socket and starts accepting clients
+//
+// Inputs: None
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: true on success
+//
+// Side Effects: Starts the acceptor thread
+//
+// ----------------------------------------------------------------------------
+bool FrameServer::start(std::string* error)
+{
+    if (this->options.socket_path.empty()) {
+        this->listener = Socket::listenTcp(this->options.port, error);
+    } else {
+        this->listener = Socket::listenLocal(this->options.socket_path, error);
+        this->created_socket = this->listener.isValid();
+    }
+    if (!this->listener.isValid()) {
+        return false;
+    }
+
+    this->acceptor = std::thread(&FrameServer::acceptLoop, this);
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// FrameServer::run
+// ----------------------------------------------------------------------------
+//
+// Description: The render loop. Waits for commands and new clients, applies
+//              camera changes, renders at most one frame per wake-up no
+//              matter how many commands arrived, and hands the frame to every
+//              link's mailbox.
+//
+// Inputs:
+// - stop: Raised by the caller (e.g. from a signal handler) to finish
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Closes all links before returning
+//
+// ----------------------------------------------------------------------------
+void FrameServer::run(const std::atomic<bool>& stop)
+{
+    while (!stop.load()) {
+        std::deque<Command> batch;
+        std::vector<std::shared_ptr<Link>> joined;
+        {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            this->wakeup.wait_for(lock, kIdleWait, [this]() {
+                return !this->commands.empty() || !this->new_links.empty();
+            });
+            batch.swap(this->commands);
+            joined.swap(this->new_links);
+        }
+
+        bool render_due = false;
+        for (auto& link : joined) {
+            this->links.push_back(link);
+            if (this->last_frame) {
+                this->publish(link, this->last_frame);
+            } else {
+                render_due = true;
+            }
+        }
+        for (const auto& command : batch) {
+            render_due = this->applyCommand(command) || render_due;
+        }
+
+        // Reap links whose client went away
+        for (auto it = this->links.begin(); it != this->links.end();) {
+            if ((*it)->isClosed()) {
+                this->retireLink(*it);
+                it = this->links.erase(it);
+            } else {
+                ++it;
+            }
+        }
+
+        if (render_due) {
+            this->last_frame = this->renderFrame();
+            for (auto& link : this->links) {
+                this->publish(link, this->last_frame);
+            }
+        }
+    }
+
+    this->shutdown();
+}
+
+
+// ============================================================================
+// Private Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// FrameServer::acceptLoop
+// ----------------------------------------------------------------------------
+//
+// Description: Accepts clients and starts their reader and sender threads
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Queues new links for the render thread
+//
+// ----------------------------------------------------------------------------
+void FrameServer::acceptLoop()
+{
+    while (!this->stopping.load()) {
+        Socket socket = this->listener.accept();
+        if (!socket.isValid()) {
+            if (this->stopping.load()) {
+                break;
+            }
+            // Transient failure (e.g. out of descriptors), back off a little
+            std::this_thread::sleep_for(kIdleWait);
+            continue;
+        }
+
+        auto link = std::make_shared<Link>();
+        link->id = ++this->link_counter;
+        link->socket = std::move(socket);
+        link->reader = std::thread(&FrameServer::readLoop, this, link);
+        link->sender = std::thread(&FrameServer::sendLoop, this, link);
+        this->report("Link " + std::to_string(link->id) + " connected");
+
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->new_links.push_back(link);
+        }
+        this->wakeup.notify_one();
+    }
+}
+
+// ----------------------------------------------------------------------------
+// FrameServer::readLoop
+// ----------------------------------------------------------------------------
+//
+// Description: Reads commands from a client. Link settings are applied
+//              right here, camera commands are queued for the render thread.
+//
+// Inputs:
+// - link: The link to serve
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Closes the link when the client quits or disconnects
+//
+// ----------------------------------------------------------------------------
+void FrameServer::readLoop(std::shared_ptr<Link> link)
+{
+    std::string line;
+    while (link->socket.receiveLine(line)) {
+        std::istringstream stream(line);
+        std::string keyword;
+        stream >> keyword;
+
+        if (keyword.empty()) {
+            continue;
+        }
+        if (keyword == "QUIT") {
+            break;
+        }
+        if (keyword == "ENCODING") {
+            std::string name;
+            int quality = kDefaultJpegQuality;
+            stream >> name >> quality;
+            FrameEncoding encoding;
+            if (parseFrameEncoding(name, encoding)) {
+                link->encoding = encoding;
+                link->quality = quality;
+            } else {
+                this->report(
+                    "Link " + std::to_string(link->id)
+                        + ": unknown encoding '" + name + "'",
+                    true
+                    );
+            }
+            continue;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->commands.push_back({link, line});
+        }
+        this->wakeup.notify_one();
+    }
+
+    link->close();
+    this->wakeup.notify_one();
+}
+
+// ----------------------------------------------------------------------------
+// FrameServer::sendLoop
+// ----------------------------------------------------------------------------
+//
+// Description: Takes the newest frame from the link's mailbox, encodes it in
+//              the link's current encoding and sends it. Encoding happens
+//              here, off the render thread.
+//
+// Inputs:
+// - link: The link to serve
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Closes the link if sending fails
+//
+// ----------------------------------------------------------------------------
+void FrameServer::sendLoop(std::shared_ptr<Link> link)
+{
+    FrameEncoder encoder;
+
+    while (true) {
+        std::shared_ptr<const RawFrame> frame;
+        {
+            std::unique_lock<std::mutex> lock(link->mutex);
+            link->ready.wait(lock, [&link]() {
+                return link->pending || link->closed;
+            });
+            if (link->closed) {
+                break;
+            }
+            frame.swap(link->pending);
+        }
+
+        EncodedFrame encoded;
+        if (!encoder.encode(
+                *frame,
+                link->encoding.load(),
+                link->quality.load(),
+                encoded
+                )) {
+            this->report(
+                "Link " + std::to_string(link->id)
+                    + ": failed to encode frame "
+                    + std::to_string(frame->id),
+                true
+                );
+            continue;
+        }
+
+        FrameHeader header;
+        std::memcpy(header.magic, kFrameMagic, sizeof(kFrameMagic));
+        header.encoding = static_cast<std::uint32_t>(encoded.encoding);
+        header.width = static_cast<std::uint32_t>(frame->width);
+        header.height = static_cast<std::uint32_t>(frame->height);
+        header.frame_id = frame->id;
+        header.raw_size = static_cast<std::uint32_t>(frame->rgb.size());
+        header.payload_size = static_cast<std::uint32_t>(encoded.size);
+
+        if (!link->socket.sendAll(&header, sizeof(header))
+            || !link->socket.sendAll(encoded.data, encoded.size)) {
+            break;
+        }
+        ++link->sent;
+    }
+
+    link->close();
+    this->wakeup.notify_one();
+}
+
+// ----------------------------------------------------------------------------
+// FrameServer::applyCommand
+// ----------------------------------------------------------------------------
+//
+// Description: Applies a camera command on the render thread
+//
+// Inputs:
+// - command: The command and the link it came from
+//
+// Outputs: None
+//
+// Returns: true if the scene changed and a new frame has to be rendered
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool FrameServer::applyCommand(const Command& command)
+{
+    std::istringstream stream(command.line);
+    std::string keyword;
+    double value = 0.0;
+    stream >> keyword >> value;
+
+    vtkCamera* camera = this->scene->renderer()->GetActiveCamera();
+    if (keyword == "AZIMUTH") {
+        camera->Azimuth(value);
+    } else if (keyword == "ELEVATION") {
+        camera->Elevation(value);
+        camera->OrthogonalizeViewUp();
+    } else if (keyword == "ROLL") {
+        camera->Roll(value);
+    } else if (keyword == "ZOOM") {
+        if (value <= 0.0) {
+            return false;
+        }
+        camera->Dolly(value);
+    } else if (keyword == "RESET") {
+        this->scene->renderer()->ResetCamera();
+    } else if (keyword == "FRAME") {
+        // Nothing changed, resend the newest frame to this link only
+        if (this->last_frame) {
+            this->publish(command.link, this->last_frame);
+            return false;
+        }
+        return true;
+    } else {
+        this->report(
+            "Link " + std::to_string(command.link->id)
+                + ": unknown command '" + command.line + "'",
+            true
+            );
+        return false;
+    }
+
+    this->scene->renderer()->ResetCameraClippingRange();
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// FrameServer::renderFrame
+// ----------------------------------------------------------------------------
+//
+// Description: Renders the scene and reads the pixels back
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: The new frame
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+std::shared_ptr<const RawFrame> FrameServer::renderFrame()
+{
+    auto frame = std::make_shared<RawFrame>();
+    frame->id = ++this->frame_counter;
+    this->scene->capture(frame->rgb, frame->width, frame->height);
+
+    return frame;
+}
+
+// ----------------------------------------------------------------------------
+// FrameServer::publish
+// ----------------------------------------------------------------------------
+//
+// Description: Puts a frame into a link's single-slot mailbox. A frame still
+//              waiting there is replaced, which is how a slow link drops
+//              frames instead of building up a backlog.
+//
+// Inputs:
+// - link: Destination link
+// - frame: Frame to send
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void FrameServer::publish(
+    const std::shared_ptr<Link>& link,
+    const std::shared_ptr<const RawFrame>& frame
+    )
+{
+    {
+        std::lock_guard<std::mutex> lock(link->mutex);
+        if (link->closed) {
+            return;
+        }
+        if (link->pending) {
+            ++link->dropped;
+        }
+        link->pending = frame;
+    }
+    link->ready.notify_one();
+}
+
+// ----------------------------------------------------------------------------
+// FrameServer::retireLink
+// ----------------------------------------------------------------------------
+//
+// Description: Joins the threads of a closed link and reports its statistics
+//
+// Inputs:
+// - link: The link to retire
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void FrameServer::retireLink(const std::shared_ptr<Link>& link)
+{
+    link->close();
+    if (link->reader.joinable()) {
+        link->reader.join();
+    }
+    if (link->sender.joinable()) {
+        link->sender.join();
+    }
+
+    this->report(
+        "Link " + std::to_string(link->id) + " closed: "
+            + std::to_string(link->sent.load()) + " frames sent, "
+            + std::to_string(link->dropped.load()) + " dropped"
+        );
+}
+
+// ----------------------------------------------------------------------------
+// FrameServer::report
+// ----------------------------------------------------------------------------
+//
+// Description: Passes a message on to the log of the options, if any
+//
+// Inputs:
+// - message: The message, without a line end
+// - failure: Whether it reports an error
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Blocks while another thread reports
+//
+// ----------------------------------------------------------------------------
+void FrameServer::report(const std::string& message, bool failure)
+{
+    if (!this->options.log) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(this->log_mutex);
+    this->options.log(message, failure);
+}
+
+// ----------------------------------------------------------------------------
+// FrameServer::shutdown
+// ----------------------------------------------------------------------------
+//
+// Description: Stops accepting clients and closes every link
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Joins all threads, removes the socket file it created
+//
+// ----------------------------------------------------------------------------
+void FrameServer::shutdown()
+{
+    if (this->stopping.exchange(true)) {
+        return;
+    }
+
+    this->listener.shutdown();
+    if (this->acceptor.joinable()) {
+        this->acceptor.join();
+    }
+    this->listener.close();
+    if (this->created_socket) {
+        std::remove(this->options.socket_path.c_str());
+        this->created_socket = false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        for (auto& link : this->new_links) {
+            this->links.push_back(link);
+        }
+        this->new_links.clear();
+        this->commands.clear();
+    }
+    for (auto& link : this->links) {
+        this->retireLink(link);
+    }
+    this->links.clear();
+}
@@ -0,0 +1,196 @@
+// ============================================================================
+// FrameServer.h - Streams offscreen rendered frames to local clients
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * FrameServer.h: created.
+// * FrameServer.h: links are reported through FrameServerOptions::log
+//   instead of the standard streams.
+// * FrameServer.h: remembers whether it created its socket file.
+//
+// ============================================================================
+
+
+#ifndef FrameServer_H
+#define FrameServer_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// "C" system headers
+
+// Standard Library headers
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// External libraries headers
+#include <vtkRenderer.h>
+
+// Project headers
+#include "FrameEncoder.h"
+#include "Scene.h"
+#include "Socket.h"
+
+
+// ============================================================================
+// Type Definitions Section
+// ============================================================================
+
+// Told about a link connecting, closing or failing; failure marks errors.
+// Calls come from the server threads, one at a time.
+using FrameServerLog = std::function<void(
+    const std::string& message,
+    bool failure
+    )>;
+
+
+// ============================================================================
+// Structure Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// FrameServerOptions
+// ----------------------------------------------------------------------------
+//
+// Description: Configuration of a FrameServer
+//
+// Properties:
+// - port: Loopback TCP port to listen on, used if socket_path is empty
+// - socket_path: Unix domain socket to listen on instead of TCP
+// - width: Frame width in pixels
+// - height: Frame height in pixels
+// - log: Reports on the links, may be empty
+//
+// ----------------------------------------------------------------------------
+struct FrameServerOptions {
+    std::uint16_t port = 0;
+    std::string socket_path;
+    int width = 800;
+    int height = 600;
+    FrameServerLog log;
+};
+
+
+// ============================================================================
+// Class Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// FrameServer
+// ----------------------------------------------------------------------------
+//
+// Description: Renders the scene offscreen and streams frames to any number
+//              of local clients (see FrameProtocol.h). Rendering and camera
+//              updates happen on the thread calling run(). Every link has its
+//              own encoder thread and a single-slot mailbox: if a link is
+//              still encoding or sending when a newer frame is rendered, the
+//              pending frame is replaced and counted as dropped, so a slow
+//              link never stalls rendering or the other links.
+//
+// Properties:
+// - options: Server configuration
+// - scene: Offscreen render window and the scene it shows
+// - listener: Listening socket
+// - links: Connected clients
+// - commands: Camera commands waiting for the render thread
+//
+// Methods:
+// - start: Starts listening for clients
+// - run: Serves frames until the stop flag is raised
+// - renderer: Returns the renderer so callers can populate the scene
+//
+// Example usage:
+//   FrameServerOptions options;
+//   options.port = 8000;
+//   FrameServer server(options);
+//   if (server.start(&error)) {
+//       server.run(stop_requested);
+//   }
+//
+// ----------------------------------------------------------------------------
+class FrameServer
+{
+public:
+    // Constructor/Destructor
+    explicit FrameServer(const FrameServerOptions& options);
+    ~FrameServer();
+
+    FrameServer(const FrameServer&) = delete;
+    FrameServer& operator=(const FrameServer&) = delete;
+
+    bool start(std::string* error = nullptr);  // Starts listening
+    void run(const std::atomic<bool>& stop);  // Serves until stop is raised
+
+    vtkRenderer* renderer() const { return this->scene->renderer(); }
+
+private:
+    struct Link;
+    struct Command {
+        std::shared_ptr<Link> link;
+        std::string line;
+    };
+
+    void acceptLoop();  // Runs on the acceptor thread
+    void readLoop(std::shared_ptr<Link> link);  // Runs per link
+    void sendLoop(std::shared_ptr<Link> link);  // Runs per link
+    bool applyCommand(const Command& command);  // True if a render is due
+    std::shared_ptr<const RawFrame> renderFrame();
+    void publish(
+        const std::shared_ptr<Link>& link,
+        const std::shared_ptr<const RawFrame>& frame
+        );
+    void retireLink(const std::shared_ptr<Link>& link);
+    void shutdown();
+    void report(const std::string& message, bool failure = false);
+
+    FrameServerOptions options;
+    std::unique_ptr<OffscreenScene> scene;
+    std::uint64_t frame_counter;
+    std::shared_ptr<const RawFrame> last_frame;
+
+    Socket listener;
+    std::thread acceptor;
+    std::atomic<bool> stopping;
+    std::uint64_t link_counter;
+    bool created_socket;  // Whether the socket file at socket_path is ours
+    std::mutex log_mutex;  // Serializes calls of options.log
+
+    // Guarded by mutex
+    std::mutex mutex;
+    std::condition_variable wakeup;
+    std::vector<std::shared_ptr<Link>> links;
+    std::vector<std::shared_ptr<Link>> new_links;
+    std::deque<Command> commands;
+};
+
+#endif  // FrameServer_H
@@ -0,0 +1,530 @@
+// ============================================================================
+// GeometryBatcher.cxx - Implementation of the GeometryBatcher class
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * GeometryBatcher.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header -------------------------------------------------------------
+#include "GeometryBatcher.h"
+
+// "C" system headers ---------------------------------------------------------
+
+// Standard Library headers ---------------------------------------------------
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <map>
+
+// External libraries headers -------------------------------------------------
+
+// VTK headers
+#include <vtkCellArray.h>
+#include <vtkCellArrayIterator.h>
+#include <vtkCellData.h>
+#include <vtkFloatArray.h>
+#include <vtkIdTypeArray.h>
+#include <vtkIntArray.h>
+#include <vtkMatrix4x4.h>
+#include <vtkPointData.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+#include <vtkPolyDataMapper.h>
+#include <vtkProperty.h>
+#include <vtkSMPTools.h>
+#include <vtkUnsignedCharArray.h>
+
+
+// ============================================================================
+// Local helpers section
+// ============================================================================
+
+namespace {
+
+// Name of the part index arrays of the batches
+const char* const kPartIdArray = "PartId";
+
+// Everything of a property that must match within a batch. Colors are left
+// out, they become per-vertex colors.
+std::vector<double> materialKey(vtkProperty* property)
+{
+    return {
+        property->GetAmbient(),
+        property->GetDiffuse(),
+        property->GetSpecular(),
+        property->GetSpecularPower(),
+        property->GetOpacity(),
+        double(property->GetRepresentation()),
+        double(property->GetInterpolation()),
+        double(property->GetEdgeVisibility()),
+        double(property->GetBackfaceCulling()),
+        double(property->GetFrontfaceCulling()),
+        double(property->GetLighting()),
+        double(property->GetLineWidth()),
+        double(property->GetPointSize())
+    };
+}
+
+// Mapper input of a part if it can be batched, null otherwise
+vtkPolyData* batchableInput(vtkActor* part)
+{
+    auto mapper = vtkPolyDataMapper::SafeDownCast(part->GetMapper());
+    if (mapper == nullptr || part->GetTexture() != nullptr) {
+        return nullptr;
+    }
+
+    mapper->Update();
+    vtkPolyData* input = mapper->GetInput();
+    if (input == nullptr
+        || input->GetNumberOfPolys() == 0
+        || input->GetNumberOfVerts() + input->GetNumberOfLines()
+           + input->GetNumberOfStrips() > 0) {
+        return nullptr;
+    }
+
+    return input;
+}
+
+}  // namespace
+
+
+// ============================================================================
+// Constructor/Destructor Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// GeometryBatcher::GeometryBatcher
+// ----------------------------------------------------------------------------
+//
+// Description: Constructor
+//
+// Inputs:
+// - max_batch_points: Batches are split beyond this point count
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+GeometryBatcher::GeometryBatcher(vtkIdType max_batch_points)
+    : max_batch_points(max_batch_points > 0
+                       ? max_batch_points
+                       : kDefaultMaxBatchPoints)
+{
+}
+
+
+// ============================================================================
+// Public Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// GeometryBatcher::add
+// ----------------------------------------------------------------------------
+//
+// Description: Adds a static actor. Its geometry, transform and property
+//              are read by the next build.
+//
+// Inputs:
+// - part: The actor
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void GeometryBatcher::add(vtkActor* part)
+{
+    if (part != nullptr) {
+        this->parts.emplace_back(part);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// GeometryBatcher::clear
+// ----------------------------------------------------------------------------
+//
+// Description: Forgets all parts and batches
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void GeometryBatcher::clear()
+{
+    this->parts.clear();
+    this->merged.clear();
+    this->unbatched.clear();
+}
+
+// ----------------------------------------------------------------------------
+// GeometryBatcher::build
+// ----------------------------------------------------------------------------
+//
+// Description: Groups the parts by material and merges every group into
+//              batches of at most max_batch_points points
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: Number of batches
+//
+// Side Effects: Updates the mappers of the parts
+//
+// ----------------------------------------------------------------------------
+std::size_t GeometryBatcher::build()
+{
+    this->merged.clear();
+    this->unbatched.clear();
+
+    std::map<std::vector<double>, std::vector<std::size_t>> groups;
+    for (std::size_t i = 0; i < this->parts.size(); ++i) {
+        vtkActor* part = this->parts[i];
+        if (batchableInput(part) == nullptr) {
+            this->unbatched.push_back(part);
+            continue;
+        }
+        groups[materialKey(part->GetProperty())].push_back(i);
+    }
+
+    for (const auto& group : groups) {
+        std::vector<std::size_t> members;
+        vtkIdType points = 0;
+        for (std::size_t index : group.second) {
+            const vtkIdType count = vtkPolyDataMapper::SafeDownCast(
+                this->parts[index]->GetMapper()
+                )->GetInput()->GetNumberOfPoints();
+            if (!members.empty()
+                && points + count > this->max_batch_points) {
+                this->buildBatch(members);
+                members.clear();
+                points = 0;
+            }
+            members.push_back(index);
+            points += count;
+        }
+        this->buildBatch(members);
+    }
+
+    return this->merged.size();
+}
+
+// ----------------------------------------------------------------------------
+// GeometryBatcher::pickedPart
+// ----------------------------------------------------------------------------
+//
+// Description: Maps a pick result back to the part that was hit
+//
+// Inputs:
+// - prop: The picked prop, a batch or an unbatched part
+// - cell_id: The picked cell
+//
+// Outputs: None
+//
+// Returns: The part, null if the prop is not managed by the batcher
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+vtkActor* GeometryBatcher::pickedPart(vtkProp* prop, vtkIdType cell_id) const
+{
+    for (const auto& batch : this->merged) {
+        if (batch != prop) {
+            continue;
+        }
+        vtkPolyData* data = vtkPolyDataMapper::SafeDownCast(
+            batch->GetMapper()
+            )->GetInput();
+        auto ids = vtkIntArray::SafeDownCast(
+            data->GetCellData()->GetArray(kPartIdArray)
+            );
+        if (ids == nullptr
+            || cell_id < 0
+            || cell_id >= ids->GetNumberOfTuples()) {
+            return nullptr;
+        }
+        return this->parts[ids->GetValue(cell_id)];
+    }
+
+    for (const auto& part : this->unbatched) {
+        if (part == prop) {
+            return part;
+        }
+    }
+
+    return nullptr;
+}
+
+// ----------------------------------------------------------------------------
+// GeometryBatcher::describe
+// ----------------------------------------------------------------------------
+//
+// Description: Returns a short summary for status lines
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: E.g. "20000 parts in 3 batches"
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+std::string GeometryBatcher::describe() const
+{
+    char text[96];
+    const int length = std::snprintf(
+        text,
+        sizeof(text),
+        "%zu parts in %zu batches",
+        this->parts.size() - this->unbatched.size(),
+        this->merged.size()
+        );
+    std::string summary(text, static_cast<std::size_t>(length));
+    if (!this->unbatched.empty()) {
+        summary += ", " + std::to_string(this->unbatched.size())
+            + " unbatched";
+    }
+    return summary;
+}
+
+
+// ============================================================================
+// Private Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// GeometryBatcher::buildBatch
+// ----------------------------------------------------------------------------
+//
+// Description: Merges parts of one material into a batch actor. Offsets of
+//              every part in the merged arrays are computed first, then the
+//              parts are transformed and copied in parallel.
+//
+// Inputs:
+// - members: Indices of the parts
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void GeometryBatcher::buildBatch(const std::vector<std::size_t>& members)
+{
+    if (members.empty()) {
+        return;
+    }
+
+    const vtkIdType count = static_cast<vtkIdType>(members.size());
+    std::vector<vtkPolyData*> inputs(count);
+    std::vector<vtkIdType> point_offsets(count + 1, 0);
+    std::vector<vtkIdType> cell_offsets(count + 1, 0);
+    std::vector<vtkIdType> id_offsets(count + 1, 0);
+    std::vector<std::array<double, 16>> matrices(count);
+    std::vector<std::array<double, 9>> normal_matrices(count);
+    std::vector<std::array<unsigned char, 3>> colors(count);
+    bool with_normals = true;
+
+    // Transforms and colors are read serially, GetMatrix may recompute
+    auto matrix = vtkSmartPointer<vtkMatrix4x4>::New();
+    auto inverse = vtkSmartPointer<vtkMatrix4x4>::New();
+    for (vtkIdType k = 0; k < count; ++k) {
+        vtkActor* part = this->parts[members[k]];
+        vtkPolyData* input = vtkPolyDataMapper::SafeDownCast(
+            part->GetMapper()
+            )->GetInput();
+        inputs[k] = input;
+        point_offsets[k + 1] = point_offsets[k] + input->GetNumberOfPoints();
+        cell_offsets[k + 1] = cell_offsets[k] + input->GetNumberOfPolys();
+        id_offsets[k + 1] = id_offsets[k]
+            + input->GetPolys()->GetNumberOfConnectivityIds();
+        with_normals = with_normals
+            && input->GetPointData()->GetNormals() != nullptr;
+
+        part->GetMatrix(matrix);
+        std::copy(
+            &matrix->Element[0][0],
+            &matrix->Element[0][0] + 16,
+            matrices[k].begin()
+            );
+        vtkMatrix4x4::Invert(matrix, inverse);
+        for (int row = 0; row < 3; ++row) {
+            for (int column = 0; column < 3; ++column) {
+                normal_matrices[k][3 * row + column] =
+                    inverse->Element[column][row];
+            }
+        }
+
+        const double* color = part->GetProperty()->GetDiffuseColor();
+        for (int c = 0; c < 3; ++c) {
+            colors[k][c] = static_cast<unsigned char>(
+                std::lround(255.0 * std::min(1.0, std::max(0.0, color[c])))
+                );
+        }
+    }
+
+    const vtkIdType point_count = point_offsets[count];
+    const vtkIdType cell_count = cell_offsets[count];
+
+    auto coordinates = vtkSmartPointer<vtkFloatArray>::New();
+    coordinates->SetNumberOfComponents(3);
+    coordinates->SetNumberOfTuples(point_count);
+    auto normals = vtkSmartPointer<vtkFloatArray>::New();
+    normals->SetName("Normals");
+    normals->SetNumberOfComponents(3);
+    normals->SetNumberOfTuples(with_normals ? point_count : 0);
+    auto vertex_colors = vtkSmartPointer<vtkUnsignedCharArray>::New();
+    vertex_colors->SetName("Colors");
+    vertex_colors->SetNumberOfComponents(3);
+    vertex_colors->SetNumberOfTuples(point_count);
+    auto point_parts = vtkSmartPointer<vtkIntArray>::New();
+    point_parts->SetName(kPartIdArray);
+    point_parts->SetNumberOfTuples(point_count);
+    auto cell_parts = vtkSmartPointer<vtkIntArray>::New();
+    cell_parts->SetName(kPartIdArray);
+    cell_parts->SetNumberOfTuples(cell_count);
+    auto offsets = vtkSmartPointer<vtkIdTypeArray>::New();
+    offsets->SetNumberOfValues(cell_count + 1);
+    auto connectivity = vtkSmartPointer<vtkIdTypeArray>::New();
+    connectivity->SetNumberOfValues(id_offsets[count]);
+
+    float* xyz = coordinates->GetPointer(0);
+    float* normal_values = normals->GetPointer(0);
+    unsigned char* rgb = vertex_colors->GetPointer(0);
+    int* point_part_values = point_parts->GetPointer(0);
+    int* cell_part_values = cell_parts->GetPointer(0);
+    vtkIdType* offset_values = offsets->GetPointer(0);
+    vtkIdType* connectivity_values = connectivity->GetPointer(0);
+
+    vtkSMPTools::For(0, count, 1, [&](vtkIdType begin, vtkIdType end) {
+        for (vtkIdType k = begin; k < end; ++k) {
+            vtkPolyData* input = inputs[k];
+            const double* m = matrices[k].data();
+            const double* n = normal_matrices[k].data();
+            const int part_id = static_cast<int>(members[k]);
+            vtkDataArray* input_normals = input->GetPointData()->GetNormals();
+
+            const vtkIdType first = point_offsets[k];
+            for (vtkIdType p = 0; p < input->GetNumberOfPoints(); ++p) {
+                const vtkIdType out = first + p;
+                double x[3];
+                input->GetPoint(p, x);
+                for (int r = 0; r < 3; ++r) {
+                    xyz[3 * out + r] = static_cast<float>(
+                        m[4 * r] * x[0] + m[4 * r + 1] * x[1]
+                        + m[4 * r + 2] * x[2] + m[4 * r + 3]
+                        );
+                }
+                if (with_normals) {
+                    double v[3];
+                    input_normals->GetTuple(p, v);
+                    double t[3];
+                    for (int r = 0; r < 3; ++r) {
+                        t[r] = n[3 * r] * v[0] + n[3 * r + 1] * v[1]
+                            + n[3 * r + 2] * v[2];
+                    }
+                    const double length =
+                        std::sqrt(t[0] * t[0] + t[1] * t[1] + t[2] * t[2]);
+                    for (int r = 0; r < 3; ++r) {
+                        normal_values[3 * out + r] = length > 0.0
+                            ? static_cast<float>(t[r] / length)
+                            : 0.0f;
+                    }
+                }
+                std::copy(colors[k].begin(), colors[k].end(), rgb + 3 * out);
+                point_part_values[out] = part_id;
+            }
+
+            vtkIdType cell = cell_offsets[k];
+            vtkIdType id = id_offsets[k];
+            auto cells = vtk::TakeSmartPointer(
+                input->GetPolys()->NewIterator()
+                );
+            for (cells->GoToFirstCell();
+                 !cells->IsDoneWithTraversal();
+                 cells->GoToNextCell()) {
+                vtkIdType size;
+                const vtkIdType* ids;
+                cells->GetCurrentCell(size, ids);
+                offset_values[cell] = id;
+                for (vtkIdType i = 0; i < size; ++i) {
+                    connectivity_values[id++] = ids[i] + first;
+                }
+                cell_part_values[cell++] = part_id;
+            }
+        }
+    });
+    offset_values[cell_count] = id_offsets[count];
+
+    auto batch = vtkSmartPointer<vtkPolyData>::New();
+    auto points = vtkSmartPointer<vtkPoints>::New();
+    points->SetData(coordinates);
+    batch->SetPoints(points);
+    auto polys = vtkSmartPointer<vtkCellArray>::New();
+    polys->SetData(offsets, connectivity);
+    batch->SetPolys(polys);
+    if (with_normals) {
+        batch->GetPointData()->SetNormals(normals);
+    }
+    batch->GetPointData()->AddArray(vertex_colors);
+    batch->GetPointData()->AddArray(point_parts);
+    batch->GetCellData()->AddArray(cell_parts);
+
+    // Colors come straight from the vertex array
+    auto mapper = vtkSmartPointer<vtkPolyDataMapper>::New();
+    mapper->SetInputData(batch);
+    mapper->SetScalarModeToUsePointFieldData();
+    mapper->SelectColorArray("Colors");
+    mapper->SetColorModeToDirectScalars();
+    mapper->ScalarVisibilityOn();
+    mapper->StaticOn();
+
+    auto property = vtkSmartPointer<vtkProperty>::New();
+    property->DeepCopy(this->parts[members.front()]->GetProperty());
+
+    auto actor = vtkSmartPointer<vtkActor>::New();
+    actor->SetMapper(mapper);
+    actor->SetProperty(property);
+    this->merged.push_back(actor);
+}
@@ -0,0 +1,134 @@
+// ============================================================================
+// GeometryBatcher.h - Merges static parts into a few large draw batches
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * GeometryBatcher.h: created.
+//
+// ============================================================================
+
+
+#ifndef GeometryBatcher_H
+#define GeometryBatcher_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Standard Library headers
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// External libraries headers
+#include <vtkActor.h>
+#include <vtkProp.h>
+#include <vtkSmartPointer.h>
+#include <vtkType.h>
+
+
+// ============================================================================
+// Class Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// GeometryBatcher
+// ----------------------------------------------------------------------------
+//
+// Description: Merges static actors into a few large poly data batches to
+//              cut draw calls. Actors are grouped by material (every
+//              vtkProperty setting except the colors), so the bisque and
+//              tomato versions of a part share a batch; the color moves to
+//              a per-vertex "Colors" array. The actor transforms are baked
+//              into the points and normals. Every batch carries the index
+//              of the source part as "PartId" in its point and cell data,
+//              so a picked cell still identifies its part. Batches are
+//              filled in parallel, one part per task.
+//              Actors with textures, or whose mapper input is not a
+//              polygonal vtkPolyData, are left unbatched.
+//
+// Properties:
+// - parts: Actors added for batching
+// - merged: The batch actors
+// - unbatched: Parts that could not be batched
+// - max_batch_points: Batches are split beyond this point count
+//
+// Methods:
+// - add: Adds a static actor
+// - clear: Forgets all parts and batches
+// - build: Builds the batches
+// - batches: Returns the batch actors
+// - unbatchedParts: Returns the parts left as they are
+// - pickedPart: Maps a picked batch cell back to its part
+// - describe: Returns a short summary for status lines
+//
+// Example usage:
+//   GeometryBatcher batcher;
+//   for (auto& part : parts) {
+//       batcher.add(part);
+//       part->VisibilityOff();
+//   }
+//   batcher.build();
+//   for (auto& batch : batcher.batches()) {
+//       renderer->AddActor(batch);
+//   }
+//
+// ----------------------------------------------------------------------------
+class GeometryBatcher
+{
+public:
+    static constexpr vtkIdType kDefaultMaxBatchPoints = vtkIdType(1) << 22;
+
+    // Constructor/Destructor
+    explicit GeometryBatcher(
+        vtkIdType max_batch_points = kDefaultMaxBatchPoints
+        );
+
+    void add(vtkActor* part);
+    void clear();
+    std::size_t build();  // Returns the number of batches
+
+    const std::vector<vtkSmartPointer<vtkActor>>& batches() const
+    {
+        return this->merged;
+    }
+    const std::vector<vtkSmartPointer<vtkActor>>& unbatchedParts() const
+    {
+        return this->unbatched;
+    }
+    std::size_t partCount() const { return this->parts.size(); }
+
+    vtkActor* pickedPart(vtkProp* prop, vtkIdType cell_id) const;
+    std::string describe() const;
+
+private:
+    void buildBatch(const std::vector<std::size_t>& members);
+
+    std::vector<vtkSmartPointer<vtkActor>> parts;
+    std::vector<vtkSmartPointer<vtkActor>> merged;
+    std::vector<vtkSmartPointer<vtkActor>> unbatched;
+    vtkIdType max_batch_points;
+};
+
+#endif  // GeometryBatcher_H
@@ -0,0 +1,1022 @@
+// ============================================================================
+// ImageDisplay.cxx - Window/level and colormap display of image slices
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * ImageDisplay.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header -------------------------------------------------------------
+#include "ImageDisplay.h"
+
+// "C" system headers ---------------------------------------------------------
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) \
+    || defined(_M_IX86)
+#define QTVTK_X86_KERNELS
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+// Standard Library headers ---------------------------------------------------
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+
+// External libraries headers -------------------------------------------------
+
+// VTK headers
+#include <vtkDataArray.h>
+#include <vtkImageMapper3D.h>
+#include <vtkImageProperty.h>
+#include <vtkPointData.h>
+#include <vtkSMPTools.h>
+#include <vtkUnsignedCharArray.h>
+
+
+// ============================================================================
+// Local helpers section
+// ============================================================================
+
+namespace {
+
+// Pixels per block of the parallel mapping, enough to amortize a task
+const std::size_t kBlockPixels = 64 * 1024;
+
+// GCC and Clang compile the AVX2 kernels for AVX2 only, without raising the
+// instruction set of the whole file; MSVC compiles any intrinsic as is
+#if defined(QTVTK_X86_KERNELS) && !defined(_MSC_VER)
+#define QTVTK_TARGET_AVX2 __attribute__((target("avx2")))
+#define QTVTK_TARGET_SSE2 __attribute__((target("sse2")))
+#else
+#define QTVTK_TARGET_AVX2
+#define QTVTK_TARGET_SSE2
+#endif
+
+// The window as an affine map to table indices: index = value * scale +
+// offset, clamped to [0, 255]. Single precision represents 16 bit scalars
+// exactly, so every kernel computes the same indices.
+struct WindowMap {
+    float scale;
+    float offset;
+};
+
+WindowMap makeWindowMap(double window, double level)
+{
+    if (std::fabs(window) < 1e-12) {
+        window = window < 0.0 ? -1e-12 : 1e-12;
+    }
+    const double scale = 256.0 / window;
+    const double lower = level - 0.5 * window;
+
+    return {static_cast<float>(scale), static_cast<float>(-lower * scale)};
+}
+
+inline std::uint32_t lookup(
+    float value,
+    const WindowMap& map,
+    const std::uint32_t* table
+    )
+{
+    float index = value * map.scale + map.offset;
+    index = index > 0.0f ? index : 0.0f;  // Also sends NaN to 0
+    index = index < 255.0f ? index : 255.0f;
+    return table[static_cast<int>(index)];
+}
+
+// Generic kernel: any type, any stride
+template <typename T>
+void mapScalarKernel(
+    const T* scalars,
+    std::size_t count,
+    int stride,
+    const WindowMap& map,
+    const std::uint32_t* table,
+    std::uint32_t* rgba
+    )
+{
+    for (std::size_t i = 0; i < count; ++i) {
+        rgba[i] = lookup(static_cast<float>(scalars[i * stride]), map, table);
+    }
+}
+
+// 8 bit kernel: 256 possible values, so window and colors fuse into one
+// table and every pixel is a single load. No vector unit does better.
+void mapUnsignedCharKernel(
+    const unsigned char* scalars,
+    std::size_t count,
+    const WindowMap& map,
+    const std::uint32_t* table,
+    std::uint32_t* rgba
+    )
+{
+    std::uint32_t fused[256];
+    for (int value = 0; value < 256; ++value) {
+        fused[value] = lookup(static_cast<float>(value), map, table);
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        rgba[i] = fused[scalars[i]];
+    }
+}
+
+#if defined(QTVTK_X86_KERNELS)
+// Eight indices from eight values
+QTVTK_TARGET_AVX2 inline __m256i indicesAvx2(
+    __m256 values,
+    __m256 scale,
+    __m256 offset
+    )
+{
+    const __m256 index = _mm256_add_ps(_mm256_mul_ps(values, scale), offset);
+    const __m256 clamped = _mm256_min_ps(
+        _mm256_max_ps(index, _mm256_setzero_ps()),
+        _mm256_set1_ps(255.0f)
+        );
+    return _mm256_cvttps_epi32(clamped);
+}
+
+QTVTK_TARGET_AVX2 void mapShortKernelAvx2(
+    const void* scalars,
+    bool is_signed,
+    std::size_t count,
+    const WindowMap& map,
+    const std::uint32_t* table,
+    std::uint32_t* rgba
+    )
+{
+    const __m256 scale = _mm256_set1_ps(map.scale);
+    const __m256 offset = _mm256_set1_ps(map.offset);
+    const int* entries = reinterpret_cast<const int*>(table);
+    const auto* values = static_cast<const std::uint16_t*>(scalars);
+
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const __m256i packed = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(values + i)
+            );
+        const __m128i low = _mm256_castsi256_si128(packed);
+        const __m128i high = _mm256_extracti128_si256(packed, 1);
+        const __m256i first = is_signed
+            ? _mm256_cvtepi16_epi32(low)
+            : _mm256_cvtepu16_epi32(low);
+        const __m256i second = is_signed
+            ? _mm256_cvtepi16_epi32(high)
+            : _mm256_cvtepu16_epi32(high);
+
+        const __m256i first_indices = indicesAvx2(
+            _mm256_cvtepi32_ps(first), scale, offset
+            );
+        const __m256i second_indices = indicesAvx2(
+            _mm256_cvtepi32_ps(second), scale, offset
+            );
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(rgba + i),
+            _mm256_i32gather_epi32(entries, first_indices, 4)
+            );
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(rgba + i + 8),
+            _mm256_i32gather_epi32(entries, second_indices, 4)
+            );
+    }
+
+    if (is_signed) {
+        mapScalarKernel(
+            static_cast<const std::int16_t*>(scalars) + i,
+            count - i, 1, map, table, rgba + i
+            );
+    } else {
+        mapScalarKernel(values + i, count - i, 1, map, table, rgba + i);
+    }
+}
+
+QTVTK_TARGET_AVX2 void mapFloatKernelAvx2(
+    const float* scalars,
+    std::size_t count,
+    const WindowMap& map,
+    const std::uint32_t* table,
+    std::uint32_t* rgba
+    )
+{
+    const __m256 scale = _mm256_set1_ps(map.scale);
+    const __m256 offset = _mm256_set1_ps(map.offset);
+    const int* entries = reinterpret_cast<const int*>(table);
+
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256i indices = indicesAvx2(
+            _mm256_loadu_ps(scalars + i), scale, offset
+            );
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(rgba + i),
+            _mm256_i32gather_epi32(entries, indices, 4)
+            );
+    }
+    mapScalarKernel(scalars + i, count - i, 1, map, table, rgba + i);
+}
+
+// Four indices from four values, looked up one by one: SSE2 has no gather
+QTVTK_TARGET_SSE2 inline void lookupSse2(
+    __m128 values,
+    __m128 scale,
+    __m128 offset,
+    const std::uint32_t* table,
+    std::uint32_t* rgba
+    )
+{
+    const __m128 index = _mm_add_ps(_mm_mul_ps(values, scale), offset);
+    const __m128 clamped = _mm_min_ps(
+        _mm_max_ps(index, _mm_setzero_ps()),
+        _mm_set1_ps(255.0f)
+        );
+    alignas(16) std::int32_t indices[4];
+    _mm_store_si128(
+        reinterpret_cast<__m128i*>(indices),
+        _mm_cvttps_epi32(clamped)
+        );
+    rgba[0] = table[indices[0]];
+    rgba[1] = table[indices[1]];
+    rgba[2] = table[indices[2]];
+    rgba[3] = table[indices[3]];
+}
+
+QTVTK_TARGET_SSE2 void mapShortKernelSse2(
+    const void* scalars,
+    bool is_signed,
+    std::size_t count,
+    const WindowMap& map,
+    const std::uint32_t* table,
+    std::uint32_t* rgba
+    )
+{
+    const __m128 scale = _mm_set1_ps(map.scale);
+    const __m128 offset = _mm_set1_ps(map.offset);
+    const auto* values = static_cast<const std::uint16_t*>(scalars);
+
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m128i packed = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(values + i)
+            );
+        __m128i first;
+        __m128i second;
+        if (is_signed) {
+            // Duplicate each value into the high half, shift it back down
+            first = _mm_srai_epi32(_mm_unpacklo_epi16(packed, packed), 16);
+            second = _mm_srai_epi32(_mm_unpackhi_epi16(packed, packed), 16);
+        } else {
+            first = _mm_unpacklo_epi16(packed, _mm_setzero_si128());
+            second = _mm_unpackhi_epi16(packed, _mm_setzero_si128());
+        }
+        lookupSse2(_mm_cvtepi32_ps(first), scale, offset, table, rgba + i);
+        lookupSse2(
+            _mm_cvtepi32_ps(second), scale, offset, table, rgba + i + 4
+            );
+    }
+
+    if (is_signed) {
+        mapScalarKernel(
+            static_cast<const std::int16_t*>(scalars) + i,
+            count - i, 1, map, table, rgba + i
+            );
+    } else {
+        mapScalarKernel(values + i, count - i, 1, map, table, rgba + i);
+    }
+}
+
+QTVTK_TARGET_SSE2 void mapFloatKernelSse2(
+    const float* scalars,
+    std::size_t count,
+    const WindowMap& map,
+    const std::uint32_t* table,
+    std::uint32_t* rgba
+    )
+{
+    const __m128 scale = _mm_set1_ps(map.scale);
+    const __m128 offset = _mm_set1_ps(map.offset);
+
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        lookupSse2(_mm_loadu_ps(scalars + i), scale, offset, table, rgba + i);
+    }
+    mapScalarKernel(scalars + i, count - i, 1, map, table, rgba + i);
+}
+
+bool cpuHasAvx2()
+{
+#if defined(_MSC_VER)
+    // AVX2 needs the CPU flag and the OS saving the YMM registers
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+        return false;
+    }
+    __cpuid(info, 1);
+    const bool os_saves_ymm = (info[2] & (1 << 27)) != 0
+        && (_xgetbv(0) & 0x6) == 0x6;
+    __cpuidex(info, 7, 0);
+    return os_saves_ymm && (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+bool cpuHasSse2()
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    return true;  // Part of x86-64
+#elif defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    return (info[3] & (1 << 26)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse2");
+#endif
+}
+#endif
+
+// Maps one contiguous run of pixels with the chosen kernel
+bool mapRun(
+    const void* scalars,
+    int scalar_type,
+    std::size_t count,
+    int stride,
+    const WindowMap& map,
+    const std::uint32_t* table,
+    std::uint32_t* rgba,
+    SimdLevel simd
+    )
+{
+    if (stride == 1 && scalar_type == VTK_UNSIGNED_CHAR) {
+        mapUnsignedCharKernel(
+            static_cast<const unsigned char*>(scalars),
+            count, map, table, rgba
+            );
+        return true;
+    }
+
+#if defined(QTVTK_X86_KERNELS)
+    const bool is_short = scalar_type == VTK_SHORT
+        || scalar_type == VTK_UNSIGNED_SHORT;
+    if (stride == 1 && simd == SimdLevel::Avx2) {
+        if (is_short) {
+            mapShortKernelAvx2(
+                scalars, scalar_type == VTK_SHORT, count, map, table, rgba
+                );
+            return true;
+        }
+        if (scalar_type == VTK_FLOAT) {
+            mapFloatKernelAvx2(
+                static_cast<const float*>(scalars), count, map, table, rgba
+                );
+            return true;
+        }
+    }
+    if (stride == 1 && simd == SimdLevel::Sse2) {
+        if (is_short) {
+            mapShortKernelSse2(
+                scalars, scalar_type == VTK_SHORT, count, map, table, rgba
+                );
+            return true;
+        }
+        if (scalar_type == VTK_FLOAT) {
+            mapFloatKernelSse2(
+                static_cast<const float*>(scalars), count, map, table, rgba
+                );
+            return true;
+        }
+    }
+#else
+    (void)simd;
+#endif
+
+    switch (scalar_type) {
+        vtkTemplateMacro(
+            mapScalarKernel(
+                static_cast<const VTK_TT*>(scalars),
+                count, stride, map, table, rgba
+                )
+            );
+        default:
+            return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+
+// ============================================================================
+// Function Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// detectSimdLevel
+// ----------------------------------------------------------------------------
+//
+// Description: Finds the best display kernel the processor runs
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: The kernel, detected on the first call
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+SimdLevel detectSimdLevel()
+{
+    static const SimdLevel level = []() {
+#if defined(QTVTK_X86_KERNELS)
+        if (cpuHasAvx2()) {
+            return SimdLevel::Avx2;
+        }
+        if (cpuHasSse2()) {
+            return SimdLevel::Sse2;
+        }
+#endif
+        return SimdLevel::Scalar;
+    }();
+
+    return level;
+}
+
+// ----------------------------------------------------------------------------
+// simdLevelName
+// ----------------------------------------------------------------------------
+//
+// Description: Names a display kernel
+//
+// Inputs:
+// - level: The kernel
+//
+// Outputs: None
+//
+// Returns: The name, for status messages
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+const char* simdLevelName(SimdLevel level)
+{
+    switch (level) {
+        case SimdLevel::Avx2:
+            return "AVX2";
+        case SimdLevel::Sse2:
+            return "SSE2";
+        default:
+            return "scalar";
+    }
+}
+
+// ----------------------------------------------------------------------------
+// buildDisplayTable
+// ----------------------------------------------------------------------------
+//
+// Description: Samples a lookup table into the 256 entries of the kernels
+//
+// Inputs:
+// - colors: The lookup table, null for a gray ramp
+//
+// Outputs: None
+//
+// Returns: 256 RGBA entries, as bytes in memory order
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+std::vector<std::uint32_t> buildDisplayTable(vtkScalarsToColors* colors)
+{
+    std::vector<std::uint32_t> table(256);
+    const double* range = colors != nullptr ? colors->GetRange() : nullptr;
+    for (int i = 0; i < 256; ++i) {
+        unsigned char rgba[4] = {
+            static_cast<unsigned char>(i),
+            static_cast<unsigned char>(i),
+            static_cast<unsigned char>(i),
+            255
+        };
+        if (colors != nullptr) {
+            const double value = range[0] + (range[1] - range[0]) * i / 255.0;
+            std::memcpy(rgba, colors->MapValue(value), 3);
+        }
+        std::memcpy(&table[i], rgba, 4);
+    }
+
+    return table;
+}
+
+// ----------------------------------------------------------------------------
+// mapWindowLevel
+// ----------------------------------------------------------------------------
+//
+// Description: Maps scalars through a window and a display table
+//
+// Inputs:
+// - scalars: First value to map
+// - scalar_type: VTK scalar type of the values
+// - count: Number of pixels
+// - stride: Values from one pixel to the next
+// - window, level: The window
+// - table: 256 RGBA entries
+// - simd: Kernel to use
+//
+// Outputs:
+// - rgba: count pixels
+//
+// Returns: false for an unknown scalar type, true otherwise
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool mapWindowLevel(
+    const void* scalars,
+    int scalar_type,
+    std::size_t count,
+    int stride,
+    double window,
+    double level,
+    const std::uint32_t* table,
+    std::uint32_t* rgba,
+    SimdLevel simd
+    )
+{
+    return mapRun(
+        scalars,
+        scalar_type,
+        count,
+        std::max(1, stride),
+        makeWindowMap(window, level),
+        table,
+        rgba,
+        std::min(simd, detectSimdLevel())
+        );
+}
+
+
+// ============================================================================
+// Constructor/Destructor Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// ImageSliceDisplay::ImageSliceDisplay
+// ----------------------------------------------------------------------------
+//
+// Description: Creates the RGBA slice and its actor, with nothing to show
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+ImageSliceDisplay::ImageSliceDisplay()
+    : output(vtkSmartPointer<vtkImageData>::New()),
+      slice_actor(vtkSmartPointer<vtkImageActor>::New()),
+      display_table(buildDisplayTable(nullptr)),
+      simd(detectSimdLevel())
+{
+    // RGBA bytes with the default window pass through the slice mapper
+    // untouched, so the GPU only draws the texture
+    this->slice_actor->GetMapper()->SetInputData(this->output);
+    this->slice_actor->GetProperty()->SetColorWindow(255.0);
+    this->slice_actor->GetProperty()->SetColorLevel(127.5);
+    this->slice_actor->GetProperty()->SetInterpolationTypeToNearest();
+    this->slice_actor->ForceOpaqueOn();
+}
+
+
+// ============================================================================
+// Public Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// ImageSliceDisplay::setImage
+// ----------------------------------------------------------------------------
+//
+// Description: Shows an image, from its middle slice. The window is set to
+//              the scalar range unless the previous input had the same
+//              scalar type.
+//
+// Inputs:
+// - image: The image, read in place
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void ImageSliceDisplay::setImage(vtkImageData* image)
+{
+    const bool same_type = this->input && image
+        && this->input->GetScalarType() == image->GetScalarType();
+    this->input = image;
+    this->volume.reset();
+    this->setSlice(this->sliceCount() / 2);
+    if (!same_type) {
+        this->resetWindowLevel();
+    }
+    this->dirty = true;
+}
+
+// ----------------------------------------------------------------------------
+// ImageSliceDisplay::setVolume
+// ----------------------------------------------------------------------------
+//
+// Description: Shows a bricked volume, from its middle slice. Only the
+//              bricks of the slice shown are decoded.
+//
+// Inputs:
+// - bricked: The volume
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void ImageSliceDisplay::setVolume(std::shared_ptr<BrickedVolume> bricked)
+{
+    this->volume = std::move(bricked);
+    this->input = nullptr;
+    this->slice_input = vtkSmartPointer<vtkImageData>::New();
+    this->setSlice(this->sliceCount() / 2);
+    this->resetWindowLevel();
+    this->dirty = true;
+}
+
+// ----------------------------------------------------------------------------
+// ImageSliceDisplay::sliceCount
+// ----------------------------------------------------------------------------
+//
+// Description: Counts the z slices of the input
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: The number of slices, 0 without an input
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+int ImageSliceDisplay::sliceCount() const
+{
+    if (!this->hasInput()) {
+        return 0;
+    }
+    int whole[6];
+    this->extent(whole);
+    return whole[5] - whole[4] + 1;
+}
+
+// ----------------------------------------------------------------------------
+// ImageSliceDisplay::setSlice
+// ----------------------------------------------------------------------------
+//
+// Description: Chooses the slice shown
+//
+// Inputs:
+// - slice: Index from the start of the z extent, clamped to the slices
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void ImageSliceDisplay::setSlice(int slice)
+{
+    slice = std::max(0, std::min(slice, this->sliceCount() - 1));
+    if (slice != this->current_slice) {
+        this->current_slice = slice;
+        this->dirty = true;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// ImageSliceDisplay::setWindowLevel
+// ----------------------------------------------------------------------------
+//
+// Description: Sets the window mapped to the lookup table
+//
+// Inputs:
+// - window: Width of the window, negative to invert
+// - level: Center of the window
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void ImageSliceDisplay::setWindowLevel(double window, double level)
+{
+    if (window != this->color_window || level != this->color_level) {
+        this->color_window = window;
+        this->color_level = level;
+        this->dirty = true;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// ImageSliceDisplay::resetWindowLevel
+// ----------------------------------------------------------------------------
+//
+// Description: Sets the window to the scalar range of the input
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Computes the scalar range of an image input
+//
+// ----------------------------------------------------------------------------
+void ImageSliceDisplay::resetWindowLevel()
+{
+    double range[2];
+    this->scalarRange(range);
+    this->setWindowLevel(
+        std::max(range[1] - range[0], 1e-6),
+        0.5 * (range[0] + range[1])
+        );
+}
+
+// ----------------------------------------------------------------------------
+// ImageSliceDisplay::scalarRange
+// ----------------------------------------------------------------------------
+//
+// Description: Returns the range of the first scalar component
+//
+// Inputs: None
+//
+// Outputs:
+// - range: Minimum and maximum, 0 and 1 without an input
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void ImageSliceDisplay::scalarRange(double range[2]) const
+{
+    range[0] = 0.0;
+    range[1] = 1.0;
+    if (this->volume) {
+        range[0] = this->volume->scalarRange()[0];
+        range[1] = this->volume->scalarRange()[1];
+    } else if (this->input
+               && this->input->GetPointData()->GetScalars() != nullptr) {
+        this->input->GetPointData()->GetScalars()->GetRange(range, 0);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// ImageSliceDisplay::setLookupTable
+// ----------------------------------------------------------------------------
+//
+// Description: Sets the colors the window is spread over
+//
+// Inputs:
+// - colors: The lookup table, sampled now at 256 values over its range;
+//           null for a gray ramp
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void ImageSliceDisplay::setLookupTable(vtkScalarsToColors* colors)
+{
+    this->display_table = buildDisplayTable(colors);
+    this->dirty = true;
+}
+
+// ----------------------------------------------------------------------------
+// ImageSliceDisplay::setSimdLevel
+// ----------------------------------------------------------------------------
+//
+// Description: Chooses the display kernel, for comparisons
+//
+// Inputs:
+// - level: The kernel, lowered to what the processor runs
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void ImageSliceDisplay::setSimdLevel(SimdLevel level)
+{
+    this->simd = std::min(level, detectSimdLevel());
+    this->dirty = true;
+}
+
+// ----------------------------------------------------------------------------
+// ImageSliceDisplay::update
+// ----------------------------------------------------------------------------
+//
+// Description: Maps the current slice into the RGBA image if the slice,
+//              the window, the lookup table or the input changed. Rows are
+//              mapped in blocks on all cores.
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: true if the slice was mapped, false if nothing changed or there
+//          is no input
+//
+// Side Effects: Decodes the bricks of the slice of a bricked volume and
+//               marks the RGBA image modified
+//
+// ----------------------------------------------------------------------------
+bool ImageSliceDisplay::update()
+{
+    if (!this->hasInput()) {
+        return false;
+    }
+    if (this->input && this->inputTime() != this->mapped_time) {
+        this->dirty = true;
+    }
+    if (!this->dirty) {
+        return false;
+    }
+    const auto started = std::chrono::steady_clock::now();
+
+    int whole[6];
+    this->extent(whole);
+    const int z = whole[4] + this->current_slice;
+    int region[6] = {whole[0], whole[1], whole[2], whole[3], z, z};
+
+    // The slice, in place or decoded from the bricks it cuts through
+    vtkImageData* source = this->input;
+    if (this->volume) {
+        if (!this->volume->extractRegion(region, this->slice_input)) {
+            return false;
+        }
+        source = this->slice_input;
+    }
+    vtkDataArray* scalars = source->GetPointData()->GetScalars();
+    if (scalars == nullptr) {
+        return false;
+    }
+    const void* first = source->GetScalarPointer(region[0], region[2], z);
+    const int components = scalars->GetNumberOfComponents();
+    const int scalar_type = scalars->GetDataType();
+
+    // The RGBA slice has the geometry of the input slice
+    const int width = whole[1] - whole[0] + 1;
+    const int height = whole[3] - whole[2] + 1;
+    int* output_extent = this->output->GetExtent();
+    if (this->output->GetPointData()->GetScalars() == nullptr
+        || output_extent[0] != region[0] || output_extent[1] != region[1]
+        || output_extent[2] != region[2] || output_extent[3] != region[3]) {
+        this->output->SetExtent(region);
+        this->output->AllocateScalars(VTK_UNSIGNED_CHAR, 4);
+    } else if (output_extent[4] != z) {
+        this->output->SetExtent(region);
+    }
+    this->output->SetSpacing(source->GetSpacing());
+    this->output->SetOrigin(source->GetOrigin());
+    auto* rgba = static_cast<std::uint32_t*>(
+        this->output->GetScalarPointer()
+        );
+
+    // Slices are contiguous in x and y, so blocks of rows are flat runs
+    const std::size_t pixels = std::size_t(width) * std::size_t(height);
+    const std::size_t value_size = scalars->GetDataTypeSize();
+    const std::size_t blocks = (pixels + kBlockPixels - 1) / kBlockPixels;
+    const WindowMap map = makeWindowMap(this->color_window, this->color_level);
+    const std::uint32_t* table = this->display_table.data();
+    const SimdLevel level = this->simd;
+    vtkSMPTools::For(0, static_cast<vtkIdType>(blocks),
+        [&](vtkIdType begin, vtkIdType end) {
+            for (vtkIdType block = begin; block < end; ++block) {
+                const std::size_t start = block * kBlockPixels;
+                const std::size_t count = std::min(
+                    kBlockPixels,
+                    pixels - start
+                    );
+                mapRun(
+                    static_cast<const char*>(first)
+                        + start * components * value_size,
+                    scalar_type,
+                    count,
+                    components,
+                    map,
+                    table,
+                    rgba + start,
+                    level
+                    );
+            }
+        });
+
+    this->output->Modified();
+    this->mapped_time = this->input ? this->inputTime() : 0;
+    this->dirty = false;
+    this->map_seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - started).count();
+
+    return true;
+}
+
+
+// ============================================================================
+// Private Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// ImageSliceDisplay::extent
+// ----------------------------------------------------------------------------
+//
+// Description: Returns the whole extent of the input
+//
+// Inputs: None
+//
+// Outputs:
+// - whole: The extent
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void ImageSliceDisplay::extent(int whole[6]) const
+{
+    const int* source = this->volume
+        ? this->volume->extent()
+        : this->input->GetExtent();
+    std::copy(source, source + 6, whole);
+}
+
+// ----------------------------------------------------------------------------
+// ImageSliceDisplay::inputTime
+// ----------------------------------------------------------------------------
+//
+// Description: Returns when the image input or its scalars last changed.
+//              Live data rewrites the scalars without touching the image.
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: The later modification time of the two
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+vtkMTimeType ImageSliceDisplay::inputTime() const
+{
+    vtkMTimeType time = this->input->GetMTime();
+    vtkDataArray* scalars = this->input->GetPointData()->GetScalars();
+    if (scalars != nullptr) {
+        time = std::max(time, scalars->GetMTime());
+    }
+    return time;
+}
@@ -0,0 +1,233 @@
+// ============================================================================
+// ImageDisplay.h - Window/level and colormap display of image slices
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * ImageDisplay.h: created.
+//
+// ============================================================================
+
+
+#ifndef ImageDisplay_H
+#define ImageDisplay_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Standard Library headers
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// External libraries headers
+#include <vtkImageActor.h>
+#include <vtkImageData.h>
+#include <vtkScalarsToColors.h>
+#include <vtkSmartPointer.h>
+#include <vtkType.h>
+
+// Project headers
+#include "BrickedVolume.h"
+
+
+// ============================================================================
+// Enumerations Section
+// ============================================================================
+
+// Instruction sets of the display kernels, in increasing order
+enum class SimdLevel {
+    Scalar,  // Portable C++
+    Sse2,  // 4 pixels per step, table lookups one by one
+    Avx2  // 8 pixels per step, table lookups gathered
+};
+
+
+// ============================================================================
+// Function Declarations Section
+// ============================================================================
+
+// Returns the best kernel the processor runs, detected once. Processors
+// other than x86 always get the scalar kernels.
+SimdLevel detectSimdLevel();
+
+// Returns "scalar", "SSE2" or "AVX2"
+const char* simdLevelName(SimdLevel level);
+
+// Samples a lookup table over its range into the 256 RGBA entries the
+// kernels use, as packed bytes. A null table gives a gray ramp.
+std::vector<std::uint32_t> buildDisplayTable(vtkScalarsToColors* colors);
+
+// ----------------------------------------------------------------------------
+// mapWindowLevel
+// ----------------------------------------------------------------------------
+//
+// Description: Maps scalars to RGBA pixels: the window [level - window / 2,
+//              level + window / 2] is spread over the 256 table entries and
+//              values outside it take the first or last entry. A negative
+//              window inverts the ramp, NaN takes the first entry. 8, 16 bit
+//              and float scalars of one component use explicit SIMD kernels
+//              (8 bit scalars go through a table fused with the window, 16
+//              bit and float ones are converted, scaled, clamped and looked
+//              up in vector registers); every other type and interleaved
+//              components use a generic scalar kernel. All kernels give the
+//              same pixels.
+//
+// Inputs:
+// - scalars: First value to map
+// - scalar_type: VTK scalar type of the values
+// - count: Number of pixels
+// - stride: Values from one pixel to the next (the component count)
+// - window, level: The window
+// - table: 256 RGBA entries from buildDisplayTable
+// - simd: Kernel to use, clamped to what the processor runs
+//
+// Outputs:
+// - rgba: count pixels
+//
+// Returns: false for a scalar type VTK does not know, true otherwise
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool mapWindowLevel(
+    const void* scalars,
+    int scalar_type,
+    std::size_t count,
+    int stride,
+    double window,
+    double level,
+    const std::uint32_t* table,
+    std::uint32_t* rgba,
+    SimdLevel simd = detectSimdLevel()
+    );
+
+
+// ============================================================================
+// Class Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// ImageSliceDisplay
+// ----------------------------------------------------------------------------
+//
+// Description: The 2D display path of volume images. The current z slice
+//              is window/leveled and color mapped with mapWindowLevel, split
+//              over cores in row blocks, into an RGBA image that an image
+//              actor shows as is. It takes the place of vtkImageMapToColors
+//              and of the color mapping of the image slice mappers, both of
+//              which convert every pixel through doubles. Slices are read in
+//              place from an image, or decoded from a bricked volume; only
+//              the slice, the window or the lookup table changing (or the
+//              image being modified) maps again.
+//
+// Properties:
+// - input: The image shown, or null
+// - volume: The bricked volume shown, or null
+// - slice_input: The decoded slice of the bricked volume
+// - output: The RGBA slice, shown by slice_actor
+// - display_table: The lookup table sampled for the kernels
+// - current_slice: Index of the slice from the start of the z extent
+// - color_window, color_level: The window
+// - simd: Kernel used
+// - mapped_time: Modification time of the input at the last mapping
+// - dirty: Whether the next update has to map
+// - map_seconds: Time the last mapping took
+//
+// Methods:
+// - setImage: Shows an image
+// - setVolume: Shows a bricked volume
+// - sliceCount: Returns the number of z slices
+// - setSlice, slice: Sets and returns the slice shown
+// - setWindowLevel, window, level: Sets and returns the window
+// - resetWindowLevel: Sets the window to the scalar range
+// - scalarRange: Returns the scalar range of the input
+// - setLookupTable: Sets the colors of the window, null for gray
+// - setSimdLevel, simdLevel: Sets and returns the kernel
+// - update: Maps the slice if something changed
+// - actor: Returns the actor showing the slice
+// - lastMapSeconds: Returns the time the last mapping took
+//
+// Example usage:
+//   ImageSliceDisplay display;
+//   display.setImage(image);
+//   display.setSlice(display.sliceCount() / 2);
+//   display.setWindowLevel(400.0, 40.0);
+//   display.update();
+//   renderer->AddActor(display.actor());
+//
+// ----------------------------------------------------------------------------
+class ImageSliceDisplay
+{
+public:
+    // Constructor/Destructor
+    ImageSliceDisplay();
+    ~ImageSliceDisplay() = default;
+
+    ImageSliceDisplay(const ImageSliceDisplay&) = delete;
+    ImageSliceDisplay& operator=(const ImageSliceDisplay&) = delete;
+
+    void setImage(vtkImageData* image);  // Keeps the window if already set
+    void setVolume(std::shared_ptr<BrickedVolume> bricked);
+    bool hasInput() const { return this->input || this->volume; }
+
+    int sliceCount() const;
+    void setSlice(int slice);  // Clamped to the slices
+    int slice() const { return this->current_slice; }
+
+    void setWindowLevel(double window, double level);
+    double window() const { return this->color_window; }
+    double level() const { return this->color_level; }
+    void resetWindowLevel();
+    void scalarRange(double range[2]) const;
+
+    void setLookupTable(vtkScalarsToColors* colors);
+    void setSimdLevel(SimdLevel level);  // Clamped to what the CPU runs
+    SimdLevel simdLevel() const { return this->simd; }
+
+    bool update();  // Returns whether the slice was mapped
+    vtkImageActor* actor() const { return this->slice_actor; }
+    double lastMapSeconds() const { return this->map_seconds; }
+
+private:
+    void extent(int whole[6]) const;
+    vtkMTimeType inputTime() const;  // Of the image and its scalars
+
+    vtkSmartPointer<vtkImageData> input;
+    std::shared_ptr<BrickedVolume> volume;
+    vtkSmartPointer<vtkImageData> slice_input;
+    vtkSmartPointer<vtkImageData> output;
+    vtkSmartPointer<vtkImageActor> slice_actor;
+    std::vector<std::uint32_t> display_table;
+    int current_slice = 0;
+    double color_window = 1.0;
+    double color_level = 0.5;
+    SimdLevel simd;
+    vtkMTimeType mapped_time = 0;
+    bool dirty = true;
+    double map_seconds = 0.0;
+};
+
+#endif  // ImageDisplay_H
@@ -0,0 +1,891 @@
+// ============================================================================
+// ImageStatistics.cxx - Histograms and statistics of volume images
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * ImageStatistics.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header -------------------------------------------------------------
+#include "ImageStatistics.h"
+
+// Standard Library headers ---------------------------------------------------
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+// External libraries headers -------------------------------------------------
+
+// VTK headers
+#include <vtkDataArray.h>
+#include <vtkPointData.h>
+#include <vtkSMPThreadLocal.h>
+#include <vtkSMPTools.h>
+
+
+// ============================================================================
+// Local helpers section
+// ============================================================================
+
+namespace {
+
+// Bins of types without one bin per value
+const int kRangeBins = 4096;
+
+// Values of an image counted as one brick, enough to amortize a task
+const std::size_t kSlabValues = 1u << 20;
+
+// Progress is reported about this many times per pass
+const std::size_t kProgressRounds = 32;
+
+// Maps values to bins: bin = (value - lower) * scale
+struct Binning {
+    double lower = 0.0;
+    double scale = 0.0;
+    int bins = 1;
+};
+
+// Running statistics of the values counted by one thread or one round.
+// Mean and spread are kept as mean and sum of squared deviations, which
+// merge exactly (Chan et al.) and do not lose precision over billions of
+// values the way a sum of squares does.
+struct Accumulator {
+    std::uint64_t count = 0;
+    double minimum = std::numeric_limits<double>::infinity();
+    double maximum = -std::numeric_limits<double>::infinity();
+    double mean = 0.0;
+    double m2 = 0.0;
+    std::vector<std::uint64_t> histogram;
+
+    void reset(int bins)
+    {
+        *this = Accumulator();
+        this->histogram.assign(bins, 0);
+    }
+
+    void merge(std::uint64_t other_count, double other_mean, double other_m2)
+    {
+        if (other_count == 0) {
+            return;
+        }
+        const double total = double(this->count) + double(other_count);
+        const double delta = other_mean - this->mean;
+        this->mean += delta * double(other_count) / total;
+        this->m2 += other_m2
+            + delta * delta * double(this->count) * double(other_count)
+            / total;
+        this->count += other_count;
+    }
+
+    void merge(const Accumulator& other)
+    {
+        this->merge(other.count, other.mean, other.m2);
+        this->minimum = std::min(this->minimum, other.minimum);
+        this->maximum = std::max(this->maximum, other.maximum);
+        for (std::size_t bin = 0; bin < this->histogram.size(); ++bin) {
+            this->histogram[bin] += other.histogram[bin];
+        }
+    }
+};
+
+// Counts the first component of a run of values. Sums are taken around the
+// first value, so they stay small and exact enough over one brick.
+template <typename T>
+void countValues(
+    const T* values,
+    std::size_t count,
+    int stride,
+    const Binning& binning,
+    Accumulator& accumulator
+    )
+{
+    constexpr bool kOneBinPerValue =
+        std::is_integral<T>::value && sizeof(T) <= 2;
+    const int last_bin = binning.bins - 1;
+    std::uint64_t* histogram = accumulator.histogram.data();
+
+    std::uint64_t counted = 0;
+    double shift = 0.0;
+    double sum = 0.0;
+    double squares = 0.0;
+    double minimum = accumulator.minimum;
+    double maximum = accumulator.maximum;
+    for (std::size_t index = 0; index < count; ++index) {
+        const T value = values[index * stride];
+        const double number = static_cast<double>(value);
+        if constexpr (!std::is_integral<T>::value) {
+            if (!std::isfinite(number)) {
+                continue;
+            }
+        }
+        if (counted == 0) {
+            shift = number;
+        }
+        ++counted;
+        const double deviation = number - shift;
+        sum += deviation;
+        squares += deviation * deviation;
+        minimum = std::min(minimum, number);
+        maximum = std::max(maximum, number);
+
+        int bin;
+        if constexpr (kOneBinPerValue) {
+            bin = static_cast<int>(value) - static_cast<int>(binning.lower);
+        } else {
+            bin = static_cast<int>(std::min(
+                (number - binning.lower) * binning.scale,
+                double(last_bin)
+                ));
+            bin = std::max(bin, 0);
+        }
+        ++histogram[bin];
+    }
+    if (counted == 0) {
+        return;
+    }
+
+    const double mean = sum / double(counted);
+    accumulator.merge(
+        counted,
+        shift + mean,
+        std::max(0.0, squares - sum * mean)
+        );
+    accumulator.minimum = minimum;
+    accumulator.maximum = maximum;
+}
+
+// Reads one brick: points values at its first value and sets the number of
+// voxels. buffer belongs to the calling thread and can hold decoded data.
+using BrickReader = std::function<bool(
+    std::size_t brick,
+    std::vector<std::uint8_t>& buffer,
+    const void** values,
+    std::size_t* count
+    )>;
+
+// Counts a range of bricks, each thread into its own accumulator, merged
+// into result by Reduce
+class CountFunctor
+{
+public:
+    CountFunctor(
+        const BrickReader& read,
+        int scalar_type,
+        int stride,
+        const Binning& binning,
+        const std::atomic<bool>* cancel
+        )
+        : failed(false)
+        , read(read)
+        , scalar_type(scalar_type)
+        , stride(stride)
+        , binning(binning)
+        , cancel(cancel)
+    {
+    }
+
+    void Initialize()
+    {
+        this->accumulators.Local().reset(this->binning.bins);
+    }
+
+    void operator()(vtkIdType begin, vtkIdType end)
+    {
+        Accumulator& accumulator = this->accumulators.Local();
+        std::vector<std::uint8_t>& buffer = this->buffers.Local();
+        for (vtkIdType brick = begin; brick < end; ++brick) {
+            if (this->cancel != nullptr && *this->cancel) {
+                return;
+            }
+            const void* values = nullptr;
+            std::size_t count = 0;
+            if (!this->read(brick, buffer, &values, &count)) {
+                this->failed = true;
+                return;
+            }
+            switch (this->scalar_type) {
+                vtkTemplateMacro(countValues(
+                    static_cast<const VTK_TT*>(values),
+                    count,
+                    this->stride,
+                    this->binning,
+                    accumulator
+                    ));
+            default:
+                this->failed = true;
+                return;
+            }
+        }
+    }
+
+    void Reduce()
+    {
+        this->result.reset(this->binning.bins);
+        for (auto local = this->accumulators.begin();
+            local != this->accumulators.end();
+            ++local) {
+            this->result.merge(*local);
+        }
+    }
+
+    Accumulator result;
+    std::atomic<bool> failed;
+
+private:
+    const BrickReader& read;
+    int scalar_type;
+    int stride;
+    Binning binning;
+    const std::atomic<bool>* cancel;
+    vtkSMPThreadLocal<Accumulator> accumulators;
+    vtkSMPThreadLocal<std::vector<std::uint8_t>> buffers;
+};
+
+// Statistics of what an accumulator counted
+ImageStatistics finish(const Accumulator& counted, const Binning& binning)
+{
+    ImageStatistics stats;
+    stats.count = counted.count;
+    if (counted.count > 0) {
+        stats.minimum = counted.minimum;
+        stats.maximum = counted.maximum;
+        stats.mean = counted.mean;
+        stats.deviation = std::sqrt(counted.m2 / double(counted.count));
+    }
+    stats.histogram = counted.histogram;
+    stats.lower = binning.lower;
+    stats.upper = binning.scale > 0.0
+        ? binning.lower + binning.bins / binning.scale
+        : binning.lower;
+
+    return stats;
+}
+
+// Counts bricks in rounds, reporting after each round. Returns the
+// statistics with bricks_done short of bricks_total if the pass stopped.
+ImageStatistics countBricks(
+    std::size_t brick_count,
+    int scalar_type,
+    int stride,
+    const Binning& binning,
+    const BrickReader& read,
+    const StatisticsProgress& progress,
+    const std::atomic<bool>* cancel
+    )
+{
+    Accumulator total;
+    total.reset(binning.bins);
+    ImageStatistics stats = finish(total, binning);
+    stats.bricks_total = brick_count;
+
+    const std::size_t round = std::max<std::size_t>(
+        vtkSMPTools::GetEstimatedNumberOfThreads(),
+        (brick_count + kProgressRounds - 1) / kProgressRounds
+        );
+    for (std::size_t first = 0; first < brick_count; first += round) {
+        const std::size_t last = std::min(first + round, brick_count);
+        CountFunctor functor(read, scalar_type, stride, binning, cancel);
+        vtkSMPTools::For(
+            static_cast<vtkIdType>(first),
+            static_cast<vtkIdType>(last),
+            1,
+            functor
+            );
+        if (functor.failed || (cancel != nullptr && *cancel)) {
+            return stats;
+        }
+
+        total.merge(functor.result);
+        stats = finish(total, binning);
+        stats.bricks_done = last;
+        stats.bricks_total = brick_count;
+        if (progress) {
+            progress(stats);
+        }
+    }
+    if (brick_count == 0 && progress) {
+        progress(stats);
+    }
+
+    return stats;
+}
+
+// One bin per value of 8 and 16 bit integers, false for other types
+template <typename T>
+bool valueBinning(Binning* binning)
+{
+    if constexpr (std::is_integral<T>::value && sizeof(T) <= 2) {
+        binning->lower = double(std::numeric_limits<T>::min());
+        binning->scale = 1.0;
+        binning->bins = 1 << (8 * sizeof(T));
+        return true;
+    }
+    return false;
+}
+
+bool valueBinning(int scalar_type, Binning* binning)
+{
+    switch (scalar_type) {
+        vtkTemplateMacro(return valueBinning<VTK_TT>(binning));
+    default:
+        return false;
+    }
+}
+
+// One bin per value for 8 and 16 bit integers, kRangeBins bins over the
+// range otherwise
+Binning chooseBinning(int scalar_type, double minimum, double maximum)
+{
+    Binning binning;
+    if (valueBinning(scalar_type, &binning)) {
+        return binning;
+    }
+
+    binning.lower = minimum;
+    binning.bins = kRangeBins;
+    binning.scale = maximum > minimum
+        ? kRangeBins / (maximum - minimum)
+        : 1.0;
+    return binning;
+}
+
+// Modification time of an image, which changes with its scalars too
+vtkMTimeType imageTime(vtkImageData* image)
+{
+    vtkMTimeType time = image->GetMTime();
+    vtkDataArray* scalars = image->GetPointData()->GetScalars();
+    if (scalars != nullptr) {
+        time = std::max(time, scalars->GetMTime());
+    }
+    return time;
+}
+
+}  // namespace
+
+
+// ============================================================================
+// Structure Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// ImageStatistics::percentile
+// ----------------------------------------------------------------------------
+//
+// Description: Returns the value below which a fraction of the values lie,
+//              interpolated within its histogram bin
+//
+// Inputs:
+// - fraction: Fraction of the values, clamped to [0, 1]
+//
+// Outputs: None
+//
+// Returns: The value, within [minimum, maximum]
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+double ImageStatistics::percentile(double fraction) const
+{
+    if (this->count == 0 || this->histogram.empty()) {
+        return this->minimum;
+    }
+
+    const double target = std::min(std::max(fraction, 0.0), 1.0)
+        * double(this->count);
+    const double width = (this->upper - this->lower)
+        / double(this->histogram.size());
+    double below = 0.0;
+    for (std::size_t bin = 0; bin < this->histogram.size(); ++bin) {
+        const double in_bin = double(this->histogram[bin]);
+        if (in_bin > 0.0 && below + in_bin >= target) {
+            const double value = this->lower
+                + (double(bin) + (target - below) / in_bin) * width;
+            return std::min(std::max(value, this->minimum), this->maximum);
+        }
+        below += in_bin;
+    }
+
+    return this->maximum;
+}
+
+
+// ============================================================================
+// Function Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// computeImageStatistics
+// ----------------------------------------------------------------------------
+//
+// Description: Computes the statistics of an image, in slabs of about a
+//              million values. Types without one bin per value take a first,
+//              unreported pass for the range the bins are spread over.
+//
+// Inputs:
+// - image: The image, its first scalar component is counted
+// - progress: Receives partial and final results, may be empty
+// - cancel: Stops the pass between slabs when raised, may be null
+//
+// Outputs: None
+//
+// Returns: The statistics
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+ImageStatistics computeImageStatistics(
+    vtkImageData* image,
+    const StatisticsProgress& progress,
+    const std::atomic<bool>* cancel
+    )
+{
+    vtkDataArray* scalars = image != nullptr
+        ? image->GetPointData()->GetScalars()
+        : nullptr;
+    if (scalars == nullptr) {
+        ImageStatistics empty;
+        if (progress) {
+            progress(empty);
+        }
+        return empty;
+    }
+
+    const int stride = scalars->GetNumberOfComponents();
+    const int element_size = scalars->GetDataTypeSize();
+    const auto* data = static_cast<const std::uint8_t*>(
+        scalars->GetVoidPointer(0)
+        );
+    const std::size_t tuples = std::size_t(scalars->GetNumberOfTuples());
+    const std::size_t slabs = (tuples + kSlabValues - 1) / kSlabValues;
+    BrickReader read = [=](
+        std::size_t slab,
+        std::vector<std::uint8_t>&,
+        const void** values,
+        std::size_t* count
+        ) {
+        const std::size_t first = slab * kSlabValues;
+        *values = data + first * stride * element_size;
+        *count = std::min(kSlabValues, tuples - first);
+        return true;
+    };
+
+    const int scalar_type = scalars->GetDataType();
+    Binning binning;
+    if (!valueBinning(scalar_type, &binning)) {
+        const ImageStatistics range = countBricks(
+            slabs, scalar_type, stride, Binning(), read, {}, cancel
+            );
+        if (!range.complete()) {
+            return range;
+        }
+        binning = chooseBinning(scalar_type, range.minimum, range.maximum);
+    }
+
+    return countBricks(
+        slabs, scalar_type, stride, binning, read, progress, cancel
+        );
+}
+
+// ----------------------------------------------------------------------------
+// computeImageStatistics
+// ----------------------------------------------------------------------------
+//
+// Description: Computes the statistics of a bricked volume, one brick at a
+//              time. The bins of types without one bin per value are spread
+//              over the range recorded when the volume was built.
+//
+// Inputs:
+// - volume: The volume, its first scalar component is counted
+// - progress: Receives partial and final results, may be empty
+// - cancel: Stops the pass between bricks when raised, may be null
+//
+// Outputs: None
+//
+// Returns: The statistics
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+ImageStatistics computeImageStatistics(
+    BrickedVolume& volume,
+    const StatisticsProgress& progress,
+    const std::atomic<bool>* cancel
+    )
+{
+    BrickReader read = [&volume](
+        std::size_t brick,
+        std::vector<std::uint8_t>& buffer,
+        const void** values,
+        std::size_t* count
+        ) {
+        int extent[6];
+        if (!volume.readBrick(brick, buffer, extent)) {
+            return false;
+        }
+        *values = buffer.data();
+        *count = std::size_t(extent[1] - extent[0] + 1)
+            * std::size_t(extent[3] - extent[2] + 1)
+            * std::size_t(extent[5] - extent[4] + 1);
+        return true;
+    };
+
+    return countBricks(
+        volume.brickCount(),
+        volume.scalarType(),
+        volume.components(),
+        chooseBinning(
+            volume.scalarType(),
+            volume.scalarRange()[0],
+            volume.scalarRange()[1]
+            ),
+        read,
+        progress,
+        cancel
+        );
+}
+
+// ----------------------------------------------------------------------------
+// autoWindowLevel
+// ----------------------------------------------------------------------------
+//
+// Description: Returns the window spanning the values between two
+//              percentiles
+//
+// Inputs:
+// - stats: Statistics of the image
+// - low, high: Fractions of the values below the window and below its top
+//
+// Outputs:
+// - window, level: The window, at least 1e-6 wide
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void autoWindowLevel(
+    const ImageStatistics& stats,
+    double* window,
+    double* level,
+    double low,
+    double high
+    )
+{
+    const double bottom = stats.percentile(low);
+    const double top = stats.percentile(high);
+    *window = std::max(top - bottom, 1e-6);
+    *level = 0.5 * (bottom + top);
+}
+
+
+// ============================================================================
+// Constructor/Destructor Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// ImageStatisticsEngine::~ImageStatisticsEngine
+// ----------------------------------------------------------------------------
+//
+// Description: Destructor
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Cancels the running pass and waits for it
+//
+// ----------------------------------------------------------------------------
+ImageStatisticsEngine::~ImageStatisticsEngine()
+{
+    this->cancel();
+}
+
+
+// ============================================================================
+// Public Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// ImageStatisticsEngine::compute
+// ----------------------------------------------------------------------------
+//
+// Description: Starts computing the statistics of an image on the
+//              background thread, after cancelling the pass running. A
+//              cached result for the image as it is now is reported at once
+//              instead.
+//
+// Inputs:
+// - image: The image, kept alive until the pass ends
+// - progress: Receives partial and final results, on the background thread
+//             (or on the calling one for a cached result)
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Starts the background thread
+//
+// ----------------------------------------------------------------------------
+void ImageStatisticsEngine::compute(
+    vtkImageData* image,
+    StatisticsProgress progress
+    )
+{
+    this->cancel();
+    if (image == nullptr) {
+        return;
+    }
+
+    ImageStatistics stats;
+    if (this->cached(image, &stats)) {
+        if (progress) {
+            progress(stats);
+        }
+        return;
+    }
+
+    vtkSmartPointer<vtkImageData> held(image);
+    const vtkMTimeType time = imageTime(image);
+    this->worker = std::thread([this, held, time, progress]() {
+        CacheEntry entry;
+        entry.stats = computeImageStatistics(
+            held,
+            progress,
+            &this->cancelled
+            );
+        if (entry.stats.complete() && !this->cancelled) {
+            entry.image = held.Get();
+            entry.time = time;
+            this->store(std::move(entry));
+        }
+    });
+}
+
+// ----------------------------------------------------------------------------
+// ImageStatisticsEngine::compute
+// ----------------------------------------------------------------------------
+//
+// Description: Starts computing the statistics of a bricked volume on the
+//              background thread, after cancelling the pass running. A
+//              cached result is reported at once instead.
+//
+// Inputs:
+// - volume: The volume, kept alive until the pass ends
+// - progress: Receives partial and final results, on the background thread
+//             (or on the calling one for a cached result)
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Starts the background thread
+//
+// ----------------------------------------------------------------------------
+void ImageStatisticsEngine::compute(
+    std::shared_ptr<BrickedVolume> volume,
+    StatisticsProgress progress
+    )
+{
+    this->cancel();
+    if (!volume) {
+        return;
+    }
+
+    ImageStatistics stats;
+    if (this->cached(volume.get(), &stats)) {
+        if (progress) {
+            progress(stats);
+        }
+        return;
+    }
+
+    this->worker = std::thread([this, volume, progress]() {
+        CacheEntry entry;
+        entry.stats = computeImageStatistics(
+            *volume,
+            progress,
+            &this->cancelled
+            );
+        if (entry.stats.complete() && !this->cancelled) {
+            entry.volume = volume;
+            this->store(std::move(entry));
+        }
+    });
+}
+
+// ----------------------------------------------------------------------------
+// ImageStatisticsEngine::cancel
+// ----------------------------------------------------------------------------
+//
+// Description: Stops the running pass, if any, and waits for it. Its
+//              progress callback is not called again.
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Joins the background thread
+//
+// ----------------------------------------------------------------------------
+void ImageStatisticsEngine::cancel()
+{
+    if (this->worker.joinable()) {
+        this->cancelled = true;
+        this->worker.join();
+    }
+    this->cancelled = false;
+}
+
+// ----------------------------------------------------------------------------
+// ImageStatisticsEngine::cached
+// ----------------------------------------------------------------------------
+//
+// Description: Looks up the finished statistics of an image, valid only if
+//              the image was not modified since they were computed
+//
+// Inputs:
+// - image: The image
+//
+// Outputs:
+// - stats: The statistics, if found
+//
+// Returns: Whether they were found
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool ImageStatisticsEngine::cached(vtkImageData* image, ImageStatistics* stats)
+{
+    if (image == nullptr) {
+        return false;
+    }
+
+    const vtkMTimeType time = imageTime(image);
+    std::lock_guard<std::mutex> lock(this->mutex);
+    for (const CacheEntry& entry : this->cache) {
+        if (entry.image.GetPointer() == image && entry.time == time) {
+            *stats = entry.stats;
+            return true;
+        }
+    }
+    return false;
+}
+
+// ----------------------------------------------------------------------------
+// ImageStatisticsEngine::cached
+// ----------------------------------------------------------------------------
+//
+// Description: Looks up the finished statistics of a bricked volume
+//
+// Inputs:
+// - volume: The volume
+//
+// Outputs:
+// - stats: The statistics, if found
+//
+// Returns: Whether they were found
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool ImageStatisticsEngine::cached(
+    const BrickedVolume* volume,
+    ImageStatistics* stats
+    )
+{
+    if (volume == nullptr) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(this->mutex);
+    for (const CacheEntry& entry : this->cache) {
+        if (entry.volume.lock().get() == volume) {
+            *stats = entry.stats;
+            return true;
+        }
+    }
+    return false;
+}
+
+
+// ============================================================================
+// Private Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// ImageStatisticsEngine::store
+// ----------------------------------------------------------------------------
+//
+// Description: Caches finished statistics, replacing older ones of the same
+//              dataset and dropping those of datasets that were destroyed
+//
+// Inputs:
+// - entry: The statistics and their dataset
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Drops the oldest entry beyond kCacheEntries
+//
+// ----------------------------------------------------------------------------
+void ImageStatisticsEngine::store(CacheEntry entry)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    vtkImageData* image = entry.image.GetPointer();
+    const std::shared_ptr<BrickedVolume> volume = entry.volume.lock();
+    this->cache.erase(
+        std::remove_if(
+            this->cache.begin(),
+            this->cache.end(),
+            [image, &volume](const CacheEntry& old) {
+                const std::shared_ptr<BrickedVolume> old_volume =
+                    old.volume.lock();
+                if (old.image.GetPointer() == nullptr && !old_volume) {
+                    return true;
+                }
+                return (image != nullptr && old.image.GetPointer() == image)
+                    || (volume && old_volume == volume);
+            }
+            ),
+        this->cache.end()
+        );
+    this->cache.push_back(std::move(entry));
+    if (this->cache.size() > kCacheEntries) {
+        this->cache.erase(this->cache.begin());
+    }
+}
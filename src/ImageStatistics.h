@@ -0,0 +1,234 @@
+// ============================================================================
+// ImageStatistics.h - Histograms and statistics of volume images
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * ImageStatistics.h: created.
+//
+// ============================================================================
+
+
+#ifndef ImageStatistics_H
+#define ImageStatistics_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Standard Library headers
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// External libraries headers
+#include <vtkImageData.h>
+#include <vtkSmartPointer.h>
+#include <vtkType.h>
+#include <vtkWeakPointer.h>
+
+// Project headers
+#include "BrickedVolume.h"
+
+
+// ============================================================================
+// Structure Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// ImageStatistics
+// ----------------------------------------------------------------------------
+//
+// Description: Histogram and statistics of the first scalar component of a
+//              volume, or of the bricks of it counted so far. NaN and
+//              infinite values are not counted.
+//
+// Properties:
+// - count: Values counted
+// - minimum, maximum: Range of the values counted
+// - mean, deviation: Mean and standard deviation of the values counted
+// - histogram: Values per bin. 8 and 16 bit integers get one bin per
+//              value, other types 4096 bins over the scalar range.
+// - lower, upper: Values at the low edge of the first bin and at the high
+//                 edge of the last bin
+// - bricks_done, bricks_total: Bricks (or slabs of an image) counted, and
+//                              bricks of the volume
+//
+// Methods:
+// - complete: Returns whether every brick was counted
+// - percentile: Returns the value below which a fraction of the values lie
+//
+// ----------------------------------------------------------------------------
+struct ImageStatistics {
+    std::uint64_t count = 0;
+    double minimum = 0.0;
+    double maximum = 0.0;
+    double mean = 0.0;
+    double deviation = 0.0;
+    std::vector<std::uint64_t> histogram;
+    double lower = 0.0;
+    double upper = 0.0;
+    std::size_t bricks_done = 0;
+    std::size_t bricks_total = 0;
+
+    bool complete() const { return this->bricks_done == this->bricks_total; }
+    double percentile(double fraction) const;  // fraction in [0, 1]
+};
+
+
+// ============================================================================
+// Function Declarations Section
+// ============================================================================
+
+// Receives the statistics of the bricks counted so far, then the final ones
+// (complete() true). Called on the thread computing them.
+using StatisticsProgress = std::function<void(const ImageStatistics& stats)>;
+
+// ----------------------------------------------------------------------------
+// computeImageStatistics
+// ----------------------------------------------------------------------------
+//
+// Description: Computes the histogram and statistics of an image, or of a
+//              bricked volume, in parallel. The volume is counted in rounds
+//              of bricks (slabs of about a million values for images);
+//              within a round bricks are spread over cores with
+//              vtkSMPTools, each thread filling its own histogram, and the
+//              histograms are merged at the end of the round, so no counter
+//              is shared between threads. After each round the statistics so
+//              far are passed to progress, so results stream in long before
+//              a multi gigabyte volume is done. Bricked volumes are decoded
+//              brick by brick without going through their cache.
+//
+// Inputs:
+// - image / volume: The data
+// - progress: Receives partial and final results, may be empty
+// - cancel: Stops the pass between bricks when raised, may be null
+//
+// Outputs: None
+//
+// Returns: The statistics, with complete() false if cancelled or a brick
+//          could not be decoded
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+ImageStatistics computeImageStatistics(
+    vtkImageData* image,
+    const StatisticsProgress& progress = StatisticsProgress(),
+    const std::atomic<bool>* cancel = nullptr
+    );
+ImageStatistics computeImageStatistics(
+    BrickedVolume& volume,
+    const StatisticsProgress& progress = StatisticsProgress(),
+    const std::atomic<bool>* cancel = nullptr
+    );
+
+// Window and level spanning the values between two percentiles, e.g. 1 %
+// and 99 %, which ignores outliers a min/max window would be stretched by.
+void autoWindowLevel(
+    const ImageStatistics& stats,
+    double* window,
+    double* level,
+    double low = 0.01,
+    double high = 0.99
+    );
+
+
+// ============================================================================
+// Class Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// ImageStatisticsEngine
+// ----------------------------------------------------------------------------
+//
+// Description: Computes image statistics on a background thread, one
+//              dataset at a time, and caches finished results. Images are
+//              cached by modification time (of the image and its scalars),
+//              so a modified image is counted again; bricked volumes never
+//              change once built. Asking for another dataset cancels the
+//              pass running.
+//
+// Properties:
+// - worker: The thread of the running pass
+// - cancelled: Raised to stop the running pass
+// - cache: Finished results, at most kCacheEntries
+//
+// Methods:
+// - compute: Starts a pass, or reports a cached result at once
+// - cancel: Stops the running pass and waits for it
+// - cached: Looks up a finished result
+//
+// Example usage:
+//   ImageStatisticsEngine engine;
+//   engine.compute(image, [](const ImageStatistics& stats) {
+//       std::cout << stats.bricks_done << "/" << stats.bricks_total << "\n";
+//   });
+//
+// ----------------------------------------------------------------------------
+class ImageStatisticsEngine
+{
+public:
+    static constexpr std::size_t kCacheEntries = 16;
+
+    // Constructor/Destructor
+    ImageStatisticsEngine() = default;
+    ~ImageStatisticsEngine();
+
+    ImageStatisticsEngine(const ImageStatisticsEngine&) = delete;
+    ImageStatisticsEngine& operator=(const ImageStatisticsEngine&) = delete;
+
+    void compute(vtkImageData* image, StatisticsProgress progress);
+    void compute(
+        std::shared_ptr<BrickedVolume> volume,
+        StatisticsProgress progress
+        );
+    void cancel();
+    bool cached(vtkImageData* image, ImageStatistics* stats);
+    bool cached(const BrickedVolume* volume, ImageStatistics* stats);
+
+private:
+    struct CacheEntry {
+        vtkWeakPointer<vtkImageData> image;
+        std::weak_ptr<BrickedVolume> volume;
+        vtkMTimeType time = 0;
+        ImageStatistics stats;
+    };
+
+    void store(CacheEntry entry);
+
+    std::thread worker;
+    std::atomic<bool> cancelled{false};
+
+    // Guarded by mutex
+    std::mutex mutex;
+    std::vector<CacheEntry> cache;  // Most recently stored last
+};
+
+#endif  // ImageStatistics_H
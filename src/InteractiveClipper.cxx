@@ -0,0 +1,689 @@
+// ============================================================================
+// InteractiveClipper.cxx - Clip plane and crop box widgets, deferred clipping
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * InteractiveClipper.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header -------------------------------------------------------------
+#include "InteractiveClipper.h"
+
+// Standard Library headers ---------------------------------------------------
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+// External libraries headers -------------------------------------------------
+
+// VTK headers
+#include <vtkActor.h>
+#include <vtkBoxRepresentation.h>
+#include <vtkClipPolyData.h>
+#include <vtkCommand.h>
+#include <vtkImageSlice.h>
+#include <vtkImplicitPlaneRepresentation.h>
+#include <vtkMapper.h>
+#include <vtkMath.h>
+#include <vtkMatrix4x4.h>
+#include <vtkNew.h>
+#include <vtkPlanes.h>
+#include <vtkSMPTools.h>
+#include <vtkTransform.h>
+#include <vtkVolume.h>
+
+
+// ============================================================================
+// Local helpers section
+// ============================================================================
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Faces of a crop box, each one a mapper clipping plane
+const int kBoxPlanes = 6;
+
+// The mapper of the props that can be clipped, null for other props
+vtkAbstractMapper* propMapper(vtkProp3D* prop)
+{
+    if (auto actor = vtkActor::SafeDownCast(prop)) {
+        return actor->GetMapper();
+    }
+    if (auto volume = vtkVolume::SafeDownCast(prop)) {
+        return volume->GetMapper();
+    }
+    if (auto slice = vtkImageSlice::SafeDownCast(prop)) {
+        return slice->GetMapper();
+    }
+    return nullptr;
+}
+
+// Clips a mesh, null if cancelled. vtkClipPolyData polls its abort flag
+// when it reports progress, so a cancelled commit stops within a fraction
+// of the mesh.
+vtkSmartPointer<vtkPolyData> clipMesh(
+    vtkPolyData* input,
+    vtkImplicitFunction* function,
+    bool inside_out,
+    const std::atomic<bool>& cancel
+    )
+{
+    vtkNew<vtkClipPolyData> clip;
+    clip->SetInputData(input);
+    clip->SetClipFunction(function);
+    clip->SetInsideOut(inside_out ? 1 : 0);
+
+    EventDispatcher events;
+    events.connect(
+        clip,
+        vtkCommand::ProgressEvent,
+        [&clip, &cancel](vtkObject*, unsigned long) {
+            if (cancel) {
+                clip->SetAbortExecute(1);
+            }
+        }
+        );
+    clip->Update();
+    if (cancel) {
+        return nullptr;
+    }
+
+    vtkSmartPointer<vtkPolyData> output = clip->GetOutput();
+    return output;
+}
+
+}  // namespace
+
+
+// ============================================================================
+// Constructor/Destructor Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// InteractiveClipper::~InteractiveClipper
+// ----------------------------------------------------------------------------
+//
+// Description: Destructor
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Cancels the running commit and restores the targets
+//
+// ----------------------------------------------------------------------------
+InteractiveClipper::~InteractiveClipper()
+{
+    this->disable();
+}
+
+
+// ============================================================================
+// Public Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// InteractiveClipper::enable
+// ----------------------------------------------------------------------------
+//
+// Description: Shows a clip plane or crop box widget placed around the
+//              props, and clips them with the clipping planes of their
+//              mappers. The plane starts through the center with its normal
+//              along x, the box on the bounds of the props. Props that are
+//              not actors, volumes or image slices are skipped.
+//
+// Inputs:
+// - interactor: Interactor of the view
+// - shape: Widget to show
+// - props: Props to clip
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false if no prop can be clipped
+//
+// Side Effects: Disables the widget shown before
+//
+// ----------------------------------------------------------------------------
+bool InteractiveClipper::enable(
+    vtkRenderWindowInteractor* interactor,
+    ClipShape shape,
+    const std::vector<vtkProp3D*>& props,
+    std::string* error
+    )
+{
+    this->disable();
+
+    double bounds[6];
+    vtkMath::UninitializeBounds(bounds);
+    for (vtkProp3D* prop : props) {
+        vtkAbstractMapper* mapper = prop ? propMapper(prop) : nullptr;
+        const double* prop_bounds = prop ? prop->GetBounds() : nullptr;
+        if (mapper == nullptr
+            || prop_bounds == nullptr
+            || !vtkMath::AreBoundsInitialized(prop_bounds)) {
+            continue;
+        }
+
+        Target target;
+        target.prop = prop;
+        target.original = mapper;
+        target.previous_planes = mapper->GetClippingPlanes();
+
+        // Commits read a shallow copy: the arrays are shared with the
+        // rendered data, the cell links they build are not
+        auto surface = vtkMapper::SafeDownCast(mapper);
+        vtkPolyData* data = surface
+            ? vtkPolyData::SafeDownCast(surface->GetInputAsDataSet())
+            : nullptr;
+        if (vtkActor::SafeDownCast(prop) && data
+            && data->GetNumberOfCells() > 0) {
+            target.input = vtkSmartPointer<vtkPolyData>::New();
+            target.input->ShallowCopy(data);
+        }
+        this->targets.push_back(std::move(target));
+
+        for (int axis = 0; axis < 3; ++axis) {
+            if (!vtkMath::AreBoundsInitialized(bounds)) {
+                bounds[2 * axis] = prop_bounds[2 * axis];
+                bounds[2 * axis + 1] = prop_bounds[2 * axis + 1];
+                continue;
+            }
+            bounds[2 * axis] = std::min(
+                bounds[2 * axis],
+                prop_bounds[2 * axis]
+                );
+            bounds[2 * axis + 1] = std::max(
+                bounds[2 * axis + 1],
+                prop_bounds[2 * axis + 1]
+                );
+        }
+    }
+    if (interactor == nullptr || this->targets.empty()) {
+        this->targets.clear();
+        if (error != nullptr) {
+            *error = "Nothing to clip, open a mesh or a volume first";
+        }
+        return false;
+    }
+
+    // The mappers share one collection, so moving its planes is all a
+    // drag does
+    this->clip_shape = shape;
+    this->display_planes = vtkSmartPointer<vtkPlaneCollection>::New();
+    const int plane_count = shape == ClipShape::Box ? kBoxPlanes : 1;
+    for (int index = 0; index < plane_count; ++index) {
+        this->planes.push_back(vtkSmartPointer<vtkPlane>::New());
+        this->display_planes->AddItem(this->planes.back());
+    }
+
+    const double center[3] = {
+        0.5 * (bounds[0] + bounds[1]),
+        0.5 * (bounds[2] + bounds[3]),
+        0.5 * (bounds[4] + bounds[5])
+    };
+    vtkAbstractWidget* widget = nullptr;
+    if (shape == ClipShape::Plane) {
+        if (!this->plane_widget) {
+            this->plane_widget =
+                vtkSmartPointer<vtkImplicitPlaneWidget2>::New();
+            vtkNew<vtkImplicitPlaneRepresentation> representation;
+            representation->SetPlaceFactor(1.0);
+            representation->OutlineTranslationOff();
+            this->plane_widget->SetRepresentation(representation);
+            this->plane_widget->KeyPressActivationOff();
+        }
+        vtkImplicitPlaneRepresentation* representation =
+            this->plane_widget->GetImplicitPlaneRepresentation();
+        representation->PlaceWidget(bounds);
+        representation->SetOrigin(center[0], center[1], center[2]);
+        representation->SetNormal(1.0, 0.0, 0.0);
+        widget = this->plane_widget;
+    } else {
+        if (!this->box_widget) {
+            this->box_widget = vtkSmartPointer<vtkBoxWidget2>::New();
+            vtkNew<vtkBoxRepresentation> representation;
+            representation->SetPlaceFactor(1.0);
+            this->box_widget->SetRepresentation(representation);
+            this->box_widget->KeyPressActivationOff();
+        }
+        this->box_widget->GetRepresentation()->PlaceWidget(bounds);
+        widget = this->box_widget;
+    }
+
+    auto handler = [this](vtkObject*, unsigned long vtk_event) {
+        if (vtk_event == vtkCommand::StartInteractionEvent) {
+            this->beginDrag();
+        } else if (vtk_event == vtkCommand::InteractionEvent) {
+            this->updatePlanes();
+        } else {
+            this->updatePlanes();
+            this->commit();
+        }
+    };
+    for (unsigned long vtk_event : {
+            vtkCommand::StartInteractionEvent,
+            vtkCommand::InteractionEvent,
+            vtkCommand::EndInteractionEvent
+            }) {
+        this->events.connect(widget, vtk_event, handler);
+    }
+    widget->SetInteractor(interactor);
+    widget->On();
+
+    this->updatePlanes();
+    for (const Target& target : this->targets) {
+        target.original->SetClippingPlanes(this->display_planes);
+    }
+    this->enabled = true;
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// InteractiveClipper::disable
+// ----------------------------------------------------------------------------
+//
+// Description: Hides the widget and shows the targets unclipped again
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Cancels the running commit, restores the original mappers
+//               and their clipping planes
+//
+// ----------------------------------------------------------------------------
+void InteractiveClipper::disable()
+{
+    ++this->generation;
+    this->cancel();
+    this->events.disconnectAll();
+    if (this->plane_widget) {
+        this->plane_widget->Off();
+    }
+    if (this->box_widget) {
+        this->box_widget->Off();
+    }
+
+    this->showOriginal();
+    for (const Target& target : this->targets) {
+        target.original->SetClippingPlanes(target.previous_planes);
+    }
+    this->targets.clear();
+    this->planes.clear();
+    this->display_planes = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->results.clear();
+    }
+    this->enabled = false;
+}
+
+// ----------------------------------------------------------------------------
+// InteractiveClipper::setCommitReady
+// ----------------------------------------------------------------------------
+//
+// Description: Sets the function told that a commit finished. It runs on
+//              the worker thread and should hand the commit to the GUI
+//              thread, which calls applyCommit.
+//
+// Inputs:
+// - ready: The function, may be empty
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Cancels the running commit
+//
+// ----------------------------------------------------------------------------
+void InteractiveClipper::setCommitReady(CommitReady ready)
+{
+    this->cancel();
+    this->commit_ready = std::move(ready);
+}
+
+// ----------------------------------------------------------------------------
+// InteractiveClipper::applyCommit
+// ----------------------------------------------------------------------------
+//
+// Description: Shows the clipped meshes of a finished commit in place of
+//              the original data. The committed mappers take the lookup
+//              table and scalar settings of the original ones, and no
+//              clipping planes.
+//
+// Inputs:
+// - commit: Commit passed to the commit ready function
+//
+// Outputs: None
+//
+// Returns: true if the meshes were replaced, false if the commit was
+//          overtaken by a later drag or commit, or the widget disabled
+//
+// Side Effects: Changes the mappers of the clipped actors
+//
+// ----------------------------------------------------------------------------
+bool InteractiveClipper::applyCommit(std::uint64_t commit)
+{
+    if (!this->enabled || commit != this->generation) {
+        return false;
+    }
+
+    std::vector<vtkSmartPointer<vtkPolyData>> clipped;
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if (commit != this->results_generation) {
+            return false;
+        }
+        clipped.swap(this->results);
+        this->applied_stats = this->results_stats;
+    }
+
+    for (std::size_t index = 0; index < clipped.size(); ++index) {
+        Target& target = this->targets[index];
+        auto actor = vtkActor::SafeDownCast(target.prop);
+        if (!clipped[index] || actor == nullptr) {
+            continue;
+        }
+        if (!target.committed) {
+            target.committed = vtkSmartPointer<vtkPolyDataMapper>::New();
+        }
+        target.committed->ShallowCopy(target.original);
+        target.committed->SetClippingPlanes(nullptr);
+        target.committed->SetInputData(clipped[index]);
+        actor->SetMapper(target.committed);
+    }
+
+    return true;
+}
+
+
+// ============================================================================
+// Private Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// InteractiveClipper::beginDrag
+// ----------------------------------------------------------------------------
+//
+// Description: Starts a widget interaction: the running commit is stale
+//              and the original mappers, clipped by the moving planes, are
+//              shown again. Their geometry is still uploaded, so nothing
+//              executes or uploads for the whole drag.
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Cancels the running commit
+//
+// ----------------------------------------------------------------------------
+void InteractiveClipper::beginDrag()
+{
+    ++this->generation;
+    this->cancel();
+    this->showOriginal();
+}
+
+// ----------------------------------------------------------------------------
+// InteractiveClipper::updatePlanes
+// ----------------------------------------------------------------------------
+//
+// Description: Moves the mapper clipping planes to the widget. Mappers keep
+//              the side the plane normals point to, so the outward faces of
+//              the crop box are turned inwards.
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Modifies the planes
+//
+// ----------------------------------------------------------------------------
+void InteractiveClipper::updatePlanes()
+{
+    if (this->planes.empty()) {
+        return;
+    }
+
+    if (this->clip_shape == ClipShape::Plane) {
+        this->plane_widget->GetImplicitPlaneRepresentation()->GetPlane(
+            this->planes.front()
+            );
+        return;
+    }
+
+    vtkNew<vtkPlanes> box;
+    vtkNew<vtkPlane> face;
+    vtkBoxRepresentation::SafeDownCast(
+        this->box_widget->GetRepresentation()
+        )->GetPlanes(box);
+    for (int index = 0; index < kBoxPlanes; ++index) {
+        double normal[3];
+        box->GetPlane(index, face);
+        face->GetNormal(normal);
+        this->planes[index]->SetOrigin(face->GetOrigin());
+        this->planes[index]->SetNormal(-normal[0], -normal[1], -normal[2]);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// InteractiveClipper::commit
+// ----------------------------------------------------------------------------
+//
+// Description: Ends a widget interaction: clips the meshes with a snapshot
+//              of the widget on the worker thread, one mesh per task. The
+//              original mappers keep showing the clip through their planes
+//              until the result is applied.
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Starts the worker thread
+//
+// ----------------------------------------------------------------------------
+void InteractiveClipper::commit()
+{
+    this->cancel();
+    const std::uint64_t commit = ++this->generation;
+
+    std::vector<vtkSmartPointer<vtkPolyData>> inputs;
+    std::vector<vtkSmartPointer<vtkImplicitFunction>> functions;
+    bool any = false;
+    for (const Target& target : this->targets) {
+        inputs.push_back(target.input);
+        functions.push_back(
+            target.input ? this->clipFunction(target.prop) : nullptr
+            );
+        any = any || target.input;
+    }
+    if (!any) {
+        return;
+    }
+
+    // The crop box keeps the inside, where its function is negative
+    const bool inside_out = this->clip_shape == ClipShape::Box;
+    auto clip = [this, commit, inputs, functions, inside_out]() {
+        const auto started = Clock::now();
+        std::vector<vtkSmartPointer<vtkPolyData>> clipped(inputs.size());
+        vtkSMPTools::For(
+            0,
+            static_cast<vtkIdType>(inputs.size()),
+            1,
+            [&](vtkIdType first, vtkIdType last) {
+                for (vtkIdType index = first; index < last; ++index) {
+                    if (inputs[index] && !this->cancelled) {
+                        clipped[index] = clipMesh(
+                            inputs[index],
+                            functions[index],
+                            inside_out,
+                            this->cancelled
+                            );
+                    }
+                }
+            }
+            );
+        if (this->cancelled) {
+            return;
+        }
+
+        ClipCommitStats stats;
+        for (std::size_t index = 0; index < inputs.size(); ++index) {
+            if (clipped[index]) {
+                ++stats.meshes;
+                stats.input_cells += inputs[index]->GetNumberOfCells();
+                stats.output_cells += clipped[index]->GetNumberOfCells();
+            }
+        }
+        stats.seconds = std::chrono::duration<double>(
+            Clock::now() - started).count();
+
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->results_generation = commit;
+            this->results = std::move(clipped);
+            this->results_stats = stats;
+        }
+        if (this->commit_ready) {
+            this->commit_ready(commit);
+        }
+    };
+    this->worker = std::thread(clip);
+}
+
+// ----------------------------------------------------------------------------
+// InteractiveClipper::cancel
+// ----------------------------------------------------------------------------
+//
+// Description: Stops the running commit, if any, and waits for it. Its
+//              commit ready function is not called.
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Joins the worker thread
+//
+// ----------------------------------------------------------------------------
+void InteractiveClipper::cancel()
+{
+    if (this->worker.joinable()) {
+        this->cancelled = true;
+        this->worker.join();
+    }
+    this->cancelled = false;
+}
+
+// ----------------------------------------------------------------------------
+// InteractiveClipper::showOriginal
+// ----------------------------------------------------------------------------
+//
+// Description: Puts the original mappers back on the actors showing a
+//              committed clip
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Changes the mappers of the clipped actors
+//
+// ----------------------------------------------------------------------------
+void InteractiveClipper::showOriginal()
+{
+    for (const Target& target : this->targets) {
+        auto actor = vtkActor::SafeDownCast(target.prop);
+        if (actor != nullptr && actor->GetMapper() != target.original) {
+            actor->SetMapper(vtkMapper::SafeDownCast(target.original));
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// InteractiveClipper::clipFunction
+// ----------------------------------------------------------------------------
+//
+// Description: Returns a copy of the widget as an implicit function, which
+//              the worker thread owns. The widget is in world space; the
+//              transform of the prop maps its data points there first.
+//
+// Inputs:
+// - prop: The prop whose data is clipped
+//
+// Outputs: None
+//
+// Returns: A vtkPlane, or the vtkPlanes of the crop box
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+vtkSmartPointer<vtkImplicitFunction> InteractiveClipper::clipFunction(
+    vtkProp3D* prop
+    ) const
+{
+    vtkSmartPointer<vtkImplicitFunction> function;
+    if (this->clip_shape == ClipShape::Plane) {
+        auto plane = vtkSmartPointer<vtkPlane>::New();
+        this->plane_widget->GetImplicitPlaneRepresentation()->GetPlane(plane);
+        function = plane;
+    } else {
+        auto box = vtkSmartPointer<vtkPlanes>::New();
+        vtkBoxRepresentation::SafeDownCast(
+            this->box_widget->GetRepresentation()
+            )->GetPlanes(box);
+        function = box;
+    }
+
+    vtkMatrix4x4* matrix = prop->GetMatrix();
+    if (!matrix->IsIdentity()) {
+        vtkNew<vtkTransform> transform;
+        transform->SetMatrix(matrix);
+        function->SetTransform(transform);
+    }
+
+    return function;
+}
@@ -0,0 +1,206 @@
+// ============================================================================
+// InteractiveClipper.h - Clip plane and crop box widgets, deferred clipping
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * InteractiveClipper.h: created.
+//
+// ============================================================================
+
+
+#ifndef InteractiveClipper_H
+#define InteractiveClipper_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Standard Library headers
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// External libraries headers
+#include <vtkAbstractMapper.h>
+#include <vtkBoxWidget2.h>
+#include <vtkImplicitFunction.h>
+#include <vtkImplicitPlaneWidget2.h>
+#include <vtkPlane.h>
+#include <vtkPlaneCollection.h>
+#include <vtkPolyData.h>
+#include <vtkPolyDataMapper.h>
+#include <vtkProp3D.h>
+#include <vtkRenderWindowInteractor.h>
+#include <vtkSmartPointer.h>
+#include <vtkType.h>
+
+// Project headers
+#include "EventDispatcher.h"
+
+
+// ============================================================================
+// Enumerations Section
+// ============================================================================
+
+// Widget clipping the targets
+enum class ClipShape {
+    Plane,  // Keeps the side the plane normal points to
+    Box  // Keeps the inside of the box
+};
+
+
+// ============================================================================
+// Structure Definitions Section
+// ============================================================================
+
+// What the last committed clip did
+struct ClipCommitStats {
+    int meshes = 0;  // Meshes clipped
+    vtkIdType input_cells = 0;
+    vtkIdType output_cells = 0;
+    double seconds = 0.0;  // Time on the worker thread
+};
+
+
+// ============================================================================
+// Class Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// InteractiveClipper
+// ----------------------------------------------------------------------------
+//
+// Description: Clips or crops the displayed props with an implicit plane
+//              widget or a box widget. While the widget is dragged only the
+//              clipping planes of the mappers move: the GPU discards the
+//              fragments outside, nothing upstream executes and the
+//              uploaded geometry is reused. When the widget is released
+//              the meshes are clipped for real with vtkClipPolyData on a
+//              worker thread, one mesh per task, and the results replace
+//              the displayed geometry once applyCommit is called on the
+//              GUI thread. Grabbing the widget again cancels a commit
+//              still running and puts the original mappers back.
+//              Volumes, image slices and meshes that are not poly data
+//              keep the mapper clipping planes only.
+//
+// Properties:
+// - targets: The clipped props, with their original and committed mappers
+// - plane_widget, box_widget: The widget of each shape, created on use
+// - display_planes: The planes of the mappers, moved during drags
+// - clip_shape: Shape of the widget shown
+// - enabled: Whether a widget is shown
+// - worker: The thread of the running commit
+// - cancelled: Raised to stop the running commit
+// - generation: Commit shown when finished, bumped by every commit and drag
+// - commit_ready: Told on the worker thread when a commit finished
+// - results: Clipped meshes of the last finished commit, guarded by mutex
+//
+// Methods:
+// - enable: Shows a widget around the targets
+// - disable: Hides the widget and restores the targets
+// - isEnabled, shape: Return the state
+// - setCommitReady: Sets the function told about finished commits
+// - applyCommit: Shows the clipped meshes of a finished commit
+// - lastCommitStats: Returns what the last applied commit did
+//
+// Example usage:
+//   InteractiveClipper clipper;
+//   clipper.setCommitReady([&](std::uint64_t commit) {
+//       postToGuiThread([&, commit]() { clipper.applyCommit(commit); });
+//   });
+//   clipper.enable(interactor, ClipShape::Box, {mesh_actor});
+//
+// ----------------------------------------------------------------------------
+class InteractiveClipper
+{
+public:
+    using CommitReady = std::function<void(std::uint64_t commit)>;
+
+    // Constructor/Destructor
+    InteractiveClipper() = default;
+    ~InteractiveClipper();
+
+    InteractiveClipper(const InteractiveClipper&) = delete;
+    InteractiveClipper& operator=(const InteractiveClipper&) = delete;
+
+    bool enable(
+        vtkRenderWindowInteractor* interactor,
+        ClipShape shape,
+        const std::vector<vtkProp3D*>& props,
+        std::string* error = nullptr
+        );  // Replaces the widget shown, if any
+    void disable();
+    bool isEnabled() const { return this->enabled; }
+    ClipShape shape() const { return this->clip_shape; }
+
+    void setCommitReady(CommitReady ready);  // Called on the worker thread
+    bool applyCommit(std::uint64_t commit);  // On the GUI thread
+    ClipCommitStats lastCommitStats() const { return this->applied_stats; }
+
+private:
+    struct Target {
+        vtkSmartPointer<vtkProp3D> prop;
+        vtkSmartPointer<vtkAbstractMapper> original;  // Shows the full data
+        vtkSmartPointer<vtkPlaneCollection> previous_planes;
+        vtkSmartPointer<vtkPolyData> input;  // Meshes only, read by commits
+        vtkSmartPointer<vtkPolyDataMapper> committed;  // Shows the clip
+    };
+
+    void beginDrag();  // Start of a widget interaction
+    void updatePlanes();  // From the widget, during drags
+    void commit();  // End of a widget interaction
+    void cancel();  // Stops the running commit and waits for it
+    void showOriginal();  // Puts the original mappers back
+    vtkSmartPointer<vtkImplicitFunction> clipFunction(
+        vtkProp3D* prop
+        ) const;  // Snapshot of the widget, in the data space of prop
+
+    std::vector<Target> targets;
+    vtkSmartPointer<vtkImplicitPlaneWidget2> plane_widget;
+    vtkSmartPointer<vtkBoxWidget2> box_widget;
+    vtkSmartPointer<vtkPlaneCollection> display_planes;
+    std::vector<vtkSmartPointer<vtkPlane>> planes;  // Items of the above
+    ClipShape clip_shape = ClipShape::Plane;
+    bool enabled = false;
+    ClipCommitStats applied_stats;
+    EventDispatcher events;
+
+    std::thread worker;
+    std::atomic<bool> cancelled{false};
+    std::atomic<std::uint64_t> generation{0};
+    CommitReady commit_ready;
+
+    // Guarded by mutex
+    std::mutex mutex;
+    std::uint64_t results_generation = 0;
+    std::vector<vtkSmartPointer<vtkPolyData>> results;  // Per target
+    ClipCommitStats results_stats;
+};
+
+#endif  // InteractiveClipper_H
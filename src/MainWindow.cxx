@@ -26,6 +26,40 @@
 //
 // * MainWindow.cpp: created.
 //
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * MainWindow.cpp: added the shared memory live-data ingest.
+// * MainWindow.cpp: the scene is now built by buildScene (Scene.h).
+// * MainWindow.cpp: renderer events and the status line now come from the
+//   qtvtk_core library (EventDispatcher, StatusReport).
+// * MainWindow.cpp: added the adaptive frame rate controller.
+// * MainWindow.cpp: added volume loading under the global memory budget.
+// * MainWindow.cpp: volumes can be kept compressed in bricks and shown as
+//   streamed orthogonal slices.
+// * MainWindow.cpp: added mesh loading with cached preprocessing.
+// * MainWindow.cpp: added hierarchical culling of parts.
+// * MainWindow.cpp: added merged-geometry batching of parts and meshes,
+//   with cell picking of the batched parts.
+// * MainWindow.cpp: added tiled high resolution image export.
+// * MainWindow.cpp: added video export.
+// * MainWindow.cpp: added declarative scene files.
+// * MainWindow.cpp: added the window/level slice view.
+// * MainWindow.cpp: added the statistics panel and auto window/level.
+// * MainWindow.cpp: added the volume pyramid builder.
+// * MainWindow.cpp: added opening chunked volume files.
+// * MainWindow.cpp: added the clip plane and crop box widgets.
+// * MainWindow.cpp: added parallel streamline tracing.
+// * MainWindow.cpp: added frame pacing of mouse moves, with the
+//   input-to-frame latency in the status bar.
+// * MainWindow.cpp: added rendering into pooled frame buffers.
+// * MainWindow.cpp: added sort-last rendering of the meshes.
+// * MainWindow.cpp: added camera bookmarks on the digit keys, kept in
+//   session files, with animated transitions between them.
+// * MainWindow.cpp: the live-data color range is the one the producer
+//   publishes, or a scan at most once per kIngestRangeInterval.
+// * MainWindow.cpp: motion proxies of a mesh are built when it is opened.
+// * MainWindow.cpp: opened meshes are tracked by the memory budget.
+//
 // ============================================================================
 
 
@@ -42,9 +76,6 @@
 // ============================================================================
 
 
-#define _USE_MATH_DEFINES
-
-
 // ============================================================================
 // Headers include section
 // ============================================================================
@@ -52,11 +83,24 @@
 // Related header -------------------------------------------------------------
 #include "MainWindow.h"
 #include "ui_MainWindow.h"
+#include "BrickedImageSource.h"
+#include "ChunkedVolumeImageReader.h"
+#include "MeshPreprocessor.h"
+#include "Scene.h"
+#include "StatisticsPanel.h"
+#include "TiledImageExport.h"
+#include "VideoExport.h"
+#include "VolumePyramid.h"
 
 // "C" system headers ---------------------------------------------------------
 
 // Standard Library headers ---------------------------------------------------
+#include <algorithm>
 #include <cmath>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <utility>
 
 // External libraries headers -------------------------------------------------
 
@@ -66,20 +110,48 @@
 #include <vtkRenderWindowInteractor.h>
 #include <vtkRenderer.h>
 #include <vtkActor.h>
-#include <vtkProperty.h>
-#include <vtkPolyDataMapper.h>
-#include <vtkConeSource.h>
-#include <vtkColor.h>
-#include <vtkNamedColors.h>
+#include <vtkAbstractVolumeMapper.h>
+#include <vtkAppendPolyData.h>
 #include <vtkCamera.h>
+#include <vtkInteractorStyleImage.h>
+#include <vtkPropCollection.h>
+#include <vtkDataSetMapper.h>
+#include <vtkPointData.h>
+#include <vtkCommand.h>
+#include <vtkCellPicker.h>
+#include <vtkCullerCollection.h>
+#include <vtkColorTransferFunction.h>
+#include <vtkImageData.h>
+#include <vtkImageProperty.h>
+#include <vtkImageReader2.h>
+#include <vtkImageSlice.h>
+#include <vtkImageSliceMapper.h>
+#include <vtkPiecewiseFunction.h>
+#include <vtkPolyDataMapper.h>
+#include <vtkSmartVolumeMapper.h>
+#include <vtkTexture.h>
+#include <vtkVolume.h>
+#include <vtkVolumeProperty.h>
 
 // Qt headers
 #include <QAction>
-#include <QChar>
 #include <QKeySequence>
 #include <QtWidgets>
 
 
+// ============================================================================
+// Global constants section
+// ============================================================================
+
+// Render requests arriving within this window (milliseconds) are merged
+// into a single render, which caps live-data redraws at roughly 60 fps
+const int kRenderCoalesceInterval = 16;
+
+// Live data whose producer publishes no value range is scanned for it at
+// most this often (milliseconds), not for every generation
+const int kIngestRangeInterval = 1000;
+
+
 // ============================================================================
 // Constructor/Destructor Section
 // ============================================================================
@@ -117,127 +189,413 @@ MainWindow::MainWindow(int argc, char* argv[])
 
     // Initialize the VTK scene -----------------------------------------------
 
-    //Create a cone
-    auto coneSource = vtkSmartPointer<vtkConeSource>::New();
-    coneSource->SetHeight(3.0);
-    coneSource->SetRadius(1.5);
-    coneSource->SetResolution(40);
-    coneSource->Update();
-
-    //Create a mapper and actor
-    auto mapper = vtkSmartPointer<vtkPolyDataMapper>::New();
-    mapper->SetInputConnection(coneSource->GetOutputPort());
-
-    auto colors = vtkSmartPointer<vtkNamedColors>::New();
-
-    auto actor = vtkSmartPointer<vtkActor>::New();
-    actor->SetMapper(mapper);
-    actor->GetProperty()->SetDiffuseColor(
-        // Demonstrate how to use the named colors
-        colors->GetColor3d("bisque").GetData()
-        );
+    // Chunked volume files open through the image reader factory
+    ChunkedVolumeImageReader::RegisterWithFactory();
 
     //Create a renderer, render window, and interactor
-    auto renderer = vtkSmartPointer<vtkRenderer>::New();
+    this->renderer = vtkSmartPointer<vtkRenderer>::New();
     this->render_widget = new QVTKOpenGLNativeWidget();
     vtkNew<vtkGenericOpenGLRenderWindow> render_window;
     this->render_widget->setRenderWindow(render_window.Get());
     this->ui->mainview->setRenderWindow(render_window.Get());
-    render_window->AddRenderer(renderer);
-
-    //Add the actors to the scene
-    renderer->AddActor(actor);
-    renderer->SetBackground(
-        // Demonstrate how to use custom colors. The background is a dark
-        // slate gray. We pass the relative intensity of each color in the
-        // range 0 to 1.
-        vtkColor3d(7.0/255.0, 54.0/255.0, 66.0/255.0).GetData()
-        );
-    
-    // Connect the VTK events to the Qt slots
-    this->vtk_event_connect = vtkSmartPointer<vtkEventQtSlotConnect>::New();
-    this->vtk_event_connect->Connect(
-        renderer,
+    render_window->AddRenderer(this->renderer);
+
+    // Populate the scene. The default description is a bisque cone on a
+    // dark slate gray background, seen from 30 degrees azimuth and elevation.
+    this->cone_actor = buildScene(this->renderer, SceneDescription());
+
+    // Replace the default coverage culler, which tests every prop every
+    // frame, by the hierarchy. Unregistered props are passed through.
+    this->culler = vtkSmartPointer<BvhCuller>::New();
+    this->renderer->GetCullers()->RemoveAllItems();
+    this->renderer->AddCuller(this->culler);
+
+    // Route the renderer events to the status line
+    this->events.connect(
+        this->renderer,
         vtkCommand::EndEvent,
+        [this](vtkObject* caller, unsigned long vtk_event) {
+            this->dispatchRendererEvent(caller, vtk_event);
+        }
+        );
+
+    // Hold the interactive frame rate by lowering quality while interacting
+    this->frame_rate.attach(this->renderer, render_window->GetInteractor());
+
+    // Merge mouse moves and pass them on at a fixed rate, so high rate
+    // mice do not queue up renders
+    this->frame_pacer = new FramePacer(
+        this->ui->mainview,
+        render_window.Get(),
+        this
+        );
+
+    // Read frames for embedding pipelines into a few reused buffers
+    this->frame_readback = std::make_unique<FrameReadback>(
+        render_window.Get()
+        );
+
+    // Digit keys restore bookmarked views, Ctrl+digit keys bookmark them.
+    // Pressing a mouse button or turning the wheel ends a transition.
+    vtkRenderWindowInteractor* interactor = render_window->GetInteractor();
+    this->events.connect(
+        interactor,
+        vtkCommand::KeyPressEvent,
+        [this](vtkObject*, unsigned long) { this->handleBookmarkKey(); }
+        );
+    for (unsigned long vtk_event : {
+            vtkCommand::LeftButtonPressEvent,
+            vtkCommand::MiddleButtonPressEvent,
+            vtkCommand::RightButtonPressEvent,
+            vtkCommand::MouseWheelForwardEvent,
+            vtkCommand::MouseWheelBackwardEvent
+            }) {
+        this->events.connect(
+            interactor,
+            vtk_event,
+            [this](vtkObject*, unsigned long) { this->stopCameraTransition(); }
+            );
+    }
+
+    // Pick cells with the 'p' key, so parts merged into a batch can still
+    // be told apart by their cell ids
+    this->picker = vtkSmartPointer<vtkCellPicker>::New();
+    this->picker->SetTolerance(0.0005);
+    render_window->GetInteractor()->SetPicker(this->picker);
+    this->events.connect(
+        this->picker,
+        vtkCommand::EndPickEvent,
+        [this](vtkObject*, unsigned long) { this->reportPick(); }
+        );
+
+    // Merge bursts of render requests into a single render
+    this->render_timer = new QTimer(this);
+    this->render_timer->setSingleShot(true);
+    this->render_timer->setInterval(kRenderCoalesceInterval);
+    connect(
+        this->render_timer,
+        &QTimer::timeout,
+        this,
+        &MainWindow::render
+        );
+
+    // Statistics of the last volume opened, docked on the right and shown
+    // from the View menu
+    this->statistics_panel = new StatisticsPanel();
+    this->statistics_dock = new QDockWidget(tr("Statistics"), this);
+    this->statistics_dock->setObjectName("statistics_dock");
+    this->statistics_dock->setWidget(this->statistics_panel);
+    this->addDockWidget(Qt::RightDockWidgetArea, this->statistics_dock);
+    this->statistics_dock->hide();
+    this->ui->menuView->addAction(this->statistics_dock->toggleViewAction());
+    connect(
+        this->statistics_panel,
+        &StatisticsPanel::autoWindowLevelRequested,
         this,
-        SLOT(dispatchRendererEvent(vtkObject*, unsigned long, void*))
+        &MainWindow::autoWindowLevel
         );
 
-    // Set the camera position
-    renderer->ResetCamera();
-    renderer->GetActiveCamera()->Azimuth(30.0);
-    renderer->GetActiveCamera()->Elevation(30.0);
+    // Clips finish on the clipper thread, they are shown on the GUI thread
+    QPointer<MainWindow> window(this);
+    this->clipper.setCommitReady([window](std::uint64_t commit) {
+        if (window) {
+            QMetaObject::invokeMethod(
+                window,
+                [window, commit]() { window->applyClipCommit(commit); },
+                Qt::AutoConnection
+                );
+        }
+    });
+
+    // Preprocessed meshes are cached per user
+    this->mesh_cache_dir = QStandardPaths::writableLocation(
+        QStandardPaths::CacheLocation
+        ).toStdString() + "/meshes";
 
     // Initialize the status bar ----------------------------------------------
     this->ui->statusbar->showMessage("Ready");
 }
 
+// ----------------------------------------------------------------------------
+// MainWindow::~MainWindow
+// ----------------------------------------------------------------------------
+//
+// Description: Destructor
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Removes the loaded volumes and meshes from the global
+//               memory budget
+//
+// ----------------------------------------------------------------------------
+MainWindow::~MainWindow()
+{
+    for (const auto& loaded : this->volumes) {
+        MemoryBudget::global().untrack(loaded.memory_id);
+        MemoryBudget::global().untrack(loaded.cache_id);
+    }
+    for (const std::uint64_t id : this->mesh_memory_ids) {
+        MemoryBudget::global().untrack(id);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::attachSharedMemory
+// ----------------------------------------------------------------------------
+//
+// Description: Maps a live-data shared memory segment and displays it in
+//              place of the demo cone. The segment arrays are used in place,
+//              without copying, and a timer watches the sequence counter for
+//              new generations.
+//
+// Inputs:
+// - name: Name of the shared memory segment
+// - poll_interval: How often the sequence counter is checked, in ms
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: Hides the demo cone and resets the camera
+//
+// ----------------------------------------------------------------------------
+bool MainWindow::attachSharedMemory(
+    const std::string& name,
+    int poll_interval,
+    std::string* error
+    )
+{
+    auto ingest = std::make_unique<SharedMemoryIngest>();
+    if (!ingest->open(name)) {
+        if (error != nullptr) {
+            *error = ingest->lastError();
+        }
+        return false;
+    }
+
+    auto mapper = vtkSmartPointer<vtkDataSetMapper>::New();
+    mapper->SetInputData(ingest->image());
+    mapper->SetScalarModeToUsePointData();
+    mapper->ScalarVisibilityOn();
+
+    if (this->ingest_actor) {
+        this->renderer->RemoveActor(this->ingest_actor);
+    }
+    this->ingest_actor = vtkSmartPointer<vtkActor>::New();
+    this->ingest_actor->SetMapper(mapper);
+    this->renderer->AddActor(this->ingest_actor);
+    this->cone_actor->VisibilityOff();
+    this->renderer->ResetCamera();
+
+    this->ingest = std::move(ingest);
+    this->updateIngestRange(true);
+    if (!this->ingest_timer) {
+        this->ingest_timer = new QTimer(this);
+        connect(
+            this->ingest_timer,
+            &QTimer::timeout,
+            this,
+            &MainWindow::pollSharedMemory
+            );
+    }
+    this->ingest_timer->start(poll_interval);
+
+    this->statusMessage(
+        QString("Attached to shared memory segment '%1'")
+        .arg(QString::fromStdString(name))
+        );
+    this->requestRender();
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::pollSharedMemory
+// ----------------------------------------------------------------------------
+//
+// Description: Checks the live-data segment for a new generation and, if
+//              there is one, requests a render. Several generations arriving
+//              before the render fires are drawn only once.
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Updates the scalar range of the live-data mapper
+//
+// ----------------------------------------------------------------------------
+void MainWindow::pollSharedMemory()
+{
+    if (!this->ingest || !this->ingest->poll()) {
+        return;
+    }
+
+    this->updateIngestRange(false);
+    this->requestRender();
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::updateIngestRange
+// ----------------------------------------------------------------------------
+//
+// Description: Sets the color range of the live data to the range its
+//              producer published. Without one the payload is scanned, which
+//              touches every value on the GUI thread, so at most once per
+//              kIngestRangeInterval unless forced.
+//
+// Inputs:
+// - force: Whether to scan regardless of the last scan
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Updates the scalar range of the live-data mapper
+//
+// ----------------------------------------------------------------------------
+void MainWindow::updateIngestRange(bool force)
+{
+    double range[2];
+    if (!this->ingest->publishedRange(range)) {
+        vtkDataArray* scalars =
+            this->ingest->image()->GetPointData()->GetScalars();
+        const bool recent = !force && this->ingest_range_clock.isValid()
+            && this->ingest_range_clock.elapsed() < kIngestRangeInterval;
+        if (scalars == nullptr || recent) {
+            return;
+        }
+        scalars->GetRange(range);
+        this->ingest_range_clock.start();
+    }
+
+    this->ingest_actor->GetMapper()->SetScalarRange(range);
+}
+
 // ----------------------------------------------------------------------------
 // MainWindow::dispatchRendererEvent
 // ----------------------------------------------------------------------------
 //
-// Description: Registers the VTK events from the renderer object
+// Description: Handles the VTK events from the renderer object
 //
 // Inputs:
 // - caller: The object that triggered the event
 // - vtk_event: The event that was triggered
-// - client_data: The data associated with the event
 //
 // Outputs: None
 //
 // Returns: None
 //
-// Side Effects: None
+// Side Effects: Updates the status bar
 //
 // ----------------------------------------------------------------------------
 void MainWindow::dispatchRendererEvent(
     vtkObject* caller,
-    unsigned long vtk_event,
-    void* client_data
+    unsigned long vtk_event
     )
 {
-    // Note the use of reinterpret_cast to cast the caller to the expected type.
-    auto renderer = reinterpret_cast<vtkRenderer*>(caller);
-
-    // Calculate the azimuth and elevation of the camera
-    double azimuth = asin(
-        - renderer->GetActiveCamera()->GetDirectionOfProjection()[1]
-        ) * 180.0 / M_PI;
-    double elevation = acos(
-        - renderer->GetActiveCamera()->GetDirectionOfProjection()[2]
-        / cos(azimuth * M_PI / 180.0)
-        ) * 180.0 / M_PI;
-    
+    auto renderer = vtkRenderer::SafeDownCast(caller);
+    if (renderer == nullptr || vtk_event != vtkCommand::EndEvent) {
+        return;
+    }
+
     // Display the camera position in the status bar
-    QString str_azimuth = QString("azimuth: %1%2")
-        .arg(azimuth, 6, 'f', 1)
-        .arg(QChar(0x00B0));
-    QString str_elevation = QString("elevation: %1%2")
-        .arg(elevation, 6, 'f', 1)
-        .arg(QChar(0x00B0));
-    QString str_roll = QString("roll: %1%2")
-        .arg(renderer->GetActiveCamera()->GetRoll(), 6, 'f', 1)
-        .arg(QChar(0x00B0));
-    QString str_zoom = QString("distance: %1").arg(
-        renderer->GetActiveCamera()->GetDistance(), 6, 'f', 1
-        );
-    this->statusMessage(
-        QString("Camera ")
-        + str_azimuth + " / "
-        + str_elevation + " / "
-        + str_roll + " / "
-        + str_zoom
+    this->status.setCamera(cameraStatus(renderer->GetActiveCamera()));
+    if (this->ingest) {
+        this->status.setField(
+            "Generation",
+            std::to_string(this->ingest->generation())
+            );
+    }
+    MemoryBudget& memory = MemoryBudget::global();
+    memory.markRendered(renderer);
+    if (memory.budget() > 0 || memory.entryCount() > 0) {
+        this->status.setField("Memory", memory.describe());
+    }
+    if (this->culler->GetLastStats().managed > 0) {
+        this->status.setField("Parts", this->culler->DescribeLastStats());
+    }
+    if (this->batching && this->batcher.partCount() > 0) {
+        this->status.setField("Batches", this->batcher.describe());
+    }
+    if (this->frame_rate.framesPerSecond() > 0.0) {
+        char fps[32];
+        std::snprintf(
+            fps, sizeof(fps), "%.1f", this->frame_rate.framesPerSecond()
+            );
+        this->status.setField("FPS", fps);
+        this->status.setField(
+            "Quality",
+            this->frame_rate.qualityLevel() == 0
+                ? std::string("full")
+                : "level " + std::to_string(this->frame_rate.qualityLevel())
+            );
+    }
+    const FramePacerStats input = this->frame_pacer
+        ? this->frame_pacer->stats()
+        : FramePacerStats();
+    if (input.samples > 0) {
+        char latency[64];
+        std::snprintf(
+            latency,
+            sizeof(latency),
+            "%.1f ms (max %.1f)",
+            input.latency_mean,
+            input.latency_max
+            );
+        this->status.setField("Latency", latency);
+    }
+    this->statusMessage(QString::fromStdString(this->status.text()));
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::setTargetFrameRate
+// ----------------------------------------------------------------------------
+//
+// Description: Sets the frame rate the view should hold while the user
+//              interacts with it
+//
+// Inputs:
+// - fps: Target frames per second, 0 or less disables adaptive quality
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Attaches or detaches the frame rate controller
+//
+// ----------------------------------------------------------------------------
+void MainWindow::setTargetFrameRate(double fps)
+{
+    if (fps <= 0.0) {
+        this->frame_rate.detach();
+        this->status.removeField("FPS");
+        this->status.removeField("Quality");
+        return;
+    }
+
+    this->frame_rate.setTargetFrameRate(fps);
+    this->frame_rate.attach(
+        this->renderer,
+        this->ui->mainview->renderWindow()->GetInteractor()
         );
 }
 
 // ----------------------------------------------------------------------------
-// MainWindow::statusMessage
+// MainWindow::setInputRate
 // ----------------------------------------------------------------------------
 //
-// Description: Displays a status message in the status bar
+// Description: Sets the rate mouse moves over the view are passed on to the
+//              interactor at. Moves in between are merged into the last one.
 //
 // Inputs:
-// - message: The message to display
+// - hz: Deliveries per second, 0 or less passes every move on as it comes
 //
 // Outputs: None
 //
@@ -246,18 +604,145 @@ void MainWindow::dispatchRendererEvent(
 // Side Effects: None
 //
 // ----------------------------------------------------------------------------
-void MainWindow::statusMessage(const QString& message)
+void MainWindow::setInputRate(double hz)
 {
-    this->ui->statusbar->showMessage(message);
+    if (this->frame_pacer) {
+        this->frame_pacer->setRate(hz);
+    }
 }
 
 // ----------------------------------------------------------------------------
-// MainWindow::render
+// MainWindow::openVolume
 // ----------------------------------------------------------------------------
 //
-// Description: Renders the VTK scene
+// Description: Loads a volume image (any format createVolumeReader
+//              reads: MetaImage, NRRD, single DICOM files, TIFF and chunked
+//              volume files, among others) and displays it
+//              with a volume mapper. Before reading, datasets are evicted
+//              from the global memory budget until the new volume fits.
+//              With volume compression on, the volume goes to
+//              openBrickedVolume instead.
 //
-// Inputs: None
+// Inputs:
+// - path: The file to open
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: Hides the demo cone and resets the camera
+//
+// ----------------------------------------------------------------------------
+bool MainWindow::openVolume(const std::string& path, std::string* error)
+{
+    vtkSmartPointer<vtkImageReader2> reader = createVolumeReader(path);
+    if (!reader) {
+        if (error != nullptr) {
+            *error = "No reader for '" + path + "'";
+        }
+        return false;
+    }
+    reader->SetFileName(path.c_str());
+    if (this->compress_volumes) {
+        return this->openBrickedVolume(reader, path, error);
+    }
+    reader->UpdateInformation();
+
+    // Make room before reading, using the size the header announces
+    const int* extent = reader->GetDataExtent();
+    const std::uint64_t estimate =
+        std::uint64_t(extent[1] - extent[0] + 1)
+        * std::uint64_t(extent[3] - extent[2] + 1)
+        * std::uint64_t(extent[5] - extent[4] + 1)
+        * std::uint64_t(std::max(1, reader->GetNumberOfScalarComponents()))
+        * std::uint64_t(
+            vtkDataArray::GetDataTypeSize(reader->GetDataScalarType())
+            );
+    const std::vector<std::string> evicted =
+        MemoryBudget::global().enforce(estimate);
+
+    reader->Update();
+    vtkImageData* output = reader->GetOutput();
+    if (reader->GetErrorCode() != 0
+        || output == nullptr
+        || output->GetPointData()->GetScalars() == nullptr) {
+        if (error != nullptr) {
+            *error = "Failed to read '" + path + "'";
+        }
+        return false;
+    }
+
+    // Keep only the image, not the reader and its buffers
+    auto image = vtkSmartPointer<vtkImageData>::New();
+    image->ShallowCopy(output);
+    reader = nullptr;
+
+    double range[2];
+    image->GetPointData()->GetScalars()->GetRange(range);
+    auto color = vtkSmartPointer<vtkColorTransferFunction>::New();
+    color->AddRGBPoint(range[0], 0.0, 0.0, 0.0);
+    color->AddRGBPoint(range[1], 1.0, 1.0, 1.0);
+    auto opacity = vtkSmartPointer<vtkPiecewiseFunction>::New();
+    opacity->AddPoint(range[0], 0.0);
+    opacity->AddPoint(range[1], 0.2);
+
+    auto property = vtkSmartPointer<vtkVolumeProperty>::New();
+    property->SetColor(color);
+    property->SetScalarOpacity(opacity);
+    property->SetInterpolationTypeToLinear();
+
+    auto mapper = vtkSmartPointer<vtkSmartVolumeMapper>::New();
+    mapper->SetInputData(image);
+
+    auto volume = vtkSmartPointer<vtkVolume>::New();
+    volume->SetMapper(mapper);
+    volume->SetProperty(property);
+
+    LoadedVolume loaded;
+    loaded.label = QFileInfo(QString::fromStdString(path))
+        .fileName().toStdString();
+    loaded.props.push_back(volume);
+    loaded.memory_id = MemoryBudget::global().track(
+        image,
+        CacheTier::Primary,
+        this->evictionHandler(volume),
+        loaded.label,
+        volume
+        );
+    this->renderer->AddVolume(volume);
+    this->volumes.push_back(loaded);
+    this->computeStatistics();
+
+    this->cone_actor->VisibilityOff();
+    this->renderer->ResetCamera();
+
+    QString message = QString("Opened %1")
+        .arg(QString::fromStdString(loaded.label));
+    if (!evicted.empty()) {
+        message += QString(", evicted %1 dataset(s) to stay within budget")
+            .arg(evicted.size());
+    }
+    this->statusMessage(message);
+    this->requestRender();
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::setVolumeCompression
+// ----------------------------------------------------------------------------
+//
+// Description: Chooses how volumes opened afterwards are kept in memory.
+//              Compressed volumes are stored as losslessly compressed
+//              bricks (see BrickedVolume) and shown as three orthogonal
+//              slices that decode only the bricks they cut through, which
+//              lets volumes several times larger than the memory budget be
+//              browsed.
+//
+// Inputs:
+// - enabled: true to keep volumes compressed
+// - cache_bytes: Capacity of the decoded brick cache of each volume
 //
 // Outputs: None
 //
@@ -266,16 +751,185 @@ void MainWindow::statusMessage(const QString& message)
 // Side Effects: None
 //
 // ----------------------------------------------------------------------------
-void MainWindow::render()
+void MainWindow::setVolumeCompression(bool enabled, std::size_t cache_bytes)
 {
-    this->ui->mainview->renderWindow()->Render();
+    this->compress_volumes = enabled;
+    this->brick_cache_bytes = cache_bytes;
 }
 
 // ----------------------------------------------------------------------------
-// MainWindow::about
+// MainWindow::openBrickedVolume
 // ----------------------------------------------------------------------------
 //
-// Description: Displays the about dialog
+// Description: Streams a volume from its reader into compressed bricks, one
+//              slab of bricks at a time, and displays it as three orthogonal
+//              slices through the middle of the volume. The compressed
+//              bricks are tracked by the memory budget as primary data, the
+//              decoded brick cache as derived data, so the cache is dropped
+//              first under pressure.
+//
+// Inputs:
+// - reader: Reader with its file name set
+// - path: The file being opened
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: Hides the demo cone and resets the camera
+//
+// ----------------------------------------------------------------------------
+bool MainWindow::openBrickedVolume(
+    vtkAlgorithm* reader,
+    const std::string& path,
+    std::string* error
+    )
+{
+    // The compressed size is unknown up front, make room for the cache
+    MemoryBudget& memory = MemoryBudget::global();
+    const std::vector<std::string> evicted =
+        memory.enforce(this->brick_cache_bytes);
+
+    std::string reason;
+    std::shared_ptr<BrickedVolume> bricked = BrickedVolume::fromSource(
+        reader,
+        BrickedVolume::kDefaultBrickSize,
+        this->brick_cache_bytes,
+        &reason
+        );
+    if (!bricked) {
+        if (error != nullptr) {
+            *error = "Failed to read '" + path + "': " + reason;
+        }
+        return false;
+    }
+
+    // Grey window/level over the full range, shared by the three slices
+    const double* range = bricked->scalarRange();
+    auto property = vtkSmartPointer<vtkImageProperty>::New();
+    property->SetColorWindow(std::max(range[1] - range[0], 1.0));
+    property->SetColorLevel(0.5 * (range[0] + range[1]));
+    property->SetInterpolationTypeToLinear();
+
+    LoadedVolume loaded;
+    loaded.label = QFileInfo(QString::fromStdString(path))
+        .fileName().toStdString();
+    loaded.bricked = bricked;
+    const int* extent = bricked->extent();
+    for (int axis = 0; axis < 3; ++axis) {
+        auto source = vtkSmartPointer<BrickedImageSource>::New();
+        source->SetVolume(bricked);
+
+        // Streaming makes the mapper request only the displayed slice
+        auto mapper = vtkSmartPointer<vtkImageSliceMapper>::New();
+        mapper->SetInputConnection(source->GetOutputPort());
+        mapper->SetOrientation(axis);
+        mapper->SetSliceNumber((extent[2 * axis] + extent[2 * axis + 1]) / 2);
+        mapper->StreamingOn();
+
+        auto slice = vtkSmartPointer<vtkImageSlice>::New();
+        slice->SetMapper(mapper);
+        slice->SetProperty(property);
+        this->renderer->AddViewProp(slice);
+        loaded.props.push_back(slice);
+    }
+
+    std::weak_ptr<BrickedVolume> weak = bricked;
+    vtkProp* key = loaded.props.front();
+    loaded.memory_id = memory.trackSized(
+        [weak]() -> std::uint64_t {
+            auto volume = weak.lock();
+            return volume ? volume->compressedBytes() : 0;
+        },
+        CacheTier::Primary,
+        this->evictionHandler(key),
+        loaded.label,
+        key
+        );
+    loaded.cache_id = memory.trackSized(
+        [weak]() -> std::uint64_t {
+            auto volume = weak.lock();
+            return volume ? volume->cache().size() : 0;
+        },
+        CacheTier::Derived,
+        [weak]() {
+            if (auto volume = weak.lock()) {
+                volume->cache().clear();
+            }
+        },
+        loaded.label + " (brick cache)",
+        key
+        );
+    this->volumes.push_back(loaded);
+    this->computeStatistics();
+
+    this->cone_actor->VisibilityOff();
+    this->renderer->ResetCamera();
+
+    char ratio[32];
+    std::snprintf(
+        ratio,
+        sizeof(ratio),
+        "%.1f:1",
+        double(bricked->uncompressedBytes())
+            / double(std::max<std::size_t>(bricked->compressedBytes(), 1))
+        );
+    QString message = QString("Opened %1 compressed %2 in %3 bricks")
+        .arg(QString::fromStdString(loaded.label))
+        .arg(ratio)
+        .arg(bricked->brickCount());
+    if (!evicted.empty()) {
+        message += QString(", evicted %1 dataset(s) to stay within budget")
+            .arg(evicted.size());
+    }
+    this->statusMessage(message);
+    this->requestRender();
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::evictionHandler
+// ----------------------------------------------------------------------------
+//
+// Description: Returns the memory budget eviction handler of a volume or
+//              a mesh. Eviction may be triggered from another thread, the
+//              data is always removed on the GUI thread. The raw pointer
+//              only identifies it.
+//
+// Inputs:
+// - key: First prop of the volume, or the actor of the mesh
+//
+// Outputs: None
+//
+// Returns: The handler
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+MemoryBudget::EvictHandler MainWindow::evictionHandler(vtkProp* key)
+{
+    QPointer<MainWindow> window(this);
+    return [window, key]() {
+        if (window) {
+            QMetaObject::invokeMethod(
+                window,
+                [window, key]() {
+                    window->unloadVolume(key);
+                    window->unloadMesh(key);
+                },
+                Qt::AutoConnection
+                );
+        }
+    };
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::browseVolume
+// ----------------------------------------------------------------------------
+//
+// Description: Asks the user for a volume file and opens it
 //
 // Inputs: None
 //
@@ -283,32 +937,2583 @@ void MainWindow::render()
 //
 // Returns: None
 //
-// Side Effects: None
+// Side Effects: Shows a file dialog, and a message box on failure
 //
 // ----------------------------------------------------------------------------
-void MainWindow::about()
+void MainWindow::browseVolume()
 {
-    QMessageBox::about(
+    const QString path = QFileDialog::getOpenFileName(
         this,
-        tr("About the Qt VTK Framework"),
-        tr("A lightweight C++ framework for creating graphical applications "
-        "using the <a href='https://vtk.org/'>Visualization Toolkit</a> (VTK) "
-        "for rendering and <a href='https://www.qt.io/product/framework'>Qt "
-        "Framework</a> for the user interface."
-        "<br><br>"
-        "<b>Features:</b><br>"
-        "<ul>"
-        "<li>UI creation with Qt Designer for a streamlined development "
-        "process.</li>"
-        "<li>Basic \"Main Window\" application structure with an about dialog."
-        "</li>"
-        "<li>Eye-catching <a href='https://icons8.com/icons/isometric'>"
-        "Isometric icons</a> from <a href='https://icons8.com'>Icons8</a> for "
-        "a polished look.</li>"
-        "<li>Simple VTK rendering scene with standard event interaction "
-        "(camera control with mouse).</li>"
-        "<li>Seamless integration of VTK events with Qt slots using "
-        "<code>vtkEventQtSlotConnect</code> for responsive applications.</li>"
+        tr("Open Volume"),
+        QString(),
+        tr("Volume images (*.qvc *.mhd *.mha *.nrrd *.nhdr *.tif *.tiff "
+           "*.dcm);;All files (*)")
+        );
+    if (path.isEmpty()) {
+        return;
+    }
+
+    std::string error;
+    if (!this->openVolume(path.toStdString(), &error)) {
+        QMessageBox::warning(
+            this,
+            tr("Open Volume"),
+            QString::fromStdString(error)
+            );
+    }
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::setMeshCacheDirectory
+// ----------------------------------------------------------------------------
+//
+// Description: Sets the directory of the preprocessed mesh cache
+//
+// Inputs:
+// - directory: Cache directory, empty to always preprocess
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void MainWindow::setMeshCacheDirectory(const std::string& directory)
+{
+    this->mesh_cache_dir = directory;
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::openMesh
+// ----------------------------------------------------------------------------
+//
+// Description: Loads a surface mesh (STL, OBJ, PLY, VTP, legacy VTK) and
+//              displays it. Meshes are merged, given normals and reordered
+//              for the vertex cache on all cores the first time, and later
+//              loads of the unchanged file come from the mesh cache. The
+//              mesh is tracked by the memory budget as primary data.
+//
+// Inputs:
+// - path: The file to open
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: Hides the demo cone and resets the camera
+//
+// ----------------------------------------------------------------------------
+bool MainWindow::openMesh(const std::string& path, std::string* error)
+{
+    // Make room before reading, the file size is the best estimate known
+    const QFileInfo file(QString::fromStdString(path));
+    const std::vector<std::string> evicted = MemoryBudget::global().enforce(
+        static_cast<std::uint64_t>(std::max<qint64>(0, file.size()))
+        );
+
+    MeshPreprocessStats stats;
+    vtkSmartPointer<vtkPolyData> mesh = loadPreprocessedMesh(
+        path,
+        this->mesh_cache_dir,
+        MeshPreprocessOptions(),
+        &stats,
+        error
+        );
+    if (!mesh) {
+        return false;
+    }
+
+    auto mapper = vtkSmartPointer<vtkPolyDataMapper>::New();
+    mapper->SetInputData(mesh);
+    auto actor = vtkSmartPointer<vtkActor>::New();
+    actor->SetMapper(mapper);
+    this->renderer->AddActor(actor);
+    this->culler->AddProp(actor);
+    this->mesh_actors.push_back(actor);
+    this->mesh_memory_ids.push_back(MemoryBudget::global().track(
+        mesh,
+        CacheTier::Primary,
+        this->evictionHandler(actor),
+        file.fileName().toStdString(),
+        actor
+        ));
+    this->motion_proxies.setActors(this->renderer, this->mesh_actors);
+    if (this->batching) {
+        this->rebuildBatches();
+    }
+
+    this->cone_actor->VisibilityOff();
+    this->renderer->ResetCamera();
+    if (this->sort_last) {
+        this->updateSortLastMesh();
+    }
+
+    QString message = QString("Opened %1: %2 points, %3 triangles")
+        .arg(file.fileName())
+        .arg(stats.output_points)
+        .arg(stats.triangles);
+    if (stats.cache_hit) {
+        message += QString(" from the mesh cache in %1 s")
+            .arg(stats.seconds, 0, 'f', 2);
+    } else {
+        message += QString(" (%1 points merged, cache misses per triangle "
+                           "%2 -> %3) in %4 s")
+            .arg(stats.input_points - stats.output_points)
+            .arg(stats.acmr_before, 0, 'f', 2)
+            .arg(stats.acmr_after, 0, 'f', 2)
+            .arg(stats.seconds, 0, 'f', 2);
+    }
+    if (!evicted.empty()) {
+        message += QString(", evicted %1 dataset(s) to stay within budget")
+            .arg(evicted.size());
+    }
+    this->statusMessage(message);
+    this->requestRender();
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::openScene
+// ----------------------------------------------------------------------------
+//
+// Description: Builds the scene described in a scene file (see SceneScript)
+//              in the view, replacing the scene of the previous file.
+//              Pipelines of the previous file that are unchanged are kept,
+//              so reopening an edited file re-executes only what changed.
+//
+// Inputs:
+// - path: The scene file to open
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: Hides the demo cone and sets the camera of the scene
+//
+// ----------------------------------------------------------------------------
+bool MainWindow::openScene(const std::string& path, std::string* error)
+{
+    SceneBuildStats stats;
+    if (!this->scene_script.load(path, error)
+        || !this->scene_script.build(this->renderer, &stats, error)) {
+        return false;
+    }
+
+    this->cone_actor->VisibilityOff();
+
+    const QString name = QFileInfo(QString::fromStdString(path)).fileName();
+    this->statusMessage(
+        QString("Opened %1: %2 nodes, %3 created, %4 shared in %5 s")
+        .arg(name)
+        .arg(stats.nodes)
+        .arg(stats.created)
+        .arg(stats.reused)
+        .arg(stats.seconds, 0, 'f', 2)
+        );
+    this->requestRender();
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::setSceneVariable
+// ----------------------------------------------------------------------------
+//
+// Description: Overrides a variable of the scene files opened afterwards
+//
+// Inputs:
+// - name: Variable name, as used in ${name}
+// - value: Its text
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void MainWindow::setSceneVariable(
+    const std::string& name,
+    const std::string& value
+    )
+{
+    this->scene_script.setVariable(name, value);
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::addParts
+// ----------------------------------------------------------------------------
+//
+// Description: Adds a synthetic assembly of box parts (see buildPartGrid)
+//              and registers them with the culler. Stands in for large
+//              assemblies when measuring culling.
+//
+// Inputs:
+// - count: Number of parts
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Hides the demo cone and resets the camera
+//
+// ----------------------------------------------------------------------------
+void MainWindow::addParts(int count)
+{
+    for (const auto& part : buildPartGrid(this->renderer, count)) {
+        this->culler->AddProp(part);
+        this->parts.push_back(part);
+    }
+    if (this->batching) {
+        this->rebuildBatches();
+    }
+
+    this->cone_actor->VisibilityOff();
+    this->renderer->ResetCamera();
+    this->requestRender();
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::setMinimumPartPixels
+// ----------------------------------------------------------------------------
+//
+// Description: Sets below how many pixels meshes and parts are not drawn
+//
+// Inputs:
+// - pixels: Minimum projected size, 0 disables screen-size culling
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Requests a render
+//
+// ----------------------------------------------------------------------------
+void MainWindow::setMinimumPartPixels(double pixels)
+{
+    this->culler->SetMinimumPixelSize(pixels);
+    this->requestRender();
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::setBatching
+// ----------------------------------------------------------------------------
+//
+// Description: Switches between drawing every part and mesh as its own
+//              actor and drawing them merged into a few batches, one or
+//              more per material (see GeometryBatcher). Parts and meshes
+//              added while batching is on are merged as they arrive.
+//
+// Inputs:
+// - enabled: Whether to draw merged batches
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Requests a render
+//
+// ----------------------------------------------------------------------------
+void MainWindow::setBatching(bool enabled)
+{
+    if (enabled == this->batching) {
+        return;
+    }
+    this->stopCameraTransition();  // Shows the meshes the proxies hide
+    if (enabled) {
+        this->setSortLast(0);  // Batches and partitions both draw meshes
+    }
+
+    this->batching = enabled;
+    this->rebuildBatches();
+    this->requestRender();
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::rebuildBatches
+// ----------------------------------------------------------------------------
+//
+// Description: Drops the current batches and, if batching is on, merges
+//              the parts and meshes again. Merged originals are hidden and
+//              leave the culler, the batches take their place.
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Changes the visibility of parts and meshes, turns clipping
+//               off
+//
+// ----------------------------------------------------------------------------
+void MainWindow::rebuildBatches()
+{
+    // The clip holds the mappers of the actors being re-merged
+    this->setClipping(false);
+
+    for (const auto& batch : this->batcher.batches()) {
+        this->culler->RemoveProp(batch);
+        this->renderer->RemoveActor(batch);
+    }
+    this->batcher.clear();
+
+    const std::vector<vtkSmartPointer<vtkActor>>* sources[] = {
+        &this->parts,
+        &this->mesh_actors
+    };
+    for (const auto* source : sources) {
+        for (const auto& actor : *source) {
+            actor->SetVisibility(!this->batching);
+            if (this->batching) {
+                this->batcher.add(actor);
+                this->culler->RemoveProp(actor);
+            } else {
+                this->culler->AddProp(actor);
+            }
+        }
+    }
+
+    if (!this->batching) {
+        this->status.removeField("Batches");
+        return;
+    }
+
+    this->batcher.build();
+    for (const auto& part : this->batcher.unbatchedParts()) {
+        part->VisibilityOn();
+        this->culler->AddProp(part);
+    }
+    for (const auto& batch : this->batcher.batches()) {
+        this->renderer->AddActor(batch);
+        this->culler->AddProp(batch);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::reportPick
+// ----------------------------------------------------------------------------
+//
+// Description: Shows which part or mesh the last pick hit. Hits on a batch
+//              are mapped back to the part through the batch cell ids.
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Updates the status bar
+//
+// ----------------------------------------------------------------------------
+void MainWindow::reportPick()
+{
+    vtkProp* prop = this->picker->GetViewProp();
+    vtkActor* picked = this->batcher.pickedPart(
+        prop,
+        this->picker->GetCellId()
+        );
+    if (picked == nullptr) {
+        picked = vtkActor::SafeDownCast(prop);
+    }
+
+    auto part = std::find(this->parts.begin(), this->parts.end(), picked);
+    auto mesh = std::find(
+        this->mesh_actors.begin(),
+        this->mesh_actors.end(),
+        picked
+        );
+    if (picked == nullptr) {
+        this->status.removeField("Picked");
+    } else if (part != this->parts.end()) {
+        this->status.setField(
+            "Picked",
+            "part " + std::to_string(part - this->parts.begin())
+            );
+    } else if (mesh != this->mesh_actors.end()) {
+        this->status.setField(
+            "Picked",
+            "mesh " + std::to_string(mesh - this->mesh_actors.begin())
+            );
+    } else {
+        this->status.setField("Picked", "scene");
+    }
+    this->statusMessage(QString::fromStdString(this->status.text()));
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::exportImage
+// ----------------------------------------------------------------------------
+//
+// Description: Saves the view as a PNG or TIFF image of any size. The view
+//              is rendered in window-sized tiles and the image streamed to
+//              the file, so poster sizes need memory for one row of tiles
+//              only (see exportTiledImage).
+//
+// Inputs:
+// - path: Output file, the extension selects the format
+// - width, height: Image size in pixels
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: Renders the view once per tile
+//
+// ----------------------------------------------------------------------------
+bool MainWindow::exportImage(
+    const std::string& path,
+    int width,
+    int height,
+    std::string* error
+    )
+{
+    TiledExportOptions options;
+    options.width = width;
+    options.height = height;
+    TiledExportStats stats;
+    if (!exportTiledImage(
+            this->ui->mainview->renderWindow(),
+            path,
+            options,
+            &stats,
+            error
+            )) {
+        return false;
+    }
+
+    const QString name = QFileInfo(QString::fromStdString(path)).fileName();
+    this->statusMessage(
+        QString("Exported %1 (%2x%3, %4 tiles, %5 MiB) in %6 s")
+        .arg(name)
+        .arg(width)
+        .arg(height)
+        .arg(stats.tiles)
+        .arg(double(stats.bytes_written) / (1 << 20), 0, 'f', 1)
+        .arg(stats.seconds, 0, 'f', 2)
+        );
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::exportVideo
+// ----------------------------------------------------------------------------
+//
+// Description: Saves a full orbit of the camera around the scene as a video
+//              at the view size. Frames are rendered on the GUI thread and
+//              encoded on another one (see exportVideo in VideoExport.h).
+//
+// Inputs:
+// - path: Output file, the extension selects the format
+// - frames: Length of the orbit in frames, played at 30 frames a second
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: Renders the view once per frame
+//
+// ----------------------------------------------------------------------------
+bool MainWindow::exportVideo(
+    const std::string& path,
+    int frames,
+    std::string* error
+    )
+{
+    VideoExportStats stats;
+    if (!::exportVideo(
+            this->ui->mainview->renderWindow(),
+            path,
+            frames,
+            orbitAnimation(this->renderer, frames),
+            VideoExportOptions(),
+            &stats,
+            error
+            )) {
+        return false;
+    }
+
+    const QString name = QFileInfo(QString::fromStdString(path)).fileName();
+    this->statusMessage(
+        QString("Exported %1 (%2 frames) in %3 s, rendering %4 s, "
+            "encoding %5 s")
+        .arg(name)
+        .arg(stats.frames)
+        .arg(stats.seconds, 0, 'f', 2)
+        .arg(stats.render_seconds, 0, 'f', 2)
+        .arg(stats.encode_seconds, 0, 'f', 2)
+        );
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::renderToBuffer
+// ----------------------------------------------------------------------------
+//
+// Description: Renders the view into its framebuffer and returns the frame
+//              as memory, for pipelines embedding the viewer: the pixels,
+//              and optionally the depth buffer, are read straight into one
+//              of a few pooled buffers (see FrameReadback), which returns
+//              to the pool when the last copy of the view is released. The
+//              frame has the size of the view.
+//
+// Inputs:
+// - with_depth: Whether to read the depth buffer too
+//
+// Outputs:
+// - frame: The frame, replacing the view it held
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false when every pooled buffer is still held
+//          by earlier frames
+//
+// Side Effects: Renders the view
+//
+// ----------------------------------------------------------------------------
+bool MainWindow::renderToBuffer(
+    FrameView* frame,
+    bool with_depth,
+    std::string* error
+    )
+{
+    return this->frame_readback->render(frame, with_depth, error);
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::setSliceView
+// ----------------------------------------------------------------------------
+//
+// Description: Switches between the 3D view and a 2D view of the z slices
+//              of the last volume opened. Slices are window/leveled and
+//              color mapped by ImageSliceDisplay; the left button drags the
+//              window and level, 'r' resets them to the scalar range, 'a'
+//              sets them from the statistics of the volume, and the arrow
+//              and page keys step through the slices.
+//
+// Inputs:
+// - enabled: Whether to show the slice view
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false if there is no volume to show
+//
+// Side Effects: Hides the 3D props, turns clipping and the streamlines off,
+//               and replaces the camera and the interactor style while the
+//               slice view is shown
+//
+// ----------------------------------------------------------------------------
+bool MainWindow::setSliceView(bool enabled, std::string* error)
+{
+    if (enabled == this->slice_view) {
+        return true;
+    }
+    vtkRenderWindowInteractor* interactor =
+        this->ui->mainview->renderWindow()->GetInteractor();
+
+    if (!enabled) {
+        for (unsigned long id : this->slice_connections) {
+            this->events.disconnect(id);
+        }
+        this->slice_connections.clear();
+        interactor->SetInteractorStyle(this->view_style);
+        this->view_style = nullptr;
+        this->renderer->RemoveViewProp(this->slice_display.actor());
+        for (const auto& prop : this->hidden_props) {
+            prop->VisibilityOn();
+        }
+        this->hidden_props.clear();
+        this->renderer->GetActiveCamera()->DeepCopy(this->view_camera);
+        this->renderer->ResetCameraClippingRange();
+        this->slice_display.setImage(nullptr);
+        this->slice_view = false;
+        this->status.removeField("Slice");
+        this->statusMessage(QString::fromStdString(this->status.text()));
+        this->requestRender();
+        return true;
+    }
+
+    if (this->volumes.empty()) {
+        if (error != nullptr) {
+            *error = "Open a volume to show its slices";
+        }
+        return false;
+    }
+
+    // Bricked volumes are decoded slice by slice, other volumes are read
+    // in place from the image of their mapper
+    const LoadedVolume& loaded = this->volumes.back();
+    if (loaded.bricked) {
+        this->slice_display.setVolume(loaded.bricked);
+    } else {
+        this->slice_display.setImage(this->volumeImage(loaded));
+    }
+    if (!this->slice_display.hasInput()) {
+        if (error != nullptr) {
+            *error = "'" + loaded.label + "' has no image to slice";
+        }
+        return false;
+    }
+    this->slice_display.update();
+    this->stopCameraTransition();
+    this->setClipping(false);
+    if (this->flow_view) {
+        this->setFlowView(false);
+        this->ui->actionStreamlines->setChecked(false);
+    }
+
+    // Hide the 3D scene and look down the z axis
+    vtkPropCollection* props = this->renderer->GetViewProps();
+    props->InitTraversal();
+    for (vtkProp* prop = props->GetNextProp();
+        prop != nullptr;
+        prop = props->GetNextProp()) {
+        if (prop->GetVisibility()) {
+            this->hidden_props.emplace_back(prop);
+        }
+    }
+    for (const auto& prop : this->hidden_props) {
+        prop->VisibilityOff();
+    }
+    this->renderer->AddViewProp(this->slice_display.actor());
+
+    this->view_camera = vtkSmartPointer<vtkCamera>::New();
+    this->view_camera->DeepCopy(this->renderer->GetActiveCamera());
+    vtkCamera* camera = this->renderer->GetActiveCamera();
+    camera->ParallelProjectionOn();
+    camera->SetFocalPoint(0.0, 0.0, 0.0);
+    camera->SetPosition(0.0, 0.0, 1.0);
+    camera->SetViewUp(0.0, 1.0, 0.0);
+    this->renderer->ResetCamera(this->slice_display.actor()->GetBounds());
+
+    // With observers on its window/level events, the image style leaves
+    // the window and level to them
+    if (!this->slice_style) {
+        this->slice_style = vtkSmartPointer<vtkInteractorStyleImage>::New();
+        this->slice_style->SetInteractionModeToImage2D();
+    }
+    this->view_style = interactor->GetInteractorStyle();
+    interactor->SetInteractorStyle(this->slice_style);
+    auto handler = [this](vtkObject* caller, unsigned long vtk_event) {
+        this->handleSliceEvent(caller, vtk_event);
+    };
+    for (unsigned long vtk_event : {
+            vtkCommand::StartWindowLevelEvent,
+            vtkCommand::WindowLevelEvent,
+            vtkCommand::ResetWindowLevelEvent
+            }) {
+        this->slice_connections.push_back(
+            this->events.connect(this->slice_style, vtk_event, handler)
+            );
+    }
+    this->slice_connections.push_back(
+        this->events.connect(interactor, vtkCommand::KeyPressEvent, handler)
+        );
+
+    this->slice_view = true;
+    this->updateSliceView();
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::handleSliceEvent
+// ----------------------------------------------------------------------------
+//
+// Description: Handles the window/level events of the image style and the
+//              slice keys of the slice view. The window and level follow
+//              the drag the way vtkInteractorStyleImage computes them:
+//              dragging across the whole view changes them by four times
+//              their value at the start of the drag.
+//
+// Inputs:
+// - caller: The image style or the interactor
+// - vtk_event: The event
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Maps the slice again and schedules a render
+//
+// ----------------------------------------------------------------------------
+void MainWindow::handleSliceEvent(vtkObject* caller, unsigned long vtk_event)
+{
+    (void)caller;
+    vtkRenderWindowInteractor* interactor =
+        this->ui->mainview->renderWindow()->GetInteractor();
+
+    switch (vtk_event) {
+    case vtkCommand::StartWindowLevelEvent:
+        this->drag_window = this->slice_display.window();
+        this->drag_level = this->slice_display.level();
+        return;
+    case vtkCommand::ResetWindowLevelEvent:
+        this->slice_display.resetWindowLevel();
+        break;
+    case vtkCommand::WindowLevelEvent: {
+        const int* size = this->ui->mainview->renderWindow()->GetSize();
+        const int* start = this->slice_style->GetWindowLevelStartPosition();
+        const int* current =
+            this->slice_style->GetWindowLevelCurrentPosition();
+        double dx = 4.0 * (current[0] - start[0]) / std::max(1, size[0]);
+        double dy = 4.0 * (start[1] - current[1]) / std::max(1, size[1]);
+        dx *= std::max(std::abs(this->drag_window), 0.01);
+        dy *= std::max(std::abs(this->drag_level), 0.01);
+        if (this->drag_window < 0.0) {
+            dx = -dx;
+        }
+        if (this->drag_level < 0.0) {
+            dy = -dy;
+        }
+        double window = this->drag_window + dx;
+        if (std::abs(window) < 0.01) {
+            window = window < 0.0 ? -0.01 : 0.01;
+        }
+        this->slice_display.setWindowLevel(window, this->drag_level - dy);
+        break;
+    }
+    case vtkCommand::KeyPressEvent: {
+        const std::string key = interactor->GetKeySym() != nullptr
+            ? interactor->GetKeySym()
+            : "";
+        int step = 0;
+        if (key == "Up" || key == "Right") {
+            step = 1;
+        } else if (key == "Down" || key == "Left") {
+            step = -1;
+        } else if (key == "Prior") {
+            step = 10;
+        } else if (key == "Next") {
+            step = -10;
+        } else if (key == "a") {
+            this->autoWindowLevel();
+            return;
+        }
+        if (step == 0) {
+            return;
+        }
+        this->slice_display.setSlice(this->slice_display.slice() + step);
+        break;
+    }
+    default:
+        return;
+    }
+
+    this->updateSliceView();
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::updateSliceView
+// ----------------------------------------------------------------------------
+//
+// Description: Maps the slice if it changed and shows the slice, the window
+//              and the mapping time in the status bar
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Schedules a render
+//
+// ----------------------------------------------------------------------------
+void MainWindow::updateSliceView()
+{
+    this->slice_display.update();
+
+    char text[128];
+    std::snprintf(
+        text,
+        sizeof(text),
+        "%d/%d, W/L %.6g/%.6g, mapped in %.2f ms (%s)",
+        this->slice_display.slice() + 1,
+        this->slice_display.sliceCount(),
+        this->slice_display.window(),
+        this->slice_display.level(),
+        1000.0 * this->slice_display.lastMapSeconds(),
+        simdLevelName(this->slice_display.simdLevel())
+        );
+    this->status.setField("Slice", text);
+    this->statusMessage(QString::fromStdString(this->status.text()));
+    this->requestRender();
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::volumeImage
+// ----------------------------------------------------------------------------
+//
+// Description: Returns the image of an uncompressed volume, the input of its
+//              volume mapper
+//
+// Inputs:
+// - loaded: The volume
+//
+// Outputs: None
+//
+// Returns: The image, null for compressed volumes
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+vtkImageData* MainWindow::volumeImage(const LoadedVolume& loaded) const
+{
+    auto volume = vtkVolume::SafeDownCast(loaded.props.front());
+    if (volume == nullptr || volume->GetMapper() == nullptr) {
+        return nullptr;
+    }
+    return vtkImageData::SafeDownCast(volume->GetMapper()->GetDataSetInput());
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::computeStatistics
+// ----------------------------------------------------------------------------
+//
+// Description: Starts the statistics pass of the last volume opened, on the
+//              background thread of the statistics engine. Partial results
+//              are shown in the statistics panel as they stream in.
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Cancels the pass of the previous volume
+//
+// ----------------------------------------------------------------------------
+void MainWindow::computeStatistics()
+{
+    const std::uint64_t request = ++this->statistics_request;
+    this->volume_statistics = ImageStatistics();
+    if (this->volumes.empty()) {
+        this->statistics.cancel();
+        this->statistics_panel->clear();
+        return;
+    }
+
+    // Results arrive on the engine thread, they are shown on the GUI thread
+    // unless a newer pass was started meanwhile
+    QPointer<MainWindow> window(this);
+    auto progress = [window, request](const ImageStatistics& stats) {
+        if (window) {
+            QMetaObject::invokeMethod(
+                window,
+                [window, request, stats]() {
+                    window->showStatistics(request, stats);
+                },
+                Qt::AutoConnection
+                );
+        }
+    };
+
+    const LoadedVolume& loaded = this->volumes.back();
+    this->statistics_panel->setStatistics(
+        QString::fromStdString(loaded.label),
+        ImageStatistics()
+        );
+    if (loaded.bricked) {
+        this->statistics.compute(loaded.bricked, progress);
+    } else {
+        this->statistics.compute(this->volumeImage(loaded), progress);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::showStatistics
+// ----------------------------------------------------------------------------
+//
+// Description: Shows partial or final statistics of the last volume
+//
+// Inputs:
+// - request: Pass the statistics come from
+// - stats: The statistics
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Ignores the statistics of passes that were replaced
+//
+// ----------------------------------------------------------------------------
+void MainWindow::showStatistics(
+    std::uint64_t request,
+    const ImageStatistics& stats
+    )
+{
+    if (request != this->statistics_request || this->volumes.empty()) {
+        return;
+    }
+
+    this->volume_statistics = stats;
+    this->statistics_panel->setStatistics(
+        QString::fromStdString(this->volumes.back().label),
+        stats
+        );
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::autoWindowLevel
+// ----------------------------------------------------------------------------
+//
+// Description: Windows the last volume from the 1st to the 99th percentile
+//              of its values: the slice view window, the window of the
+//              slices of a compressed volume, or the color and opacity ramps
+//              of a rendered volume. Statistics still streaming in give a
+//              window from the bricks counted so far.
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Schedules a render
+//
+// ----------------------------------------------------------------------------
+void MainWindow::autoWindowLevel()
+{
+    if (this->volumes.empty() || this->volume_statistics.count == 0) {
+        this->statusMessage(tr("No statistics to window from yet"));
+        return;
+    }
+
+    double window = 1.0;
+    double level = 0.5;
+    ::autoWindowLevel(this->volume_statistics, &window, &level);
+    if (this->slice_view) {
+        this->slice_display.setWindowLevel(window, level);
+        this->updateSliceView();
+        return;
+    }
+
+    const double bottom = level - 0.5 * window;
+    const double top = level + 0.5 * window;
+    for (const auto& prop : this->volumes.back().props) {
+        if (auto slice = vtkImageSlice::SafeDownCast(prop)) {
+            slice->GetProperty()->SetColorWindow(window);
+            slice->GetProperty()->SetColorLevel(level);
+        } else if (auto volume = vtkVolume::SafeDownCast(prop)) {
+            vtkVolumeProperty* property = volume->GetProperty();
+            vtkColorTransferFunction* color =
+                property->GetRGBTransferFunction();
+            color->RemoveAllPoints();
+            color->AddRGBPoint(bottom, 0.0, 0.0, 0.0);
+            color->AddRGBPoint(top, 1.0, 1.0, 1.0);
+            vtkPiecewiseFunction* opacity = property->GetScalarOpacity();
+            opacity->RemoveAllPoints();
+            opacity->AddPoint(bottom, 0.0);
+            opacity->AddPoint(top, 0.2);
+        }
+    }
+    this->statusMessage(
+        QString("Window %1, level %2")
+        .arg(window, 0, 'g', 6)
+        .arg(level, 0, 'g', 6)
+        );
+    this->requestRender();
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::buildPyramid
+// ----------------------------------------------------------------------------
+//
+// Description: Writes the multi-resolution pyramid of the last volume
+//              opened, averaged 2 x 2 x 2 levels in chunked files (see
+//              buildVolumePyramid in VolumePyramid.h)
+//
+// Inputs:
+// - directory: Output directory, created if needed
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: Writes the level files and their manifest
+//
+// ----------------------------------------------------------------------------
+bool MainWindow::buildPyramid(const std::string& directory, std::string* error)
+{
+    vtkImageData* image = this->volumes.empty()
+        ? nullptr
+        : this->volumeImage(this->volumes.back());
+    if (image == nullptr) {
+        if (error != nullptr) {
+            *error = this->volumes.empty()
+                ? "Open a volume to build its pyramid"
+                : "Compressed volumes are built from their file, with "
+                  "--build-pyramid";
+        }
+        return false;
+    }
+
+    PyramidStats stats;
+    if (!buildVolumePyramid(
+            image, directory, PyramidOptions(), &stats, error
+            )) {
+        return false;
+    }
+
+    double reduce_seconds = 0.0;
+    for (double seconds : stats.reduce_seconds) {
+        reduce_seconds += seconds;
+    }
+    this->statusMessage(
+        QString("Built %1 pyramid levels (%2 MiB) in %3 s, "
+            "downsampling %4 s")
+        .arg(stats.dimensions.size())
+        .arg(stats.bytes >> 20)
+        .arg(stats.seconds, 0, 'f', 2)
+        .arg(reduce_seconds, 0, 'f', 2)
+        );
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::setClipping
+// ----------------------------------------------------------------------------
+//
+// Description: Shows a clip plane or crop box widget over the visible
+//              meshes, parts, batches and volumes (see InteractiveClipper).
+//              Dragging it moves the clipping planes of their mappers, so
+//              nothing re-executes per mouse move; releasing it clips the
+//              meshes on a worker thread and the result replaces them when
+//              it arrives. Volumes stay clipped by their mapper.
+//
+// Inputs:
+// - enabled: Whether to show the widget
+// - shape: Clip plane or crop box, replacing the widget shown
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false in the slice view or with nothing to clip
+//
+// Side Effects: Restores the unclipped data when disabled
+//
+// ----------------------------------------------------------------------------
+bool MainWindow::setClipping(
+    bool enabled,
+    ClipShape shape,
+    std::string* error
+    )
+{
+    if (!enabled) {
+        if (this->clipper.isEnabled()) {
+            this->clipper.disable();
+            this->culler->BoundsModified();
+            this->status.removeField("Clip");
+            this->statusMessage(QString::fromStdString(this->status.text()));
+            this->requestRender();
+        }
+        this->updateClipActions();
+        return true;
+    }
+
+    if (this->slice_view) {
+        if (error != nullptr) {
+            *error = "Leave the slice view to clip the 3D view";
+        }
+        this->updateClipActions();
+        return false;
+    }
+
+    std::vector<vtkProp3D*> props;
+    const std::vector<vtkSmartPointer<vtkActor>>* sources[] = {
+        &this->parts,
+        &this->mesh_actors,
+        &this->batcher.batches()
+    };
+    for (const auto* source : sources) {
+        for (const auto& actor : *source) {
+            if (actor->GetVisibility()) {
+                props.push_back(actor);
+            }
+        }
+    }
+    for (const auto& loaded : this->volumes) {
+        for (const auto& prop : loaded.props) {
+            auto volume = vtkProp3D::SafeDownCast(prop);
+            if (volume != nullptr && volume->GetVisibility()) {
+                props.push_back(volume);
+            }
+        }
+    }
+
+    const bool shown = this->clipper.enable(
+        this->ui->mainview->renderWindow()->GetInteractor(),
+        shape,
+        props,
+        error
+        );
+    if (shown) {
+        this->status.setField(
+            "Clip",
+            shape == ClipShape::Box ? "crop box" : "plane"
+            );
+        this->statusMessage(QString::fromStdString(this->status.text()));
+        this->requestRender();
+    }
+    this->updateClipActions();
+
+    return shown;
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::applyClipCommit
+// ----------------------------------------------------------------------------
+//
+// Description: Shows the meshes clipped when the widget was released
+//
+// Inputs:
+// - commit: Commit that finished on the worker thread
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Ignores commits overtaken by a later drag; requests a render
+//
+// ----------------------------------------------------------------------------
+void MainWindow::applyClipCommit(std::uint64_t commit)
+{
+    if (!this->clipper.applyCommit(commit)) {
+        return;
+    }
+
+    // Clipped parts shrink, the bounds cached by the hierarchy are stale
+    this->culler->BoundsModified();
+
+    const ClipCommitStats stats = this->clipper.lastCommitStats();
+    char text[96];
+    std::snprintf(
+        text,
+        sizeof(text),
+        "%d meshes, %lld of %lld cells, %.2f s",
+        stats.meshes,
+        static_cast<long long>(stats.output_cells),
+        static_cast<long long>(stats.input_cells),
+        stats.seconds
+        );
+    this->status.setField("Clip", text);
+    this->statusMessage(QString::fromStdString(this->status.text()));
+    this->requestRender();
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::updateClipActions
+// ----------------------------------------------------------------------------
+//
+// Description: Checks the menu action of the widget shown, and only it
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None, the actions do not emit toggled
+//
+// ----------------------------------------------------------------------------
+void MainWindow::updateClipActions()
+{
+    const bool enabled = this->clipper.isEnabled();
+    QSignalBlocker plane_blocker(this->ui->actionClip_Plane);
+    QSignalBlocker box_blocker(this->ui->actionCrop_Box);
+    this->ui->actionClip_Plane->setChecked(
+        enabled && this->clipper.shape() == ClipShape::Plane
+        );
+    this->ui->actionCrop_Box->setChecked(
+        enabled && this->clipper.shape() == ClipShape::Box
+        );
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::setFlowView
+// ----------------------------------------------------------------------------
+//
+// Description: Shows streamlines of the vector field of the last volume,
+//              traced from the seeds of a plane widget placed in it. The
+//              lines are traced in the background, seeds spread over cores
+//              (see traceStreamlines); dragging the plane starts a new
+//              trace and cancels the one running, so the lines follow the
+//              seeds without waiting for stale traces.
+//
+// Inputs:
+// - enabled: Whether to show the streamlines
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false in the slice view or if the last volume
+//          has no vector field in memory
+//
+// Side Effects: Adds the streamline actor and the seed widget to the view
+//
+// ----------------------------------------------------------------------------
+bool MainWindow::setFlowView(bool enabled, std::string* error)
+{
+    if (enabled == this->flow_view) {
+        return true;
+    }
+
+    if (!enabled) {
+        ++this->flow_request;
+        this->flow_engine.cancel();
+        for (unsigned long id : this->flow_connections) {
+            this->events.disconnect(id);
+        }
+        this->flow_connections.clear();
+        this->seed_widget->Off();
+        this->renderer->RemoveActor(this->flow_display.actor());
+        this->flow_display.setLines(nullptr);
+        this->flow_field = nullptr;
+        this->flow_view = false;
+        this->status.removeField("Flow");
+        this->statusMessage(QString::fromStdString(this->status.text()));
+        this->requestRender();
+        return true;
+    }
+
+    std::string message;
+    vtkImageData* field = this->volumes.empty()
+        ? nullptr
+        : this->volumeImage(this->volumes.back());
+    if (this->slice_view) {
+        message = "Leave the slice view to trace streamlines";
+    } else if (this->volumes.empty()) {
+        message = "Open a vector volume to trace its streamlines";
+    } else if (field == nullptr) {
+        message = "Compressed volumes cannot be traced, open '"
+            + this->volumes.back().label + "' uncompressed";
+    } else if (flowVectors(field) == nullptr) {
+        message = "'" + this->volumes.back().label + "' has no vector field";
+    }
+    if (!message.empty()) {
+        if (error != nullptr) {
+            *error = message;
+        }
+        return false;
+    }
+    this->flow_field = field;
+
+    // The lines reuse the geometry of the scene cone as their glyph
+    auto cone_mapper = vtkPolyDataMapper::SafeDownCast(
+        this->cone_actor->GetMapper()
+        );
+    this->flow_display.setGlyphSource(cone_mapper->GetInput());
+    this->flow_display.setGlyphLength(0.01 * field->GetLength());
+    this->renderer->AddActor(this->flow_display.actor());
+
+    if (!this->seed_widget) {
+        this->seed_widget = vtkSmartPointer<vtkPlaneWidget>::New();
+        this->seed_widget->SetInteractor(
+            this->ui->mainview->renderWindow()->GetInteractor()
+            );
+        this->seed_widget->SetPlaceFactor(1.0);
+        this->seed_widget->KeyPressActivationOff();
+    }
+    this->seed_widget->SetResolution(std::max(1, this->flow_seeds - 1));
+    this->seed_widget->PlaceWidget(field->GetBounds());
+    this->seed_widget->On();
+    for (unsigned long vtk_event : {
+            vtkCommand::InteractionEvent,
+            vtkCommand::EndInteractionEvent
+            }) {
+        this->flow_connections.push_back(this->events.connect(
+            this->seed_widget,
+            vtk_event,
+            [this](vtkObject*, unsigned long) { this->reseedFlow(); }
+            ));
+    }
+
+    this->flow_view = true;
+    this->reseedFlow();
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::setFlowStyle
+// ----------------------------------------------------------------------------
+//
+// Description: Draws the streamlines as tubes or as cones instanced along
+//              them
+//
+// Inputs:
+// - style: The style
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Requests a render
+//
+// ----------------------------------------------------------------------------
+void MainWindow::setFlowStyle(FlowStyle style)
+{
+    this->flow_display.setStyle(style);
+    QSignalBlocker blocker(this->ui->actionCone_Glyphs);
+    this->ui->actionCone_Glyphs->setChecked(style == FlowStyle::Cones);
+    this->requestRender();
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::setFlowSeeds
+// ----------------------------------------------------------------------------
+//
+// Description: Sets the seeds per side of the seed plane
+//
+// Inputs:
+// - per_side: Seeds per side, at least 2
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Retraces the streamlines if they are shown
+//
+// ----------------------------------------------------------------------------
+void MainWindow::setFlowSeeds(int per_side)
+{
+    this->flow_seeds = std::max(2, per_side);
+    if (this->flow_view) {
+        this->seed_widget->SetResolution(this->flow_seeds - 1);
+        this->reseedFlow();
+    }
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::reseedFlow
+// ----------------------------------------------------------------------------
+//
+// Description: Starts tracing from the seeds of the plane widget
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Cancels the trace running
+//
+// ----------------------------------------------------------------------------
+void MainWindow::reseedFlow()
+{
+    if (!this->flow_view) {
+        return;
+    }
+
+    vtkNew<vtkPolyData> plane;
+    this->seed_widget->GetPolyData(plane);
+
+    // Lines arrive on the engine thread, they are shown on the GUI thread
+    // unless the seeds moved meanwhile
+    const std::uint64_t request = ++this->flow_request;
+    QPointer<MainWindow> window(this);
+    this->flow_engine.trace(
+        this->flow_field,
+        plane->GetPoints(),
+        TraceOptions(),
+        [window, request](
+            vtkSmartPointer<vtkPolyData> lines,
+            const TraceStats& stats
+            ) {
+            if (window) {
+                QMetaObject::invokeMethod(
+                    window,
+                    [window, request, lines, stats]() {
+                        window->showFlow(request, lines, stats);
+                    },
+                    Qt::AutoConnection
+                    );
+            }
+        }
+        );
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::showFlow
+// ----------------------------------------------------------------------------
+//
+// Description: Shows the streamlines of a finished trace
+//
+// Inputs:
+// - request: Trace the lines come from
+// - lines: The streamlines
+// - stats: What the trace did
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Ignores the lines of traces that were replaced
+//
+// ----------------------------------------------------------------------------
+void MainWindow::showFlow(
+    std::uint64_t request,
+    vtkSmartPointer<vtkPolyData> lines,
+    const TraceStats& stats
+    )
+{
+    if (request != this->flow_request || !this->flow_view) {
+        return;
+    }
+
+    this->flow_display.setLines(lines);
+    char text[96];
+    std::snprintf(
+        text,
+        sizeof(text),
+        "%zu lines, %lld points, %.2f s",
+        stats.lines,
+        static_cast<long long>(stats.points),
+        stats.seconds
+        );
+    this->status.setField("Flow", text);
+    this->statusMessage(QString::fromStdString(this->status.text()));
+    this->requestRender();
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::setSortLast
+// ----------------------------------------------------------------------------
+//
+// Description: Switches sort-last rendering of the meshes on or off. The
+//              meshes are merged, partitioned spatially and rendered each
+//              frame by one offscreen worker thread per partition; the color
+//              and depth images are composited (see SortLastRenderer) and
+//              shown as the background texture of the view, in place of
+//              the mesh actors. Meshes opened later join the partitions.
+//              Batching is turned off, as it would draw the meshes again.
+//
+// Inputs:
+// - partitions: Partitions and worker threads, 0 to draw the meshes in the
+//               view again
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false if there is no mesh to partition
+//
+// Side Effects: Hides the mesh actors and turns clipping off
+//
+// ----------------------------------------------------------------------------
+bool MainWindow::setSortLast(int partitions, std::string* error)
+{
+    this->stopCameraTransition();
+    if (this->sort_last) {
+        this->events.disconnect(this->sort_last_connection);
+        this->renderer->TexturedBackgroundOff();
+        this->renderer->SetBackgroundTexture(nullptr);
+        this->sort_last.reset();
+        for (const auto& actor : this->mesh_actors) {
+            actor->VisibilityOn();
+        }
+        this->status.removeField("Composite");
+    }
+    if (partitions <= 0) {
+        this->requestRender();
+        return true;
+    }
+    if (this->mesh_actors.empty()) {
+        if (error) {
+            *error = "Sort-last rendering needs a mesh to partition";
+        }
+        return false;
+    }
+
+    // Batches would draw the meshes again, and the clip holds their mappers
+    this->setBatching(false);
+    this->setClipping(false);
+
+    this->sort_last = std::make_unique<SortLastRenderer>(partitions);
+    this->sort_last->setMethod(this->composite_method);
+    this->updateSortLastMesh();
+
+    this->sort_last_texture = vtkSmartPointer<vtkTexture>::New();
+    this->sort_last_texture->InterpolateOff();
+    this->sort_last_texture->SetInputData(this->sort_last->output());
+    this->renderer->SetBackgroundTexture(this->sort_last_texture);
+    this->renderer->TexturedBackgroundOn();
+    this->sort_last_connection = this->events.connect(
+        this->renderer,
+        vtkCommand::StartEvent,
+        [this](vtkObject*, unsigned long) { this->compositeSortLast(); }
+        );
+
+    this->requestRender();
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::setCompositeMethod
+// ----------------------------------------------------------------------------
+//
+// Description: Sets how sort-last rendering composites the partitions
+//
+// Inputs:
+// - method: Direct-send or binary-swap
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void MainWindow::setCompositeMethod(CompositeMethod method)
+{
+    this->composite_method = method;
+    if (this->sort_last) {
+        this->sort_last->setMethod(method);
+        this->requestRender();
+    }
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::updateSortLastMesh
+// ----------------------------------------------------------------------------
+//
+// Description: Merges the meshes and partitions them among the sort-last
+//              workers, with the surface property of the first mesh
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Hides the mesh actors
+//
+// ----------------------------------------------------------------------------
+void MainWindow::updateSortLastMesh()
+{
+    auto merged = vtkSmartPointer<vtkAppendPolyData>::New();
+    for (const auto& actor : this->mesh_actors) {
+        auto mapper = vtkPolyDataMapper::SafeDownCast(actor->GetMapper());
+        if (mapper != nullptr && mapper->GetInput() != nullptr) {
+            merged->AddInputData(mapper->GetInput());
+        }
+        actor->VisibilityOff();
+    }
+    if (merged->GetNumberOfInputConnections(0) == 0) {
+        this->sort_last->setMesh(nullptr);
+        return;
+    }
+
+    merged->Update();
+    this->sort_last->setMesh(
+        merged->GetOutput(),
+        this->mesh_actors.front()->GetProperty()
+        );
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::compositeSortLast
+// ----------------------------------------------------------------------------
+//
+// Description: Renders the partitions with the camera of the view and
+//              composites them into the background texture, before the
+//              view renders
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Updates the status bar
+//
+// ----------------------------------------------------------------------------
+void MainWindow::compositeSortLast()
+{
+    const int* size = this->renderer->GetSize();
+    this->sort_last->setBackground(this->renderer->GetBackground());
+
+    SortLastStats stats;
+    std::string error;
+    if (!this->sort_last->render(
+            this->renderer->GetActiveCamera(),
+            size[0],
+            size[1],
+            &stats,
+            &error
+            )) {
+        this->status.setField("Composite", error);
+        return;
+    }
+
+    char composite[96];
+    std::snprintf(
+        composite,
+        sizeof(composite),
+        "%d parts, %s, render %.1f ms, composite %.1f ms",
+        stats.partitions,
+        compositeMethodName(this->composite_method),
+        1000.0 * stats.render_seconds,
+        1000.0 * stats.composite_seconds
+        );
+    this->status.setField("Composite", composite);
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::storeBookmark
+// ----------------------------------------------------------------------------
+//
+// Description: Bookmarks the full camera state of the 3D view under a key,
+//              replacing the bookmark of the key, if any
+//
+// Inputs:
+// - key: The key, 0 for a bookmark restored from a session file only
+// - name: Name of the bookmark, "View <key>" if empty
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Updates the status bar
+//
+// ----------------------------------------------------------------------------
+void MainWindow::storeBookmark(char key, const std::string& name)
+{
+    // The slice view has a camera of its own, the 3D one is kept aside
+    vtkCamera* camera = this->slice_view
+        ? this->view_camera.Get()
+        : this->renderer->GetActiveCamera();
+
+    CameraBookmark bookmark;
+    bookmark.key = key;
+    bookmark.name = name.empty() && key != 0
+        ? "View " + std::string(1, key)
+        : name;
+    bookmark.camera = captureCamera(camera);
+    this->bookmarks.set(bookmark);
+
+    this->statusMessage(
+        QString("Bookmarked the view as '%1'")
+        .arg(QString::fromStdString(bookmark.name))
+        );
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::restoreBookmark
+// ----------------------------------------------------------------------------
+//
+// Description: Returns to the view bookmarked under a key. Only camera
+//              fields are set, so restoring costs renders and never a
+//              pipeline update. Animated restores move the camera over
+//              CameraTransition::kDefaultSeconds, drawing the large meshes
+//              as decimated proxies until the last frame, which shows the
+//              bookmarked state exactly.
+//
+// Inputs:
+// - key: The key
+// - animate: Whether to move to the view rather than jump
+//
+// Outputs: None
+//
+// Returns: false if no bookmark is bound to the key, true otherwise
+//
+// Side Effects: Renders the view; in the slice view, only sets the 3D
+//               camera shown when the slice view is left
+//
+// ----------------------------------------------------------------------------
+bool MainWindow::restoreBookmark(char key, bool animate)
+{
+    const CameraBookmark* bookmark = this->bookmarks.find(key);
+    if (bookmark == nullptr) {
+        this->statusMessage(
+            QString("No view is bookmarked on key %1")
+            .arg(QChar::fromLatin1(key))
+            );
+        return false;
+    }
+
+    this->stopCameraTransition();
+    this->status.setField("View", bookmark->name);
+    if (this->slice_view) {
+        applyCamera(bookmark->camera, this->view_camera);
+        this->requestRender();
+        return true;
+    }
+
+    vtkCamera* camera = this->renderer->GetActiveCamera();
+    if (!animate) {
+        applyCamera(bookmark->camera, camera);
+        this->requestRender();
+        return true;
+    }
+
+    this->motion_proxies.setActors(this->renderer, this->mesh_actors);
+    this->motion_proxies.setMoving(true);
+    this->camera_transition.start(camera, bookmark->camera);
+    if (!this->transition_timer) {
+        this->transition_timer = new QTimer(this);
+        this->transition_timer->setTimerType(Qt::PreciseTimer);
+        this->transition_timer->setInterval(kRenderCoalesceInterval);
+        connect(
+            this->transition_timer,
+            &QTimer::timeout,
+            this,
+            &MainWindow::stepCameraTransition
+            );
+    }
+    this->transition_timer->start();
+    this->stepCameraTransition();
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::openBookmarks
+// ----------------------------------------------------------------------------
+//
+// Description: Reads the bookmarks of a session file (see CameraBookmarks
+//              for the syntax), replacing the current ones
+//
+// Inputs:
+// - path: The session file
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: Updates the status bar
+//
+// ----------------------------------------------------------------------------
+bool MainWindow::openBookmarks(const std::string& path, std::string* error)
+{
+    if (!this->bookmarks.load(path, error)) {
+        return false;
+    }
+
+    this->statusMessage(
+        QString("Read %1 camera bookmarks from %2")
+        .arg(this->bookmarks.all().size())
+        .arg(QString::fromStdString(path))
+        );
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::saveBookmarks
+// ----------------------------------------------------------------------------
+//
+// Description: Writes the bookmarks to a session file
+//
+// Inputs:
+// - path: The session file
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: Replaces the file and updates the status bar
+//
+// ----------------------------------------------------------------------------
+bool MainWindow::saveBookmarks(const std::string& path, std::string* error)
+{
+    if (!this->bookmarks.save(path, error)) {
+        return false;
+    }
+
+    this->statusMessage(
+        QString("Wrote %1 camera bookmarks to %2")
+        .arg(this->bookmarks.all().size())
+        .arg(QString::fromStdString(path))
+        );
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::handleBookmarkKey
+// ----------------------------------------------------------------------------
+//
+// Description: Bookmarks the view on Ctrl+digit and restores the view
+//              bookmarked on a digit. The slice view keeps its keys.
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: See storeBookmark and restoreBookmark
+//
+// ----------------------------------------------------------------------------
+void MainWindow::handleBookmarkKey()
+{
+    vtkRenderWindowInteractor* interactor =
+        this->ui->mainview->renderWindow()->GetInteractor();
+    const std::string key = interactor->GetKeySym() != nullptr
+        ? interactor->GetKeySym()
+        : "";
+    if (this->slice_view || key.size() != 1 || key[0] < '0' || key[0] > '9') {
+        return;
+    }
+
+    if (interactor->GetControlKey()) {
+        this->storeBookmark(key[0]);
+    } else {
+        this->restoreBookmark(key[0]);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::stepCameraTransition
+// ----------------------------------------------------------------------------
+//
+// Description: Moves the camera to the next frame of the transition and
+//              renders it. The clipping range follows the moving camera;
+//              the last frame sets the bookmarked state as stored and
+//              shows the meshes again.
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Renders the view
+//
+// ----------------------------------------------------------------------------
+void MainWindow::stepCameraTransition()
+{
+    if (this->camera_transition.step()) {
+        this->renderer->ResetCameraClippingRange();
+    } else {
+        this->transition_timer->stop();
+        this->motion_proxies.setMoving(false);
+    }
+    this->render();
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::stopCameraTransition
+// ----------------------------------------------------------------------------
+//
+// Description: Ends a transition in progress, leaving the camera where it
+//              is and showing the meshes in place of their proxies
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Requests a render if a transition was running
+//
+// ----------------------------------------------------------------------------
+void MainWindow::stopCameraTransition()
+{
+    if (!this->camera_transition.isRunning()) {
+        return;
+    }
+
+    this->camera_transition.stop();
+    this->transition_timer->stop();
+    this->motion_proxies.setMoving(false);
+    this->requestRender();
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::browseMesh
+// ----------------------------------------------------------------------------
+//
+// Description: Asks the user for a mesh file and opens it
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Shows a file dialog, and a message box on failure
+//
+// ----------------------------------------------------------------------------
+void MainWindow::browseMesh()
+{
+    const QString path = QFileDialog::getOpenFileName(
+        this,
+        tr("Open Mesh"),
+        QString(),
+        tr("Meshes (*.stl *.obj *.ply *.vtp *.vtk);;All files (*)")
+        );
+    if (path.isEmpty()) {
+        return;
+    }
+
+    std::string error;
+    if (!this->openMesh(path.toStdString(), &error)) {
+        QMessageBox::warning(
+            this,
+            tr("Open Mesh"),
+            QString::fromStdString(error)
+            );
+    }
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::browseScene
+// ----------------------------------------------------------------------------
+//
+// Description: Asks the user for a scene file and opens it
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Shows a file dialog, and a message box on failure
+//
+// ----------------------------------------------------------------------------
+void MainWindow::browseScene()
+{
+    const QString path = QFileDialog::getOpenFileName(
+        this,
+        tr("Open Scene"),
+        QString(),
+        tr("Scene files (*.scene *.txt);;All files (*)")
+        );
+    if (path.isEmpty()) {
+        return;
+    }
+
+    std::string error;
+    QApplication::setOverrideCursor(Qt::WaitCursor);
+    const bool opened = this->openScene(path.toStdString(), &error);
+    QApplication::restoreOverrideCursor();
+    if (!opened) {
+        QMessageBox::warning(
+            this,
+            tr("Open Scene"),
+            QString::fromStdString(error)
+            );
+    }
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::browseExportImage
+// ----------------------------------------------------------------------------
+//
+// Description: Asks the user for an image file and size, four times the
+//              view size by default, and exports the view
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Shows dialogs, and a message box on failure
+//
+// ----------------------------------------------------------------------------
+void MainWindow::browseExportImage()
+{
+    const QString path = QFileDialog::getSaveFileName(
+        this,
+        tr("Export Image"),
+        QString(),
+        tr("PNG images (*.png);;TIFF images (*.tif *.tiff)")
+        );
+    if (path.isEmpty()) {
+        return;
+    }
+
+    // Image size, up to the PNG and TIFF limits of 2^31 - 1
+    const int* view = this->ui->mainview->renderWindow()->GetSize();
+    QDialog dialog(this);
+    dialog.setWindowTitle(tr("Export Image"));
+    auto layout = new QFormLayout(&dialog);
+    auto width = new QSpinBox(&dialog);
+    auto height = new QSpinBox(&dialog);
+    for (auto box : {width, height}) {
+        box->setRange(1, std::numeric_limits<int>::max());
+        box->setSuffix(tr(" px"));
+    }
+    width->setValue(4 * view[0]);
+    height->setValue(4 * view[1]);
+    layout->addRow(tr("Width:"), width);
+    layout->addRow(tr("Height:"), height);
+    auto buttons = new QDialogButtonBox(
+        QDialogButtonBox::Ok | QDialogButtonBox::Cancel,
+        &dialog
+        );
+    connect(buttons, &QDialogButtonBox::accepted, &dialog, &QDialog::accept);
+    connect(buttons, &QDialogButtonBox::rejected, &dialog, &QDialog::reject);
+    layout->addRow(buttons);
+    if (dialog.exec() != QDialog::Accepted) {
+        return;
+    }
+
+    std::string error;
+    QApplication::setOverrideCursor(Qt::WaitCursor);
+    const bool exported = this->exportImage(
+        path.toStdString(),
+        width->value(),
+        height->value(),
+        &error
+        );
+    QApplication::restoreOverrideCursor();
+    if (!exported) {
+        QMessageBox::warning(
+            this,
+            tr("Export Image"),
+            QString::fromStdString(error)
+            );
+    }
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::browseExportVideo
+// ----------------------------------------------------------------------------
+//
+// Description: Asks the user for a video file and the number of frames and
+//              exports an orbit of the view
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Shows dialogs, and a message box on failure
+//
+// ----------------------------------------------------------------------------
+void MainWindow::browseExportVideo()
+{
+    QString filter = tr("Y4M video (*.y4m);;PNG sequence (*.png)");
+    if (VideoWriter::ffmpegAvailable()) {
+        filter.prepend(tr("MP4 video (*.mp4);;"));
+    }
+    const QString path = QFileDialog::getSaveFileName(
+        this,
+        tr("Export Video"),
+        QString(),
+        filter
+        );
+    if (path.isEmpty()) {
+        return;
+    }
+
+    bool accepted = false;
+    const int frames = QInputDialog::getInt(
+        this,
+        tr("Export Video"),
+        tr("Frames (30 per second):"),
+        300,
+        1,
+        std::numeric_limits<int>::max(),
+        1,
+        &accepted
+        );
+    if (!accepted) {
+        return;
+    }
+
+    std::string error;
+    QApplication::setOverrideCursor(Qt::WaitCursor);
+    const bool exported = this->exportVideo(
+        path.toStdString(),
+        frames,
+        &error
+        );
+    QApplication::restoreOverrideCursor();
+    if (!exported) {
+        QMessageBox::warning(
+            this,
+            tr("Export Video"),
+            QString::fromStdString(error)
+            );
+    }
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::browseBuildPyramid
+// ----------------------------------------------------------------------------
+//
+// Description: Asks the user for a directory and builds the pyramid of the
+//              last volume in it
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Shows a directory dialog, and a message box on failure
+//
+// ----------------------------------------------------------------------------
+void MainWindow::browseBuildPyramid()
+{
+    const QString directory = QFileDialog::getExistingDirectory(
+        this,
+        tr("Build Pyramid")
+        );
+    if (directory.isEmpty()) {
+        return;
+    }
+
+    std::string error;
+    QApplication::setOverrideCursor(Qt::WaitCursor);
+    const bool built = this->buildPyramid(directory.toStdString(), &error);
+    QApplication::restoreOverrideCursor();
+    if (!built) {
+        QMessageBox::warning(
+            this,
+            tr("Build Pyramid"),
+            QString::fromStdString(error)
+            );
+    }
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::browseOpenBookmarks
+// ----------------------------------------------------------------------------
+//
+// Description: Asks the user for a session file and reads its bookmarks
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Shows a file dialog, and a message box on failure
+//
+// ----------------------------------------------------------------------------
+void MainWindow::browseOpenBookmarks()
+{
+    const QString path = QFileDialog::getOpenFileName(
+        this,
+        tr("Open Bookmarks"),
+        QString(),
+        tr("Bookmark files (*.views *.txt);;All files (*)")
+        );
+    if (path.isEmpty()) {
+        return;
+    }
+
+    std::string error;
+    if (!this->openBookmarks(path.toStdString(), &error)) {
+        QMessageBox::warning(
+            this,
+            tr("Open Bookmarks"),
+            QString::fromStdString(error)
+            );
+    }
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::browseSaveBookmarks
+// ----------------------------------------------------------------------------
+//
+// Description: Asks the user for a session file and writes the bookmarks
+//              to it
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Shows a file dialog, and a message box on failure
+//
+// ----------------------------------------------------------------------------
+void MainWindow::browseSaveBookmarks()
+{
+    const QString path = QFileDialog::getSaveFileName(
+        this,
+        tr("Save Bookmarks"),
+        QString(),
+        tr("Bookmark files (*.views *.txt);;All files (*)")
+        );
+    if (path.isEmpty()) {
+        return;
+    }
+
+    std::string error;
+    if (!this->saveBookmarks(path.toStdString(), &error)) {
+        QMessageBox::warning(
+            this,
+            tr("Save Bookmarks"),
+            QString::fromStdString(error)
+            );
+    }
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::toggleSliceView
+// ----------------------------------------------------------------------------
+//
+// Description: Switches between the 3D view and the slice view
+//
+// Inputs:
+// - checked: Whether the slice view action is checked
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Unchecks the action, and shows a message box, on failure
+//
+// ----------------------------------------------------------------------------
+void MainWindow::toggleSliceView(bool checked)
+{
+    std::string error;
+    if (!this->setSliceView(checked, &error)) {
+        QSignalBlocker blocker(this->ui->actionSlice_View);
+        this->ui->actionSlice_View->setChecked(this->slice_view);
+        QMessageBox::warning(
+            this,
+            tr("Slice View"),
+            QString::fromStdString(error)
+            );
+    }
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::toggleClipPlane
+// ----------------------------------------------------------------------------
+//
+// Description: Shows or hides the clip plane widget
+//
+// Inputs:
+// - checked: Whether the clip plane action is checked
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Shows a message box on failure
+//
+// ----------------------------------------------------------------------------
+void MainWindow::toggleClipPlane(bool checked)
+{
+    std::string error;
+    if (!this->setClipping(checked, ClipShape::Plane, &error)) {
+        QMessageBox::warning(
+            this,
+            tr("Clip Plane"),
+            QString::fromStdString(error)
+            );
+    }
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::toggleCropBox
+// ----------------------------------------------------------------------------
+//
+// Description: Shows or hides the crop box widget
+//
+// Inputs:
+// - checked: Whether the crop box action is checked
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Shows a message box on failure
+//
+// ----------------------------------------------------------------------------
+void MainWindow::toggleCropBox(bool checked)
+{
+    std::string error;
+    if (!this->setClipping(checked, ClipShape::Box, &error)) {
+        QMessageBox::warning(
+            this,
+            tr("Crop Box"),
+            QString::fromStdString(error)
+            );
+    }
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::toggleFlowView
+// ----------------------------------------------------------------------------
+//
+// Description: Shows or hides the streamlines and their seed plane
+//
+// Inputs:
+// - checked: Whether the streamlines action is checked
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Unchecks the action, and shows a message box, on failure
+//
+// ----------------------------------------------------------------------------
+void MainWindow::toggleFlowView(bool checked)
+{
+    std::string error;
+    if (!this->setFlowView(checked, &error)) {
+        QSignalBlocker blocker(this->ui->actionStreamlines);
+        this->ui->actionStreamlines->setChecked(this->flow_view);
+        QMessageBox::warning(
+            this,
+            tr("Streamlines"),
+            QString::fromStdString(error)
+            );
+    }
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::toggleFlowCones
+// ----------------------------------------------------------------------------
+//
+// Description: Draws the streamlines as cones or as tubes
+//
+// Inputs:
+// - checked: Whether the cone glyphs action is checked
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void MainWindow::toggleFlowCones(bool checked)
+{
+    this->setFlowStyle(checked ? FlowStyle::Cones : FlowStyle::Tubes);
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::unloadVolume
+// ----------------------------------------------------------------------------
+//
+// Description: Eviction handler of the loaded volumes. Removes the volume
+//              from the scene and drops the last references to its image or
+//              bricks.
+//
+// Inputs:
+// - key: First prop of the volume to remove
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Turns clipping and the streamlines off, requests a render
+//
+// ----------------------------------------------------------------------------
+void MainWindow::unloadVolume(vtkProp* key)
+{
+    auto found = std::find_if(
+        this->volumes.begin(),
+        this->volumes.end(),
+        [key](const LoadedVolume& loaded) {
+            return loaded.props.front() == key;
+        }
+        );
+    if (found == this->volumes.end()) {
+        return;
+    }
+
+    // The slice view may show the volume
+    if (this->slice_view) {
+        this->setSliceView(false);
+        this->ui->actionSlice_View->setChecked(false);
+    }
+
+    // The clip widget may be placed around the volume, the streamlines
+    // may be traced through it
+    this->setClipping(false);
+    if (this->flow_view) {
+        this->setFlowView(false);
+        this->ui->actionStreamlines->setChecked(false);
+    }
+
+    this->statusMessage(
+        QString("Evicted %1 to stay within the memory budget")
+        .arg(QString::fromStdString(found->label))
+        );
+    for (const auto& prop : found->props) {
+        this->renderer->RemoveViewProp(prop);
+    }
+    MemoryBudget::global().untrack(found->cache_id);
+    this->volumes.erase(found);
+    this->computeStatistics();
+    this->requestRender();
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::unloadMesh
+// ----------------------------------------------------------------------------
+//
+// Description: Eviction handler of the opened meshes. Removes the mesh from
+//              the scene, the culler, the batches and the sort-last
+//              partitions, and drops the last references to its data.
+//
+// Inputs:
+// - key: Actor of the mesh to remove
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Turns clipping off, requests a render
+//
+// ----------------------------------------------------------------------------
+void MainWindow::unloadMesh(vtkProp* key)
+{
+    const auto found = std::find_if(
+        this->mesh_actors.begin(),
+        this->mesh_actors.end(),
+        [key](const vtkSmartPointer<vtkActor>& actor) {
+            return actor.GetPointer() == key;
+        }
+        );
+    if (found == this->mesh_actors.end()) {
+        return;
+    }
+    const std::size_t index = found - this->mesh_actors.begin();
+    const vtkSmartPointer<vtkActor> actor = *found;
+
+    // The clip holds the mapper of the mesh
+    this->setClipping(false);
+
+    this->renderer->RemoveActor(actor);
+    this->culler->RemoveProp(actor);
+    MemoryBudget::global().untrack(this->mesh_memory_ids[index]);
+    this->mesh_actors.erase(found);
+    this->mesh_memory_ids.erase(this->mesh_memory_ids.begin() + index);
+    this->motion_proxies.setActors(this->renderer, this->mesh_actors);
+    if (this->batching) {
+        this->rebuildBatches();
+    }
+    if (this->sort_last) {
+        this->updateSortLastMesh();
+    }
+
+    const auto mapper = vtkPolyDataMapper::SafeDownCast(actor->GetMapper());
+    if (mapper != nullptr) {
+        mapper->SetInputData(nullptr);
+    }
+    this->statusMessage(
+        QString("Evicted a mesh to stay within the memory budget")
+        );
+    this->requestRender();
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::statusMessage
+// ----------------------------------------------------------------------------
+//
+// Description: Displays a status message in the status bar
+//
+// Inputs:
+// - message: The message to display
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void MainWindow::statusMessage(const QString& message)
+{
+    this->ui->statusbar->showMessage(message);
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::requestRender
+// ----------------------------------------------------------------------------
+//
+// Description: Schedules a render of the VTK scene. Requests arriving while
+//              one is already pending are merged into it.
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void MainWindow::requestRender()
+{
+    if (!this->render_timer->isActive()) {
+        this->render_timer->start();
+    }
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::render
+// ----------------------------------------------------------------------------
+//
+// Description: Renders the VTK scene
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void MainWindow::render()
+{
+    this->ui->mainview->renderWindow()->Render();
+}
+
+// ----------------------------------------------------------------------------
+// MainWindow::about
+// ----------------------------------------------------------------------------
+//
+// Description: Displays the about dialog
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void MainWindow::about()
+{
+    QMessageBox::about(
+        this,
+        tr("About the Qt VTK Framework"),
+        tr("A lightweight C++ framework for creating graphical applications "
+        "using the <a href='https://vtk.org/'>Visualization Toolkit</a> (VTK) "
+        "for rendering and <a href='https://www.qt.io/product/framework'>Qt "
+        "Framework</a> for the user interface."
+        "<br><br>"
+        "<b>Features:</b><br>"
+        "<ul>"
+        "<li>UI creation with Qt Designer for a streamlined development "
+        "process.</li>"
+        "<li>Basic \"Main Window\" application structure with an about dialog."
+        "</li>"
+        "<li>Eye-catching <a href='https://icons8.com/icons/isometric'>"
+        "Isometric icons</a> from <a href='https://icons8.com'>Icons8</a> for "
+        "a polished look.</li>"
+        "<li>Simple VTK rendering scene with standard event interaction "
+        "(camera control with mouse).</li>"
+        "<li>VTK events routed to C++ callables by the Qt independent "
+        "<code>qtvtk_core</code> library, shared with the headless tools."
+        "</li>"
         "<li>Efficient linking of graphical resources (icons, etc.) with the "
         "executable using CMake's <code>qt5_add_resources</code> command.</li>"
         "<li>Streamlined post-build resource copying using CMake's "
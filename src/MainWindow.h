@@ -26,6 +26,31 @@
 //
 // * MainWindow.h: created.
 //
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * MainWindow.h: added the shared memory live-data ingest.
+// * MainWindow.h: now a thin Qt layer over the qtvtk_core library.
+// * MainWindow.h: added the adaptive frame rate controller.
+// * MainWindow.h: added volume loading under the global memory budget.
+// * MainWindow.h: volumes can be kept compressed in bricks.
+// * MainWindow.h: added mesh loading with cached preprocessing.
+// * MainWindow.h: added hierarchical culling of parts.
+// * MainWindow.h: added merged-geometry batching of parts and meshes.
+// * MainWindow.h: added tiled high resolution image export.
+// * MainWindow.h: added video export.
+// * MainWindow.h: added declarative scene files.
+// * MainWindow.h: added the window/level slice view.
+// * MainWindow.h: added the statistics panel and auto window/level.
+// * MainWindow.h: added the volume pyramid builder.
+// * MainWindow.h: added the clip plane and crop box widgets.
+// * MainWindow.h: added parallel streamline tracing.
+// * MainWindow.h: added frame pacing of mouse moves.
+// * MainWindow.h: added rendering into pooled frame buffers.
+// * MainWindow.h: added sort-last rendering of the meshes.
+// * MainWindow.h: added camera bookmarks with animated transitions.
+// * MainWindow.h: live-data ranges come from the producer or are throttled.
+// * MainWindow.h: opened meshes are tracked by the memory budget.
+//
 // ============================================================================
 
 
@@ -39,15 +64,52 @@
 // "C" system headers
 
 // Standard Library headers
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
 
 // External libraries headers
+#include <QDockWidget>
+#include <QElapsedTimer>
 #include <QPointer>
 #include <QMainWindow>
+#include <QTimer>
 #include <QVTKOpenGLNativeWidget.h>
-#include <vtkEventQtSlotConnect.h>
+#include <vtkActor.h>
+#include <vtkCamera.h>
+#include <vtkCellPicker.h>
+#include <vtkInteractorObserver.h>
+#include <vtkInteractorStyleImage.h>
+#include <vtkPlaneWidget.h>
+#include <vtkProp.h>
+#include <vtkRenderer.h>
+#include <vtkSmartPointer.h>
+#include <vtkTexture.h>
+
+// Project headers
+#include "BrickedVolume.h"
+#include "BvhCuller.h"
+#include "CameraBookmarks.h"
+#include "EventDispatcher.h"
+#include "FlowTracer.h"
+#include "FramePacer.h"
+#include "FrameReadback.h"
+#include "FrameRateController.h"
+#include "GeometryBatcher.h"
+#include "ImageDisplay.h"
+#include "ImageStatistics.h"
+#include "InteractiveClipper.h"
+#include "MemoryBudget.h"
+#include "SceneScript.h"
+#include "SharedMemoryIngest.h"
+#include "SortLastRenderer.h"
+#include "StatusReport.h"
 
 
 // Forward Qt class declarations
+class StatisticsPanel;
 class Ui_MainWindow;
 
 
@@ -59,7 +121,9 @@ class Ui_MainWindow;
 // MainWindow
 // ----------------------------------------------------------------------------
 //
-// Description: A subclass of QMainWindow that sets up a VTK renderer
+// Description: A subclass of QMainWindow that sets up a VTK renderer. It is
+//              the thin Qt layer of the viewer: scene construction, event
+//              dispatch and the status line come from qtvtk_core.
 //
 // Properties:
 // - render_widget: A QVTKOpenGLNativeWidget that holds the VTK renderer
@@ -67,13 +131,55 @@ class Ui_MainWindow;
 // Methods:
 // - MainWindow: Constructor
 // - ~MainWindow: Destructor
+// - attachSharedMemory: Displays live data from a shared memory segment
+// - setTargetFrameRate: Sets the interactive frame rate to hold
+// - setInputRate: Sets the rate mouse moves reach the interactor at
+// - openVolume: Loads a volume image under the global memory budget
+// - setVolumeCompression: Keeps volumes opened later compressed in bricks
+// - openMesh: Loads a surface mesh through the preprocessed mesh cache
+// - setMeshCacheDirectory: Sets where preprocessed meshes are cached
+// - openScene: Builds the scene described in a scene file
+// - setSceneVariable: Sets a variable of scene files opened later
+// - addParts: Adds a synthetic assembly of parts
+// - setMinimumPartPixels: Sets the screen-size culling threshold
+// - setBatching: Draws parts and meshes as a few merged batches
+// - exportImage: Saves the view as an image of any size
+// - exportVideo: Saves an orbit around the scene as a video
+// - renderToBuffer: Renders the view into a pooled frame buffer
+// - setSliceView: Shows the last volume as window/leveled 2D slices
+// - buildPyramid: Writes the multi-resolution pyramid of the last volume
+// - setClipping: Clips or crops the meshes and volumes with a widget
+// - setFlowView: Traces streamlines of the last volume from a seed plane
+// - setFlowStyle: Draws the streamlines as tubes or cones
+// - setFlowSeeds: Sets the seeds per side of the seed plane
+// - setSortLast: Renders the meshes in partitions on worker threads
+// - setCompositeMethod: Sets how the partitions are composited
+// - storeBookmark: Bookmarks the view under a key
+// - restoreBookmark: Returns to the view bookmarked under a key
+// - openBookmarks: Reads the bookmarks of a session file
+// - saveBookmarks: Writes the bookmarks to a session file
 //
 // Signals:
 // - None
 //
 // Slots:
-// - dispatchRendererEvent: Registers the VTK events from the renderer object
+// - browseVolume: Asks for a volume file and opens it
+// - browseMesh: Asks for a mesh file and opens it
+// - browseScene: Asks for a scene file and opens it
+// - browseExportImage: Asks for an image file and size and exports
+// - browseExportVideo: Asks for a video file and length and exports
+// - browseBuildPyramid: Asks for a directory and builds a pyramid
+// - browseOpenBookmarks: Asks for a session file and reads its bookmarks
+// - browseSaveBookmarks: Asks for a session file and writes the bookmarks
+// - toggleSliceView: Switches between the 3D view and the slice view
+// - toggleClipPlane: Shows or hides the clip plane widget
+// - toggleCropBox: Shows or hides the crop box widget
+// - toggleFlowView: Shows or hides the streamlines and their seed plane
+// - toggleFlowCones: Draws the streamlines as cones or as tubes
+// - autoWindowLevel: Windows the last volume from its statistics
+// - pollSharedMemory: Picks up new live-data generations
 // - statusMessage: Updates a status message in the status bar
+// - requestRender: Schedules a coalesced render of the VTK scene
 // - Render: Renders the VTK scene
 // - close: Exits the application
 //
@@ -91,14 +197,114 @@ class MainWindow : public QMainWindow
 public:
     // Constructor/Destructor
     MainWindow(int argc, char* argv[]);
-    ~MainWindow() override {}
+    ~MainWindow() override;
+
+    bool attachSharedMemory(
+        const std::string& name,
+        int poll_interval,
+        std::string* error = nullptr
+        );  // Displays live data from a shared memory segment
+    void setTargetFrameRate(double fps);  // 0 disables the adaptive quality
+    void setInputRate(double hz);  // 0 passes every mouse move on
+    bool openVolume(
+        const std::string& path,
+        std::string* error = nullptr
+        );  // Loads and displays a volume image
+    void setVolumeCompression(
+        bool enabled,
+        std::size_t cache_bytes = BrickedVolume::kDefaultCacheBytes
+        );  // Applies to volumes opened afterwards
+    bool openMesh(
+        const std::string& path,
+        std::string* error = nullptr
+        );  // Loads and displays a surface mesh
+    void setMeshCacheDirectory(
+        const std::string& directory
+        );  // Empty disables the preprocessed mesh cache
+    bool openScene(
+        const std::string& path,
+        std::string* error = nullptr
+        );  // Builds a scene file, replacing the previous one
+    void setSceneVariable(
+        const std::string& name,
+        const std::string& value
+        );  // Overrides a set statement of scene files
+    void addParts(int count);  // Synthetic assembly, for culling tests
+    void setMinimumPartPixels(double pixels);  // 0 disables size culling
+    void setBatching(bool enabled);  // Merges parts and meshes by material
+    bool exportImage(
+        const std::string& path,
+        int width,
+        int height,
+        std::string* error = nullptr
+        );  // Renders the view tiled and streams it to a PNG or TIFF file
+    bool exportVideo(
+        const std::string& path,
+        int frames,
+        std::string* error = nullptr
+        );  // Renders an orbit of the view and encodes it on another thread
+    bool renderToBuffer(
+        FrameView* frame,
+        bool with_depth = false,
+        std::string* error = nullptr
+        );  // The view as pixels, and depth, in a reused buffer
+    bool setSliceView(
+        bool enabled,
+        std::string* error = nullptr
+        );  // 2D slices of the last volume, with window/level dragging
+    bool buildPyramid(
+        const std::string& directory,
+        std::string* error = nullptr
+        );  // Downsampled levels of the last volume, as chunked files
+    bool setClipping(
+        bool enabled,
+        ClipShape shape = ClipShape::Plane,
+        std::string* error = nullptr
+        );  // Drags move clipping planes, releases clip in the background
+    bool setFlowView(
+        bool enabled,
+        std::string* error = nullptr
+        );  // Streamlines of the last volume, retraced as the seeds move
+    void setFlowStyle(FlowStyle style);  // Tubes or instanced cones
+    void setFlowSeeds(int per_side);  // Seeds of the plane: per_side squared
+    bool setSortLast(
+        int partitions,
+        std::string* error = nullptr
+        );  // Partitions rendered on threads and composited, 0 disables
+    void setCompositeMethod(CompositeMethod method);  // Of sort-last
+    void storeBookmark(
+        char key,
+        const std::string& name = std::string()
+        );  // Replaces the bookmark of the key, if any
+    bool restoreBookmark(
+        char key,
+        bool animate = true
+        );  // Camera only: renders, never updates a pipeline
+    bool openBookmarks(
+        const std::string& path,
+        std::string* error = nullptr
+        );  // Replaces the bookmarks
+    bool saveBookmarks(
+        const std::string& path,
+        std::string* error = nullptr
+        );
 
 private Q_SLOTS:
-        virtual void dispatchRendererEvent(
-            vtkObject* caller,
-            unsigned long vtk_event,
-            void* client_data
-            );  // Registers the VTK end event
+        virtual void browseVolume();  // Asks for a volume file to open
+        virtual void browseMesh();  // Asks for a mesh file to open
+        virtual void browseScene();  // Asks for a scene file to open
+        virtual void browseExportImage();  // Asks where to export the view
+        virtual void browseExportVideo();  // Asks where to export an orbit
+        virtual void browseBuildPyramid();  // Asks where to build a pyramid
+        virtual void browseOpenBookmarks();  // Asks for bookmarks to read
+        virtual void browseSaveBookmarks();  // Asks where to save bookmarks
+        virtual void toggleSliceView(bool checked);  // 2D or 3D view
+        virtual void toggleClipPlane(bool checked);  // Clip plane widget
+        virtual void toggleCropBox(bool checked);  // Crop box widget
+        virtual void toggleFlowView(bool checked);  // Streamlines
+        virtual void toggleFlowCones(bool checked);  // Cones or tubes
+        virtual void autoWindowLevel();  // 1st to 99th percentile window
+        virtual void pollSharedMemory();  // Picks up new live data
         virtual void render();  // Renders the VTK scene
         virtual void about();  // Displays the about dialog
         virtual void close();  // Exits the application
@@ -107,14 +313,156 @@ public Q_SLOTS:
         virtual void statusMessage(
             const QString& message
             );  // Displays a status message
+        virtual void requestRender();  // Schedules a coalesced render
 
 protected:
     QPointer<QVTKOpenGLNativeWidget> render_widget; // Holds the VTK renderer
 
 private:
+    void dispatchRendererEvent(
+        vtkObject* caller,
+        unsigned long vtk_event
+        );  // Handles the renderer events
+    bool openBrickedVolume(
+        vtkAlgorithm* reader,
+        const std::string& path,
+        std::string* error
+        );  // Loads a volume into compressed bricks
+    MemoryBudget::EvictHandler evictionHandler(
+        vtkProp* key
+        );  // Unloads the volume or mesh shown by key on the GUI thread
+    void unloadVolume(vtkProp* key);  // Eviction handler
+    void unloadMesh(vtkProp* key);  // Eviction handler
+    void updateIngestRange(bool force);  // Color range of the live data
+    void rebuildBatches();  // Re-merges parts and meshes if batching
+    void reportPick();  // Shows the part under the last pick
+    void handleSliceEvent(
+        vtkObject* caller,
+        unsigned long vtk_event
+        );  // Window/level drags and slice keys of the slice view
+    void updateSliceView();  // Maps the slice and reports it
+    void computeStatistics();  // Of the last volume, in the background
+    void showStatistics(
+        std::uint64_t request,
+        const ImageStatistics& stats
+        );  // Partial or final statistics, on the GUI thread
+    void applyClipCommit(
+        std::uint64_t commit
+        );  // Shows a clip finished in the background, on the GUI thread
+    void updateClipActions();  // Checks the action of the widget shown
+    void reseedFlow();  // Traces from the seed plane, cancelling the last
+    void showFlow(
+        std::uint64_t request,
+        vtkSmartPointer<vtkPolyData> lines,
+        const TraceStats& stats
+        );  // Finished streamlines, on the GUI thread
+    void updateSortLastMesh();  // Partitions the meshes among the workers
+    void compositeSortLast();  // Renders the partitions, before the view
+    void handleBookmarkKey();  // Ctrl+digit stores, digit restores
+    void stepCameraTransition();  // Next frame of a bookmark transition
+    void stopCameraTransition();  // Leaves the camera where it is
+
+    struct LoadedVolume {
+        std::uint64_t memory_id = 0;  // Entry in the memory budget
+        std::uint64_t cache_id = 0;  // Brick cache entry, if compressed
+        std::string label;
+        std::vector<vtkSmartPointer<vtkProp>> props;  // Volume or slices
+        std::shared_ptr<BrickedVolume> bricked;  // Compressed volumes only
+    };
+    vtkImageData* volumeImage(
+        const LoadedVolume& loaded
+        ) const;  // Image of an uncompressed volume
+
     // Designer form
     Ui_MainWindow* ui;
-    vtkSmartPointer<vtkEventQtSlotConnect> vtk_event_connect;
+    vtkSmartPointer<vtkRenderer> renderer;
+    vtkSmartPointer<vtkActor> cone_actor;
+
+    // Live-data ingest
+    std::unique_ptr<SharedMemoryIngest> ingest;
+    vtkSmartPointer<vtkActor> ingest_actor;
+    QPointer<QTimer> ingest_timer;  // Polls the sequence counter
+    QElapsedTimer ingest_range_clock;  // Since the live data was last scanned
+    QPointer<QTimer> render_timer;  // Coalesces render requests
+
+    // Volumes opened by the user, tracked by MemoryBudget::global()
+    std::vector<LoadedVolume> volumes;
+    bool compress_volumes = false;
+    std::size_t brick_cache_bytes = BrickedVolume::kDefaultCacheBytes;
+
+    // Meshes opened by the user, tracked by MemoryBudget::global()
+    std::vector<vtkSmartPointer<vtkActor>> mesh_actors;
+    std::vector<std::uint64_t> mesh_memory_ids;  // Parallel to mesh_actors
+    std::string mesh_cache_dir;  // Preprocessed meshes, empty for none
+
+    // Scene file, its pipelines are kept and reused when it is reopened
+    SceneScript scene_script;
+
+    // Meshes and parts are culled through a bounding volume hierarchy
+    vtkSmartPointer<BvhCuller> culler;
+    std::vector<vtkSmartPointer<vtkActor>> parts;
+
+    // Parts and meshes merged into a few draw batches, picked by cell
+    GeometryBatcher batcher;
+    bool batching = false;
+    vtkSmartPointer<vtkCellPicker> picker;
+
+    // 2D slice view of the last volume. The 3D props are hidden, and the
+    // camera and the interactor style put back, when it is left.
+    ImageSliceDisplay slice_display;
+    vtkSmartPointer<vtkInteractorStyleImage> slice_style;
+    vtkSmartPointer<vtkInteractorObserver> view_style;  // Style of 3D view
+    vtkSmartPointer<vtkCamera> view_camera;  // Camera of the 3D view
+    std::vector<vtkSmartPointer<vtkProp>> hidden_props;
+    std::vector<unsigned long> slice_connections;
+    double drag_window = 1.0;  // Window at the start of a drag
+    double drag_level = 0.5;  // Level at the start of a drag
+    bool slice_view = false;
+
+    // Statistics of the last volume, computed in the background. Results of
+    // a pass are shown only while it is the latest request.
+    ImageStatisticsEngine statistics;
+    ImageStatistics volume_statistics;
+    std::uint64_t statistics_request = 0;
+    QPointer<QDockWidget> statistics_dock;
+    QPointer<StatisticsPanel> statistics_panel;
+
+    // Clip plane or crop box over the meshes, parts and volumes. Drags only
+    // move the clipping planes of the mappers; the meshes are clipped for
+    // real on a worker thread when the widget is released.
+    InteractiveClipper clipper;
+
+    // Streamlines of the last volume, traced in the background from the
+    // seeds of a plane widget. Moving the seeds cancels the trace running;
+    // results are shown only while they are the latest request.
+    StreamlineEngine flow_engine;
+    FlowDisplay flow_display;
+    vtkSmartPointer<vtkPlaneWidget> seed_widget;
+    vtkSmartPointer<vtkImageData> flow_field;
+    std::vector<unsigned long> flow_connections;
+    std::uint64_t flow_request = 0;
+    int flow_seeds = 32;  // Per side of the seed plane
+    bool flow_view = false;
+
+    // Meshes partitioned among offscreen worker threads; their color and
+    // depth images are composited into the background texture of the view
+    std::unique_ptr<SortLastRenderer> sort_last;
+    vtkSmartPointer<vtkTexture> sort_last_texture;
+    unsigned long sort_last_connection = 0;
+    CompositeMethod composite_method = CompositeMethod::BinarySwap;
+
+    // Bookmarked views, and the transition to the one restored last, drawn
+    // with decimated stand-ins of the large meshes while it runs
+    CameraBookmarks bookmarks;
+    CameraTransition camera_transition;
+    MotionProxies motion_proxies;
+    QPointer<QTimer> transition_timer;  // Steps the transition
+
+    StatusReport status;  // Text of the status bar
+    FrameRateController frame_rate;  // Adaptive interactive quality
+    QPointer<FramePacer> frame_pacer;  // Paced mouse moves, their latency
+    std::unique_ptr<FrameReadback> frame_readback;  // Frames as memory
+    EventDispatcher events;  // Declared last so it is disconnected first
 };
 
 #endif  // MainWindow_H
\ No newline at end of file
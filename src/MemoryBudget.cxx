@@ -0,0 +1,561 @@
+// ============================================================================
+// MemoryBudget.cxx - Implementation of the MemoryBudget class
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * MemoryBudget.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header -------------------------------------------------------------
+#include "MemoryBudget.h"
+
+// "C" system headers ---------------------------------------------------------
+
+// Standard Library headers ---------------------------------------------------
+#include <algorithm>
+#include <cstdio>
+#include <tuple>
+#include <utility>
+
+// External libraries headers -------------------------------------------------
+
+// VTK headers
+#include <vtkPropCollection.h>
+
+
+// ============================================================================
+// Local helpers section
+// ============================================================================
+
+namespace {
+
+const double kMiB = 1024.0 * 1024.0;
+
+// GetActualMemorySize() reports kibibytes
+std::uint64_t dataObjectBytes(vtkDataObject* data)
+{
+    return data != nullptr
+        ? static_cast<std::uint64_t>(data->GetActualMemorySize()) * 1024
+        : 0;
+}
+
+}  // namespace
+
+
+// ============================================================================
+// Constructor/Destructor Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// MemoryBudget::MemoryBudget
+// ----------------------------------------------------------------------------
+//
+// Description: Constructor
+//
+// Inputs:
+// - budget_bytes: Memory budget in bytes, 0 for unlimited
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+MemoryBudget::MemoryBudget(std::uint64_t budget_bytes)
+    : budget_bytes(budget_bytes),
+      frame(0),
+      next_id(1)
+{
+}
+
+
+// ============================================================================
+// Public Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// MemoryBudget::global
+// ----------------------------------------------------------------------------
+//
+// Description: Returns the process wide budget shared by the viewer and all
+//              caches. It starts unlimited.
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: The global MemoryBudget
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+MemoryBudget& MemoryBudget::global()
+{
+    static MemoryBudget budget;
+    return budget;
+}
+
+// ----------------------------------------------------------------------------
+// MemoryBudget::setBudget
+// ----------------------------------------------------------------------------
+//
+// Description: Sets the budget. Usage above a lowered budget is reduced by
+//              the next enforce call.
+//
+// Inputs:
+// - bytes: Memory budget in bytes, 0 for unlimited
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void MemoryBudget::setBudget(std::uint64_t bytes)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->budget_bytes = bytes;
+}
+
+// ----------------------------------------------------------------------------
+// MemoryBudget::budget
+// ----------------------------------------------------------------------------
+//
+// Description: Returns the budget
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: Memory budget in bytes, 0 for unlimited
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+std::uint64_t MemoryBudget::budget() const
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->budget_bytes;
+}
+
+// ----------------------------------------------------------------------------
+// MemoryBudget::track
+// ----------------------------------------------------------------------------
+//
+// Description: Registers a cached dataset. The dataset counts as used now.
+//
+// Inputs:
+// - data: The dataset, already updated so its size is known
+// - tier: Eviction tier of the dataset
+// - on_evict: Called when the dataset is evicted, must drop the owner's
+//             references to it
+// - label: Name shown when the dataset is evicted
+// - prop: Prop displaying the dataset, if any. Visible props in a rendered
+//         renderer mark their dataset as used (see markRendered).
+//
+// Outputs: None
+//
+// Returns: Entry id, 0 if data is null
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+std::uint64_t MemoryBudget::track(
+    vtkDataObject* data,
+    CacheTier tier,
+    EvictHandler on_evict,
+    const std::string& label,
+    vtkProp* prop
+    )
+{
+    if (data == nullptr) {
+        return 0;
+    }
+
+    Entry entry;
+    entry.data = data;
+    entry.prop = prop;
+    entry.tier = tier;
+    entry.on_evict = std::move(on_evict);
+    entry.label = label;
+    entry.bytes = dataObjectBytes(data);
+
+    std::lock_guard<std::mutex> lock(this->mutex);
+    entry.last_used = this->frame;
+    const std::uint64_t id = this->next_id++;
+    this->entries.emplace(id, std::move(entry));
+
+    return id;
+}
+
+// ----------------------------------------------------------------------------
+// MemoryBudget::trackSized
+// ----------------------------------------------------------------------------
+//
+// Description: Registers a cache that is not a vtkDataObject, e.g. compressed
+//              bricks or decoded brick caches. Its size is queried through
+//              the size function on every refresh, and the entry lives until
+//              it is untracked or evicted.
+//
+// Inputs:
+// - size: Returns the current size of the cache in bytes. Called with the
+//         budget locked, so it must not call back into the budget.
+// - tier: Eviction tier of the cache
+// - on_evict: Called when the cache is evicted, must release its memory
+// - label: Name shown when the cache is evicted
+// - prop: Prop displaying the cache contents, if any
+//
+// Outputs: None
+//
+// Returns: Entry id, 0 if size is empty
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+std::uint64_t MemoryBudget::trackSized(
+    SizeFunction size,
+    CacheTier tier,
+    EvictHandler on_evict,
+    const std::string& label,
+    vtkProp* prop
+    )
+{
+    if (!size) {
+        return 0;
+    }
+
+    Entry entry;
+    entry.prop = prop;
+    entry.tier = tier;
+    entry.on_evict = std::move(on_evict);
+    entry.label = label;
+    entry.bytes = size();
+    entry.size = std::move(size);
+
+    std::lock_guard<std::mutex> lock(this->mutex);
+    entry.last_used = this->frame;
+    const std::uint64_t id = this->next_id++;
+    this->entries.emplace(id, std::move(entry));
+
+    return id;
+}
+
+// ----------------------------------------------------------------------------
+// MemoryBudget::untrack
+// ----------------------------------------------------------------------------
+//
+// Description: Forgets a dataset, e.g. because its owner released it. The
+//              eviction handler is not called.
+//
+// Inputs:
+// - id: Entry id returned by track
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void MemoryBudget::untrack(std::uint64_t id)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->entries.erase(id);
+}
+
+// ----------------------------------------------------------------------------
+// MemoryBudget::touch
+// ----------------------------------------------------------------------------
+//
+// Description: Marks a dataset as used in the current frame. Needed for
+//              datasets that are not shown by a prop, e.g. cached bricks.
+//
+// Inputs:
+// - id: Entry id returned by track
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void MemoryBudget::touch(std::uint64_t id)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    auto found = this->entries.find(id);
+    if (found != this->entries.end()) {
+        found->second.last_used = this->frame;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// MemoryBudget::markRendered
+// ----------------------------------------------------------------------------
+//
+// Description: Starts a new frame and marks the datasets whose props are
+//              visible in the renderer as used in it. Call it after every
+//              render, e.g. from the renderer EndEvent.
+//
+// Inputs:
+// - renderer: The renderer that just rendered
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void MemoryBudget::markRendered(vtkRenderer* renderer)
+{
+    if (renderer == nullptr) {
+        return;
+    }
+
+    vtkPropCollection* props = renderer->GetViewProps();
+    std::lock_guard<std::mutex> lock(this->mutex);
+    ++this->frame;
+    for (auto& entry : this->entries) {
+        vtkProp* prop = entry.second.prop;
+        if (prop != nullptr
+            && prop->GetVisibility()
+            && props->IsItemPresent(prop)) {
+            entry.second.last_used = this->frame;
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// MemoryBudget::refresh
+// ----------------------------------------------------------------------------
+//
+// Description: Re-reads the size of every dataset and cache and drops
+//              entries whose dataset no longer exists
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void MemoryBudget::refresh()
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    for (auto it = this->entries.begin(); it != this->entries.end();) {
+        if (it->second.size) {
+            it->second.bytes = it->second.size();
+            ++it;
+        } else if (it->second.data == nullptr) {
+            it = this->entries.erase(it);
+        } else {
+            it->second.bytes = dataObjectBytes(it->second.data);
+            ++it;
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// MemoryBudget::enforce
+// ----------------------------------------------------------------------------
+//
+// Description: Evicts datasets until the tracked usage plus the incoming
+//              bytes fits the budget. Datasets rendered in the last frame
+//              go last, derived data before primary data, and otherwise the
+//              least recently rendered first.
+//
+// Inputs:
+// - incoming_bytes: Size of data about to be loaded
+//
+// Outputs: None
+//
+// Returns: Labels of the evicted datasets
+//
+// Side Effects: Calls the eviction handlers
+//
+// ----------------------------------------------------------------------------
+std::vector<std::string> MemoryBudget::enforce(std::uint64_t incoming_bytes)
+{
+    this->refresh();
+
+    std::vector<std::string> labels;
+    std::vector<EvictHandler> handlers;
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if (this->budget_bytes == 0) {
+            return labels;
+        }
+
+        using Key = std::tuple<bool, int, std::uint64_t, std::uint64_t>;
+        std::vector<Key> order;
+        for (const auto& entry : this->entries) {
+            order.emplace_back(
+                entry.second.last_used == this->frame,
+                static_cast<int>(entry.second.tier),
+                entry.second.last_used,
+                entry.first
+                );
+        }
+        std::sort(order.begin(), order.end());
+
+        std::uint64_t used = this->usageLocked();
+        for (const auto& key : order) {
+            if (used + incoming_bytes <= this->budget_bytes) {
+                break;
+            }
+            auto found = this->entries.find(std::get<3>(key));
+            used -= found->second.bytes;
+            labels.push_back(found->second.label);
+            handlers.push_back(std::move(found->second.on_evict));
+            this->entries.erase(found);
+        }
+    }
+
+    for (auto& handler : handlers) {
+        if (handler) {
+            handler();
+        }
+    }
+
+    return labels;
+}
+
+// ----------------------------------------------------------------------------
+// MemoryBudget::usage
+// ----------------------------------------------------------------------------
+//
+// Description: Returns the memory used by the tracked datasets, as of the
+//              last refresh
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: Usage in bytes
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+std::uint64_t MemoryBudget::usage() const
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->usageLocked();
+}
+
+// ----------------------------------------------------------------------------
+// MemoryBudget::entryCount
+// ----------------------------------------------------------------------------
+//
+// Description: Returns the number of tracked datasets
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: Number of entries
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+std::size_t MemoryBudget::entryCount() const
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->entries.size();
+}
+
+// ----------------------------------------------------------------------------
+// MemoryBudget::describe
+// ----------------------------------------------------------------------------
+//
+// Description: Formats the usage for status lines, e.g. "812.5 / 2048 MiB"
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: The usage summary
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+std::string MemoryBudget::describe() const
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    char buffer[64];
+    if (this->budget_bytes == 0) {
+        std::snprintf(
+            buffer, sizeof(buffer), "%.1f MiB",
+            this->usageLocked() / kMiB
+            );
+    } else {
+        std::snprintf(
+            buffer, sizeof(buffer), "%.1f / %.0f MiB",
+            this->usageLocked() / kMiB,
+            this->budget_bytes / kMiB
+            );
+    }
+
+    return buffer;
+}
+
+
+// ============================================================================
+// Private Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// MemoryBudget::usageLocked
+// ----------------------------------------------------------------------------
+//
+// Description: Sums the entry sizes. The caller holds the mutex.
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: Usage in bytes
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+std::uint64_t MemoryBudget::usageLocked() const
+{
+    std::uint64_t total = 0;
+    for (const auto& entry : this->entries) {
+        total += entry.second.bytes;
+    }
+    return total;
+}
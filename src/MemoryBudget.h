@@ -0,0 +1,177 @@
+// ============================================================================
+// MemoryBudget.h - Keeps cached datasets within a memory budget
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * MemoryBudget.h: created.
+//
+// ============================================================================
+
+
+#ifndef MemoryBudget_H
+#define MemoryBudget_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// "C" system headers
+
+// Standard Library headers
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// External libraries headers
+#include <vtkDataObject.h>
+#include <vtkProp.h>
+#include <vtkRenderer.h>
+#include <vtkWeakPointer.h>
+
+
+// ============================================================================
+// Enumerations Section
+// ============================================================================
+
+// Eviction tiers. Derived data (downsampled levels, decoded bricks, caches
+// that can be rebuilt from a primary dataset) goes before primary data.
+enum class CacheTier {
+    Derived = 0,
+    Primary = 1
+};
+
+
+// ============================================================================
+// Class Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// MemoryBudget
+// ----------------------------------------------------------------------------
+//
+// Description: Tracks every cached vtkDataObject registered with it, sized
+//              by GetActualMemorySize(), and evicts entries when the total
+//              would exceed the budget. Eviction order is: entries not
+//              rendered in the last frame before those that were, derived
+//              before primary data, and least recently rendered first.
+//              Evicting an entry calls its handler, which drops the owner's
+//              references; the manager itself only holds weak pointers.
+//              All methods are thread safe, handlers run on the calling
+//              thread with the lock released.
+//
+// Properties:
+// - budget_bytes: Memory budget, 0 means unlimited
+// - entries: Tracked datasets, keyed by id
+// - frame: Number of the last rendered frame
+//
+// Methods:
+// - global: Returns the process wide budget
+// - setBudget: Sets the budget
+// - track: Registers a dataset and its eviction handler
+// - trackSized: Registers a cache that is not a vtkDataObject
+// - untrack: Forgets a dataset without evicting it
+// - touch: Marks a dataset as just used
+// - markRendered: Marks the datasets shown by visible props as rendered
+// - refresh: Re-reads the sizes of all datasets
+// - enforce: Evicts until the usage (plus incoming bytes) fits the budget
+// - usage: Returns the tracked memory in bytes
+// - describe: Returns a short usage summary for status lines
+//
+// Example usage:
+//   MemoryBudget::global().setBudget(2048ULL << 20);
+//   MemoryBudget::global().enforce(estimated_size);
+//   reader->Update();
+//   id = MemoryBudget::global().track(
+//       image, CacheTier::Primary, [&]() { unload(image); }, "head.mhd",
+//       volume
+//       );
+//
+// ----------------------------------------------------------------------------
+class MemoryBudget
+{
+public:
+    using EvictHandler = std::function<void()>;
+    using SizeFunction = std::function<std::uint64_t()>;
+
+    // Constructor/Destructor
+    explicit MemoryBudget(std::uint64_t budget_bytes = 0);
+
+    MemoryBudget(const MemoryBudget&) = delete;
+    MemoryBudget& operator=(const MemoryBudget&) = delete;
+
+    static MemoryBudget& global();
+
+    void setBudget(std::uint64_t bytes);
+    std::uint64_t budget() const;
+
+    std::uint64_t track(
+        vtkDataObject* data,
+        CacheTier tier,
+        EvictHandler on_evict,
+        const std::string& label = std::string(),
+        vtkProp* prop = nullptr
+        );  // Returns the entry id, 0 if data is null
+    std::uint64_t trackSized(
+        SizeFunction size,
+        CacheTier tier,
+        EvictHandler on_evict,
+        const std::string& label = std::string(),
+        vtkProp* prop = nullptr
+        );  // Returns the entry id, 0 if size is empty
+    void untrack(std::uint64_t id);
+    void touch(std::uint64_t id);
+    void markRendered(vtkRenderer* renderer);
+    void refresh();
+    std::vector<std::string> enforce(std::uint64_t incoming_bytes = 0);
+
+    std::uint64_t usage() const;
+    std::size_t entryCount() const;
+    std::string describe() const;
+
+private:
+    struct Entry {
+        vtkWeakPointer<vtkDataObject> data;
+        vtkWeakPointer<vtkProp> prop;
+        CacheTier tier = CacheTier::Primary;
+        EvictHandler on_evict;
+        SizeFunction size;
+        std::string label;
+        std::uint64_t bytes = 0;
+        std::uint64_t last_used = 0;
+    };
+
+    std::uint64_t usageLocked() const;
+
+    mutable std::mutex mutex;
+    std::map<std::uint64_t, Entry> entries;
+    std::uint64_t budget_bytes;
+    std::uint64_t frame;
+    std::uint64_t next_id;
+};
+
+#endif  // MemoryBudget_H
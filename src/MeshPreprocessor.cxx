@@ -0,0 +1,767 @@
+// ============================================================================
+// MeshPreprocessor.cxx - Implementation of the mesh preprocessing functions
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * MeshPreprocessor.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header -------------------------------------------------------------
+#include "MeshPreprocessor.h"
+
+// "C" system headers ---------------------------------------------------------
+
+// Standard Library headers ---------------------------------------------------
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <thread>
+#include <vector>
+
+// External libraries headers -------------------------------------------------
+
+// VTK headers
+#include <vtkCellArray.h>
+#include <vtkCellArrayIterator.h>
+#include <vtkFloatArray.h>
+#include <vtkIdTypeArray.h>
+#include <vtkOBJReader.h>
+#include <vtkPLYReader.h>
+#include <vtkPointData.h>
+#include <vtkPoints.h>
+#include <vtkPolyDataReader.h>
+#include <vtkSMPTools.h>
+#include <vtkSTLReader.h>
+#include <vtkStripper.h>
+#include <vtkTriangleFilter.h>
+#include <vtkXMLPolyDataReader.h>
+#include <vtkXMLPolyDataWriter.h>
+
+
+// ============================================================================
+// Local helpers section
+// ============================================================================
+
+namespace {
+
+namespace fs = std::filesystem;
+
+// Bump when the preprocessing output changes, to invalidate old caches
+const char* const kCacheVersion = "qtvtk-mesh-1";
+
+// Triangles are reordered in independent chunks of this size, in parallel
+const vtkIdType kReorderChunkTriangles = 1 << 16;
+
+// Vertex scoring of Forsyth's "Linear-Speed Vertex Cache Optimisation"
+const double kCacheDecayPower = 1.5;
+const double kLastTriangleScore = 0.75;
+const double kValenceBoostScale = 2.0;
+const double kValenceBoostPower = 0.5;
+
+double vertexScore(int cache_position, int remaining, int cache_size)
+{
+    if (remaining == 0) {
+        return -1.0;
+    }
+
+    double score = 0.0;
+    if (cache_position >= 0) {
+        score = cache_position < 3
+            ? kLastTriangleScore
+            : std::pow(
+                1.0 - double(cache_position - 3) / double(cache_size - 3),
+                kCacheDecayPower
+                );
+    }
+
+    const double valence_boost =
+        std::pow(double(remaining), -kValenceBoostPower);
+    return score + kValenceBoostScale * valence_boost;
+}
+
+// Greedy reordering: always emit the best scoring triangle among those using
+// cached vertices, which keeps the working set inside the vertex cache
+void optimizeTriangleOrder(vtkIdType* triangles, vtkIdType count, int size)
+{
+    // Number the vertices of the chunk densely
+    std::vector<vtkIdType> vertices(triangles, triangles + 3 * count);
+    std::sort(vertices.begin(), vertices.end());
+    vertices.erase(
+        std::unique(vertices.begin(), vertices.end()),
+        vertices.end()
+        );
+    std::vector<int> corners(3 * count);
+    for (vtkIdType i = 0; i < 3 * count; ++i) {
+        corners[i] = static_cast<int>(
+            std::lower_bound(vertices.begin(), vertices.end(), triangles[i])
+            - vertices.begin()
+            );
+    }
+
+    // Triangles of every vertex, the first remaining[v] are not emitted yet
+    const std::size_t vertex_count = vertices.size();
+    std::vector<int> remaining(vertex_count, 0);
+    for (int corner : corners) {
+        ++remaining[corner];
+    }
+    std::vector<int> offsets(vertex_count + 1, 0);
+    for (std::size_t v = 0; v < vertex_count; ++v) {
+        offsets[v + 1] = offsets[v] + remaining[v];
+    }
+    std::vector<int> adjacency(3 * count);
+    std::vector<int> fill(offsets.begin(), offsets.end() - 1);
+    for (vtkIdType t = 0; t < count; ++t) {
+        for (int k = 0; k < 3; ++k) {
+            adjacency[fill[corners[3 * t + k]]++] = static_cast<int>(t);
+        }
+    }
+
+    std::vector<int> cache_position(vertex_count, -1);
+    std::vector<double> scores(vertex_count);
+    for (std::size_t v = 0; v < vertex_count; ++v) {
+        scores[v] = vertexScore(-1, remaining[v], size);
+    }
+    std::vector<double> triangle_scores(count);
+    std::vector<char> emitted(count, 0);
+    vtkIdType best = 0;
+    for (vtkIdType t = 0; t < count; ++t) {
+        triangle_scores[t] = scores[corners[3 * t]]
+            + scores[corners[3 * t + 1]] + scores[corners[3 * t + 2]];
+        if (triangle_scores[t] > triangle_scores[best]) {
+            best = t;
+        }
+    }
+
+    std::vector<int> cache;
+    std::vector<int> next_cache;
+    std::vector<vtkIdType> order;
+    order.reserve(3 * count);
+    vtkIdType cursor = 0;
+    for (vtkIdType n = 0; n < count; ++n) {
+        if (best < 0) {
+            while (emitted[cursor]) {
+                ++cursor;
+            }
+            best = cursor;
+        }
+        emitted[best] = 1;
+
+        next_cache.clear();
+        for (int k = 0; k < 3; ++k) {
+            const int v = corners[3 * best + k];
+            order.push_back(vertices[v]);
+
+            int* first = adjacency.data() + offsets[v];
+            int* last = first + remaining[v];
+            std::iter_swap(std::find(first, last, int(best)), last - 1);
+            --remaining[v];
+            if (std::find(next_cache.begin(), next_cache.end(), v)
+                == next_cache.end()) {
+                next_cache.push_back(v);
+            }
+        }
+        const std::size_t corner_count = next_cache.size();
+        for (int v : cache) {
+            const auto corners_end = next_cache.begin() + corner_count;
+            if (std::find(next_cache.begin(), corners_end, v)
+                == corners_end) {
+                next_cache.push_back(v);
+            }
+        }
+
+        for (std::size_t i = 0; i < next_cache.size(); ++i) {
+            const int v = next_cache[i];
+            cache_position[v] = i < std::size_t(size) ? int(i) : -1;
+            scores[v] = vertexScore(cache_position[v], remaining[v], size);
+        }
+
+        best = -1;
+        double best_score = -1.0;
+        for (int v : next_cache) {
+            for (int i = offsets[v]; i < offsets[v] + remaining[v]; ++i) {
+                const int t = adjacency[i];
+                triangle_scores[t] = scores[corners[3 * t]]
+                    + scores[corners[3 * t + 1]]
+                    + scores[corners[3 * t + 2]];
+                if (triangle_scores[t] > best_score) {
+                    best_score = triangle_scores[t];
+                    best = t;
+                }
+            }
+        }
+
+        if (next_cache.size() > std::size_t(size)) {
+            next_cache.resize(size);
+        }
+        cache.swap(next_cache);
+    }
+
+    std::copy(order.begin(), order.end(), triangles);
+}
+
+// Vertex shader invocations per triangle with a FIFO cache
+double averageCacheMissRatio(
+    const std::vector<vtkIdType>& triangles,
+    int size
+    )
+{
+    if (triangles.empty()) {
+        return 0.0;
+    }
+
+    std::vector<vtkIdType> fifo(size, -1);
+    std::size_t head = 0;
+    std::size_t misses = 0;
+    for (vtkIdType vertex : triangles) {
+        if (std::find(fifo.begin(), fifo.end(), vertex) == fifo.end()) {
+            fifo[head] = vertex;
+            head = (head + 1) % fifo.size();
+            ++misses;
+        }
+    }
+
+    return double(misses) / double(triangles.size() / 3);
+}
+
+// Maps every point to the lowest numbered point with the same (quantized)
+// coordinates
+std::vector<vtkIdType> mergePoints(
+    const std::vector<double>& xyz,
+    double tolerance
+    )
+{
+    const vtkIdType count = static_cast<vtkIdType>(xyz.size() / 3);
+    std::vector<std::array<double, 3>> keys(count);
+    vtkSMPTools::For(0, count, [&](vtkIdType begin, vtkIdType end) {
+        for (vtkIdType i = begin; i < end; ++i) {
+            for (int c = 0; c < 3; ++c) {
+                keys[i][c] = tolerance > 0.0
+                    ? std::floor(xyz[3 * i + c] / tolerance)
+                    : xyz[3 * i + c];
+            }
+        }
+    });
+
+    std::vector<vtkIdType> order(count);
+    for (vtkIdType i = 0; i < count; ++i) {
+        order[i] = i;
+    }
+    vtkSMPTools::Sort(
+        order.begin(),
+        order.end(),
+        [&keys](vtkIdType a, vtkIdType b) {
+            return keys[a] != keys[b] ? keys[a] < keys[b] : a < b;
+        }
+        );
+
+    std::vector<vtkIdType> representative(count);
+    for (vtkIdType k = 0; k < count; ++k) {
+        const bool duplicate = k > 0 && keys[order[k]] == keys[order[k - 1]];
+        representative[order[k]] = duplicate
+            ? representative[order[k - 1]]
+            : order[k];
+    }
+
+    return representative;
+}
+
+std::uint64_t fnv1a(std::uint64_t hash, const void* data, std::size_t size)
+{
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (std::size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+// Cache file name for a mesh file and option set, empty if the file cannot
+// be inspected
+std::string cacheFileName(
+    const std::string& path,
+    const MeshPreprocessOptions& options
+    )
+{
+    std::error_code error;
+    const std::string absolute = fs::absolute(path, error).string();
+    const std::uintmax_t size = fs::file_size(path, error);
+    if (error) {
+        return std::string();
+    }
+    const auto modified = fs::last_write_time(path, error)
+        .time_since_epoch().count();
+    if (error) {
+        return std::string();
+    }
+
+    std::uint64_t hash = 14695981039346656037ULL;
+    hash = fnv1a(hash, kCacheVersion, std::strlen(kCacheVersion));
+    hash = fnv1a(hash, absolute.data(), absolute.size());
+    hash = fnv1a(hash, &size, sizeof(size));
+    hash = fnv1a(hash, &modified, sizeof(modified));
+    const int flags = (options.merge_points ? 1 : 0)
+        | (options.compute_normals ? 2 : 0)
+        | (options.optimize_cache ? 4 : 0)
+        | (options.build_strips ? 8 : 0);
+    hash = fnv1a(hash, &flags, sizeof(flags));
+    hash = fnv1a(
+        hash, &options.merge_tolerance, sizeof(options.merge_tolerance)
+        );
+    hash = fnv1a(hash, &options.cache_size, sizeof(options.cache_size));
+
+    char name[32];
+    std::snprintf(
+        name, sizeof(name), "%016llx.vtp", (unsigned long long)hash
+        );
+    return name;
+}
+
+template <typename Reader>
+vtkSmartPointer<vtkPolyData> readWith(const std::string& path)
+{
+    auto reader = vtkSmartPointer<Reader>::New();
+    reader->SetFileName(path.c_str());
+    reader->Update();
+
+    // Keep only the mesh, not the reader
+    auto mesh = vtkSmartPointer<vtkPolyData>::New();
+    mesh->ShallowCopy(reader->GetOutput());
+    return mesh;
+}
+
+}  // namespace
+
+
+// ============================================================================
+// Function Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// preprocessMesh
+// ----------------------------------------------------------------------------
+//
+// Description: See MeshPreprocessor.h
+//
+// ----------------------------------------------------------------------------
+vtkSmartPointer<vtkPolyData> preprocessMesh(
+    vtkPolyData* input,
+    const MeshPreprocessOptions& options,
+    MeshPreprocessStats* stats
+    )
+{
+    if (input == nullptr || input->GetNumberOfPoints() == 0
+        || input->GetNumberOfPolys() + input->GetNumberOfStrips() == 0) {
+        return nullptr;
+    }
+    const auto start = std::chrono::steady_clock::now();
+    const int cache_size = std::max(4, options.cache_size);
+
+    // Triangulate polygons and strips (serial, VTK has no SMP version)
+    vtkSmartPointer<vtkPolyData> mesh = input;
+    if (input->GetNumberOfStrips() > 0
+        || input->GetPolys()->IsHomogeneous() != 3) {
+        auto triangulate = vtkSmartPointer<vtkTriangleFilter>::New();
+        triangulate->SetInputData(input);
+        triangulate->PassVertsOff();
+        triangulate->PassLinesOff();
+        triangulate->Update();
+        mesh = triangulate->GetOutput();
+    }
+
+    std::vector<vtkIdType> triangles;
+    triangles.reserve(3 * mesh->GetNumberOfPolys());
+    auto cells = vtk::TakeSmartPointer(mesh->GetPolys()->NewIterator());
+    for (cells->GoToFirstCell();
+         !cells->IsDoneWithTraversal();
+         cells->GoToNextCell()) {
+        vtkIdType size;
+        const vtkIdType* ids;
+        cells->GetCurrentCell(size, ids);
+        if (size == 3) {
+            triangles.insert(triangles.end(), ids, ids + 3);
+        }
+    }
+
+    const vtkIdType point_count = mesh->GetNumberOfPoints();
+    vtkPoints* points = mesh->GetPoints();
+    std::vector<double> xyz(3 * point_count);
+    vtkSMPTools::For(0, point_count, [&](vtkIdType begin, vtkIdType end) {
+        for (vtkIdType i = begin; i < end; ++i) {
+            points->GetPoint(i, &xyz[3 * i]);
+        }
+    });
+    const double acmr_before = averageCacheMissRatio(triangles, cache_size);
+
+    // Merge duplicate points and drop the triangles that collapse
+    if (options.merge_points) {
+        const std::vector<vtkIdType> representative =
+            mergePoints(xyz, options.merge_tolerance);
+        vtkSMPTools::For(
+            0,
+            static_cast<vtkIdType>(triangles.size()),
+            [&](vtkIdType begin, vtkIdType end) {
+                for (vtkIdType i = begin; i < end; ++i) {
+                    triangles[i] = representative[triangles[i]];
+                }
+            });
+    }
+    std::size_t kept = 0;
+    for (std::size_t t = 0; t < triangles.size(); t += 3) {
+        const vtkIdType a = triangles[t];
+        const vtkIdType b = triangles[t + 1];
+        const vtkIdType c = triangles[t + 2];
+        if (a != b && b != c && a != c) {
+            triangles[kept++] = a;
+            triangles[kept++] = b;
+            triangles[kept++] = c;
+        }
+    }
+    triangles.resize(kept);
+    const vtkIdType triangle_count =
+        static_cast<vtkIdType>(triangles.size() / 3);
+    if (triangle_count == 0) {
+        return nullptr;
+    }
+
+    // Reorder triangles for the vertex cache, chunks in parallel
+    if (options.optimize_cache) {
+        const vtkIdType chunks =
+            (triangle_count + kReorderChunkTriangles - 1)
+            / kReorderChunkTriangles;
+        vtkSMPTools::For(0, chunks, 1, [&](vtkIdType begin, vtkIdType end) {
+            for (vtkIdType chunk = begin; chunk < end; ++chunk) {
+                const vtkIdType first = chunk * kReorderChunkTriangles;
+                const vtkIdType count = std::min(
+                    kReorderChunkTriangles, triangle_count - first
+                    );
+                optimizeTriangleOrder(
+                    triangles.data() + 3 * first, count, cache_size
+                    );
+            }
+        });
+    }
+
+    // Number the used points by first use, so vertex fetches follow the
+    // triangle order
+    std::vector<vtkIdType> new_id(point_count, -1);
+    std::vector<vtkIdType> old_id;
+    old_id.reserve(point_count);
+    for (vtkIdType& vertex : triangles) {
+        if (new_id[vertex] < 0) {
+            new_id[vertex] = static_cast<vtkIdType>(old_id.size());
+            old_id.push_back(vertex);
+        }
+        vertex = new_id[vertex];
+    }
+    const vtkIdType output_count = static_cast<vtkIdType>(old_id.size());
+
+    auto output = vtkSmartPointer<vtkPolyData>::New();
+    auto output_points = vtkSmartPointer<vtkPoints>::New();
+    output_points->SetDataType(points->GetDataType());
+    output_points->SetNumberOfPoints(output_count);
+    vtkSMPTools::For(0, output_count, [&](vtkIdType begin, vtkIdType end) {
+        for (vtkIdType i = begin; i < end; ++i) {
+            output_points->SetPoint(i, &xyz[3 * old_id[i]]);
+        }
+    });
+    output->SetPoints(output_points);
+
+    auto offsets = vtkSmartPointer<vtkIdTypeArray>::New();
+    offsets->SetNumberOfValues(triangle_count + 1);
+    auto connectivity = vtkSmartPointer<vtkIdTypeArray>::New();
+    connectivity->SetNumberOfValues(3 * triangle_count);
+    vtkIdType* offset_values = offsets->GetPointer(0);
+    vtkIdType* connectivity_values = connectivity->GetPointer(0);
+    vtkSMPTools::For(0, triangle_count, [&](vtkIdType begin, vtkIdType end) {
+        for (vtkIdType t = begin; t < end; ++t) {
+            offset_values[t] = 3 * t;
+            std::copy(
+                triangles.begin() + 3 * t,
+                triangles.begin() + 3 * t + 3,
+                connectivity_values + 3 * t
+                );
+        }
+    });
+    offset_values[triangle_count] = 3 * triangle_count;
+    auto polys = vtkSmartPointer<vtkCellArray>::New();
+    polys->SetData(offsets, connectivity);
+    output->SetPolys(polys);
+
+    // Point attributes come from the representative point (serial, the
+    // attribute copy is not thread safe)
+    vtkPointData* input_data = mesh->GetPointData();
+    vtkPointData* output_data = output->GetPointData();
+    if (options.compute_normals) {
+        output_data->CopyNormalsOff();
+    }
+    output_data->CopyAllocate(input_data, output_count);
+    for (vtkIdType i = 0; i < output_count; ++i) {
+        output_data->CopyData(input_data, old_id[i], i);
+    }
+
+    // Area weighted point normals: face normals, then a gather per point
+    if (options.compute_normals) {
+        std::vector<double> face_normals(3 * triangle_count);
+        std::vector<double> positions(3 * output_count);
+        vtkSMPTools::For(0, output_count, [&](vtkIdType b, vtkIdType e) {
+            for (vtkIdType i = b; i < e; ++i) {
+                std::copy_n(&xyz[3 * old_id[i]], 3, &positions[3 * i]);
+            }
+        });
+        vtkSMPTools::For(0, triangle_count, [&](vtkIdType b, vtkIdType e) {
+            for (vtkIdType t = b; t < e; ++t) {
+                const double* p0 = &positions[3 * triangles[3 * t]];
+                const double* p1 = &positions[3 * triangles[3 * t + 1]];
+                const double* p2 = &positions[3 * triangles[3 * t + 2]];
+                const double u[3] = {p1[0] - p0[0], p1[1] - p0[1],
+                                     p1[2] - p0[2]};
+                const double v[3] = {p2[0] - p0[0], p2[1] - p0[1],
+                                     p2[2] - p0[2]};
+                face_normals[3 * t] = u[1] * v[2] - u[2] * v[1];
+                face_normals[3 * t + 1] = u[2] * v[0] - u[0] * v[2];
+                face_normals[3 * t + 2] = u[0] * v[1] - u[1] * v[0];
+            }
+        });
+
+        std::vector<vtkIdType> first(output_count + 1, 0);
+        for (vtkIdType vertex : triangles) {
+            ++first[vertex + 1];
+        }
+        for (vtkIdType i = 0; i < output_count; ++i) {
+            first[i + 1] += first[i];
+        }
+        std::vector<vtkIdType> faces(triangles.size());
+        std::vector<vtkIdType> fill(first.begin(), first.end() - 1);
+        for (std::size_t i = 0; i < triangles.size(); ++i) {
+            faces[fill[triangles[i]]++] = static_cast<vtkIdType>(i / 3);
+        }
+
+        auto normals = vtkSmartPointer<vtkFloatArray>::New();
+        normals->SetName("Normals");
+        normals->SetNumberOfComponents(3);
+        normals->SetNumberOfTuples(output_count);
+        float* normal_values = normals->GetPointer(0);
+        vtkSMPTools::For(0, output_count, [&](vtkIdType b, vtkIdType e) {
+            for (vtkIdType i = b; i < e; ++i) {
+                double sum[3] = {0.0, 0.0, 0.0};
+                for (vtkIdType f = first[i]; f < first[i + 1]; ++f) {
+                    for (int c = 0; c < 3; ++c) {
+                        sum[c] += face_normals[3 * faces[f] + c];
+                    }
+                }
+                const double length = std::sqrt(
+                    sum[0] * sum[0] + sum[1] * sum[1] + sum[2] * sum[2]
+                    );
+                for (int c = 0; c < 3; ++c) {
+                    normal_values[3 * i + c] = length > 0.0
+                        ? static_cast<float>(sum[c] / length)
+                        : 0.0f;
+                }
+            }
+        });
+        output_data->SetNormals(normals);
+    }
+
+    if (stats != nullptr) {
+        stats->input_points = input->GetNumberOfPoints();
+        stats->output_points = output_count;
+        stats->triangles = triangle_count;
+        stats->acmr_before = acmr_before;
+        stats->acmr_after = averageCacheMissRatio(triangles, cache_size);
+    }
+
+    // Strips cut the index count further on old fixed function hardware
+    if (options.build_strips) {
+        auto stripper = vtkSmartPointer<vtkStripper>::New();
+        stripper->SetInputData(output);
+        stripper->Update();
+        output = stripper->GetOutput();
+    }
+
+    if (stats != nullptr) {
+        stats->seconds = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start
+            ).count();
+    }
+
+    return output;
+}
+
+// ----------------------------------------------------------------------------
+// readMesh
+// ----------------------------------------------------------------------------
+//
+// Description: Reads a mesh file, choosing the reader by file extension
+//
+// Inputs:
+// - path: The mesh file
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: The mesh, null on failure
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+vtkSmartPointer<vtkPolyData> readMesh(
+    const std::string& path,
+    std::string* error
+    )
+{
+    std::string extension = fs::path(path).extension().string();
+    std::transform(
+        extension.begin(),
+        extension.end(),
+        extension.begin(),
+        [](unsigned char c) { return static_cast<char>(std::tolower(c)); }
+        );
+
+    vtkSmartPointer<vtkPolyData> mesh;
+    if (extension == ".stl") {
+        mesh = readWith<vtkSTLReader>(path);
+    } else if (extension == ".obj") {
+        mesh = readWith<vtkOBJReader>(path);
+    } else if (extension == ".ply") {
+        mesh = readWith<vtkPLYReader>(path);
+    } else if (extension == ".vtp") {
+        mesh = readWith<vtkXMLPolyDataReader>(path);
+    } else if (extension == ".vtk") {
+        mesh = readWith<vtkPolyDataReader>(path);
+    } else {
+        if (error != nullptr) {
+            *error = "No mesh reader for '" + path + "'";
+        }
+        return nullptr;
+    }
+
+    if (mesh->GetNumberOfPoints() == 0) {
+        if (error != nullptr) {
+            *error = "Failed to read '" + path + "'";
+        }
+        return nullptr;
+    }
+
+    return mesh;
+}
+
+// ----------------------------------------------------------------------------
+// loadPreprocessedMesh
+// ----------------------------------------------------------------------------
+//
+// Description: See MeshPreprocessor.h
+//
+// ----------------------------------------------------------------------------
+vtkSmartPointer<vtkPolyData> loadPreprocessedMesh(
+    const std::string& path,
+    const std::string& cache_dir,
+    const MeshPreprocessOptions& options,
+    MeshPreprocessStats* stats,
+    std::string* error
+    )
+{
+    const auto start = std::chrono::steady_clock::now();
+    auto elapsed = [&start]() {
+        return std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start
+            ).count();
+    };
+
+    fs::path cache_path;
+    if (!cache_dir.empty()) {
+        const std::string name = cacheFileName(path, options);
+        if (!name.empty()) {
+            cache_path = fs::path(cache_dir) / name;
+        }
+    }
+
+    std::error_code status;
+    if (!cache_path.empty() && fs::exists(cache_path, status)) {
+        vtkSmartPointer<vtkPolyData> cached =
+            readWith<vtkXMLPolyDataReader>(cache_path.string());
+        if (cached->GetNumberOfPoints() > 0) {
+            if (stats != nullptr) {
+                *stats = MeshPreprocessStats();
+                stats->output_points = cached->GetNumberOfPoints();
+                stats->triangles = cached->GetNumberOfCells();
+                stats->cache_hit = true;
+                stats->seconds = elapsed();
+            }
+            return cached;
+        }
+    }
+
+    vtkSmartPointer<vtkPolyData> mesh = readMesh(path, error);
+    if (!mesh) {
+        return nullptr;
+    }
+    vtkSmartPointer<vtkPolyData> result =
+        preprocessMesh(mesh, options, stats);
+    if (!result) {
+        if (error != nullptr) {
+            *error = "'" + path + "' has no surface triangles";
+        }
+        return nullptr;
+    }
+
+    // Write under a temporary name first, so concurrent loads never read a
+    // partial cache file. A failed write only costs the next load time.
+    if (!cache_path.empty()) {
+        fs::create_directories(cache_dir, status);
+        const std::string partial = cache_path.string() + "."
+            + std::to_string(
+                std::hash<std::thread::id>()(std::this_thread::get_id())
+                );
+        auto writer = vtkSmartPointer<vtkXMLPolyDataWriter>::New();
+        writer->SetFileName(partial.c_str());
+        writer->SetInputData(result);
+        writer->SetDataModeToAppended();
+        writer->SetCompressorTypeToLZ4();
+        const bool written = writer->Write() == 1;
+        if (written) {
+            fs::rename(partial, cache_path, status);
+        }
+        if (!written || status) {
+            fs::remove(partial, status);
+        }
+    }
+
+    if (stats != nullptr) {
+        stats->seconds = elapsed();
+    }
+
+    return result;
+}
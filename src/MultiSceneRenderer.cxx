@@ -0,0 +1,248 @@
+// ============================================================================
+// MultiSceneRenderer.cxx - Implementation of the MultiSceneRenderer class
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * MultiSceneRenderer.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header -------------------------------------------------------------
+#include "MultiSceneRenderer.h"
+
+// "C" system headers ---------------------------------------------------------
+
+// Standard Library headers ---------------------------------------------------
+#include <algorithm>
+#include <chrono>
+#include <memory>
+
+
+// ============================================================================
+// Constructor/Destructor Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// MultiSceneRenderer::MultiSceneRenderer
+// ----------------------------------------------------------------------------
+//
+// Description: Constructor. Starts the worker threads.
+//
+// Inputs:
+// - thread_count: Number of worker threads, 0 to use one per hardware thread
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+MultiSceneRenderer::MultiSceneRenderer(int thread_count)
+    : jobs(nullptr),
+      results(nullptr),
+      active_workers(0),
+      batch(0),
+      stopping(false),
+      next_job(0)
+{
+    if (thread_count <= 0) {
+        thread_count = static_cast<int>(
+            std::max(1U, std::thread::hardware_concurrency())
+            );
+    }
+
+    for (int i = 0; i < thread_count; ++i) {
+        this->workers.emplace_back(&MultiSceneRenderer::workerLoop, this, i);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// MultiSceneRenderer::~MultiSceneRenderer
+// ----------------------------------------------------------------------------
+//
+// Description: Destructor
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Stops and joins the worker threads
+//
+// ----------------------------------------------------------------------------
+MultiSceneRenderer::~MultiSceneRenderer()
+{
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->stopping = true;
+    }
+    this->work_ready.notify_all();
+
+    for (auto& worker : this->workers) {
+        worker.join();
+    }
+}
+
+
+// ============================================================================
+// Public Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// MultiSceneRenderer::render
+// ----------------------------------------------------------------------------
+//
+// Description: Renders a batch of scenes on the worker threads and waits
+//              until all of them are done
+//
+// Inputs:
+// - jobs: The scenes to render
+//
+// Outputs: None
+//
+// Returns: One result per job, in job order
+//
+// Side Effects: Writes the PNG files requested by the jobs
+//
+// ----------------------------------------------------------------------------
+std::vector<SceneResult> MultiSceneRenderer::render(
+    const std::vector<SceneJob>& jobs
+    )
+{
+    std::vector<SceneResult> batch_results(jobs.size());
+    if (jobs.empty()) {
+        return batch_results;
+    }
+
+    std::unique_lock<std::mutex> lock(this->mutex);
+    this->jobs = &jobs;
+    this->results = &batch_results;
+    this->next_job = 0;
+    this->active_workers = this->workers.size();
+    ++this->batch;
+    this->work_ready.notify_all();
+
+    this->work_done.wait(lock, [this]() {
+        return this->active_workers == 0;
+    });
+    this->jobs = nullptr;
+    this->results = nullptr;
+
+    return batch_results;
+}
+
+
+// ============================================================================
+// Private Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// MultiSceneRenderer::workerLoop
+// ----------------------------------------------------------------------------
+//
+// Description: Body of a worker thread. Waits for a batch, then keeps taking
+//              jobs until the batch is exhausted. The offscreen scene is
+//              created on first use and reused for every later job.
+//
+// Inputs:
+// - index: Index of the worker, reported in the results
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void MultiSceneRenderer::workerLoop(int index)
+{
+    using Clock = std::chrono::steady_clock;
+
+    std::unique_ptr<OffscreenScene> scene;
+    std::vector<unsigned char> pixels;
+    std::uint64_t seen_batch = 0;
+
+    while (true) {
+        const std::vector<SceneJob>* batch_jobs = nullptr;
+        std::vector<SceneResult>* batch_results = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            this->work_ready.wait(lock, [this, seen_batch]() {
+                return this->stopping || this->batch != seen_batch;
+            });
+            if (this->stopping) {
+                break;
+            }
+            seen_batch = this->batch;
+            batch_jobs = this->jobs;
+            batch_results = this->results;
+        }
+
+        for (std::size_t i = this->next_job++;
+             i < batch_jobs->size();
+             i = this->next_job++) {
+            const SceneJob& job = (*batch_jobs)[i];
+            SceneResult& result = (*batch_results)[i];
+            const auto started = Clock::now();
+
+            if (!scene) {
+                scene = std::make_unique<OffscreenScene>(
+                    job.width,
+                    job.height
+                    );
+            } else {
+                scene->setSize(job.width, job.height);
+            }
+            scene->setScene(job.scene);
+
+            if (job.output_path.empty()) {
+                int width = 0;
+                int height = 0;
+                scene->capture(pixels, width, height);
+                result.success = !pixels.empty();
+            } else {
+                result.success = scene->writePng(job.output_path);
+            }
+
+            result.seconds = std::chrono::duration<double>(
+                Clock::now() - started
+                ).count();
+            result.worker = index;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            if (--this->active_workers == 0) {
+                this->work_done.notify_all();
+            }
+        }
+    }
+}
@@ -0,0 +1,163 @@
+// ============================================================================
+// MultiSceneRenderer.h - Renders independent scenes concurrently
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * MultiSceneRenderer.h: created.
+//
+// ============================================================================
+
+
+#ifndef MultiSceneRenderer_H
+#define MultiSceneRenderer_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// "C" system headers
+
+// Standard Library headers
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Project headers
+#include "Scene.h"
+
+
+// ============================================================================
+// Structure Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// SceneJob
+// ----------------------------------------------------------------------------
+//
+// Description: One scene to render
+//
+// Properties:
+// - scene: Parameters of the scene
+// - width: Frame width in pixels
+// - height: Frame height in pixels
+// - output_path: PNG file to write. If empty the frame is only rendered and
+//                read back, which is what benchmarks want.
+//
+// ----------------------------------------------------------------------------
+struct SceneJob {
+    SceneDescription scene;
+    int width = 800;
+    int height = 600;
+    std::string output_path;
+};
+
+// ----------------------------------------------------------------------------
+// SceneResult
+// ----------------------------------------------------------------------------
+//
+// Description: Outcome of one SceneJob
+//
+// Properties:
+// - success: Whether the frame was rendered (and written)
+// - seconds: Wall clock time spent on the job
+// - worker: Index of the worker thread that ran the job
+//
+// ----------------------------------------------------------------------------
+struct SceneResult {
+    bool success = false;
+    double seconds = 0.0;
+    int worker = -1;
+};
+
+
+// ============================================================================
+// Class Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// MultiSceneRenderer
+// ----------------------------------------------------------------------------
+//
+// Description: A fixed pool of worker threads, each owning an OffscreenScene
+//              and therefore its own render window and OpenGL context. Jobs
+//              of a batch are handed out dynamically through an atomic
+//              counter, so cheap and expensive scenes balance out. Contexts
+//              live as long as the pool, so their creation cost is paid once
+//              and not per scene.
+//
+// Properties:
+// - workers: The worker threads
+// - jobs: Jobs of the current batch
+// - results: Results of the current batch, one per job
+// - next_job: Index of the next job to hand out
+// - active_workers: Workers still busy with the current batch
+// - batch: Number of the current batch
+//
+// Methods:
+// - render: Renders a batch of jobs and waits for all of them
+// - threadCount: Returns the number of worker threads
+//
+// Example usage:
+//   MultiSceneRenderer pool(8);
+//   std::vector<SceneJob> jobs(100);
+//   std::vector<SceneResult> results = pool.render(jobs);
+//
+// ----------------------------------------------------------------------------
+class MultiSceneRenderer
+{
+public:
+    // Constructor/Destructor
+    explicit MultiSceneRenderer(int thread_count = 0);  // 0: one per core
+    ~MultiSceneRenderer();
+
+    MultiSceneRenderer(const MultiSceneRenderer&) = delete;
+    MultiSceneRenderer& operator=(const MultiSceneRenderer&) = delete;
+
+    std::vector<SceneResult> render(const std::vector<SceneJob>& jobs);
+    int threadCount() const { return static_cast<int>(this->workers.size()); }
+
+private:
+    void workerLoop(int index);
+
+    std::vector<std::thread> workers;
+
+    // Guarded by mutex
+    std::mutex mutex;
+    std::condition_variable work_ready;
+    std::condition_variable work_done;
+    const std::vector<SceneJob>* jobs;
+    std::vector<SceneResult>* results;
+    std::size_t active_workers;
+    std::uint64_t batch;
+    bool stopping;
+
+    std::atomic<std::size_t> next_job;
+};
+
+#endif  // MultiSceneRenderer_H
@@ -0,0 +1,521 @@
+// ============================================================================
+// ParameterSweep.cxx - Implementation of the parameter sweep renderer
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * ParameterSweep.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header -------------------------------------------------------------
+#include "ParameterSweep.h"
+#include "Scene.h"
+
+// "C" system headers ---------------------------------------------------------
+
+// Standard Library headers ---------------------------------------------------
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <thread>
+
+// External libraries headers -------------------------------------------------
+
+// VTK headers
+#include <vtkActor.h>
+#include <vtkActorCollection.h>
+#include <vtkCamera.h>
+#include <vtkColorTransferFunction.h>
+#include <vtkLookupTable.h>
+#include <vtkMatrix4x4.h>
+#include <vtkPolyData.h>
+#include <vtkPolyDataMapper.h>
+#include <vtkProperty.h>
+#include <vtkSmartPointer.h>
+
+
+// ============================================================================
+// Local helpers section
+// ============================================================================
+
+namespace {
+
+// Control points (position, r, g, b) of the sweep colormaps
+struct ColormapPoint {
+    double x, r, g, b;
+};
+
+const std::map<std::string, std::vector<ColormapPoint>>& colormapTable()
+{
+    static const std::map<std::string, std::vector<ColormapPoint>> table = {
+        {"gray", {{0.0, 0.0, 0.0, 0.0}, {1.0, 1.0, 1.0, 1.0}}},
+        {"rainbow", {
+            {0.0, 0.0, 0.0, 1.0}, {0.25, 0.0, 1.0, 1.0},
+            {0.5, 0.0, 1.0, 0.0}, {0.75, 1.0, 1.0, 0.0},
+            {1.0, 1.0, 0.0, 0.0}}},
+        {"coolwarm", {
+            {0.0, 0.230, 0.299, 0.754}, {0.5, 0.865, 0.865, 0.865},
+            {1.0, 0.706, 0.016, 0.150}}},
+        {"hot", {
+            {0.0, 0.0, 0.0, 0.0}, {0.4, 0.9, 0.0, 0.0},
+            {0.8, 1.0, 0.9, 0.0}, {1.0, 1.0, 1.0, 1.0}}},
+        {"viridis", {
+            {0.0, 0.267, 0.005, 0.329}, {0.25, 0.229, 0.322, 0.546},
+            {0.5, 0.128, 0.567, 0.551}, {0.75, 0.369, 0.789, 0.383},
+            {1.0, 0.993, 0.906, 0.144}}}
+    };
+    return table;
+}
+
+vtkSmartPointer<vtkLookupTable> makeColormap(const std::string& name)
+{
+    auto function = vtkSmartPointer<vtkColorTransferFunction>::New();
+    for (const ColormapPoint& point : colormapTable().at(name)) {
+        function->AddRGBPoint(point.x, point.r, point.g, point.b);
+    }
+
+    auto table = vtkSmartPointer<vtkLookupTable>::New();
+    table->SetNumberOfTableValues(256);
+    for (int i = 0; i < 256; ++i) {
+        double rgb[3];
+        function->GetColor(i / 255.0, rgb);
+        table->SetTableValue(i, rgb[0], rgb[1], rgb[2], 1.0);
+    }
+    table->Build();
+
+    return table;
+}
+
+// An actor of the scene with the pipeline output it shows
+struct SweepActor {
+    vtkActor* actor = nullptr;
+    vtkPolyDataMapper* mapper = nullptr;
+    vtkPolyData* data = nullptr;
+};
+
+// What a worker renders: copies of the actors over shallow copies of the
+// pipeline outputs. Mappers shared by several actors stay shared.
+struct WorkerScene {
+    std::vector<vtkSmartPointer<vtkActor>> actors;
+    std::map<vtkPolyDataMapper*, vtkSmartPointer<vtkPolyDataMapper>> mappers;
+    std::map<std::string, vtkSmartPointer<vtkLookupTable>> colormaps;
+    vtkSmartPointer<vtkCamera> camera;
+};
+
+vtkSmartPointer<vtkPolyDataMapper> copyMapper(
+    vtkPolyDataMapper* source,
+    vtkPolyData* data
+    )
+{
+    // Each worker reads the arrays through its own data object, so lazily
+    // built caches (bounds, cells) are never shared between threads
+    auto input = vtkSmartPointer<vtkPolyData>::New();
+    input->ShallowCopy(data);
+
+    auto mapper = vtkSmartPointer<vtkPolyDataMapper>::New();
+    mapper->SetInputData(input);
+    mapper->SetScalarVisibility(source->GetScalarVisibility());
+    mapper->SetScalarMode(source->GetScalarMode());
+    mapper->SetColorMode(source->GetColorMode());
+    mapper->SetScalarRange(source->GetScalarRange());
+    mapper->SetUseLookupTableScalarRange(
+        source->GetUseLookupTableScalarRange()
+        );
+    mapper->SetInterpolateScalarsBeforeMapping(
+        source->GetInterpolateScalarsBeforeMapping()
+        );
+    mapper->SelectColorArray(source->GetArrayName());
+    if (vtkScalarsToColors* table = source->GetLookupTable()) {
+        vtkSmartPointer<vtkScalarsToColors> copy;
+        copy.TakeReference(table->NewInstance());
+        copy->DeepCopy(table);
+        mapper->SetLookupTable(copy);
+    }
+
+    return mapper;
+}
+
+// Copies the actors for one worker
+void copyScene(
+    const std::vector<SweepActor>& actors,
+    vtkCamera* camera,
+    WorkerScene* scene
+    )
+{
+    for (const SweepActor& source : actors) {
+        auto& mapper = scene->mappers[source.mapper];
+        if (!mapper) {
+            mapper = copyMapper(source.mapper, source.data);
+        }
+
+        auto property = vtkSmartPointer<vtkProperty>::New();
+        property->DeepCopy(source.actor->GetProperty());
+        auto matrix = vtkSmartPointer<vtkMatrix4x4>::New();
+        matrix->DeepCopy(source.actor->GetMatrix());
+
+        auto actor = vtkSmartPointer<vtkActor>::New();
+        actor->SetMapper(mapper);
+        actor->SetProperty(property);
+        actor->SetUserMatrix(matrix);
+        scene->actors.push_back(actor);
+    }
+
+    scene->camera = vtkSmartPointer<vtkCamera>::New();
+    scene->camera->DeepCopy(camera);
+}
+
+// Applies the colormap of a point to the mappers that color by scalars
+void applyColormap(WorkerScene* scene, const std::string& name)
+{
+    if (name.empty()) {
+        return;
+    }
+
+    auto& table = scene->colormaps[name];
+    if (!table) {
+        table = makeColormap(name);
+    }
+    for (auto& entry : scene->mappers) {
+        vtkPolyDataMapper* mapper = entry.second;
+        if (!mapper->GetScalarVisibility()) {
+            continue;
+        }
+        if (mapper->GetLookupTable() != table) {
+            mapper->SetLookupTable(table);
+            mapper->UseLookupTableScalarRangeOff();
+            mapper->SetScalarRange(mapper->GetInput()->GetScalarRange());
+        }
+    }
+}
+
+}  // namespace
+
+
+// ============================================================================
+// Function Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// parseSweepValues
+// ----------------------------------------------------------------------------
+//
+// Description: Parses a list or a range of sweep values
+//
+// Inputs:
+// - text: "a,b,c" or "first:last:count"
+//
+// Outputs:
+// - values: The values, in order
+//
+// Returns: true on success, false if text is neither form
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool parseSweepValues(const std::string& text, std::vector<double>* values)
+{
+    values->clear();
+
+    auto number = [](const std::string& item, double* value) {
+        std::size_t used = 0;
+        try {
+            *value = std::stod(item, &used);
+        } catch (...) {
+            return false;
+        }
+        return used == item.size();
+    };
+
+    const std::size_t colon = text.find(':');
+    if (colon != std::string::npos) {
+        const std::size_t second = text.find(':', colon + 1);
+        double first = 0.0;
+        double last = 0.0;
+        double count = 0.0;
+        if (second == std::string::npos
+            || !number(text.substr(0, colon), &first)
+            || !number(text.substr(colon + 1, second - colon - 1), &last)
+            || !number(text.substr(second + 1), &count)
+            || count < 1.0 || count != static_cast<int>(count)) {
+            return false;
+        }
+
+        const int steps = static_cast<int>(count);
+        for (int i = 0; i < steps; ++i) {
+            values->push_back(
+                steps == 1 ? first : first + (last - first) * i / (steps - 1)
+                );
+        }
+        return true;
+    }
+
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        double value = 0.0;
+        if (!number(item, &value)) {
+            return false;
+        }
+        values->push_back(value);
+    }
+
+    return !values->empty();
+}
+
+// ----------------------------------------------------------------------------
+// parseSweepSizes
+// ----------------------------------------------------------------------------
+//
+// Description: Parses a list of image sizes
+//
+// Inputs:
+// - text: "800x600,1920x1080"
+//
+// Outputs:
+// - sizes: Width and height pairs, in order
+//
+// Returns: true on success, false for a malformed or non-positive size
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool parseSweepSizes(
+    const std::string& text,
+    std::vector<std::pair<int, int>>* sizes
+    )
+{
+    sizes->clear();
+
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        int width = 0;
+        int height = 0;
+        char separator = 0;
+        char rest = 0;
+        std::stringstream size(item);
+        if (!(size >> width >> separator >> height) || separator != 'x'
+            || (size >> rest) || width < 1 || height < 1) {
+            return false;
+        }
+        sizes->emplace_back(width, height);
+    }
+
+    return !sizes->empty();
+}
+
+// ----------------------------------------------------------------------------
+// sweepColormaps
+// ----------------------------------------------------------------------------
+//
+// Description: Lists the colormaps sweep points can use
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: The colormap names
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+std::vector<std::string> sweepColormaps()
+{
+    std::vector<std::string> names;
+    for (const auto& entry : colormapTable()) {
+        names.push_back(entry.first);
+    }
+    return names;
+}
+
+// ----------------------------------------------------------------------------
+// renderSweep
+// ----------------------------------------------------------------------------
+//
+// Description: Executes the upstream pipelines of the scene once and
+//              renders the sweep points on worker threads
+//
+// Inputs:
+// - scene: The renderer with the scene and the starting view
+// - points: The images to render
+// - thread_count: Number of worker threads, 0 for one per core
+//
+// Outputs:
+// - results: One per point, if not null
+// - stats: What was done, if not null
+// - error: Description of the failure, if not null
+//
+// Returns: true if every image was written, false otherwise
+//
+// Side Effects: Updates the pipelines of the scene's actors and writes the
+//               images
+//
+// ----------------------------------------------------------------------------
+bool renderSweep(
+    vtkRenderer* scene,
+    const std::vector<SweepPoint>& points,
+    int thread_count,
+    std::vector<SweepResult>* results,
+    SweepStats* stats,
+    std::string* error
+    )
+{
+    using Clock = std::chrono::steady_clock;
+    const auto started = Clock::now();
+    SweepStats counts;
+
+    for (const SweepPoint& point : points) {
+        if (!point.colormap.empty()
+            && !colormapTable().count(point.colormap)) {
+            if (error) {
+                *error = "unknown colormap " + point.colormap;
+            }
+            return false;
+        }
+    }
+
+    // Run the upstream pipelines once, here, and keep their outputs
+    std::vector<SweepActor> actors;
+    vtkActorCollection* collection = scene->GetActors();
+    vtkCollectionSimpleIterator iterator;
+    collection->InitTraversal(iterator);
+    while (vtkActor* actor = collection->GetNextActor(iterator)) {
+        if (!actor->GetVisibility()) {
+            continue;
+        }
+        auto mapper = vtkPolyDataMapper::SafeDownCast(actor->GetMapper());
+        if (!mapper) {
+            ++counts.skipped_props;
+            continue;
+        }
+        mapper->Update();
+        vtkPolyData* data = mapper->GetInput();
+        if (!data) {
+            ++counts.skipped_props;
+            continue;
+        }
+        data->GetBounds();
+        actors.push_back({actor, mapper, data});
+    }
+    counts.skipped_props += scene->GetVolumes()->GetNumberOfItems();
+    counts.upstream_seconds = std::chrono::duration<double>(
+        Clock::now() - started).count();
+
+    if (thread_count <= 0) {
+        thread_count = static_cast<int>(std::thread::hardware_concurrency());
+    }
+    thread_count = std::max(1, std::min<int>(
+        thread_count,
+        static_cast<int>(points.size())
+        ));
+
+    // Workers copy the scene before any of them renders
+    std::vector<WorkerScene> copies(thread_count);
+    for (WorkerScene& copy : copies) {
+        copyScene(actors, scene->GetActiveCamera(), &copy);
+    }
+
+    double background[3];
+    scene->GetBackground(background);
+
+    std::vector<SweepResult> outcome(points.size());
+    std::atomic<std::size_t> next_point(0);
+    auto work = [&](int index) {
+        WorkerScene& copy = copies[index];
+        std::unique_ptr<OffscreenScene> window;
+        for (std::size_t i = next_point++;
+             i < points.size();
+             i = next_point++) {
+            const SweepPoint& point = points[i];
+            const auto point_started = Clock::now();
+
+            if (!window) {
+                window = std::make_unique<OffscreenScene>(
+                    point.width,
+                    point.height
+                    );
+                vtkRenderer* renderer = window->renderer();
+                renderer->SetBackground(background);
+                for (const auto& actor : copy.actors) {
+                    renderer->AddActor(actor);
+                }
+            } else {
+                window->setSize(point.width, point.height);
+            }
+
+            vtkRenderer* renderer = window->renderer();
+            vtkCamera* camera = renderer->GetActiveCamera();
+            camera->DeepCopy(copy.camera);
+            camera->Azimuth(point.azimuth);
+            camera->Elevation(point.elevation);
+            camera->OrthogonalizeViewUp();
+            renderer->ResetCameraClippingRange();
+            applyColormap(&copy, point.colormap);
+
+            outcome[i].success = window->writePng(point.output_path);
+            outcome[i].seconds = std::chrono::duration<double>(
+                Clock::now() - point_started).count();
+            outcome[i].worker = index;
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < thread_count; ++i) {
+        workers.emplace_back(work, i);
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    for (std::size_t i = 0; i < outcome.size(); ++i) {
+        if (outcome[i].success) {
+            ++counts.images;
+        } else {
+            ++counts.failed;
+            if (error && counts.failed == 1) {
+                *error = "failed to write " + points[i].output_path;
+            }
+        }
+    }
+    counts.threads = thread_count;
+    counts.seconds = std::chrono::duration<double>(
+        Clock::now() - started).count();
+
+    if (results) {
+        *results = std::move(outcome);
+    }
+    if (stats) {
+        *stats = counts;
+    }
+
+    return counts.failed == 0;
+}
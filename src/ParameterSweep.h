@@ -0,0 +1,177 @@
+// ============================================================================
+// ParameterSweep.h - Batch rendering of one scene under many view settings
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * ParameterSweep.h: created.
+//
+// ============================================================================
+
+
+#ifndef ParameterSweep_H
+#define ParameterSweep_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Standard Library headers
+#include <string>
+#include <utility>
+#include <vector>
+
+// External libraries headers
+#include <vtkRenderer.h>
+
+
+// ============================================================================
+// Structure Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// SweepPoint
+// ----------------------------------------------------------------------------
+//
+// Description: One image of a sweep. Nothing here touches the upstream
+//              pipeline, so every point is a re-render only.
+//
+// Properties:
+// - azimuth, elevation: Camera rotation from the scene's view, in degrees
+// - width, height: Image size in pixels
+// - colormap: Lookup table of actors showing scalars (see sweepColormaps),
+//             empty to keep the scene's
+// - output_path: PNG file to write
+//
+// ----------------------------------------------------------------------------
+struct SweepPoint {
+    double azimuth = 0.0;
+    double elevation = 0.0;
+    int width = 800;
+    int height = 600;
+    std::string colormap;
+    std::string output_path;
+};
+
+// ----------------------------------------------------------------------------
+// SweepResult
+// ----------------------------------------------------------------------------
+//
+// Description: Outcome of one SweepPoint
+//
+// Properties:
+// - success: Whether the image was written
+// - seconds: Time spent rendering and writing it
+// - worker: Index of the worker thread that rendered it
+//
+// ----------------------------------------------------------------------------
+struct SweepResult {
+    bool success = false;
+    double seconds = 0.0;
+    int worker = -1;
+};
+
+// ----------------------------------------------------------------------------
+// SweepStats
+// ----------------------------------------------------------------------------
+//
+// Description: What renderSweep did
+//
+// Properties:
+// - images: Images written
+// - failed: Images that could not be written
+// - skipped_props: Props of the scene the sweep cannot copy (volumes and
+//                  non-polygonal mappers), left out of the images
+// - upstream_seconds: Time spent executing the upstream pipelines, once
+// - seconds: Wall clock time of the sweep
+// - threads: Worker threads used
+//
+// ----------------------------------------------------------------------------
+struct SweepStats {
+    int images = 0;
+    int failed = 0;
+    int skipped_props = 0;
+    double upstream_seconds = 0.0;
+    double seconds = 0.0;
+    int threads = 0;
+};
+
+
+// ============================================================================
+// Function Declarations Section
+// ============================================================================
+
+// Parses sweep values: a comma separated list ("0,45,90") or an inclusive
+// range with a count ("0:330:12" gives 0, 30, ..., 330). Returns false for
+// anything else.
+bool parseSweepValues(const std::string& text, std::vector<double>* values);
+
+// Parses image sizes: a comma separated list of WIDTHxHEIGHT. Returns false
+// for anything else.
+bool parseSweepSizes(
+    const std::string& text,
+    std::vector<std::pair<int, int>>* sizes
+    );
+
+// Names of the colormaps a SweepPoint can use
+std::vector<std::string> sweepColormaps();
+
+// ----------------------------------------------------------------------------
+// renderSweep
+// ----------------------------------------------------------------------------
+//
+// Description: Renders the scene of a renderer under many view settings.
+//              The upstream pipelines of its actors are executed once, on
+//              the calling thread. Every worker thread then gets its own
+//              offscreen window and copies of the actors that share the
+//              pipeline outputs read-only, and takes sweep points from a
+//              shared counter until all are rendered. A point only moves
+//              the camera, resizes the window or swaps a lookup table.
+//
+// Inputs:
+// - scene: The renderer with the scene, its active camera is the view the
+//          azimuth and elevation of the points start from
+// - points: The images to render
+// - thread_count: Number of worker threads, 0 for one per core
+//
+// Outputs:
+// - results: One per point, if not null
+// - stats: What was done, if not null
+// - error: Description of the failure, if not null
+//
+// Returns: true if every image was written, false otherwise
+//
+// Side Effects: Updates the pipelines of the scene's actors and writes the
+//               images
+//
+// ----------------------------------------------------------------------------
+bool renderSweep(
+    vtkRenderer* scene,
+    const std::vector<SweepPoint>& points,
+    int thread_count = 0,
+    std::vector<SweepResult>* results = nullptr,
+    SweepStats* stats = nullptr,
+    std::string* error = nullptr
+    );
+
+#endif  // ParameterSweep_H
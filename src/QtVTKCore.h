@@ -0,0 +1,105 @@
+// ============================================================================
+// QtVTKCore.h - Public API of the qtvtk_core library
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * QtVTKCore.h: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// qtvtk_core holds everything of the viewer that does not need Qt: scene
+// construction and scene files, event dispatch, status reporting, frame rate
+// control, camera bookmarks and transitions, culling, geometry batching,
+// interactive clipping, streamline tracing, 2D image display, image
+// statistics, volume pyramids, chunked volume files and their reader,
+// offscreen, concurrent and sort-last rendering, pooled frame readback, image
+// and video export, parameter sweeps, the render farm, the frame server and
+// the data sources. It depends on VTK only, so batch tools, benchmarks and
+// tests can use it headlessly.
+// The Qt layer (qtvtk_qt, MainWindow) is built on top of it.
+//
+// The headers included below are the public API. Additions keep source
+// compatibility; QTVTK_CORE_VERSION changes whenever an existing signature
+// does.
+//
+// ============================================================================
+
+
+#ifndef QtVTKCore_H
+#define QtVTKCore_H
+
+// ============================================================================
+// Preprocessor directives section
+// ============================================================================
+
+#define QTVTK_CORE_VERSION_MAJOR 1
+#define QTVTK_CORE_VERSION_MINOR 0
+#define QTVTK_CORE_VERSION \
+    (QTVTK_CORE_VERSION_MAJOR * 100 + QTVTK_CORE_VERSION_MINOR)
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Project headers
+#include "BrickCodec.h"
+#include "BrickedImageSource.h"
+#include "BrickedVolume.h"
+#include "BvhCuller.h"
+#include "CameraBookmarks.h"
+#include "ChunkedVolume.h"
+#include "ChunkedVolumeImageReader.h"
+#include "EventDispatcher.h"
+#include "FlowTracer.h"
+#include "FrameEncoder.h"
+#include "FrameReadback.h"
+#include "FrameProtocol.h"
+#include "FrameRateController.h"
+#include "FrameServer.h"
+#include "GeometryBatcher.h"
+#include "ImageDisplay.h"
+#include "ImageStatistics.h"
+#include "InteractiveClipper.h"
+#include "MemoryBudget.h"
+#include "MeshPreprocessor.h"
+#include "MultiSceneRenderer.h"
+#include "ParameterSweep.h"
+#include "RenderFarm.h"
+#include "Scene.h"
+#include "SceneScript.h"
+#include "SharedMemoryIngest.h"
+#include "SharedMemoryLayout.h"
+#include "Socket.h"
+#include "SortLastRenderer.h"
+#include "SpscRing.h"
+#include "StatusReport.h"
+#include "TiledImageExport.h"
+#include "VideoExport.h"
+#include "VolumePyramid.h"
+
+#endif  // QtVTKCore_H
@@ -57,15 +57,41 @@
 // ============================================================================
 
 // Related header
+#include "ChunkedVolume.h"
+#include "ChunkedVolumeImageReader.h"
+#include "FrameServer.h"
 #include "MainWindow.h"
+#include "MemoryBudget.h"
+#include "MeshPreprocessor.h"
+#include "MultiSceneRenderer.h"
+#include "ParameterSweep.h"
+#include "RenderFarm.h"
+#include "Scene.h"
+#include "SceneScript.h"
+#include "SortLastRenderer.h"
+#include "TiledImageExport.h"
+#include "VideoExport.h"
+#include "VolumePyramid.h"
 
 // "C" system headers
 
 // Standard Library headers
+#include <algorithm>   // required by max
+#include <atomic>      // required by atomic
+#include <chrono>      // required by steady_clock
+#include <csignal>     // required by signal
+#include <cstddef>     // required by size_t
+#include <cstdint>     // required by uint64_t
+#include <cstdio>      // required by snprintf
 #include <cstdlib>     // required by EXIT_SUCCESS, EXIT_FAILURE
 #include <filesystem>  // Used for testing directory and file status
+#include <fstream>     // required by ofstream
 #include <iostream>    // required by cin, cout, ...
+#include <memory>      // required by make_shared
+#include <sstream>     // required by stringstream
 #include <string>      // self explanatory ...
+#include <utility>     // required by pair
+#include <vector>      // required by vector
 
 
 // External libraries headers
@@ -73,6 +99,13 @@
 #include <QApplication>
 #include <QSurfaceFormat>
 #include <QVTKOpenGLNativeWidget.h>
+#include <vtkActor.h>
+#include <vtkCamera.h>
+#include <vtkImageData.h>
+#include <vtkImageReader.h>
+#include <vtkImageReader2.h>
+#include <vtkPolyDataMapper.h>
+#include <vtkRenderer.h>
 
 // ============================================================================
 // Define namespace aliases
@@ -106,6 +139,9 @@ There is NO WARRANTY, to the extent permitted by law.\n";
 
 static std::string exec_name = kAppName;
 
+// Raised by SIGINT/SIGTERM to finish headless modes cleanly
+static std::atomic<bool> stop_requested(false);
+
 
 // ============================================================================
 // Utility function prototypes
@@ -118,6 +154,70 @@ void printUsage(
         const clipp::doc_formatting& = clipp::doc_formatting{}
     );
 void printVersionInfo();
+vtkSmartPointer<vtkPolyDataMapper> buildHeadlessScene(
+        OffscreenScene&,
+        const std::string&,
+        int
+    );
+int buildPyramid(
+        const std::string&,
+        const std::string&,
+        const PyramidOptions&
+    );
+int convertVolume(
+        const std::string&,
+        const std::string&,
+        const int[3],
+        const std::string&,
+        bool,
+        const ChunkedWriteOptions&
+    );
+int exportImage(
+        const std::string&,
+        int,
+        int,
+        int,
+        int,
+        const std::string&,
+        int
+    );
+int exportVideoFile(
+        const std::string&,
+        int,
+        double,
+        const std::vector<std::string>&,
+        int,
+        int,
+        const std::string&,
+        int
+    );
+int renderFarmBatch(
+        int,
+        int,
+        const std::vector<std::string>&,
+        const std::string&,
+        int,
+        int,
+        const std::string&,
+        int
+    );
+int renderSceneBatch(int, int, const std::string&, int, int);
+void requestStop(int);
+int runSceneFile(SceneScript&);
+bool parseSceneVariables(
+        const std::vector<std::string>&,
+        std::vector<std::pair<std::string, std::string>>&
+    );
+int runParameterSweep(
+        const std::vector<SweepPoint>&,
+        const std::vector<std::pair<std::string, std::vector<double>>>&,
+        const std::string&,
+        int,
+        const std::string&,
+        const std::vector<std::pair<std::string, std::string>>&,
+        const std::string&,
+        int
+    );
 void showHelp(
         const clipp::group&,
         const std::string = kAppName,
@@ -140,9 +240,68 @@ int main(int argc, char* argv[])
         bool        show_help;
         bool        print_usage;
         bool        show_version;
+        std::string shm_name;
+        int         shm_poll_interval;
+        int         serve_port;
+        std::string serve_socket;
+        int         frame_width;
+        int         frame_height;
+        int         scene_count;
+        int         thread_count;
+        std::string output_dir;
+        double      target_fps;
+        bool        fixed_quality;
+        int         memory_budget;
+        bool        compress_volumes;
+        int         brick_cache;
+        std::string mesh_path;
+        std::string mesh_cache;
+        int         part_count;
+        double      min_part_pixels;
+        bool        batch_parts;
+        std::string export_path;
+        int         export_width;
+        int         export_height;
+        std::string video_path;
+        int         video_frames;
+        double      video_fps;
+        std::vector<std::string> video_series;
+        std::string scene_path;
+        std::vector<std::string> scene_variables;
+        std::string sweep_dir;
+        std::string sweep_azimuth;
+        std::string sweep_elevation;
+        std::string sweep_sizes;
+        std::string sweep_colormaps;
+        std::vector<std::string> sweep_variables;
+        int         farm_workers;
+        int         farm_views;
+        std::vector<std::string> farm_steps;
+        std::string pyramid_input;
+        std::string pyramid_reduction;
+        int         pyramid_levels;
+        int         pyramid_min_size;
+        int         chunk_size;
+        std::string convert_input;
+        std::string convert_output;
+        int         raw_dims[3];
+        std::string raw_type;
+        bool        raw_big_endian;
+        bool        no_compress;
+        int         flow_seeds;
+        double      input_rate;
+        int         sort_last;
+        std::string composite;
+        std::string bookmarks_path;
     };
 
-    CLIArguments user_options {false, false, false};
+    CLIArguments user_options {
+        false, false, false, "", 5, 0, "", 800, 600, 0, 0, ".", 30.0, false,
+        0, false, 256, "", "", 0, 2.0, false, "", 3200, 2400,
+        "", 300, 30.0, {}, "", {}, "", "0", "0", "", "", {}, -1, 36, {},
+        "", "average", 0, 32, 64, "", "", {0, 0, 0}, "uint16", false, false,
+        32, 60.0, 0, "binary-swap", ""
+    };
 
     // Unsupported options aggregator.
     std::vector<std::string> unknown_options;
@@ -163,6 +322,242 @@ int main(int argc, char* argv[])
             clipp::option("-V", "--version").set(user_options.show_version)
                 .doc("print program version")
         ).doc("general options:"),
+        (
+            (
+                clipp::option("--shm")
+                & clipp::value(istarget, "name", user_options.shm_name)
+            ) % "display live data from the named shared memory segment",
+            (
+                clipp::option("--shm-poll")
+                & clipp::integer("ms", user_options.shm_poll_interval)
+            ) % "sequence counter polling interval in ms (default: 5)",
+            (
+                clipp::option("--mem-budget")
+                & clipp::integer("MiB", user_options.memory_budget)
+            ) % "evict cached datasets beyond this size (default: none)",
+            clipp::option("--compress-volumes")
+                .set(user_options.compress_volumes)
+                % "keep opened volumes as compressed bricks",
+            (
+                clipp::option("--brick-cache")
+                & clipp::integer("MiB", user_options.brick_cache)
+            ) % "decoded brick cache per volume (default: 256)",
+            (
+                clipp::option("--mesh")
+                & clipp::value(istarget, "file", user_options.mesh_path)
+            ) % "open a surface mesh (STL, OBJ, PLY, VTP, VTK)",
+            (
+                clipp::option("--mesh-cache")
+                & clipp::value(istarget, "dir", user_options.mesh_cache)
+            ) % "preprocessed mesh cache (default: user cache dir)",
+            (
+                clipp::option("--scene")
+                & clipp::value(istarget, "file", user_options.scene_path)
+            ) % "build the scene described in file; scenes with an output "
+                "statement render headlessly",
+            clipp::repeatable(
+                clipp::option("--set")
+                & clipp::value(
+                    istarget,
+                    "name=value",
+                    user_options.scene_variables
+                    )
+            ) % "set a variable of the scene file, may be repeated",
+            (
+                clipp::option("--bookmarks")
+                & clipp::value(istarget, "file", user_options.bookmarks_path)
+            ) % "read camera bookmarks, restored with the digit keys"
+        ).doc("data options:"),
+        (
+            (
+                clipp::option("--target-fps")
+                & clipp::number("fps", user_options.target_fps)
+            ) % "interactive frame rate to hold (default: 30)",
+            clipp::option("--fixed-quality").set(user_options.fixed_quality)
+                % "never lower the quality while interacting",
+            (
+                clipp::option("--parts")
+                & clipp::integer("count", user_options.part_count)
+            ) % "add a synthetic assembly of count parts",
+            (
+                clipp::option("--min-part-pixels")
+                & clipp::number("px", user_options.min_part_pixels)
+            ) % "cull parts smaller on screen (default: 2, 0: never)",
+            clipp::option("--batch").set(user_options.batch_parts)
+                % "draw parts and meshes merged into batches by material",
+            (
+                clipp::option("--flow-seeds")
+                & clipp::integer("n", user_options.flow_seeds)
+            ) % "streamline seeds per side of the seed plane (default: 32)",
+            (
+                clipp::option("--input-rate")
+                & clipp::number("hz", user_options.input_rate)
+            ) % "mouse moves passed on per second (default: 60, 0: all)",
+            (
+                clipp::option("--sort-last")
+                & clipp::integer("n", user_options.sort_last)
+            ) % "render the meshes in n partitions on threads and composite",
+            (
+                clipp::option("--composite")
+                & clipp::value("direct|binary", user_options.composite)
+            ) % "sort-last compositing method (default: binary)"
+        ).doc("rendering options:"),
+        (
+            (
+                clipp::option("--serve")
+                & clipp::integer("port", user_options.serve_port)
+            ) % "render offscreen and stream frames on a loopback TCP port",
+            (
+                clipp::option("--serve-socket")
+                & clipp::value(istarget, "path", user_options.serve_socket)
+            ) % "stream frames on a Unix domain socket instead of TCP",
+            (
+                clipp::option("--frame-size")
+                & clipp::integer("width", user_options.frame_width)
+                & clipp::integer("height", user_options.frame_height)
+            ) % "size of offscreen frames in pixels (default: 800 600)"
+        ).doc("frame server options:"),
+        (
+            (
+                clipp::option("--render-scenes")
+                & clipp::integer("count", user_options.scene_count)
+            ) % "render count scenes offscreen concurrently and exit",
+            (
+                clipp::option("--threads")
+                & clipp::integer("n", user_options.thread_count)
+            ) % "number of render threads (default: one per core)",
+            (
+                clipp::option("--output-dir")
+                & clipp::value(istarget, "dir", user_options.output_dir)
+            ) % "directory for the rendered PNG files (default: .)",
+            (
+                clipp::option("--export")
+                & clipp::value(istarget, "file", user_options.export_path)
+            ) % "render the scene to a PNG or TIFF image and exit",
+            (
+                clipp::option("--export-size")
+                & clipp::integer("width", user_options.export_width)
+                & clipp::integer("height", user_options.export_height)
+            ) % "exported image size, tiled by --frame-size (default: "
+                "3200 2400)",
+            (
+                clipp::option("--video")
+                & clipp::value(istarget, "file", user_options.video_path)
+            ) % "render an orbit of the scene to Y4M, PNG frames or, with "
+                "FFmpeg, MP4 and exit",
+            (
+                clipp::option("--video-frames")
+                & clipp::integer("n", user_options.video_frames)
+            ) % "frames of the orbit (default: 300)",
+            (
+                clipp::option("--video-fps")
+                & clipp::number("fps", user_options.video_fps)
+            ) % "video frame rate (default: 30)",
+            (
+                clipp::option("--video-series")
+                & clipp::values(istarget, "files", user_options.video_series)
+            ) % "play these meshes, one per frame, instead of the orbit"
+        ).doc("batch rendering options:"),
+        (
+            (
+                clipp::option("--sweep")
+                & clipp::value(istarget, "dir", user_options.sweep_dir)
+            ) % "render the scene at every sweep point into dir, with a "
+                "manifest.csv, and exit",
+            (
+                clipp::option("--sweep-azimuth")
+                & clipp::value("values", user_options.sweep_azimuth)
+            ) % "camera azimuths, a,b,... or first:last:count (default: 0)",
+            (
+                clipp::option("--sweep-elevation")
+                & clipp::value("values", user_options.sweep_elevation)
+            ) % "camera elevations, as for --sweep-azimuth (default: 0)",
+            (
+                clipp::option("--sweep-size")
+                & clipp::value("WxH,...", user_options.sweep_sizes)
+            ) % "image sizes (default: --frame-size)",
+            (
+                clipp::option("--sweep-colormap")
+                & clipp::value("names", user_options.sweep_colormaps)
+            ) % "colormaps of scalar colored actors: gray, rainbow, "
+                "coolwarm, hot, viridis",
+            clipp::repeatable(
+                clipp::option("--sweep-var")
+                & clipp::value(
+                    "name=values",
+                    user_options.sweep_variables
+                    )
+            ) % "sweep a --scene variable; the upstream pipeline runs once "
+                "per value, not per image"
+        ).doc("parameter sweep options:"),
+        (
+            (
+                clipp::option("--farm")
+                & clipp::integer("workers", user_options.farm_workers)
+            ) % "render views and time steps into --output-dir in worker "
+                "processes and exit (0: one per core)",
+            (
+                clipp::option("--farm-views")
+                & clipp::integer("count", user_options.farm_views)
+            ) % "camera views around the scene per time step (default: 36)",
+            (
+                clipp::option("--farm-steps")
+                & clipp::values(istarget, "files", user_options.farm_steps)
+            ) % "meshes of a time series, each rendered from every view"
+        ).doc("render farm options:"),
+        (
+            (
+                clipp::option("--build-pyramid")
+                & clipp::value(istarget, "file", user_options.pyramid_input)
+            ) % "write the multi-resolution pyramid of a volume to "
+                "--output-dir and exit",
+            (
+                clipp::option("--pyramid-reduce")
+                & clipp::value(
+                    istarget,
+                    "avg|min|max",
+                    user_options.pyramid_reduction
+                    )
+            ) % "how 2x2x2 voxels are combined (default: avg)",
+            (
+                clipp::option("--pyramid-levels")
+                & clipp::integer("n", user_options.pyramid_levels)
+            ) % "most levels, including full resolution (default: all)",
+            (
+                clipp::option("--pyramid-min-size")
+                & clipp::integer("voxels", user_options.pyramid_min_size)
+            ) % "longest axis of the coarsest level (default: 32)",
+            (
+                clipp::option("--chunk-size")
+                & clipp::integer("voxels", user_options.chunk_size)
+            ) % "edge of the chunks of written volumes (default: 64)",
+            (
+                clipp::option("--convert")
+                & clipp::value(istarget, "input", user_options.convert_input)
+                & clipp::value(
+                    istarget,
+                    "output",
+                    user_options.convert_output
+                    )
+            ) % "convert a MetaImage, NRRD or raw volume to a chunked "
+                "volume file (.qvc) and exit",
+            (
+                clipp::option("--raw-dims")
+                & clipp::integer("x", user_options.raw_dims[0])
+                & clipp::integer("y", user_options.raw_dims[1])
+                & clipp::integer("z", user_options.raw_dims[2])
+            ) % "read the --convert input as headerless voxels of this size",
+            (
+                clipp::option("--raw-type")
+                & clipp::value(istarget, "type", user_options.raw_type)
+            ) % "voxel type of raw input: uint8, int8, uint16, int16, "
+                "uint32, int32, float or double (default: uint16)",
+            clipp::option("--raw-big-endian")
+                .set(user_options.raw_big_endian)
+                .doc("raw input is big endian (default: little endian)"),
+            clipp::option("--no-compress").set(user_options.no_compress)
+                .doc("store the chunks of written volumes uncompressed")
+        ).doc("volume tools:"),
         clipp::any_other(unknown_options)
     );
 
@@ -200,6 +595,254 @@ int main(int argc, char* argv[])
         }
     }
 
+    // Chunked volume files open wherever other volume files do
+    ChunkedVolumeImageReader::RegisterWithFactory();
+
+    // Every cache of the process shares one memory budget
+    if (user_options.memory_budget > 0) {
+        MemoryBudget::global().setBudget(
+            std::uint64_t(user_options.memory_budget) << 20
+            );
+    }
+
+    // Scene files with an output run headlessly, others open in the GUI
+    std::vector<std::pair<std::string, std::string>> scene_variables;
+    if (!parseSceneVariables(user_options.scene_variables, scene_variables)) {
+        return EXIT_FAILURE;
+    }
+
+    // Sweep the scene over view settings headlessly
+    if (!user_options.sweep_dir.empty()) {
+        std::vector<double> azimuths;
+        std::vector<double> elevations;
+        std::vector<std::pair<int, int>> sizes = {{
+            std::max(1, user_options.frame_width),
+            std::max(1, user_options.frame_height)
+        }};
+        std::vector<std::string> colormaps = {""};
+        if (!parseSweepValues(user_options.sweep_azimuth, &azimuths)
+            || !parseSweepValues(user_options.sweep_elevation, &elevations)
+            || (!user_options.sweep_sizes.empty()
+                && !parseSweepSizes(user_options.sweep_sizes, &sizes))) {
+            std::cerr << exec_name << ": invalid sweep values\n";
+
+            return EXIT_FAILURE;
+        }
+        if (!user_options.sweep_colormaps.empty()) {
+            colormaps.clear();
+            std::stringstream names(user_options.sweep_colormaps);
+            std::string name;
+            const std::vector<std::string> known = sweepColormaps();
+            while (std::getline(names, name, ',')) {
+                if (std::find(known.begin(), known.end(), name)
+                    == known.end()) {
+                    std::cerr << exec_name << ": unknown colormap " << name
+                        << "\n";
+
+                    return EXIT_FAILURE;
+                }
+                colormaps.push_back(name);
+            }
+        }
+
+        std::vector<std::pair<std::string, std::vector<double>>> axes;
+        for (const auto& variable : user_options.sweep_variables) {
+            const std::size_t equals = variable.find('=');
+            std::vector<double> values;
+            if (equals == std::string::npos || equals == 0
+                || !parseSweepValues(variable.substr(equals + 1), &values)) {
+                std::cerr << exec_name << ": expected name=values, got "
+                    << variable << "\n";
+
+                return EXIT_FAILURE;
+            }
+            axes.emplace_back(variable.substr(0, equals), values);
+        }
+        if (!axes.empty() && user_options.scene_path.empty()) {
+            std::cerr << exec_name << ": --sweep-var needs --scene\n";
+
+            return EXIT_FAILURE;
+        }
+
+        // Every image of one set of variables is a re-render
+        std::vector<SweepPoint> points;
+        for (const auto& size : sizes) {
+            for (const auto& colormap : colormaps) {
+                for (double elevation : elevations) {
+                    for (double azimuth : azimuths) {
+                        SweepPoint point;
+                        point.azimuth = azimuth;
+                        point.elevation = elevation;
+                        point.width = size.first;
+                        point.height = size.second;
+                        point.colormap = colormap;
+                        points.push_back(point);
+                    }
+                }
+            }
+        }
+
+        return runParameterSweep(
+            points,
+            axes,
+            user_options.sweep_dir,
+            user_options.thread_count,
+            user_options.scene_path,
+            scene_variables,
+            user_options.mesh_path,
+            user_options.part_count
+            );
+    }
+
+    if (!user_options.scene_path.empty()) {
+        SceneScript script;
+        std::string error;
+        if (!script.load(user_options.scene_path, &error)) {
+            std::cerr << exec_name << ": " << error << "\n";
+
+            return EXIT_FAILURE;
+        }
+        if (script.hasOutput()) {
+            for (const auto& variable : scene_variables) {
+                script.setVariable(variable.first, variable.second);
+            }
+
+            return runSceneFile(script);
+        }
+    }
+
+    // Split a batch of views over worker processes, before any thread or
+    // OpenGL context exists that the forked workers could not inherit
+    if (user_options.farm_workers >= 0) {
+        return renderFarmBatch(
+            user_options.farm_workers,
+            std::max(1, user_options.farm_views),
+            user_options.farm_steps,
+            user_options.output_dir,
+            std::max(1, user_options.frame_width),
+            std::max(1, user_options.frame_height),
+            user_options.mesh_path,
+            user_options.part_count
+            );
+    }
+
+    // Convert a volume to the chunked format for random access
+    if (!user_options.convert_input.empty()) {
+        ChunkedWriteOptions options;
+        options.chunk_size = std::max(1, user_options.chunk_size);
+        options.compress = !user_options.no_compress;
+
+        return convertVolume(
+            user_options.convert_input,
+            user_options.convert_output,
+            user_options.raw_dims,
+            user_options.raw_type,
+            user_options.raw_big_endian,
+            options
+            );
+    }
+
+    // Precompute the levels of multi-resolution viewing
+    if (!user_options.pyramid_input.empty()) {
+        PyramidOptions options;
+        if (!parsePyramidReduction(
+                user_options.pyramid_reduction,
+                &options.reduction
+                )) {
+            std::cerr << exec_name << ": unknown reduction "
+                << user_options.pyramid_reduction << "\n";
+
+            return EXIT_FAILURE;
+        }
+        options.levels = std::max(0, user_options.pyramid_levels);
+        options.min_size = std::max(1, user_options.pyramid_min_size);
+        options.chunk_size = std::max(1, user_options.chunk_size);
+
+        return buildPyramid(
+            user_options.pyramid_input,
+            user_options.output_dir,
+            options
+            );
+    }
+
+    // Render a batch of scenes headlessly instead of opening the main window
+    if (user_options.scene_count > 0) {
+        return renderSceneBatch(
+            user_options.scene_count,
+            user_options.thread_count,
+            user_options.output_dir,
+            std::max(1, user_options.frame_width),
+            std::max(1, user_options.frame_height)
+            );
+    }
+
+    // Export a high resolution image headlessly
+    if (!user_options.export_path.empty()) {
+        return exportImage(
+            user_options.export_path,
+            user_options.export_width,
+            user_options.export_height,
+            std::max(1, user_options.frame_width),
+            std::max(1, user_options.frame_height),
+            user_options.mesh_path,
+            user_options.part_count
+            );
+    }
+
+    // Export a video headlessly
+    if (!user_options.video_path.empty()) {
+        return exportVideoFile(
+            user_options.video_path,
+            user_options.video_frames,
+            user_options.video_fps,
+            user_options.video_series,
+            std::max(1, user_options.frame_width),
+            std::max(1, user_options.frame_height),
+            user_options.mesh_path,
+            user_options.part_count
+            );
+    }
+
+    // Serve frames headlessly instead of opening the main window
+    if (user_options.serve_port > 0 || !user_options.serve_socket.empty()) {
+        if (user_options.serve_port > 65535) {
+            std::cerr << exec_name << ": invalid port "
+                << user_options.serve_port << "\n";
+
+            return EXIT_FAILURE;
+        }
+
+        FrameServerOptions server_options;
+        server_options.port = static_cast<std::uint16_t>(
+            user_options.serve_port
+            );
+        server_options.socket_path = user_options.serve_socket;
+        server_options.width = std::max(1, user_options.frame_width);
+        server_options.height = std::max(1, user_options.frame_height);
+        server_options.log = [](const std::string& message, bool failure) {
+            (failure ? std::cerr : std::cout) << message << "\n";
+        };
+
+        FrameServer server(server_options);
+        std::string error;
+        if (!server.start(&error)) {
+            std::cerr << exec_name << ": " << error << "\n";
+
+            return EXIT_FAILURE;
+        }
+
+        std::signal(SIGINT, requestStop);
+        std::signal(SIGTERM, requestStop);
+        std::cout << "Serving frames on "
+            << (server_options.socket_path.empty()
+                ? "127.0.0.1:" + std::to_string(server_options.port)
+                : server_options.socket_path)
+            << ", press Ctrl+C to stop\n";
+        server.run(stop_requested);
+
+        return EXIT_SUCCESS;
+    }
+
     // No options provided. Execute default action
 
     // Set default format for VTK
@@ -208,6 +851,78 @@ int main(int argc, char* argv[])
     // Create and show main window
     QApplication app(argc, argv);
     MainWindow mainWindow(argc, argv);
+    mainWindow.setTargetFrameRate(
+        user_options.fixed_quality ? 0.0 : user_options.target_fps
+        );
+    mainWindow.setVolumeCompression(
+        user_options.compress_volumes,
+        std::size_t(std::max(1, user_options.brick_cache)) << 20
+        );
+    mainWindow.setMinimumPartPixels(user_options.min_part_pixels);
+    if (user_options.part_count > 0) {
+        mainWindow.addParts(user_options.part_count);
+    }
+    mainWindow.setBatching(user_options.batch_parts);
+    mainWindow.setFlowSeeds(user_options.flow_seeds);
+    mainWindow.setInputRate(user_options.input_rate);
+    if (!user_options.mesh_cache.empty()) {
+        mainWindow.setMeshCacheDirectory(user_options.mesh_cache);
+    }
+    if (!user_options.mesh_path.empty()) {
+        std::string error;
+        if (!mainWindow.openMesh(user_options.mesh_path, &error)) {
+            std::cerr << exec_name << ": " << error << "\n";
+
+            return EXIT_FAILURE;
+        }
+    }
+    if (!user_options.scene_path.empty()) {
+        std::string error;
+        for (const auto& variable : scene_variables) {
+            mainWindow.setSceneVariable(variable.first, variable.second);
+        }
+        if (!mainWindow.openScene(user_options.scene_path, &error)) {
+            std::cerr << exec_name << ": " << error << "\n";
+
+            return EXIT_FAILURE;
+        }
+    }
+    if (!user_options.bookmarks_path.empty()) {
+        std::string error;
+        if (!mainWindow.openBookmarks(user_options.bookmarks_path, &error)) {
+            std::cerr << exec_name << ": " << error << "\n";
+
+            return EXIT_FAILURE;
+        }
+    }
+    if (user_options.sort_last > 0) {
+        CompositeMethod method = CompositeMethod::BinarySwap;
+        if (!parseCompositeMethod(user_options.composite, &method)) {
+            std::cerr << exec_name << ": unknown compositing method "
+                << user_options.composite << "\n";
+
+            return EXIT_FAILURE;
+        }
+        std::string error;
+        mainWindow.setCompositeMethod(method);
+        if (!mainWindow.setSortLast(user_options.sort_last, &error)) {
+            std::cerr << exec_name << ": " << error << "\n";
+
+            return EXIT_FAILURE;
+        }
+    }
+    if (!user_options.shm_name.empty()) {
+        std::string error;
+        if (!mainWindow.attachSharedMemory(
+                user_options.shm_name,
+                std::max(1, user_options.shm_poll_interval),
+                &error
+                )) {
+            std::cerr << exec_name << ": " << error << "\n";
+
+            return EXIT_FAILURE;
+        }
+    }
     mainWindow.show();
 
     // Run the application and return the exit code
@@ -240,6 +955,719 @@ void printVersionInfo() {
 }
 
 
+vtkSmartPointer<vtkPolyDataMapper> buildHeadlessScene(
+        OffscreenScene& scene,
+        const std::string& mesh_path,
+        int part_count
+        ) {
+    const SceneDescription description;
+    scene.setScene(description);
+
+    // A mesh or parts replace the demo cone
+    vtkRenderer* renderer = scene.renderer();
+    auto mapper = vtkSmartPointer<vtkPolyDataMapper>::New();
+    if (mesh_path.empty() && part_count <= 0) {
+        return mapper;
+    }
+
+    renderer->RemoveAllViewProps();
+    if (!mesh_path.empty()) {
+        std::string error;
+        vtkSmartPointer<vtkPolyData> mesh = loadPreprocessedMesh(
+            mesh_path,
+            "",
+            MeshPreprocessOptions(),
+            nullptr,
+            &error
+            );
+        if (!mesh) {
+            std::cerr << exec_name << ": " << error << "\n";
+
+            return nullptr;
+        }
+        mapper->SetInputData(mesh);
+        auto actor = vtkSmartPointer<vtkActor>::New();
+        actor->SetMapper(mapper);
+        renderer->AddActor(actor);
+    }
+    buildPartGrid(renderer, part_count);
+    renderer->ResetCamera();
+    renderer->GetActiveCamera()->Azimuth(description.azimuth);
+    renderer->GetActiveCamera()->Elevation(description.elevation);
+    renderer->GetActiveCamera()->OrthogonalizeViewUp();
+    renderer->ResetCameraClippingRange();
+
+    return mapper;
+}
+
+
+int buildPyramid(
+        const std::string& input,
+        const std::string& directory,
+        const PyramidOptions& options
+        ) {
+    vtkSmartPointer<vtkImageReader2> reader = createVolumeReader(input);
+    if (!reader) {
+        std::cerr << exec_name << ": no reader for " << input << "\n";
+
+        return EXIT_FAILURE;
+    }
+    reader->SetFileName(input.c_str());
+    reader->Update();
+    if (reader->GetErrorCode() != 0) {
+        std::cerr << exec_name << ": failed to read " << input << "\n";
+
+        return EXIT_FAILURE;
+    }
+
+    PyramidStats stats;
+    std::string error;
+    if (!buildVolumePyramid(
+            reader->GetOutput(), directory, options, &stats, &error
+            )) {
+        std::cerr << exec_name << ": " << error << "\n";
+
+        return EXIT_FAILURE;
+    }
+
+    for (std::size_t level = 0; level < stats.dimensions.size(); ++level) {
+        const std::vector<int>& dims = stats.dimensions[level];
+        std::printf(
+            "level %zu: %dx%dx%d, reduced in %.3f s, written in %.3f s\n",
+            level,
+            dims[0],
+            dims[1],
+            dims[2],
+            stats.reduce_seconds[level],
+            stats.write_seconds[level]
+            );
+    }
+    std::cout << "Built " << stats.dimensions.size() << " "
+        << pyramidReductionName(options.reduction) << " levels ("
+        << (stats.bytes >> 20) << " MiB) in " << directory << " in "
+        << stats.seconds << " s\n";
+
+    return EXIT_SUCCESS;
+}
+
+
+
+int convertVolume(
+        const std::string& input,
+        const std::string& output,
+        const int raw_dims[3],
+        const std::string& raw_type,
+        bool raw_big_endian,
+        const ChunkedWriteOptions& options
+        ) {
+    if (output.empty()) {
+        std::cerr << exec_name << ": --convert needs an output file\n";
+
+        return EXIT_FAILURE;
+    }
+
+    // Raw voxels carry no header, their layout comes from the options
+    vtkSmartPointer<vtkImageReader2> reader;
+    if (raw_dims[0] > 0 || raw_dims[1] > 0 || raw_dims[2] > 0) {
+        const std::vector<std::pair<std::string, int>> types = {
+            {"uint8", VTK_UNSIGNED_CHAR}, {"int8", VTK_SIGNED_CHAR},
+            {"uint16", VTK_UNSIGNED_SHORT}, {"int16", VTK_SHORT},
+            {"uint32", VTK_UNSIGNED_INT}, {"int32", VTK_INT},
+            {"float", VTK_FLOAT}, {"double", VTK_DOUBLE}
+        };
+        auto type = std::find_if(
+            types.begin(),
+            types.end(),
+            [&raw_type](const auto& known) { return known.first == raw_type; }
+            );
+        if (type == types.end()) {
+            std::cerr << exec_name << ": unknown raw type " << raw_type
+                << "\n";
+
+            return EXIT_FAILURE;
+        }
+        if (raw_dims[0] < 1 || raw_dims[1] < 1 || raw_dims[2] < 1) {
+            std::cerr << exec_name << ": --raw-dims must be positive\n";
+
+            return EXIT_FAILURE;
+        }
+
+        auto raw = vtkSmartPointer<vtkImageReader>::New();
+        raw->SetFileDimensionality(3);
+        raw->SetDataExtent(
+            0, raw_dims[0] - 1, 0, raw_dims[1] - 1, 0, raw_dims[2] - 1
+            );
+        raw->SetDataScalarType(type->second);
+        raw->SetNumberOfScalarComponents(1);
+        if (raw_big_endian) {
+            raw->SetDataByteOrderToBigEndian();
+        } else {
+            raw->SetDataByteOrderToLittleEndian();
+        }
+        reader = raw;
+    } else {
+        reader = createVolumeReader(input);
+        if (!reader) {
+            std::cerr << exec_name << ": no reader for " << input << "\n";
+
+            return EXIT_FAILURE;
+        }
+    }
+    reader->SetFileName(input.c_str());
+
+    // The reader is asked for one slab of chunks at a time
+    ChunkedWriteStats stats;
+    std::string error;
+    if (!writeChunkedVolume(reader, output, options, &stats, &error)
+        || reader->GetErrorCode() != 0) {
+        std::cerr << exec_name << ": cannot convert " << input << ": "
+            << (error.empty() ? "read error" : error) << "\n";
+
+        return EXIT_FAILURE;
+    }
+
+    std::printf(
+        "Wrote %s: %llu chunks of %d voxels, %.1f of %.1f MiB (%.2f) "
+        "in %.3f s\n",
+        output.c_str(),
+        static_cast<unsigned long long>(stats.chunks),
+        options.chunk_size,
+        stats.stored_bytes / 1048576.0,
+        stats.raw_bytes / 1048576.0,
+        double(stats.stored_bytes)
+            / double(std::max<std::uint64_t>(stats.raw_bytes, 1)),
+        stats.seconds
+        );
+
+    return EXIT_SUCCESS;
+}
+
+int exportImage(
+        const std::string& path,
+        int width,
+        int height,
+        int tile_width,
+        int tile_height,
+        const std::string& mesh_path,
+        int part_count
+        ) {
+    OffscreenScene scene(tile_width, tile_height);
+    if (!buildHeadlessScene(scene, mesh_path, part_count)) {
+        return EXIT_FAILURE;
+    }
+
+    TiledExportOptions options;
+    options.width = width;
+    options.height = height;
+    TiledExportStats stats;
+    std::string error;
+    if (!exportTiledImage(
+            scene.renderWindow(), path, options, &stats, &error
+            )) {
+        std::cerr << exec_name << ": " << error << "\n";
+
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "Exported " << path << " (" << width << "x" << height
+        << ", " << stats.tiles << " tiles, " << (stats.bytes_written >> 10)
+        << " KiB) in " << stats.seconds << " s\n";
+
+    return EXIT_SUCCESS;
+}
+
+
+int exportVideoFile(
+        const std::string& path,
+        int frame_count,
+        double fps,
+        const std::vector<std::string>& series,
+        int width,
+        int height,
+        const std::string& mesh_path,
+        int part_count
+        ) {
+    OffscreenScene scene(width, height);
+    vtkSmartPointer<vtkPolyDataMapper> mapper =
+        buildHeadlessScene(scene, mesh_path, part_count);
+    if (!mapper) {
+        return EXIT_FAILURE;
+    }
+
+    // Time series playback shows the meshes in place of the scene
+    VideoAnimation animation;
+    if (!series.empty()) {
+        vtkRenderer* renderer = scene.renderer();
+        renderer->RemoveAllViewProps();
+        auto actor = vtkSmartPointer<vtkActor>::New();
+        actor->SetMapper(mapper);
+        renderer->AddActor(actor);
+        std::string error;
+        vtkSmartPointer<vtkPolyData> first = readMesh(series.front(), &error);
+        if (!first) {
+            std::cerr << exec_name << ": " << error << "\n";
+
+            return EXIT_FAILURE;
+        }
+        mapper->SetInputData(first);
+        renderer->ResetCamera();
+        frame_count = static_cast<int>(series.size());
+        animation = meshSeriesAnimation(mapper, series);
+    } else {
+        animation = orbitAnimation(scene.renderer(), frame_count);
+    }
+
+    VideoExportOptions options;
+    options.fps = fps;
+    VideoExportStats stats;
+    std::string error;
+    if (!exportVideo(
+            scene.renderWindow(),
+            path,
+            frame_count,
+            animation,
+            options,
+            &stats,
+            &error
+            )) {
+        std::cerr << exec_name << ": " << error << "\n";
+
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "Exported " << stats.frames << " frames to " << path
+        << " in " << stats.seconds << " s (rendering " << stats.render_seconds
+        << " s, encoding " << stats.encode_seconds << " s, waiting for the "
+        << "encoder " << stats.stalled_seconds << " s)\n";
+
+    return EXIT_SUCCESS;
+}
+
+
+int renderFarmBatch(
+        int worker_count,
+        int view_count,
+        const std::vector<std::string>& steps,
+        const std::string& output_dir,
+        int width,
+        int height,
+        const std::string& mesh_path,
+        int part_count
+        ) {
+    std::error_code status;
+    fs::create_directories(output_dir, status);
+    if (status) {
+        std::cerr << exec_name << ": cannot create " << output_dir << ": "
+            << status.message() << "\n";
+
+        return EXIT_FAILURE;
+    }
+
+    // Every time step from every view, the views of a step adjacent
+    std::vector<FarmJob> jobs;
+    const std::vector<std::string> step_paths = steps.empty()
+        ? std::vector<std::string>{""}
+        : steps;
+    for (const auto& step : step_paths) {
+        for (int view = 0; view < view_count; ++view) {
+            char file_name[32];
+            std::snprintf(
+                file_name,
+                sizeof(file_name),
+                "farm_%05d.png",
+                static_cast<int>(jobs.size())
+                );
+            FarmJob job;
+            job.azimuth = 360.0 * view / view_count;
+            job.time_step = step;
+            job.output_path = (fs::path(output_dir) / file_name).string();
+            jobs.push_back(job);
+        }
+    }
+
+    // Runs in each worker process, which builds its own scene and context
+    auto setup = [&](int) -> FarmJobRenderer {
+        auto scene = std::make_shared<OffscreenScene>(width, height);
+        vtkSmartPointer<vtkPolyDataMapper> mapper =
+            buildHeadlessScene(*scene, mesh_path, part_count);
+        if (!mapper) {
+            return nullptr;
+        }
+
+        // Time steps replace the scene, framed by the first one
+        vtkRenderer* renderer = scene->renderer();
+        if (!steps.empty()) {
+            std::string error;
+            vtkSmartPointer<vtkPolyData> first = readMesh(
+                steps.front(),
+                &error
+                );
+            if (!first) {
+                std::cerr << exec_name << ": " << error << "\n";
+
+                return nullptr;
+            }
+            renderer->RemoveAllViewProps();
+            auto actor = vtkSmartPointer<vtkActor>::New();
+            actor->SetMapper(mapper);
+            renderer->AddActor(actor);
+            mapper->SetInputData(first);
+            renderer->ResetCamera();
+        }
+        auto home = vtkSmartPointer<vtkCamera>::New();
+        home->DeepCopy(renderer->GetActiveCamera());
+        auto shown = std::make_shared<std::string>(
+            steps.empty() ? "" : steps.front()
+            );
+
+        return [scene, mapper, home, shown](const FarmJob& job) {
+            if (job.time_step != *shown) {
+                vtkSmartPointer<vtkPolyData> mesh = readMesh(job.time_step);
+                if (!mesh) {
+                    return false;
+                }
+                mapper->SetInputData(mesh);
+                *shown = job.time_step;
+            }
+
+            vtkRenderer* renderer = scene->renderer();
+            vtkCamera* camera = renderer->GetActiveCamera();
+            camera->DeepCopy(home);
+            camera->Azimuth(job.azimuth);
+            camera->Elevation(job.elevation);
+            camera->OrthogonalizeViewUp();
+            renderer->ResetCameraClippingRange();
+
+            return scene->writePng(job.output_path);
+        };
+    };
+
+    FarmStats stats;
+    std::string error;
+    const bool success = runRenderFarm(
+        jobs,
+        setup,
+        worker_count,
+        &stats,
+        &error
+        );
+    if (stats.workers.empty()) {
+        std::cerr << exec_name << ": " << error << "\n";
+
+        return EXIT_FAILURE;
+    }
+
+    // Per worker timing shows how evenly stealing spread the batch
+    double busiest = 0.0;
+    double total = 0.0;
+    for (std::size_t i = 0; i < stats.workers.size(); ++i) {
+        const FarmWorkerStats& worker = stats.workers[i];
+        std::cout << "Worker " << i << ": " << worker.jobs << " jobs ("
+            << worker.stolen << " stolen, " << worker.failed << " failed), "
+            << worker.busy_seconds << " s busy"
+            << (worker.alive ? "" : ", died") << "\n";
+        busiest = std::max(busiest, worker.busy_seconds);
+        total += worker.busy_seconds;
+    }
+    const double mean = total / stats.workers.size();
+    std::cout << "Rendered " << stats.jobs - stats.failed << " of "
+        << stats.jobs << " images on " << stats.workers.size()
+        << " worker processes in " << stats.seconds << " s ("
+        << stats.jobs / std::max(stats.seconds, 1e-9) << " images/s, "
+        << stats.stolen << " jobs stolen, busiest worker "
+        << (mean > 0.0 ? busiest / mean : 1.0) << "x the mean)\n";
+    if (!success) {
+        std::cerr << exec_name << ": " << error << "\n";
+
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+
+int renderSceneBatch(
+        int count,
+        int thread_count,
+        const std::string& output_dir,
+        int width,
+        int height
+        ) {
+    std::error_code error;
+    fs::create_directories(output_dir, error);
+    if (error) {
+        std::cerr << exec_name << ": cannot create " << output_dir << ": "
+            << error.message() << "\n";
+
+        return EXIT_FAILURE;
+    }
+
+    std::vector<SceneJob> jobs(count);
+    for (int i = 0; i < count; ++i) {
+        char file_name[32];
+        std::snprintf(file_name, sizeof(file_name), "scene_%04d.png", i);
+
+        jobs[i].scene = sceneVariant(i, count);
+        jobs[i].width = width;
+        jobs[i].height = height;
+        jobs[i].output_path = (fs::path(output_dir) / file_name).string();
+    }
+
+    MultiSceneRenderer renderer(thread_count);
+    const auto started = std::chrono::steady_clock::now();
+    const std::vector<SceneResult> results = renderer.render(jobs);
+    const double seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - started
+        ).count();
+
+    int failed = 0;
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        if (!results[i].success) {
+            std::cerr << exec_name << ": failed to write "
+                << jobs[i].output_path << "\n";
+            ++failed;
+        }
+    }
+
+    std::cout << "Rendered " << count - failed << " of " << count
+        << " scenes on " << renderer.threadCount() << " threads in "
+        << seconds << " s (" << count / seconds << " frames/s)\n";
+
+    return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+
+void requestStop(int) {
+    stop_requested = true;
+}
+
+
+bool parseSceneVariables(
+        const std::vector<std::string>& arguments,
+        std::vector<std::pair<std::string, std::string>>& variables
+        ) {
+    for (const auto& argument : arguments) {
+        const std::size_t equals = argument.find('=');
+        if (equals == std::string::npos || equals == 0) {
+            std::cerr << exec_name << ": expected name=value, got "
+                << argument << "\n";
+
+            return false;
+        }
+        variables.emplace_back(
+            argument.substr(0, equals),
+            argument.substr(equals + 1)
+            );
+    }
+
+    return true;
+}
+
+
+int runParameterSweep(
+        const std::vector<SweepPoint>& points,
+        const std::vector<std::pair<std::string, std::vector<double>>>& axes,
+        const std::string& output_dir,
+        int thread_count,
+        const std::string& scene_path,
+        const std::vector<std::pair<std::string, std::string>>& variables,
+        const std::string& mesh_path,
+        int part_count
+        ) {
+    std::error_code status;
+    fs::create_directories(output_dir, status);
+    if (status) {
+        std::cerr << exec_name << ": cannot create " << output_dir << ": "
+            << status.message() << "\n";
+
+        return EXIT_FAILURE;
+    }
+
+    // The scene file or the demo scene, in a window that is never shown
+    OffscreenScene source(64, 64);
+    SceneScript script;
+    std::string error;
+    if (scene_path.empty()) {
+        if (!buildHeadlessScene(source, mesh_path, part_count)) {
+            return EXIT_FAILURE;
+        }
+    } else {
+        if (!script.load(scene_path, &error)) {
+            std::cerr << exec_name << ": " << error << "\n";
+
+            return EXIT_FAILURE;
+        }
+        for (const auto& variable : variables) {
+            script.setVariable(variable.first, variable.second);
+        }
+    }
+
+    const fs::path manifest_path = fs::path(output_dir) / "manifest.csv";
+    std::ofstream manifest(manifest_path);
+    manifest << "image,azimuth,elevation,width,height,colormap";
+    for (const auto& axis : axes) {
+        manifest << "," << axis.first;
+    }
+    manifest << ",seconds,worker\n";
+
+    // Odometer over the variable values, the first axis turning fastest
+    std::vector<std::size_t> digits(axes.size(), 0);
+    int image = 0;
+    int failed = 0;
+    int variants = 0;
+    double upstream_seconds = 0.0;
+    int threads = 0;
+    const auto started = std::chrono::steady_clock::now();
+    while (true) {
+        std::vector<std::string> values;
+        for (std::size_t i = 0; i < axes.size(); ++i) {
+            char value[32];
+            std::snprintf(
+                value, sizeof(value), "%g", axes[i].second[digits[i]]
+                );
+            values.push_back(value);
+            script.setVariable(axes[i].first, value);
+        }
+
+        // Only nodes whose variables changed execute again
+        const auto built = std::chrono::steady_clock::now();
+        if (!scene_path.empty()
+            && !script.build(source.renderer(), nullptr, &error)) {
+            std::cerr << exec_name << ": " << error << "\n";
+
+            return EXIT_FAILURE;
+        }
+        upstream_seconds += std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - built).count();
+
+        std::vector<SweepPoint> variant = points;
+        for (SweepPoint& point : variant) {
+            char file_name[32];
+            std::snprintf(
+                file_name, sizeof(file_name), "sweep_%05d.png", image++
+                );
+            point.output_path = (fs::path(output_dir) / file_name).string();
+        }
+
+        std::vector<SweepResult> results;
+        SweepStats stats;
+        renderSweep(
+            source.renderer(),
+            variant,
+            thread_count,
+            &results,
+            &stats,
+            &error
+            );
+        upstream_seconds += stats.upstream_seconds;
+        threads = stats.threads;
+        failed += stats.failed;
+        ++variants;
+
+        for (std::size_t i = 0; i < variant.size(); ++i) {
+            const SweepPoint& point = variant[i];
+            if (!results[i].success) {
+                std::cerr << exec_name << ": failed to write "
+                    << point.output_path << "\n";
+            }
+            manifest << fs::path(point.output_path).filename().string()
+                << "," << point.azimuth << "," << point.elevation << ","
+                << point.width << "," << point.height << ","
+                << point.colormap;
+            for (const auto& value : values) {
+                manifest << "," << value;
+            }
+            manifest << "," << results[i].seconds << ","
+                << results[i].worker << "\n";
+        }
+
+        std::size_t axis = 0;
+        while (axis < axes.size()
+               && ++digits[axis] == axes[axis].second.size()) {
+            digits[axis++] = 0;
+        }
+        if (axis == axes.size()) {
+            break;
+        }
+    }
+
+    const double seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - started).count();
+    std::cout << "Rendered " << image - failed << " of " << image
+        << " images (" << variants << " pipeline variants) on " << threads
+        << " threads in " << seconds << " s; upstream pipelines took "
+        << upstream_seconds << " s. Manifest: " << manifest_path.string()
+        << "\n";
+
+    return failed == 0 && manifest ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+
+int runSceneFile(SceneScript& script) {
+    // Tiled image export keeps the window small whatever the image size
+    OffscreenScene scene(800, 600);
+    SceneBuildStats stats;
+    std::string error;
+    if (!script.build(scene.renderer(), &stats, &error)) {
+        std::cerr << exec_name << ": " << error << "\n";
+
+        return EXIT_FAILURE;
+    }
+    std::cout << "Built " << stats.nodes << " nodes (" << stats.created
+        << " created, " << stats.reused << " shared) in " << stats.seconds
+        << " s\n";
+
+    const SceneOutput& output = script.output();
+    if (!output.image.empty()) {
+        scene.setSize(
+            std::min(output.width, 2048),
+            std::min(output.height, 2048)
+            );
+        TiledExportOptions options;
+        options.width = output.width;
+        options.height = output.height;
+        TiledExportStats image_stats;
+        if (!exportTiledImage(
+                scene.renderWindow(),
+                output.image,
+                options,
+                &image_stats,
+                &error
+                )) {
+            std::cerr << exec_name << ": " << error << "\n";
+
+            return EXIT_FAILURE;
+        }
+        std::cout << "Wrote " << output.image << " in "
+            << image_stats.seconds << " s\n";
+    }
+
+    if (!output.video.empty()) {
+        scene.setSize(output.width, output.height);
+        VideoExportOptions options;
+        options.fps = output.fps;
+        VideoExportStats video_stats;
+        if (!exportVideo(
+                scene.renderWindow(),
+                output.video,
+                output.frames,
+                orbitAnimation(scene.renderer(), output.frames),
+                options,
+                &video_stats,
+                &error
+                )) {
+            std::cerr << exec_name << ": " << error << "\n";
+
+            return EXIT_FAILURE;
+        }
+        std::cout << "Wrote " << video_stats.frames << " frames to "
+            << output.video << " in " << video_stats.seconds << " s\n";
+    }
+
+    return EXIT_SUCCESS;
+}
+
+
 void showHelp(
         const clipp::group& group,
         const std::string exec_name,
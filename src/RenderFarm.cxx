@@ -0,0 +1,346 @@
+// ============================================================================
+// RenderFarm.cxx - Render job batches spread over forked worker processes
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * RenderFarm.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header -------------------------------------------------------------
+#include "RenderFarm.h"
+#include "Socket.h"
+
+// "C" system headers ---------------------------------------------------------
+#if !defined(_WIN32)
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+// Standard Library headers ---------------------------------------------------
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <utility>
+
+
+// ============================================================================
+// Local helpers section
+// ============================================================================
+
+namespace {
+
+#if !defined(_WIN32)
+using Clock = std::chrono::steady_clock;
+
+// The job queues of the workers. Each worker takes from the front of its
+// own queue; a worker whose queue is empty steals from the back of the
+// longest one, farthest from where its owner is working.
+class JobQueues
+{
+public:
+    JobQueues(std::size_t job_count, int worker_count)
+        : queues(worker_count)
+    {
+        for (int worker = 0; worker < worker_count; ++worker) {
+            const std::size_t first = job_count * worker / worker_count;
+            const std::size_t last = job_count * (worker + 1) / worker_count;
+            for (std::size_t job = first; job < last; ++job) {
+                this->queues[worker].push_back(job);
+            }
+        }
+    }
+
+    bool take(int worker, std::size_t* job, bool* stolen)
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+
+        std::deque<std::size_t>& own = this->queues[worker];
+        if (!own.empty()) {
+            *job = own.front();
+            own.pop_front();
+            *stolen = false;
+            return true;
+        }
+
+        auto victim = std::max_element(
+            this->queues.begin(),
+            this->queues.end(),
+            [](const auto& a, const auto& b) { return a.size() < b.size(); }
+            );
+        if (victim->empty()) {
+            return false;
+        }
+        *job = victim->back();
+        victim->pop_back();
+        *stolen = true;
+        return true;
+    }
+
+private:
+    std::mutex mutex;
+    std::vector<std::deque<std::size_t>> queues;
+};
+
+bool sendLine(Socket& link, const std::string& line)
+{
+    const std::string message = line + "\n";
+    return link.sendAll(message.data(), message.size());
+}
+
+// The worker side of the protocol, in the forked process: announce
+// "ready", then answer every "job <index>" with
+// "done <index> <written> <seconds>" until "quit" or the coordinator goes
+// away.
+[[noreturn]] void runWorker(
+    int worker,
+    Socket link,
+    const std::vector<FarmJob>& jobs,
+    const FarmWorkerSetup& setup
+    )
+{
+    int status = EXIT_FAILURE;
+    FarmJobRenderer render = setup(worker);
+    if (render && sendLine(link, "ready")) {
+        status = EXIT_SUCCESS;
+        std::string line;
+        while (link.receiveLine(line) && line.rfind("job ", 0) == 0) {
+            const std::size_t index = std::strtoul(
+                line.c_str() + 4,
+                nullptr,
+                10
+                );
+            const auto started = Clock::now();
+            const bool written = index < jobs.size() && render(jobs[index]);
+            const double seconds = std::chrono::duration<double>(
+                Clock::now() - started).count();
+
+            std::ostringstream done;
+            done << "done " << index << " " << written << " " << seconds;
+            if (!sendLine(link, done.str())) {
+                break;
+            }
+        }
+    }
+
+    // Release the scene and its context, but none of the objects the
+    // coordinator owned when it forked
+    render = FarmJobRenderer();
+    std::cout.flush();
+    std::cerr.flush();
+    _exit(status);
+}
+#endif
+
+}  // namespace
+
+
+// ============================================================================
+// Function Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// runRenderFarm
+// ----------------------------------------------------------------------------
+//
+// Description: Renders a batch of jobs in forked worker processes with work
+//              stealing between their queues
+//
+// Inputs:
+// - jobs: The batch
+// - setup: Builds a worker's scene, called in the worker process
+// - worker_count: Number of worker processes, 0 for one per core
+//
+// Outputs:
+// - stats: What was done, if not null
+// - error: Description of the failure, if not null
+//
+// Returns: true if every job wrote its image, false otherwise
+//
+// Side Effects: Forks and waits for the worker processes
+//
+// ----------------------------------------------------------------------------
+bool runRenderFarm(
+    const std::vector<FarmJob>& jobs,
+    const FarmWorkerSetup& setup,
+    int worker_count,
+    FarmStats* stats,
+    std::string* error
+    )
+{
+#if defined(_WIN32)
+    (void)jobs;
+    (void)setup;
+    (void)worker_count;
+    (void)stats;
+    if (error) {
+        *error = "The render farm needs fork(), which Windows does not have";
+    }
+    return false;
+#else
+    const auto started = Clock::now();
+    FarmStats counts;
+    counts.jobs = static_cast<int>(jobs.size());
+    if (jobs.empty()) {
+        if (stats) {
+            *stats = counts;
+        }
+        return true;
+    }
+
+    if (worker_count <= 0) {
+        worker_count = static_cast<int>(std::thread::hardware_concurrency());
+    }
+    worker_count = std::max(1, std::min<int>(
+        worker_count,
+        static_cast<int>(jobs.size())
+        ));
+
+    // Buffered output would be written once by every process
+    std::cout.flush();
+    std::cerr.flush();
+    std::fflush(nullptr);
+
+    std::vector<Socket> links;
+    std::vector<pid_t> children;
+    links.reserve(worker_count);
+    for (int worker = 0; worker < worker_count; ++worker) {
+        int pair[2];
+        if (::socketpair(AF_UNIX, SOCK_STREAM, 0, pair) != 0) {
+            break;
+        }
+
+        const pid_t child = ::fork();
+        if (child == 0) {
+            ::close(pair[0]);
+            links.clear();
+            runWorker(worker, Socket(pair[1]), jobs, setup);
+        }
+        ::close(pair[1]);
+        if (child < 0) {
+            ::close(pair[0]);
+            break;
+        }
+        links.emplace_back(pair[0]);
+        children.push_back(child);
+    }
+    if (children.empty()) {
+        if (error) {
+            *error = "Cannot start render farm worker processes";
+        }
+        return false;
+    }
+    worker_count = static_cast<int>(children.size());
+
+    // One coordinator thread per worker feeds it jobs
+    JobQueues queues(jobs.size(), worker_count);
+    std::vector<char> written(jobs.size(), 0);
+    counts.workers.resize(worker_count);
+    auto serve = [&](int worker) {
+        Socket& link = links[worker];
+        FarmWorkerStats& worker_stats = counts.workers[worker];
+        std::string line;
+        if (!link.receiveLine(line) || line != "ready") {
+            worker_stats.alive = false;
+            return;
+        }
+
+        std::size_t job = 0;
+        bool stolen = false;
+        while (queues.take(worker, &job, &stolen)) {
+            std::istringstream reply;
+            std::string tag;
+            std::size_t index = 0;
+            int success = 0;
+            double seconds = 0.0;
+            if (!sendLine(link, "job " + std::to_string(job))
+                || !link.receiveLine(line)) {
+                worker_stats.alive = false;
+                return;
+            }
+            reply.str(line);
+            if (!(reply >> tag >> index >> success >> seconds)
+                || tag != "done" || index != job) {
+                worker_stats.alive = false;
+                return;
+            }
+
+            written[job] = success != 0;
+            ++worker_stats.jobs;
+            worker_stats.stolen += stolen ? 1 : 0;
+            worker_stats.failed += success != 0 ? 0 : 1;
+            worker_stats.busy_seconds += seconds;
+        }
+        sendLine(link, "quit");
+    };
+
+    std::vector<std::thread> threads;
+    for (int worker = 0; worker < worker_count; ++worker) {
+        threads.emplace_back(serve, worker);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    links.clear();
+
+    for (int worker = 0; worker < worker_count; ++worker) {
+        int status = 0;
+        if (::waitpid(children[worker], &status, 0) < 0
+            || !WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS) {
+            counts.workers[worker].alive = false;
+        }
+    }
+
+    for (const FarmWorkerStats& worker_stats : counts.workers) {
+        counts.stolen += worker_stats.stolen;
+    }
+    counts.failed = static_cast<int>(
+        std::count(written.begin(), written.end(), 0)
+        );
+    counts.seconds = std::chrono::duration<double>(
+        Clock::now() - started).count();
+    if (stats) {
+        *stats = counts;
+    }
+    if (counts.failed > 0 && error) {
+        *error = std::to_string(counts.failed) + " of "
+            + std::to_string(counts.jobs) + " render farm jobs failed";
+    }
+
+    return counts.failed == 0;
+#endif
+}
@@ -0,0 +1,167 @@
+// ============================================================================
+// RenderFarm.h - Render job batches spread over forked worker processes
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * RenderFarm.h: created.
+//
+// ============================================================================
+
+
+#ifndef RenderFarm_H
+#define RenderFarm_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Standard Library headers
+#include <functional>
+#include <string>
+#include <vector>
+
+
+// ============================================================================
+// Structure Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// FarmJob
+// ----------------------------------------------------------------------------
+//
+// Description: One image of a render farm batch
+//
+// Properties:
+// - azimuth, elevation: Camera rotation from the scene's view, in degrees
+// - time_step: Mesh file shown by the job, empty for the worker's scene
+// - output_path: PNG file to write
+//
+// ----------------------------------------------------------------------------
+struct FarmJob {
+    double azimuth = 0.0;
+    double elevation = 0.0;
+    std::string time_step;
+    std::string output_path;
+};
+
+// ----------------------------------------------------------------------------
+// FarmWorkerStats
+// ----------------------------------------------------------------------------
+//
+// Description: What one worker process of the farm did
+//
+// Properties:
+// - jobs: Jobs the worker finished, successfully or not
+// - stolen: Of those, jobs taken from another worker's queue
+// - failed: Jobs whose image was not written
+// - busy_seconds: Time the worker spent on its jobs
+// - alive: Whether the worker lasted until the queue was empty
+//
+// ----------------------------------------------------------------------------
+struct FarmWorkerStats {
+    int jobs = 0;
+    int stolen = 0;
+    int failed = 0;
+    double busy_seconds = 0.0;
+    bool alive = true;
+};
+
+// ----------------------------------------------------------------------------
+// FarmStats
+// ----------------------------------------------------------------------------
+//
+// Description: What runRenderFarm did
+//
+// Properties:
+// - jobs: Jobs of the batch
+// - failed: Jobs without an image, including jobs of workers that died
+// - stolen: Jobs run by another worker than the one they were queued for
+// - seconds: Wall clock time of the batch
+// - workers: One entry per worker process
+//
+// ----------------------------------------------------------------------------
+struct FarmStats {
+    int jobs = 0;
+    int failed = 0;
+    int stolen = 0;
+    double seconds = 0.0;
+    std::vector<FarmWorkerStats> workers;
+};
+
+
+// ============================================================================
+// Function Declarations Section
+// ============================================================================
+
+// Renders one job in a worker process, returning whether its image was
+// written.
+using FarmJobRenderer = std::function<bool(const FarmJob& job)>;
+
+// Builds the scene of a worker process, after the fork, and returns the
+// renderer of its jobs. An empty renderer ends the worker.
+using FarmWorkerSetup = std::function<FarmJobRenderer(int worker)>;
+
+// ----------------------------------------------------------------------------
+// runRenderFarm
+// ----------------------------------------------------------------------------
+//
+// Description: Renders a batch of jobs in worker processes, each with its
+//              own OpenGL context, so one node is not limited by what one
+//              process can drive. The coordinator (the calling process)
+//              forks the workers and talks to each over a Unix domain
+//              socket pair; workers inherit the job list and only job
+//              indices cross the socket. Jobs are queued per worker in
+//              contiguous blocks, so neighbouring views and time steps stay
+//              on one worker. A worker that runs dry steals from the back of
+//              the longest remaining queue, which evens out jobs of uneven
+//              cost. A worker that dies fails its current job only; its
+//              queue is stolen by the others.
+//
+//              Call it before any OpenGL context or thread is created in the
+//              process: a forked child inherits neither.
+//
+// Inputs:
+// - jobs: The batch
+// - setup: Builds a worker's scene, called in the worker process
+// - worker_count: Number of worker processes, 0 for one per core
+//
+// Outputs:
+// - stats: What was done, if not null
+// - error: Description of the failure, if not null
+//
+// Returns: true if every job wrote its image, false otherwise
+//
+// Side Effects: Forks and waits for the worker processes. Not available on
+//               Windows, which has no fork.
+//
+// ----------------------------------------------------------------------------
+bool runRenderFarm(
+    const std::vector<FarmJob>& jobs,
+    const FarmWorkerSetup& setup,
+    int worker_count = 0,
+    FarmStats* stats = nullptr,
+    std::string* error = nullptr
+    );
+
+#endif  // RenderFarm_H
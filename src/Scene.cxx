@@ -0,0 +1,453 @@
+// ============================================================================
+// Scene.cxx - Implementation of the scene construction helpers
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * Scene.cxx: created.
+// * Scene.cxx: added the synthetic assembly of parts.
+// * Scene.cxx: offscreen contexts are created in the constructor, under the
+//   context lock, rather than by the first render.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header -------------------------------------------------------------
+#include "Scene.h"
+
+// "C" system headers ---------------------------------------------------------
+
+// Standard Library headers ---------------------------------------------------
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <mutex>
+
+// External libraries headers -------------------------------------------------
+
+// VTK headers
+#include <vtkCamera.h>
+#include <vtkConeSource.h>
+#include <vtkCubeSource.h>
+#include <vtkImageData.h>
+#include <vtkNamedColors.h>
+#include <vtkPNGWriter.h>
+#include <vtkPointData.h>
+#include <vtkPolyDataMapper.h>
+#include <vtkProperty.h>
+#include <vtkUnsignedCharArray.h>
+
+
+// ============================================================================
+// Local helpers section
+// ============================================================================
+
+namespace {
+
+// Creating and destroying OpenGL contexts goes through process wide state in
+// some window system bindings, so it is serialized. Rendering is not.
+std::mutex& contextMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+}  // namespace
+
+
+// ============================================================================
+// Function Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// buildScene
+// ----------------------------------------------------------------------------
+//
+// Description: Populates a renderer with a cone scene and sets the camera
+//
+// Inputs:
+// - renderer: The renderer to populate
+// - description: Parameters of the scene
+//
+// Outputs: None
+//
+// Returns: The cone actor
+//
+// Side Effects: Resets the active camera of the renderer
+//
+// ----------------------------------------------------------------------------
+vtkSmartPointer<vtkActor> buildScene(
+    vtkRenderer* renderer,
+    const SceneDescription& description
+    )
+{
+    //Create a cone
+    auto cone_source = vtkSmartPointer<vtkConeSource>::New();
+    cone_source->SetHeight(description.cone_height);
+    cone_source->SetRadius(description.cone_radius);
+    cone_source->SetResolution(description.cone_resolution);
+    cone_source->Update();
+
+    //Create a mapper and actor
+    auto mapper = vtkSmartPointer<vtkPolyDataMapper>::New();
+    mapper->SetInputConnection(cone_source->GetOutputPort());
+
+    auto colors = vtkSmartPointer<vtkNamedColors>::New();
+
+    auto actor = vtkSmartPointer<vtkActor>::New();
+    actor->SetMapper(mapper);
+    actor->GetProperty()->SetDiffuseColor(
+        colors->GetColor3d(description.color).GetData()
+        );
+
+    //Add the actors to the scene
+    renderer->AddActor(actor);
+    renderer->SetBackground(
+        description.background[0],
+        description.background[1],
+        description.background[2]
+        );
+
+    // Set the camera position
+    renderer->ResetCamera();
+    renderer->GetActiveCamera()->Azimuth(description.azimuth);
+    renderer->GetActiveCamera()->Elevation(description.elevation);
+    renderer->GetActiveCamera()->OrthogonalizeViewUp();
+    renderer->ResetCameraClippingRange();
+
+    return actor;
+}
+
+// ----------------------------------------------------------------------------
+// sceneVariant
+// ----------------------------------------------------------------------------
+//
+// Description: Derives one of count distinct scenes from the default scene
+//
+// Inputs:
+// - index: Index of the variant, from 0 to count - 1
+// - count: Total number of variants
+//
+// Outputs: None
+//
+// Returns: The scene description
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+SceneDescription sceneVariant(int index, int count)
+{
+    static const char* const kColors[] = {
+        "bisque", "tomato", "banana", "peacock", "mint", "orchid"
+    };
+    constexpr int kColorCount = sizeof(kColors) / sizeof(kColors[0]);
+
+    SceneDescription description;
+    description.azimuth = 360.0 * index / std::max(1, count);
+    description.elevation = 15.0 + 30.0 * (index % 3);
+    description.cone_resolution = 8 + 8 * (index % 8);
+    description.color = kColors[index % kColorCount];
+
+    return description;
+}
+
+// ----------------------------------------------------------------------------
+// buildPartGrid
+// ----------------------------------------------------------------------------
+//
+// Description: Populates a renderer with an assembly of box parts on a
+//              cubic grid. Part sizes vary over more than an order of
+//              magnitude, so a zoomed out view has many sub-pixel parts.
+//              All parts share one mapper.
+//
+// Inputs:
+// - renderer: The renderer to populate
+// - count: Number of parts
+//
+// Outputs: None
+//
+// Returns: The part actors
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+std::vector<vtkSmartPointer<vtkActor>> buildPartGrid(
+    vtkRenderer* renderer,
+    int count
+    )
+{
+    std::vector<vtkSmartPointer<vtkActor>> parts;
+    if (count <= 0) {
+        return parts;
+    }
+
+    auto cube = vtkSmartPointer<vtkCubeSource>::New();
+    auto mapper = vtkSmartPointer<vtkPolyDataMapper>::New();
+    mapper->SetInputConnection(cube->GetOutputPort());
+    auto colors = vtkSmartPointer<vtkNamedColors>::New();
+    const vtkColor3d tint = colors->GetColor3d("bisque");
+
+    const int side = static_cast<int>(std::ceil(std::cbrt(double(count))));
+    parts.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        // Cheap deterministic scatter of sizes and shades
+        const std::uint32_t hash = std::uint32_t(i) * 2654435761u;
+        const double size = 0.05 + 0.75 * double(hash % 1000) / 1000.0;
+        const double shade = 0.6 + 0.4 * double((hash >> 10) % 100) / 100.0;
+
+        auto part = vtkSmartPointer<vtkActor>::New();
+        part->SetMapper(mapper);
+        part->SetScale(size);
+        part->SetPosition(
+            2.0 * (i % side),
+            2.0 * ((i / side) % side),
+            2.0 * (i / (side * side))
+            );
+        part->GetProperty()->SetColor(
+            tint[0] * shade, tint[1] * shade, tint[2] * shade
+            );
+        renderer->AddActor(part);
+        parts.push_back(part);
+    }
+
+    return parts;
+}
+
+
+// ============================================================================
+// OffscreenScene Constructor/Destructor Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// OffscreenScene::OffscreenScene
+// ----------------------------------------------------------------------------
+//
+// Description: Constructor. Creates the offscreen render window with an
+//              empty renderer, and its OpenGL context: left to the first
+//              Render(), the context would be created by threads rendering
+//              concurrently, outside the context lock. The context is
+//              released again, so any one thread can render with it.
+//
+// Inputs:
+// - width: Frame width in pixels
+// - height: Frame height in pixels
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+OffscreenScene::OffscreenScene(int width, int height)
+{
+    std::lock_guard<std::mutex> lock(contextMutex());
+
+    this->scene_renderer = vtkSmartPointer<vtkRenderer>::New();
+    this->render_window = vtkSmartPointer<vtkRenderWindow>::New();
+    this->render_window->SetOffScreenRendering(1);
+    this->render_window->SetSize(width, height);
+    this->render_window->AddRenderer(this->scene_renderer);
+    this->render_window->Initialize();
+    this->render_window->ReleaseCurrent();
+
+    this->grabber = vtkSmartPointer<vtkWindowToImageFilter>::New();
+    this->grabber->SetInput(this->render_window);
+    this->grabber->SetInputBufferTypeToRGB();
+    this->grabber->ReadFrontBufferOff();
+    this->grabber->ShouldRerenderOff();
+}
+
+// ----------------------------------------------------------------------------
+// OffscreenScene::~OffscreenScene
+// ----------------------------------------------------------------------------
+//
+// Description: Destructor
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Releases the OpenGL context
+//
+// ----------------------------------------------------------------------------
+OffscreenScene::~OffscreenScene()
+{
+    std::lock_guard<std::mutex> lock(contextMutex());
+
+    this->grabber = nullptr;
+    this->render_window->Finalize();
+    this->render_window = nullptr;
+}
+
+
+// ============================================================================
+// OffscreenScene Public Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// OffscreenScene::setScene
+// ----------------------------------------------------------------------------
+//
+// Description: Replaces the current scene. The render window, and with it
+//              the OpenGL context, is kept.
+//
+// Inputs:
+// - description: Parameters of the new scene
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void OffscreenScene::setScene(const SceneDescription& description)
+{
+    this->render_window->RemoveRenderer(this->scene_renderer);
+    this->scene_renderer = vtkSmartPointer<vtkRenderer>::New();
+    this->render_window->AddRenderer(this->scene_renderer);
+    buildScene(this->scene_renderer, description);
+}
+
+// ----------------------------------------------------------------------------
+// OffscreenScene::setSize
+// ----------------------------------------------------------------------------
+//
+// Description: Changes the size of rendered frames
+//
+// Inputs:
+// - width: Frame width in pixels
+// - height: Frame height in pixels
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void OffscreenScene::setSize(int width, int height)
+{
+    this->render_window->SetSize(width, height);
+}
+
+// ----------------------------------------------------------------------------
+// OffscreenScene::render
+// ----------------------------------------------------------------------------
+//
+// Description: Renders the current scene
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void OffscreenScene::render()
+{
+    this->render_window->Render();
+}
+
+// ----------------------------------------------------------------------------
+// OffscreenScene::capture
+// ----------------------------------------------------------------------------
+//
+// Description: Renders the scene and reads the pixels back
+//
+// Inputs: None
+//
+// Outputs:
+// - rgb: Tightly packed RGB rows, bottom to top
+// - width: Frame width in pixels
+// - height: Frame height in pixels
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void OffscreenScene::capture(
+    std::vector<unsigned char>& rgb,
+    int& width,
+    int& height
+    )
+{
+    this->render();
+    this->grabber->Modified();
+    this->grabber->Update();
+
+    vtkImageData* image = this->grabber->GetOutput();
+    int dimensions[3];
+    image->GetDimensions(dimensions);
+    width = dimensions[0];
+    height = dimensions[1];
+
+    auto pixels = vtkUnsignedCharArray::SafeDownCast(
+        image->GetPointData()->GetScalars()
+        );
+    if (pixels == nullptr) {
+        rgb.clear();
+        return;
+    }
+    const unsigned char* data = pixels->GetPointer(0);
+    rgb.assign(data, data + pixels->GetNumberOfValues());
+}
+
+// ----------------------------------------------------------------------------
+// OffscreenScene::writePng
+// ----------------------------------------------------------------------------
+//
+// Description: Renders the scene and saves the frame as a PNG file
+//
+// Inputs:
+// - path: Output file name
+//
+// Outputs: None
+//
+// Returns: true on success
+//
+// Side Effects: Writes the file
+//
+// ----------------------------------------------------------------------------
+bool OffscreenScene::writePng(const std::string& path)
+{
+    this->render();
+    this->grabber->Modified();
+
+    auto writer = vtkSmartPointer<vtkPNGWriter>::New();
+    writer->SetFileName(path.c_str());
+    writer->SetInputConnection(this->grabber->GetOutputPort());
+    writer->Write();
+
+    return writer->GetErrorCode() == 0;
+}
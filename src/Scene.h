@@ -0,0 +1,165 @@
+// ============================================================================
+// Scene.h - Scene construction shared by the GUI and the headless modes
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * Scene.h: created.
+// * Scene.h: added the synthetic assembly of parts.
+//
+// ============================================================================
+
+
+#ifndef Scene_H
+#define Scene_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// "C" system headers
+
+// Standard Library headers
+#include <string>
+#include <vector>
+
+// External libraries headers
+#include <vtkActor.h>
+#include <vtkRenderWindow.h>
+#include <vtkRenderer.h>
+#include <vtkSmartPointer.h>
+#include <vtkWindowToImageFilter.h>
+
+
+// ============================================================================
+// Structure Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// SceneDescription
+// ----------------------------------------------------------------------------
+//
+// Description: Everything needed to build one scene. The defaults reproduce
+//              the cone shown by the main window.
+//
+// Properties:
+// - cone_height: Height of the cone
+// - cone_radius: Base radius of the cone
+// - cone_resolution: Number of facets around the cone
+// - color: Named color (vtkNamedColors) of the cone
+// - background: Background color, components in the range 0 to 1
+// - azimuth: Camera azimuth applied after resetting the camera, in degrees
+// - elevation: Camera elevation applied after resetting the camera
+//
+// ----------------------------------------------------------------------------
+struct SceneDescription {
+    double cone_height = 3.0;
+    double cone_radius = 1.5;
+    int cone_resolution = 40;
+    std::string color = "bisque";
+    double background[3] = {7.0/255.0, 54.0/255.0, 66.0/255.0};
+    double azimuth = 30.0;
+    double elevation = 30.0;
+};
+
+
+// ============================================================================
+// Function Declarations Section
+// ============================================================================
+
+// Populates the renderer according to the description and positions the
+// camera. Returns the cone actor so callers can tweak or hide it.
+vtkSmartPointer<vtkActor> buildScene(
+    vtkRenderer* renderer,
+    const SceneDescription& description
+    );
+
+// Returns variant index of count: the camera orbits the cone and the color
+// and tessellation change, so batches of scenes are easy to tell apart.
+SceneDescription sceneVariant(int index, int count);
+
+// Adds count small parts of varying size on a cubic grid, a stand-in for
+// large assemblies when testing culling. Returns the part actors.
+std::vector<vtkSmartPointer<vtkActor>> buildPartGrid(
+    vtkRenderer* renderer,
+    int count
+    );
+
+
+// ============================================================================
+// Class Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// OffscreenScene
+// ----------------------------------------------------------------------------
+//
+// Description: An offscreen render window with its own renderer. Instances
+//              are independent of each other and of the GUI, so several of
+//              them can render at the same time on different threads, each
+//              with its own OpenGL context.
+//
+// Properties:
+// - render_window: Offscreen render window
+// - renderer: Renderer of the current scene
+// - grabber: Reads the rendered pixels back
+//
+// Methods:
+// - setScene: Replaces the scene with a new one
+// - setSize: Changes the frame size
+// - render: Renders the current scene
+// - capture: Renders and reads back RGB pixels
+// - writePng: Renders and saves the frame as a PNG file
+//
+// Example usage:
+//   OffscreenScene scene(800, 600);
+//   scene.setScene(SceneDescription());
+//   scene.writePng("cone.png");
+//
+// ----------------------------------------------------------------------------
+class OffscreenScene
+{
+public:
+    // Constructor/Destructor
+    OffscreenScene(int width, int height);
+    ~OffscreenScene();
+
+    OffscreenScene(const OffscreenScene&) = delete;
+    OffscreenScene& operator=(const OffscreenScene&) = delete;
+
+    void setScene(const SceneDescription& description);
+    void setSize(int width, int height);
+    void render();
+    void capture(std::vector<unsigned char>& rgb, int& width, int& height);
+    bool writePng(const std::string& path);
+
+    vtkRenderer* renderer() const { return this->scene_renderer; }
+    vtkRenderWindow* renderWindow() const { return this->render_window; }
+
+private:
+    vtkSmartPointer<vtkRenderWindow> render_window;
+    vtkSmartPointer<vtkRenderer> scene_renderer;
+    vtkSmartPointer<vtkWindowToImageFilter> grabber;
+};
+
+#endif  // Scene_H
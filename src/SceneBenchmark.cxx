@@ -0,0 +1,261 @@
+// ============================================================================
+// SceneBenchmark - Throughput of concurrent offscreen scene rendering
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// Renders the same batch of scenes with 1, 2, 4, ... threads using the
+// MultiSceneRenderer and prints frames per second and the speedup over a
+// single thread. Every pool renders one warm-up batch first, so context
+// creation does not skew the numbers.
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * SceneBenchmark.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header
+#include "MultiSceneRenderer.h"
+
+// "C" system headers
+
+// Standard Library headers
+#include <algorithm>   // required by max
+#include <chrono>      // required by steady_clock
+#include <cstdlib>     // required by EXIT_SUCCESS, EXIT_FAILURE
+#include <filesystem>  // Used for testing directory and file status
+#include <iomanip>     // required by setw
+#include <iostream>    // required by cin, cout, ...
+#include <string>      // self explanatory ...
+#include <thread>      // required by hardware_concurrency
+#include <vector>      // self explanatory ...
+
+// External libraries headers
+#include <clipp.hpp>  // command line arguments parsing
+
+
+// ============================================================================
+// Define namespace aliases
+// ============================================================================
+
+namespace fs = std::filesystem;
+
+
+// ============================================================================
+// Global constants section
+// ============================================================================
+
+const std::string kAppName = "QtVTKSceneBench";
+const std::string kVersionString = "0.1";
+const std::string kYearString = "yyyy";
+const std::string kAuthorName = "Ljubomir Kurij";
+const std::string kAuthorEmail = "ljubomir_kurij@protonmail.com";
+const std::string kAppDoc = "\
+Measures how offscreen rendering of independent scenes scales with the\n\
+number of render threads.\n\n\
+Mandatory arguments to long options are mandatory for short options too.\n";
+const std::string kLicense = "\
+License GPLv3+: GNU GPL version 3 or later <http://gnu.org/licenses/gpl.html>\n\
+This is free software: you are free to change and redistribute it.\n\
+There is NO WARRANTY, to the extent permitted by law.\n";
+
+
+// ============================================================================
+// Global variables section
+// ============================================================================
+
+static std::string exec_name = kAppName;
+
+
+// ============================================================================
+// Utility function prototypes
+// ============================================================================
+
+void printShortHelp(std::string = kAppName);
+void printVersionInfo();
+void showHelp(
+        const clipp::group&,
+        const std::string = kAppName,
+        const std::string = kAppDoc
+    );
+
+
+// ============================================================================
+// App's main function body
+// ============================================================================
+
+int main(int argc, char* argv[])
+{
+    // Determine the exec name under wich program is beeing executed
+    fs::path exec_path {argv[0]};
+    exec_name = exec_path.filename().string();
+
+    // Define structures to store command line options arguments and validators
+    struct CLIArguments {
+        bool show_help;
+        bool show_version;
+        int  frames;
+        int  max_threads;
+        int  frame_width;
+        int  frame_height;
+    };
+
+    CLIArguments user_options {
+        false, false, 64,
+        static_cast<int>(std::max(1U, std::thread::hardware_concurrency())),
+        800, 600
+    };
+
+    // Unsupported options aggregator.
+    std::vector<std::string> unknown_options;
+
+    // Set command line options
+    auto cli = (
+        (
+            clipp::option("-h", "--help").set(user_options.show_help)
+                .doc("show this help message and exit"),
+            clipp::option("-V", "--version").set(user_options.show_version)
+                .doc("print program version")
+        ).doc("general options:"),
+        (
+            (
+                clipp::option("-n", "--frames")
+                & clipp::integer("count", user_options.frames)
+            ) % "scenes rendered per measurement (default: 64)",
+            (
+                clipp::option("--max-threads")
+                & clipp::integer("n", user_options.max_threads)
+            ) % "largest thread count to measure (default: one per core)",
+            (
+                clipp::option("--frame-size")
+                & clipp::integer("width", user_options.frame_width)
+                & clipp::integer("height", user_options.frame_height)
+            ) % "size of rendered frames in pixels (default: 800 600)"
+        ).doc("benchmark options:"),
+        clipp::any_other(unknown_options)
+    );
+
+    // Parse command line options
+    if (!clipp::parse(argc, argv, cli) || !unknown_options.empty()) {
+        std::cerr << "Unknown options: ";
+        for (const auto& opt : unknown_options) {
+            std::cerr << opt << " ";
+        }
+        std::cerr << "\n";
+        printShortHelp(exec_name);
+
+        return EXIT_FAILURE;
+    }
+    if (user_options.show_help) {
+        showHelp(cli, exec_name);
+
+        return EXIT_SUCCESS;
+    }
+    if (user_options.show_version) {
+        printVersionInfo();
+
+        return EXIT_SUCCESS;
+    }
+
+    const int frames = std::max(1, user_options.frames);
+    std::vector<SceneJob> jobs(frames);
+    for (int i = 0; i < frames; ++i) {
+        jobs[i].scene = sceneVariant(i, frames);
+        jobs[i].width = std::max(1, user_options.frame_width);
+        jobs[i].height = std::max(1, user_options.frame_height);
+    }
+
+    std::cout << std::setw(8) << "threads" << std::setw(12) << "frames/s"
+        << std::setw(10) << "speedup" << "\n";
+
+    double single_thread_rate = 0.0;
+    for (int threads = 1;
+         threads <= std::max(1, user_options.max_threads);
+         threads *= 2) {
+        MultiSceneRenderer pool(threads);
+        pool.render(jobs);  // Warm-up: creates the contexts
+
+        const auto started = std::chrono::steady_clock::now();
+        const std::vector<SceneResult> results = pool.render(jobs);
+        const double seconds = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - started
+            ).count();
+
+        for (const auto& result : results) {
+            if (!result.success) {
+                std::cerr << exec_name << ": rendering failed\n";
+
+                return EXIT_FAILURE;
+            }
+        }
+
+        const double rate = frames / seconds;
+        if (threads == 1) {
+            single_thread_rate = rate;
+        }
+        std::cout << std::setw(8) << threads
+            << std::setw(12) << std::fixed << std::setprecision(1) << rate
+            << std::setw(9) << std::setprecision(2)
+            << rate / single_thread_rate << "x\n";
+    }
+
+    return EXIT_SUCCESS;
+}
+
+
+// ============================================================================
+// Function definitions
+// ============================================================================
+
+inline void printShortHelp(std::string exec_name) {
+    std::cout << "Try '" << exec_name << " --help' for more information.\n";
+}
+
+
+void printVersionInfo() {
+    std::cout << kAppName << " " << kVersionString << " Copyright (C) "
+        << kYearString << " " << kAuthorName << "\n"
+        << kLicense;
+}
+
+
+void showHelp(
+        const clipp::group& group,
+        const std::string exec_name,
+        const std::string doc
+        ) {
+    auto fmt = clipp::doc_formatting {}.first_column(0).last_column(79);
+    clipp::man_page man;
+
+    man.prepend_section(
+        "USAGE", clipp::usage_lines(group, exec_name, fmt).str()
+        );
+    man.append_section("", doc);
+    man.append_section("", clipp::documentation(group, fmt).str());
+    man.append_section("", "Report bugs to <" + kAuthorEmail + ">.");
+
+    std::cout << man;
+}
@@ -0,0 +1,1300 @@
+// ============================================================================
+// SceneScript.cxx - Implementation of the declarative scene files
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * SceneScript.cxx: created.
+// * SceneScript.cxx: the statement helpers moved to ScriptSyntax.cxx.
+// * SceneScript.cxx: meshes of the readers are tracked by the memory
+//   budget.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header -------------------------------------------------------------
+#include "SceneScript.h"
+#include "MemoryBudget.h"
+#include "MeshPreprocessor.h"
+#include "ScriptSyntax.h"
+
+// "C" system headers ---------------------------------------------------------
+
+// Standard Library headers ---------------------------------------------------
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <set>
+#include <sstream>
+
+// External libraries headers -------------------------------------------------
+
+// VTK headers
+#include <vtkAlgorithm.h>
+#include <vtkArrowSource.h>
+#include <vtkCamera.h>
+#include <vtkClipPolyData.h>
+#include <vtkConeSource.h>
+#include <vtkCubeSource.h>
+#include <vtkCylinderSource.h>
+#include <vtkElevationFilter.h>
+#include <vtkNamedColors.h>
+#include <vtkPlane.h>
+#include <vtkPlaneSource.h>
+#include <vtkPolyDataMapper.h>
+#include <vtkPolyDataNormals.h>
+#include <vtkProperty.h>
+#include <vtkQuadricDecimation.h>
+#include <vtkShrinkPolyData.h>
+#include <vtkSphereSource.h>
+#include <vtkTransform.h>
+#include <vtkTransformPolyDataFilter.h>
+#include <vtkTriangleFilter.h>
+#include <vtkTrivialProducer.h>
+#include <vtkTubeFilter.h>
+#include <vtkWindowedSincPolyDataFilter.h>
+
+
+// ============================================================================
+// Define namespace aliases
+// ============================================================================
+
+namespace fs = std::filesystem;
+
+
+// ============================================================================
+// Local helpers section
+// ============================================================================
+
+namespace {
+
+// One parameter of a source or filter: number of components and how to set
+// it on the algorithm
+struct Parameter {
+    std::size_t size = 1;
+    std::function<void(vtkAlgorithm*, const double*)> apply;
+};
+
+// A source or filter type
+struct NodeType {
+    std::function<vtkSmartPointer<vtkAlgorithm>()> create;
+    std::map<std::string, Parameter> params;
+    bool ordered = false;  // Parameters compose in the order written
+};
+
+template <typename T, typename F>
+Parameter param(std::size_t size, F apply)
+{
+    Parameter parameter;
+    parameter.size = size;
+    parameter.apply = [apply](vtkAlgorithm* algorithm, const double* value) {
+        apply(static_cast<T*>(algorithm), value);
+    };
+    return parameter;
+}
+
+template <typename T>
+std::function<vtkSmartPointer<vtkAlgorithm>()> factory()
+{
+    return []() -> vtkSmartPointer<vtkAlgorithm> {
+        return vtkSmartPointer<T>::New();
+    };
+}
+
+const std::map<std::string, NodeType>& sourceTypes()
+{
+    static const std::map<std::string, NodeType> types = {
+        {"cone", {factory<vtkConeSource>(), {
+            {"height", param<vtkConeSource>(1,
+                [](vtkConeSource* s, const double* v) {
+                    s->SetHeight(v[0]);
+                })},
+            {"radius", param<vtkConeSource>(1,
+                [](vtkConeSource* s, const double* v) {
+                    s->SetRadius(v[0]);
+                })},
+            {"resolution", param<vtkConeSource>(1,
+                [](vtkConeSource* s, const double* v) {
+                    s->SetResolution(static_cast<int>(v[0]));
+                })},
+            {"center", param<vtkConeSource>(3,
+                [](vtkConeSource* s, const double* v) {
+                    s->SetCenter(v[0], v[1], v[2]);
+                })},
+            {"direction", param<vtkConeSource>(3,
+                [](vtkConeSource* s, const double* v) {
+                    s->SetDirection(v[0], v[1], v[2]);
+                })},
+            {"capping", param<vtkConeSource>(1,
+                [](vtkConeSource* s, const double* v) {
+                    s->SetCapping(v[0] != 0.0);
+                })}
+        }}},
+        {"sphere", {factory<vtkSphereSource>(), {
+            {"radius", param<vtkSphereSource>(1,
+                [](vtkSphereSource* s, const double* v) {
+                    s->SetRadius(v[0]);
+                })},
+            {"center", param<vtkSphereSource>(3,
+                [](vtkSphereSource* s, const double* v) {
+                    s->SetCenter(v[0], v[1], v[2]);
+                })},
+            {"resolution", param<vtkSphereSource>(1,
+                [](vtkSphereSource* s, const double* v) {
+                    s->SetThetaResolution(static_cast<int>(v[0]));
+                    s->SetPhiResolution(static_cast<int>(v[0]));
+                })},
+            {"theta_resolution", param<vtkSphereSource>(1,
+                [](vtkSphereSource* s, const double* v) {
+                    s->SetThetaResolution(static_cast<int>(v[0]));
+                })},
+            {"phi_resolution", param<vtkSphereSource>(1,
+                [](vtkSphereSource* s, const double* v) {
+                    s->SetPhiResolution(static_cast<int>(v[0]));
+                })}
+        }}},
+        {"cube", {factory<vtkCubeSource>(), {
+            {"x_length", param<vtkCubeSource>(1,
+                [](vtkCubeSource* s, const double* v) {
+                    s->SetXLength(v[0]);
+                })},
+            {"y_length", param<vtkCubeSource>(1,
+                [](vtkCubeSource* s, const double* v) {
+                    s->SetYLength(v[0]);
+                })},
+            {"z_length", param<vtkCubeSource>(1,
+                [](vtkCubeSource* s, const double* v) {
+                    s->SetZLength(v[0]);
+                })},
+            {"center", param<vtkCubeSource>(3,
+                [](vtkCubeSource* s, const double* v) {
+                    s->SetCenter(v[0], v[1], v[2]);
+                })}
+        }}},
+        {"cylinder", {factory<vtkCylinderSource>(), {
+            {"radius", param<vtkCylinderSource>(1,
+                [](vtkCylinderSource* s, const double* v) {
+                    s->SetRadius(v[0]);
+                })},
+            {"height", param<vtkCylinderSource>(1,
+                [](vtkCylinderSource* s, const double* v) {
+                    s->SetHeight(v[0]);
+                })},
+            {"resolution", param<vtkCylinderSource>(1,
+                [](vtkCylinderSource* s, const double* v) {
+                    s->SetResolution(static_cast<int>(v[0]));
+                })},
+            {"center", param<vtkCylinderSource>(3,
+                [](vtkCylinderSource* s, const double* v) {
+                    s->SetCenter(v[0], v[1], v[2]);
+                })},
+            {"capping", param<vtkCylinderSource>(1,
+                [](vtkCylinderSource* s, const double* v) {
+                    s->SetCapping(v[0] != 0.0);
+                })}
+        }}},
+        {"plane", {factory<vtkPlaneSource>(), {
+            {"origin", param<vtkPlaneSource>(3,
+                [](vtkPlaneSource* s, const double* v) {
+                    s->SetOrigin(v[0], v[1], v[2]);
+                })},
+            {"point1", param<vtkPlaneSource>(3,
+                [](vtkPlaneSource* s, const double* v) {
+                    s->SetPoint1(v[0], v[1], v[2]);
+                })},
+            {"point2", param<vtkPlaneSource>(3,
+                [](vtkPlaneSource* s, const double* v) {
+                    s->SetPoint2(v[0], v[1], v[2]);
+                })},
+            {"resolution", param<vtkPlaneSource>(2,
+                [](vtkPlaneSource* s, const double* v) {
+                    s->SetResolution(
+                        static_cast<int>(v[0]),
+                        static_cast<int>(v[1])
+                        );
+                })}
+        }}},
+        {"arrow", {factory<vtkArrowSource>(), {
+            {"tip_length", param<vtkArrowSource>(1,
+                [](vtkArrowSource* s, const double* v) {
+                    s->SetTipLength(v[0]);
+                })},
+            {"tip_radius", param<vtkArrowSource>(1,
+                [](vtkArrowSource* s, const double* v) {
+                    s->SetTipRadius(v[0]);
+                })},
+            {"tip_resolution", param<vtkArrowSource>(1,
+                [](vtkArrowSource* s, const double* v) {
+                    s->SetTipResolution(static_cast<int>(v[0]));
+                })},
+            {"shaft_radius", param<vtkArrowSource>(1,
+                [](vtkArrowSource* s, const double* v) {
+                    s->SetShaftRadius(v[0]);
+                })},
+            {"shaft_resolution", param<vtkArrowSource>(1,
+                [](vtkArrowSource* s, const double* v) {
+                    s->SetShaftResolution(static_cast<int>(v[0]));
+                })}
+        }}}
+    };
+    return types;
+}
+
+const std::map<std::string, NodeType>& filterTypes()
+{
+    // The clip plane and the transform are created with their filter
+    auto clip = []() -> vtkSmartPointer<vtkAlgorithm> {
+        auto filter = vtkSmartPointer<vtkClipPolyData>::New();
+        filter->SetClipFunction(vtkSmartPointer<vtkPlane>::New());
+        return filter;
+    };
+    auto transform = []() -> vtkSmartPointer<vtkAlgorithm> {
+        auto filter = vtkSmartPointer<vtkTransformPolyDataFilter>::New();
+        auto matrix = vtkSmartPointer<vtkTransform>::New();
+        matrix->PostMultiply();
+        filter->SetTransform(matrix);
+        return filter;
+    };
+    auto plane = [](vtkClipPolyData* filter) {
+        return static_cast<vtkPlane*>(filter->GetClipFunction());
+    };
+    auto matrix = [](vtkTransformPolyDataFilter* filter) {
+        return static_cast<vtkTransform*>(filter->GetTransform());
+    };
+
+    static const std::map<std::string, NodeType> types = {
+        {"smooth", {factory<vtkWindowedSincPolyDataFilter>(), {
+            {"iterations", param<vtkWindowedSincPolyDataFilter>(1,
+                [](vtkWindowedSincPolyDataFilter* f, const double* v) {
+                    f->SetNumberOfIterations(static_cast<int>(v[0]));
+                })},
+            {"pass_band", param<vtkWindowedSincPolyDataFilter>(1,
+                [](vtkWindowedSincPolyDataFilter* f, const double* v) {
+                    f->SetPassBand(v[0]);
+                })},
+            {"feature_angle", param<vtkWindowedSincPolyDataFilter>(1,
+                [](vtkWindowedSincPolyDataFilter* f, const double* v) {
+                    f->FeatureEdgeSmoothingOn();
+                    f->SetFeatureAngle(v[0]);
+                })},
+            {"boundary_smoothing", param<vtkWindowedSincPolyDataFilter>(1,
+                [](vtkWindowedSincPolyDataFilter* f, const double* v) {
+                    f->SetBoundarySmoothing(v[0] != 0.0);
+                })}
+        }}},
+        {"decimate", {factory<vtkQuadricDecimation>(), {
+            {"reduction", param<vtkQuadricDecimation>(1,
+                [](vtkQuadricDecimation* f, const double* v) {
+                    f->SetTargetReduction(v[0]);
+                })}
+        }}},
+        {"clip", {clip, {
+            {"origin", param<vtkClipPolyData>(3,
+                [plane](vtkClipPolyData* f, const double* v) {
+                    plane(f)->SetOrigin(v[0], v[1], v[2]);
+                })},
+            {"normal", param<vtkClipPolyData>(3,
+                [plane](vtkClipPolyData* f, const double* v) {
+                    plane(f)->SetNormal(v[0], v[1], v[2]);
+                })},
+            {"inside_out", param<vtkClipPolyData>(1,
+                [](vtkClipPolyData* f, const double* v) {
+                    f->SetInsideOut(v[0] != 0.0);
+                })}
+        }}},
+        {"normals", {factory<vtkPolyDataNormals>(), {
+            {"feature_angle", param<vtkPolyDataNormals>(1,
+                [](vtkPolyDataNormals* f, const double* v) {
+                    f->SetFeatureAngle(v[0]);
+                })},
+            {"splitting", param<vtkPolyDataNormals>(1,
+                [](vtkPolyDataNormals* f, const double* v) {
+                    f->SetSplitting(v[0] != 0.0);
+                })},
+            {"flip", param<vtkPolyDataNormals>(1,
+                [](vtkPolyDataNormals* f, const double* v) {
+                    f->SetFlipNormals(v[0] != 0.0);
+                })}
+        }}},
+        {"shrink", {factory<vtkShrinkPolyData>(), {
+            {"factor", param<vtkShrinkPolyData>(1,
+                [](vtkShrinkPolyData* f, const double* v) {
+                    f->SetShrinkFactor(v[0]);
+                })}
+        }}},
+        {"elevation", {factory<vtkElevationFilter>(), {
+            {"low_point", param<vtkElevationFilter>(3,
+                [](vtkElevationFilter* f, const double* v) {
+                    f->SetLowPoint(v[0], v[1], v[2]);
+                })},
+            {"high_point", param<vtkElevationFilter>(3,
+                [](vtkElevationFilter* f, const double* v) {
+                    f->SetHighPoint(v[0], v[1], v[2]);
+                })}
+        }}},
+        {"tube", {factory<vtkTubeFilter>(), {
+            {"radius", param<vtkTubeFilter>(1,
+                [](vtkTubeFilter* f, const double* v) {
+                    f->SetRadius(v[0]);
+                })},
+            {"sides", param<vtkTubeFilter>(1,
+                [](vtkTubeFilter* f, const double* v) {
+                    f->SetNumberOfSides(static_cast<int>(v[0]));
+                })}
+        }}},
+        {"triangulate", {factory<vtkTriangleFilter>(), {}}},
+        {"transform", {transform, {
+            {"translate", param<vtkTransformPolyDataFilter>(3,
+                [matrix](vtkTransformPolyDataFilter* f, const double* v) {
+                    matrix(f)->Translate(v[0], v[1], v[2]);
+                })},
+            {"rotate_x", param<vtkTransformPolyDataFilter>(1,
+                [matrix](vtkTransformPolyDataFilter* f, const double* v) {
+                    matrix(f)->RotateX(v[0]);
+                })},
+            {"rotate_y", param<vtkTransformPolyDataFilter>(1,
+                [matrix](vtkTransformPolyDataFilter* f, const double* v) {
+                    matrix(f)->RotateY(v[0]);
+                })},
+            {"rotate_z", param<vtkTransformPolyDataFilter>(1,
+                [matrix](vtkTransformPolyDataFilter* f, const double* v) {
+                    matrix(f)->RotateZ(v[0]);
+                })},
+            {"scale", param<vtkTransformPolyDataFilter>(3,
+                [matrix](vtkTransformPolyDataFilter* f, const double* v) {
+                    matrix(f)->Scale(v[0], v[1], v[2]);
+                })}
+        }, true}}
+    };
+    return types;
+}
+
+const std::set<std::string> kActorParams = {
+    "color", "opacity", "representation", "position", "orientation",
+    "scale", "line_width", "point_size", "scalars", "edges", "specular"
+};
+const std::set<std::string> kCameraParams = {
+    "position", "focal_point", "view_up", "azimuth", "elevation", "roll",
+    "zoom", "view_angle", "parallel", "parallel_scale"
+};
+const std::set<std::string> kOutputParams = {
+    "image", "video", "size", "frames", "fps"
+};
+
+// A color is a vtkNamedColors name or r,g,b components in 0..1
+bool parseColor(const std::string& text, double rgb[3])
+{
+    std::vector<double> values;
+    if (parseNumbers(text, 3, &values)) {
+        std::copy(values.begin(), values.end(), rgb);
+        return true;
+    }
+
+    auto colors = vtkSmartPointer<vtkNamedColors>::New();
+    if (!colors->ColorExists(text)) {
+        return false;
+    }
+    colors->GetColorRGB(text, rgb);
+
+    return true;
+}
+
+// Numbers in a canonical form, so 3, 3.0 and 3e0 give the same node key
+std::string canonical(const std::vector<double>& values)
+{
+    std::string text;
+    char buffer[32];
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        std::snprintf(buffer, sizeof(buffer), "%.17g", values[i]);
+        text += (i ? "," : "") + std::string(buffer);
+    }
+    return text;
+}
+
+const std::string* findParam(
+    const std::vector<std::pair<std::string, std::string>>& params,
+    const std::string& key
+    )
+{
+    for (const auto& param : params) {
+        if (param.first == key) {
+            return &param.second;
+        }
+    }
+    return nullptr;
+}
+
+}  // namespace
+
+
+// ============================================================================
+// SceneScript Constructor/Destructor Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// SceneScript::~SceneScript
+// ----------------------------------------------------------------------------
+//
+// Description: Destructor. Takes the actors of the last build out of their
+//              renderer.
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Changes the renderer of the last build, removes the reader
+//               meshes from the global memory budget
+//
+// ----------------------------------------------------------------------------
+SceneScript::~SceneScript()
+{
+    if (this->target) {
+        for (const auto& actor : this->built_actors) {
+            this->target->RemoveActor(actor);
+        }
+    }
+    for (const auto& entry : this->reader_memory) {
+        MemoryBudget::global().untrack(entry.second);
+    }
+}
+
+
+// ============================================================================
+// SceneScript Public Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// SceneScript::load
+// ----------------------------------------------------------------------------
+//
+// Description: Reads and parses a scene file. Relative file names in the
+//              scene are resolved against the directory of the file.
+//
+// Inputs:
+// - path: The scene file
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool SceneScript::load(const std::string& path, std::string* error)
+{
+    std::ifstream file(path);
+    if (!file) {
+        if (error) {
+            *error = "cannot open " + path;
+        }
+        return false;
+    }
+
+    std::stringstream text;
+    text << file.rdbuf();
+
+    return this->parse(
+        text.str(),
+        path,
+        fs::path(path).parent_path().string(),
+        error
+        );
+}
+
+// ----------------------------------------------------------------------------
+// SceneScript::parse
+// ----------------------------------------------------------------------------
+//
+// Description: Parses scene text and checks everything that does not
+//              depend on variable values: keywords, names and references,
+//              types and parameter names. Replaces the statements of an
+//              earlier parse; pipelines cached by earlier builds are kept
+//              and reused where the new scene has the same nodes.
+//
+// Inputs:
+// - text: The scene
+// - origin: Name of the scene in error messages
+// - base_dir: Directory relative file names are resolved against
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool SceneScript::parse(
+    const std::string& text,
+    const std::string& origin,
+    const std::string& base_dir,
+    std::string* error
+    )
+{
+    this->statements.clear();
+    this->defaults.clear();
+    this->origin = origin;
+    this->base_dir = base_dir;
+
+    // Kind of every declared name, to check references
+    std::map<std::string, std::string> declared;
+    std::set<std::string> singletons;
+
+    std::stringstream stream(text);
+    std::string line;
+    int number = 0;
+    while (std::getline(stream, line)) {
+        Statement statement;
+        statement.line = ++number;
+
+        std::vector<std::string> words;
+        if (!tokenizeStatement(line, &words)) {
+            return this->fail(statement, "unterminated quote", error);
+        }
+        if (words.empty()) {
+            continue;
+        }
+
+        statement.kind = words[0];
+        const std::string& kind = statement.kind;
+        const bool declares = kind == "source" || kind == "reader"
+            || kind == "filter" || kind == "actor";
+        if (!declares && kind != "set" && kind != "camera"
+            && kind != "background" && kind != "output") {
+            return this->fail(statement, "unknown statement " + kind, error);
+        }
+
+        std::size_t first = 1;
+        if (declares) {
+            if (words.size() < 2 || words[1].find('=') != std::string::npos) {
+                return this->fail(statement, kind + " needs a name", error);
+            }
+            statement.name = words[1];
+            if (declared.count(statement.name)) {
+                return this->fail(
+                    statement,
+                    statement.name + " is already declared",
+                    error
+                    );
+            }
+            first = 2;
+        } else if (kind != "set" && !singletons.insert(kind).second) {
+            return this->fail(statement, kind + " given twice", error);
+        }
+
+        for (std::size_t i = first; i < words.size(); ++i) {
+            const std::size_t equals = words[i].find('=');
+            if (equals == std::string::npos || equals == 0) {
+                return this->fail(
+                    statement,
+                    "expected key=value, got " + words[i],
+                    error
+                    );
+            }
+            statement.params.emplace_back(
+                words[i].substr(0, equals),
+                words[i].substr(equals + 1)
+                );
+        }
+
+        // Check parameter names and references
+        const std::map<std::string, NodeType>* types = nullptr;
+        const std::set<std::string>* known = nullptr;
+        if (kind == "source") {
+            types = &sourceTypes();
+        } else if (kind == "filter") {
+            types = &filterTypes();
+        } else if (kind == "actor") {
+            known = &kActorParams;
+        } else if (kind == "camera") {
+            known = &kCameraParams;
+        } else if (kind == "output") {
+            known = &kOutputParams;
+        }
+
+        const NodeType* type = nullptr;
+        if (types) {
+            const std::string* name = findParam(statement.params, "type");
+            if (!name) {
+                return this->fail(statement, kind + " needs a type", error);
+            }
+            auto found = types->find(*name);
+            if (found == types->end()) {
+                return this->fail(
+                    statement,
+                    "unknown " + kind + " type " + *name,
+                    error
+                    );
+            }
+            type = &found->second;
+        }
+
+        for (const auto& param : statement.params) {
+            const std::string& key = param.first;
+            bool valid = false;
+            if (kind == "set") {
+                this->defaults[key] = param.second;
+                valid = true;
+            } else if (kind == "reader") {
+                valid = key == "file";
+            } else if (kind == "background") {
+                valid = key == "color";
+            } else if (type) {
+                valid = key == "type" || (kind == "filter" && key == "input")
+                    || type->params.count(key);
+            } else if (known) {
+                valid = key == "input" ? kind == "actor" : known->count(key);
+            }
+            if (!valid) {
+                return this->fail(
+                    statement,
+                    "unknown parameter " + key + " of " + kind,
+                    error
+                    );
+            }
+        }
+
+        if (kind == "reader" && !findParam(statement.params, "file")) {
+            return this->fail(statement, "reader needs a file", error);
+        }
+        if (kind == "filter" || kind == "actor") {
+            const std::string* input = findParam(statement.params, "input");
+            if (!input) {
+                return this->fail(statement, kind + " needs an input", error);
+            }
+            auto source = declared.find(*input);
+            if (source == declared.end() || source->second == "actor") {
+                return this->fail(
+                    statement,
+                    *input + " is not a source, reader or filter declared "
+                    "before",
+                    error
+                    );
+            }
+        }
+
+        if (declares) {
+            declared[statement.name] = kind;
+        }
+        this->statements.push_back(std::move(statement));
+    }
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// SceneScript::setVariable
+// ----------------------------------------------------------------------------
+//
+// Description: Sets a variable for the following builds, overriding the
+//              value set by the scene
+//
+// Inputs:
+// - name: Variable name, as used in ${name}
+// - value: Its text
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void SceneScript::setVariable(
+    const std::string& name,
+    const std::string& value
+    )
+{
+    this->overrides[name] = value;
+}
+
+// ----------------------------------------------------------------------------
+// SceneScript::hasOutput
+// ----------------------------------------------------------------------------
+//
+// Description: Tells whether the scene has an output statement, i.e. is
+//              meant to run headlessly
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: true if the scene declares an output
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool SceneScript::hasOutput() const
+{
+    return std::any_of(
+        this->statements.begin(),
+        this->statements.end(),
+        [](const Statement& statement) {
+            return statement.kind == "output";
+        });
+}
+
+// ----------------------------------------------------------------------------
+// SceneScript::build
+// ----------------------------------------------------------------------------
+//
+// Description: Resolves the variables, creates the nodes missing from the
+//              pipeline cache and puts the actors, background and camera of
+//              the scene into the renderer. Nodes no longer used are dropped
+//              from the cache. The camera is set from scratch every build,
+//              so the same variables always give the same view. On failure
+//              the renderer and the cache are left as they were.
+//
+// Inputs:
+// - renderer: The renderer to fill
+//
+// Outputs:
+// - stats: What was done, if not null
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: Reads mesh files of new readers, replaces the actors of the
+//               previous build and resets the active camera
+//
+// ----------------------------------------------------------------------------
+bool SceneScript::build(
+    vtkRenderer* renderer,
+    SceneBuildStats* stats,
+    std::string* error
+    )
+{
+    const auto start = std::chrono::steady_clock::now();
+    SceneBuildStats counts;
+
+    // Readers evicted since the last build are read again when needed
+    {
+        std::lock_guard<std::mutex> lock(this->evicted->mutex);
+        for (const std::string& key : this->evicted->keys) {
+            this->cache.erase(key);
+        }
+        this->evicted->keys.clear();
+    }
+    this->releaseReaders();
+
+    std::map<std::string, vtkSmartPointer<vtkObject>> next_cache;
+    std::map<std::string, std::string> keys;  // Node key by name
+    std::vector<vtkSmartPointer<vtkActor>> actors;
+    SceneOutput output;
+    double background[3] = {0.0, 0.0, 0.0};
+    bool has_background = false;
+    bool has_camera = false;
+    std::map<std::string, std::vector<double>> camera_values;
+
+    // Looks a node up in this build, then in the previous one
+    auto lookup = [&](const std::string& key) -> vtkObject* {
+        auto found = next_cache.find(key);
+        if (found == next_cache.end()) {
+            auto kept = this->cache.find(key);
+            if (kept == this->cache.end()) {
+                return nullptr;
+            }
+            found = next_cache.insert(*kept).first;
+        }
+        ++counts.reused;
+        return found->second;
+    };
+
+    for (const Statement& statement : this->statements) {
+        const std::string& kind = statement.kind;
+        if (kind == "set") {
+            continue;
+        }
+
+        // Resolve the variables of every parameter
+        std::vector<std::pair<std::string, std::string>> params;
+        for (const auto& param : statement.params) {
+            std::string value;
+            if (!this->resolve(statement, param.second, &value, error)) {
+                return false;
+            }
+            params.emplace_back(param.first, value);
+        }
+        const std::string* input = findParam(params, "input");
+        const std::string input_key = input ? keys[*input] : "";
+
+        if (kind == "source" || kind == "filter") {
+            ++counts.nodes;
+            const NodeType& type = (kind == "source"
+                ? sourceTypes()
+                : filterTypes()).at(*findParam(params, "type"));
+
+            // Parse the values and build the key of the node
+            std::vector<std::pair<const Parameter*, std::vector<double>>>
+                values;
+            std::vector<std::string> key_items;
+            for (const auto& param : params) {
+                if (param.first == "type" || param.first == "input") {
+                    continue;
+                }
+                const Parameter& parameter = type.params.at(param.first);
+                std::vector<double> numbers;
+                if (!parseNumbers(param.second, parameter.size, &numbers)) {
+                    return this->fail(
+                        statement,
+                        param.first + " takes " + std::to_string(
+                            parameter.size) + " number(s), got "
+                            + param.second,
+                        error
+                        );
+                }
+                key_items.push_back(param.first + "=" + canonical(numbers));
+                values.emplace_back(&parameter, std::move(numbers));
+            }
+            if (!type.ordered) {
+                std::sort(key_items.begin(), key_items.end());
+            }
+            std::string key = *findParam(params, "type") + "{";
+            for (const auto& item : key_items) {
+                key += item + ";";
+            }
+            key += "}(" + input_key + ")";
+
+            if (!lookup(key)) {
+                vtkSmartPointer<vtkAlgorithm> algorithm = type.create();
+                for (const auto& value : values) {
+                    value.first->apply(algorithm, value.second.data());
+                }
+                if (input) {
+                    algorithm->SetInputConnection(
+                        vtkAlgorithm::SafeDownCast(next_cache[input_key])
+                            ->GetOutputPort()
+                        );
+                }
+                next_cache[key] = algorithm;
+                ++counts.created;
+            }
+            keys[statement.name] = key;
+        } else if (kind == "reader") {
+            ++counts.nodes;
+            fs::path path = *findParam(params, "file");
+            if (path.is_relative() && !this->base_dir.empty()) {
+                path = fs::path(this->base_dir) / path;
+            }
+
+            // A changed file is a new node
+            std::error_code status;
+            const auto stamp = fs::last_write_time(path, status);
+            const std::string key = "reader(" + path.lexically_normal()
+                .string() + "@" + std::to_string(
+                    stamp.time_since_epoch().count()) + ")";
+
+            if (!lookup(key)) {
+                // Make room first, the file size is the best estimate known
+                std::error_code unknown;
+                const std::uintmax_t size = fs::file_size(path, unknown);
+                MemoryBudget::global().enforce(unknown ? 0 : size);
+
+                std::string message;
+                vtkSmartPointer<vtkPolyData> mesh =
+                    readMesh(path.string(), &message);
+                if (!mesh) {
+                    return this->fail(statement, message, error);
+                }
+                auto producer = vtkSmartPointer<vtkTrivialProducer>::New();
+                producer->SetOutput(mesh);
+                next_cache[key] = producer;
+                ++counts.created;
+
+                // Eviction only drops the cache entry, the actors showing
+                // the mesh keep it until the next build replaces them
+                std::shared_ptr<EvictedReaders> evicted = this->evicted;
+                this->reader_memory[key] = MemoryBudget::global().track(
+                    mesh,
+                    CacheTier::Primary,
+                    [evicted, key]() {
+                        std::lock_guard<std::mutex> lock(evicted->mutex);
+                        evicted->keys.insert(key);
+                    },
+                    path.filename().string()
+                    );
+            }
+            keys[statement.name] = key;
+        } else if (kind == "actor") {
+            ++counts.nodes;
+            std::vector<std::string> key_items;
+            for (const auto& param : params) {
+                key_items.push_back(param.first + "=" + param.second);
+            }
+            std::sort(key_items.begin(), key_items.end());
+            std::string key = "actor{";
+            for (const auto& item : key_items) {
+                key += item + ";";
+            }
+            key += "}(" + input_key + ")";
+
+            vtkActor* actor = vtkActor::SafeDownCast(lookup(key));
+            if (!actor) {
+                auto mapper = vtkSmartPointer<vtkPolyDataMapper>::New();
+                mapper->SetInputConnection(
+                    vtkAlgorithm::SafeDownCast(next_cache[input_key])
+                        ->GetOutputPort()
+                    );
+                auto created = vtkSmartPointer<vtkActor>::New();
+                created->SetMapper(mapper);
+                vtkProperty* property = created->GetProperty();
+
+                for (const auto& param : params) {
+                    const std::string& name = param.first;
+                    const std::string& value = param.second;
+                    std::vector<double> numbers;
+                    double rgb[3];
+                    bool valid = true;
+                    if (name == "input") {
+                        continue;
+                    } else if (name == "color") {
+                        valid = parseColor(value, rgb);
+                        if (valid) {
+                            property->SetColor(rgb);
+                            mapper->ScalarVisibilityOff();
+                        }
+                    } else if (name == "representation") {
+                        if (value == "surface") {
+                            property->SetRepresentationToSurface();
+                        } else if (value == "wireframe") {
+                            property->SetRepresentationToWireframe();
+                        } else if (value == "points") {
+                            property->SetRepresentationToPoints();
+                        } else {
+                            valid = false;
+                        }
+                    } else if (name == "position" || name == "orientation") {
+                        valid = parseNumbers(value, 3, &numbers);
+                        if (valid && name == "position") {
+                            created->SetPosition(numbers.data());
+                        } else if (valid) {
+                            created->SetOrientation(numbers.data());
+                        }
+                    } else if (name == "scale") {
+                        valid = parseNumbers(value, 3, &numbers)
+                            || parseNumbers(value, 1, &numbers);
+                        if (valid) {
+                            numbers.resize(3, numbers[0]);
+                            created->SetScale(numbers.data());
+                        }
+                    } else {
+                        valid = parseNumbers(value, 1, &numbers);
+                        const double number = valid ? numbers[0] : 0.0;
+                        if (name == "opacity") {
+                            property->SetOpacity(number);
+                        } else if (name == "line_width") {
+                            property->SetLineWidth(
+                                static_cast<float>(number));
+                        } else if (name == "point_size") {
+                            property->SetPointSize(
+                                static_cast<float>(number));
+                        } else if (name == "scalars") {
+                            mapper->SetScalarVisibility(number != 0.0);
+                        } else if (name == "edges") {
+                            property->SetEdgeVisibility(number != 0.0);
+                        } else if (name == "specular") {
+                            property->SetSpecular(number);
+                        }
+                    }
+                    if (!valid) {
+                        return this->fail(
+                            statement,
+                            "invalid " + name + " " + value,
+                            error
+                            );
+                    }
+                }
+                next_cache[key] = created;
+                actor = created;
+                ++counts.created;
+            }
+            actors.push_back(actor);
+        } else if (kind == "background") {
+            has_background = true;
+            const std::string* color = findParam(params, "color");
+            if (color && !parseColor(*color, background)) {
+                return this->fail(statement, "invalid color " + *color, error);
+            }
+        } else if (kind == "camera") {
+            has_camera = true;
+            for (const auto& param : params) {
+                const bool vector = param.first == "position"
+                    || param.first == "focal_point"
+                    || param.first == "view_up";
+                std::vector<double>& numbers = camera_values[param.first];
+                if (!parseNumbers(param.second, vector ? 3 : 1, &numbers)) {
+                    return this->fail(
+                        statement,
+                        "invalid " + param.first + " " + param.second,
+                        error
+                        );
+                }
+            }
+        } else if (kind == "output") {
+            for (const auto& param : params) {
+                std::vector<double> numbers;
+                bool valid = true;
+                if (param.first == "image") {
+                    output.image = param.second;
+                } else if (param.first == "video") {
+                    output.video = param.second;
+                } else if (param.first == "size") {
+                    valid = parseNumbers(param.second, 2, &numbers)
+                        && numbers[0] >= 1.0 && numbers[1] >= 1.0;
+                    if (valid) {
+                        output.width = static_cast<int>(numbers[0]);
+                        output.height = static_cast<int>(numbers[1]);
+                    }
+                } else if (param.first == "frames") {
+                    valid = parseNumbers(param.second, 1, &numbers)
+                        && numbers[0] >= 1.0;
+                    if (valid) {
+                        output.frames = static_cast<int>(numbers[0]);
+                    }
+                } else if (param.first == "fps") {
+                    valid = parseNumbers(param.second, 1, &numbers)
+                        && numbers[0] > 0.0;
+                    if (valid) {
+                        output.fps = numbers[0];
+                    }
+                }
+                if (!valid) {
+                    return this->fail(
+                        statement,
+                        "invalid " + param.first + " " + param.second,
+                        error
+                        );
+                }
+            }
+        }
+    }
+
+    // Everything resolved, replace the previous scene
+    if (this->target) {
+        for (const auto& actor : this->built_actors) {
+            this->target->RemoveActor(actor);
+        }
+    }
+    for (const auto& actor : actors) {
+        renderer->AddActor(actor);
+    }
+    if (has_background) {
+        renderer->SetBackground(background);
+    }
+
+    // Start from a fixed view so the result does not depend on the last one
+    vtkCamera* view = renderer->GetActiveCamera();
+    view->SetPosition(0.0, 0.0, 1.0);
+    view->SetFocalPoint(0.0, 0.0, 0.0);
+    view->SetViewUp(0.0, 1.0, 0.0);
+    view->SetViewAngle(30.0);
+    view->ParallelProjectionOff();
+    renderer->ResetCamera();
+    if (has_camera) {
+        auto value = [&camera_values](const char* name) -> const double* {
+            auto found = camera_values.find(name);
+            return found == camera_values.end() ? nullptr
+                : found->second.data();
+        };
+        if (const double* v = value("parallel")) {
+            view->SetParallelProjection(v[0] != 0.0);
+        }
+        if (const double* v = value("view_angle")) {
+            view->SetViewAngle(v[0]);
+        }
+        if (const double* v = value("position")) {
+            view->SetPosition(v);
+        }
+        if (const double* v = value("focal_point")) {
+            view->SetFocalPoint(v);
+        }
+        if (const double* v = value("view_up")) {
+            view->SetViewUp(v);
+        }
+        if (const double* v = value("parallel_scale")) {
+            view->SetParallelScale(v[0]);
+        }
+        if (const double* v = value("azimuth")) {
+            view->Azimuth(v[0]);
+        }
+        if (const double* v = value("elevation")) {
+            view->Elevation(v[0]);
+        }
+        if (const double* v = value("roll")) {
+            view->Roll(v[0]);
+        }
+        if (const double* v = value("zoom")) {
+            view->Zoom(v[0]);
+        }
+        view->OrthogonalizeViewUp();
+    }
+    renderer->ResetCameraClippingRange();
+
+    this->cache.swap(next_cache);
+    this->releaseReaders();
+    this->target = renderer;
+    this->built_actors.swap(actors);
+    this->scene_output = output;
+
+    counts.seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+    if (stats) {
+        *stats = counts;
+    }
+
+    return true;
+}
+
+
+// ============================================================================
+// SceneScript Private Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// SceneScript::releaseReaders
+// ----------------------------------------------------------------------------
+//
+// Description: Removes the memory budget entries of the reader meshes no
+//              longer in the cache: evicted, left out of the last build, or
+//              read by a build that failed
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void SceneScript::releaseReaders()
+{
+    for (auto entry = this->reader_memory.begin();
+         entry != this->reader_memory.end();) {
+        if (this->cache.count(entry->first) == 0) {
+            MemoryBudget::global().untrack(entry->second);
+            entry = this->reader_memory.erase(entry);
+        } else {
+            ++entry;
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// SceneScript::fail
+// ----------------------------------------------------------------------------
+//
+// Description: Reports an error at a statement as "origin:line: message"
+//
+// Inputs:
+// - statement: Where the error is
+// - message: What is wrong
+//
+// Outputs:
+// - error: The located message, if not null
+//
+// Returns: false, for returning straight from the caller
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool SceneScript::fail(
+    const Statement& statement,
+    const std::string& message,
+    std::string* error
+    ) const
+{
+    if (error) {
+        *error = this->origin + ":" + std::to_string(statement.line) + ": "
+            + message;
+    }
+    return false;
+}
+
+// ----------------------------------------------------------------------------
+// SceneScript::resolve
+// ----------------------------------------------------------------------------
+//
+// Description: Replaces every ${name} in a value with the variable, taken
+//              from the caller's overrides first and the scene's set
+//              statements second
+//
+// Inputs:
+// - statement: The statement of the value, for error messages
+// - value: Text with variables
+//
+// Outputs:
+// - resolved: Text without variables
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false for an unknown variable
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool SceneScript::resolve(
+    const Statement& statement,
+    const std::string& value,
+    std::string* resolved,
+    std::string* error
+    ) const
+{
+    resolved->clear();
+    std::size_t position = 0;
+    while (true) {
+        const std::size_t open = value.find("${", position);
+        if (open == std::string::npos) {
+            *resolved += value.substr(position);
+            return true;
+        }
+        const std::size_t close = value.find('}', open);
+        if (close == std::string::npos) {
+            return this->fail(statement, "unterminated ${ in " + value, error);
+        }
+
+        const std::string name = value.substr(open + 2, close - open - 2);
+        auto found = this->overrides.find(name);
+        if (found == this->overrides.end()) {
+            found = this->defaults.find(name);
+            if (found == this->defaults.end()) {
+                return this->fail(
+                    statement,
+                    "undefined variable " + name,
+                    error
+                    );
+            }
+        }
+        *resolved += value.substr(position, open - position) + found->second;
+        position = close + 1;
+    }
+}
@@ -0,0 +1,251 @@
+// ============================================================================
+// SceneScript.h - Declarative scene files compiled into VTK pipelines
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * SceneScript.h: created.
+// * SceneScript.h: meshes of the readers are tracked by the memory budget.
+//
+// ============================================================================
+
+
+#ifndef SceneScript_H
+#define SceneScript_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Standard Library headers
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+// External libraries headers
+#include <vtkActor.h>
+#include <vtkObject.h>
+#include <vtkRenderer.h>
+#include <vtkSmartPointer.h>
+
+
+// ============================================================================
+// Structure Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// SceneOutput
+// ----------------------------------------------------------------------------
+//
+// Description: What a headless run of a scene file writes, from its output
+//              statement
+//
+// Properties:
+// - image: Image file (PNG or TIFF), empty for none
+// - video: Video file of a camera orbit (see VideoExport.h), empty for none
+// - width, height: Frame size in pixels
+// - frames: Length of the orbit
+// - fps: Frame rate of the video
+//
+// ----------------------------------------------------------------------------
+struct SceneOutput {
+    std::string image;
+    std::string video;
+    int width = 800;
+    int height = 600;
+    int frames = 120;
+    double fps = 30.0;
+};
+
+// ----------------------------------------------------------------------------
+// SceneBuildStats
+// ----------------------------------------------------------------------------
+//
+// Description: What SceneScript::build did
+//
+// Properties:
+// - nodes: Sources, readers, filters and actors referenced by the scene
+// - created: Pipeline objects created by this build
+// - reused: Nodes served by an existing pipeline object, either a duplicate
+//           within the scene or one kept from the previous build
+// - seconds: Wall clock time of the build, without rendering
+//
+// ----------------------------------------------------------------------------
+struct SceneBuildStats {
+    int nodes = 0;
+    int created = 0;
+    int reused = 0;
+    double seconds = 0.0;
+};
+
+
+// ============================================================================
+// Class Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// SceneScript
+// ----------------------------------------------------------------------------
+//
+// Description: A scene described by a small declarative file, compiled into
+//              VTK pipelines. Every line is one statement: a keyword, a name
+//              for the statements that declare something, and key=value
+//              parameters. Values are numbers, comma separated vectors,
+//              named colors or (quoted) file names, and may use ${variable}.
+//              '#' starts a comment.
+//
+//                set     res=40
+//                source  cone   type=cone resolution=${res} height=3
+//                reader  part   file="meshes/part.stl"
+//                filter  smooth type=smooth input=part iterations=20
+//                actor   a      input=cone color=tomato
+//                actor   b      input=smooth color=0.8,0.8,0.9 opacity=0.5
+//                camera  azimuth=30 elevation=20 zoom=1.2
+//                background color=midnightblue
+//                output  image=out.png size=1920,1080
+//
+//              Sources: cone, sphere, cube, cylinder, plane, arrow. Readers
+//              take any mesh readMesh knows. Filters (polygonal data):
+//              smooth, decimate, clip, normals, shrink, elevation, tube,
+//              triangulate, transform. Names must be declared before use.
+//
+//              Parsing checks the structure once; build resolves variables
+//              and creates the pipelines. Every node is keyed by its type,
+//              resolved parameters and the key of its input, so a reader,
+//              source or filter chain referenced twice, or declared twice
+//              with the same parameters, is created and executed once.
+//              Pipeline objects are kept between builds: building again
+//              with other variable values creates only the nodes whose
+//              parameters changed, and VTK re-executes only downstream of
+//              them. This is what makes batches of parameter variants cheap.
+//              The meshes of the readers are tracked by
+//              MemoryBudget::global(); an evicted reader is dropped from the
+//              cache and read again by the next build that needs it.
+//
+// Properties:
+// - statements: Parsed statements in file order
+// - defaults: Variables set by the file
+// - overrides: Variables set by the caller, taking precedence
+// - origin: Name of the file in error messages
+// - base_dir: Directory relative file names are resolved against
+// - cache: Pipeline objects of the last build by node key
+// - reader_memory: Memory budget entries of the reader meshes, by node key
+// - evicted: Reader keys evicted by the memory budget since the last build
+// - scene_output: Output statement of the last build
+// - target, built_actors: Where the actors of the last build were added
+//
+// Methods:
+// - load: Parses a scene file
+// - parse: Parses scene text
+// - setVariable: Overrides a variable for the following builds
+// - build: Creates or updates the pipelines and fills a renderer
+// - output: Returns the output statement of the last build
+// - hasOutput: Whether the scene declares an output
+// - actors: Returns the actors of the last build
+//
+// Example usage:
+//   SceneScript script;
+//   script.load("scene.txt", &error);
+//   script.setVariable("res", "80");
+//   script.build(renderer, &stats, &error);
+//
+// ----------------------------------------------------------------------------
+class SceneScript
+{
+public:
+    // Constructor/Destructor
+    SceneScript() = default;
+    ~SceneScript();
+
+    SceneScript(const SceneScript&) = delete;
+    SceneScript& operator=(const SceneScript&) = delete;
+
+    bool load(const std::string& path, std::string* error = nullptr);
+    bool parse(
+        const std::string& text,
+        const std::string& origin,
+        const std::string& base_dir = "",
+        std::string* error = nullptr
+        );  // origin names the text in error messages
+    void setVariable(const std::string& name, const std::string& value);
+    bool build(
+        vtkRenderer* renderer,
+        SceneBuildStats* stats = nullptr,
+        std::string* error = nullptr
+        );  // Replaces the actors of the previous build
+
+    const SceneOutput& output() const { return this->scene_output; }
+    bool hasOutput() const;
+    const std::vector<vtkSmartPointer<vtkActor>>& actors() const
+    {
+        return this->built_actors;
+    }
+
+private:
+    struct Statement {
+        std::string kind;
+        std::string name;
+        std::vector<std::pair<std::string, std::string>> params;
+        int line = 0;
+    };
+
+    bool fail(
+        const Statement& statement,
+        const std::string& message,
+        std::string* error
+        ) const;
+    bool resolve(
+        const Statement& statement,
+        const std::string& value,
+        std::string* resolved,
+        std::string* error
+        ) const;  // Substitutes variables
+    void releaseReaders();  // Untracks readers that left the cache
+
+    // Written by eviction handlers, which may run on any thread
+    struct EvictedReaders {
+        std::mutex mutex;
+        std::set<std::string> keys;
+    };
+
+    std::vector<Statement> statements;
+    std::map<std::string, std::string> defaults;
+    std::map<std::string, std::string> overrides;
+    std::string origin;
+    std::string base_dir;
+    std::map<std::string, vtkSmartPointer<vtkObject>> cache;
+    std::map<std::string, std::uint64_t> reader_memory;
+    std::shared_ptr<EvictedReaders> evicted =
+        std::make_shared<EvictedReaders>();
+    SceneOutput scene_output;
+    vtkSmartPointer<vtkRenderer> target;
+    std::vector<vtkSmartPointer<vtkActor>> built_actors;
+};
+
+#endif  // SceneScript_H
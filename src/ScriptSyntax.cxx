@@ -0,0 +1,151 @@
+// ============================================================================
+// ScriptSyntax.cxx - Statement syntax shared by the text file formats
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * ScriptSyntax.cxx: created, from the statement helpers of
+//   SceneScript.cxx.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header -------------------------------------------------------------
+#include "ScriptSyntax.h"
+
+// Standard Library headers ---------------------------------------------------
+#include <sstream>
+
+
+// ============================================================================
+// Function Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// tokenizeStatement
+// ----------------------------------------------------------------------------
+//
+// Description: Splits a statement into words at blanks. Double quotes group
+//              blanks into a word and are removed; '#' outside quotes
+//              starts a comment.
+//
+// Inputs:
+// - line: The statement
+//
+// Outputs:
+// - words: The words are appended
+//
+// Returns: false if a quote is left open, true otherwise
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool tokenizeStatement(
+    const std::string& line,
+    std::vector<std::string>* words
+    )
+{
+    std::string word;
+    bool quoted = false;
+    bool in_word = false;
+    for (char c : line) {
+        if (c == '"') {
+            quoted = !quoted;
+            in_word = true;
+        } else if (!quoted && c == '#') {
+            break;
+        } else if (!quoted && (c == ' ' || c == '\t' || c == '\r')) {
+            if (in_word) {
+                words->push_back(word);
+                word.clear();
+                in_word = false;
+            }
+        } else {
+            word += c;
+            in_word = true;
+        }
+    }
+    if (in_word) {
+        words->push_back(word);
+    }
+
+    return !quoted;
+}
+
+// ----------------------------------------------------------------------------
+// parseNumbers
+// ----------------------------------------------------------------------------
+//
+// Description: Parses size comma separated numbers. Single values also take
+//              on/off, true/false and yes/no, as 1 and 0.
+//
+// Inputs:
+// - text: The value
+// - size: Number of numbers expected
+//
+// Outputs:
+// - values: The numbers
+//
+// Returns: true if text holds exactly size numbers, false otherwise
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool parseNumbers(
+    const std::string& text,
+    std::size_t size,
+    std::vector<double>* values
+    )
+{
+    values->clear();
+    if (size == 1) {
+        if (text == "on" || text == "true" || text == "yes") {
+            values->push_back(1.0);
+            return true;
+        }
+        if (text == "off" || text == "false" || text == "no") {
+            values->push_back(0.0);
+            return true;
+        }
+    }
+
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        std::size_t used = 0;
+        try {
+            values->push_back(std::stod(item, &used));
+        } catch (...) {
+            return false;
+        }
+        if (used != item.size()) {
+            return false;
+        }
+    }
+
+    return values->size() == size;
+}
@@ -0,0 +1,66 @@
+// ============================================================================
+// ScriptSyntax.h - Statement syntax shared by the text file formats
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * ScriptSyntax.h: created.
+//
+// ============================================================================
+
+
+#ifndef ScriptSyntax_H
+#define ScriptSyntax_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Standard Library headers
+#include <cstddef>
+#include <string>
+#include <vector>
+
+
+// ============================================================================
+// Function Declarations Section
+// ============================================================================
+
+// Internal to the core: the words and values of the line based text files,
+// scene files (SceneScript) and session files (CameraBookmarks), so both
+// read them the same way.
+
+// Splits a statement into words at blanks
+bool tokenizeStatement(
+    const std::string& line,
+    std::vector<std::string>* words
+    );
+
+// Parses size comma separated numbers, or a single on/off style switch
+bool parseNumbers(
+    const std::string& text,
+    std::size_t size,
+    std::vector<double>* values
+    );
+
+#endif  // ScriptSyntax_H
@@ -0,0 +1,581 @@
+// ============================================================================
+// SharedMemoryIngest.cxx - Implementation of the SharedMemoryIngest class
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * SharedMemoryIngest.cxx: created.
+// * SharedMemoryIngest.cxx: the slot shown is marked in the header so the
+//   producer never overwrites it.
+// * SharedMemoryIngest.cxx: added the value range published by the producer.
+// * SharedMemoryIngest.cxx: reads active_slot atomically.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header -------------------------------------------------------------
+#include "SharedMemoryIngest.h"
+
+// "C" system headers ---------------------------------------------------------
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Standard Library headers ---------------------------------------------------
+#include <cerrno>
+#include <cstring>
+#include <thread>
+
+// External libraries headers -------------------------------------------------
+
+// VTK headers
+#include <vtkAOSDataArrayTemplate.h>
+#include <vtkPointData.h>
+
+
+// ============================================================================
+// Local helpers section
+// ============================================================================
+
+namespace {
+
+std::size_t scalarSize(std::uint32_t scalar_type)
+{
+    switch (scalar_type) {
+        case kShmFloat32:
+            return sizeof(float);
+        case kShmFloat64:
+            return sizeof(double);
+        default:
+            return 0;
+    }
+}
+
+// Points an AOS array at external memory. The save flag tells VTK that it
+// does not own the buffer, so it is never freed or reallocated.
+template <typename ValueType>
+void wrapPayload(vtkDataArray* array, void* payload, vtkIdType value_count)
+{
+    auto typed = static_cast<vtkAOSDataArrayTemplate<ValueType>*>(array);
+    typed->SetArray(static_cast<ValueType*>(payload), value_count, 1);
+    typed->Modified();
+}
+
+}  // namespace
+
+
+// ============================================================================
+// Constructor/Destructor Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// SharedMemoryIngest::SharedMemoryIngest
+// ----------------------------------------------------------------------------
+//
+// Description: Constructor
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+SharedMemoryIngest::SharedMemoryIngest()
+    : mapping(nullptr),
+      mapping_size(0),
+#if defined(_WIN32)
+      file_mapping(nullptr),
+#else
+      descriptor(-1),
+#endif
+      header(nullptr),
+      last_sequence(0),
+      bound_slot(kShmMaxSlots)
+{
+}
+
+// ----------------------------------------------------------------------------
+// SharedMemoryIngest::~SharedMemoryIngest
+// ----------------------------------------------------------------------------
+//
+// Description: Destructor
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Unmaps the segment
+//
+// ----------------------------------------------------------------------------
+SharedMemoryIngest::~SharedMemoryIngest()
+{
+    this->close();
+}
+
+
+// ============================================================================
+// Public Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// SharedMemoryIngest::open
+// ----------------------------------------------------------------------------
+//
+// Description: Maps the named shared memory segment, validates its header
+//              and wraps every field as a point data array of a new
+//              vtkImageData. Only the reader fields of the header are ever
+//              written.
+//
+// Inputs:
+// - name: Segment name as passed to shm_open (without the leading slash) or
+//         CreateFileMapping by the producer
+//
+// Outputs: None
+//
+// Returns: true on success, false otherwise (see lastError)
+//
+// Side Effects: Closes a previously opened segment
+//
+// ----------------------------------------------------------------------------
+bool SharedMemoryIngest::open(const std::string& name)
+{
+    this->close();
+    this->segment_name = name;
+    if (name.empty()) {
+        this->error = "Shared memory segment name is empty";
+        return false;
+    }
+
+#if defined(_WIN32)
+    this->file_mapping = OpenFileMappingA(
+        FILE_MAP_READ | FILE_MAP_WRITE,
+        FALSE,
+        name.c_str()
+        );
+    if (this->file_mapping == nullptr) {
+        this->error = "Cannot open shared memory segment '" + name + "'";
+        return false;
+    }
+    this->mapping = MapViewOfFile(
+        this->file_mapping,
+        FILE_MAP_READ | FILE_MAP_WRITE,
+        0,
+        0,
+        0
+        );
+    if (this->mapping == nullptr) {
+        this->error = "Cannot map shared memory segment '" + name + "'";
+        this->close();
+        return false;
+    }
+    MEMORY_BASIC_INFORMATION info;
+    VirtualQuery(this->mapping, &info, sizeof(info));
+    this->mapping_size = info.RegionSize;
+#else
+    const std::string posix_name = (name.front() == '/') ? name : "/" + name;
+    this->descriptor = shm_open(posix_name.c_str(), O_RDWR, 0);
+    if (this->descriptor < 0) {
+        this->error = "Cannot open shared memory segment '" + name + "': "
+            + std::strerror(errno);
+        return false;
+    }
+    struct stat status;
+    if (fstat(this->descriptor, &status) != 0) {
+        this->error = "Cannot stat shared memory segment '" + name + "'";
+        this->close();
+        return false;
+    }
+    this->mapping_size = static_cast<std::size_t>(status.st_size);
+    this->mapping = mmap(
+        nullptr,
+        this->mapping_size,
+        PROT_READ | PROT_WRITE,
+        MAP_SHARED,
+        this->descriptor,
+        0
+        );
+    if (this->mapping == MAP_FAILED) {
+        this->mapping = nullptr;
+        this->error = "Cannot map shared memory segment '" + name + "': "
+            + std::strerror(errno);
+        this->close();
+        return false;
+    }
+#endif
+
+    this->header = static_cast<ShmSegmentHeader*>(this->mapping);
+    if (!this->validateHeader()) {
+        this->close();
+        return false;
+    }
+
+    // Build the image data once. Geometry is fixed for the segment lifetime.
+    this->image_data = vtkSmartPointer<vtkImageData>::New();
+    this->image_data->SetDimensions(this->header->dimensions);
+    this->image_data->SetOrigin(this->header->origin);
+    this->image_data->SetSpacing(this->header->spacing);
+
+    for (std::uint32_t i = 0; i < this->header->field_count; ++i) {
+        const ShmFieldDescriptor& field = this->header->fields[i];
+        vtkSmartPointer<vtkDataArray> array;
+        if (field.scalar_type == kShmFloat32) {
+            array = vtkSmartPointer<vtkAOSDataArrayTemplate<float>>::New();
+        } else {
+            array = vtkSmartPointer<vtkAOSDataArrayTemplate<double>>::New();
+        }
+        array->SetNumberOfComponents(static_cast<int>(field.components));
+        array->SetName(std::string(field.name, strnlen(
+            field.name, kShmFieldNameLength)).c_str());
+        this->arrays.push_back(array);
+        this->image_data->GetPointData()->AddArray(array);
+    }
+    if (!this->arrays.empty()) {
+        this->image_data->GetPointData()->SetActiveScalars(
+            this->arrays.front()->GetName()
+            );
+    }
+
+    // Expose whatever is currently published. Bits left by a consumer that
+    // went away without closing would keep slots from the producer.
+    this->header->reader_slots.store(0);
+    for (int attempt = 0; attempt < 1000; ++attempt) {
+        const std::uint64_t sequence = this->header->sequence.load();
+        if ((sequence & 1U) == 0 && this->acquireGeneration(sequence)) {
+            return true;
+        }
+        std::this_thread::yield();
+    }
+
+    this->error = "Shared memory segment '" + name
+        + "' never settled on a generation";
+    this->close();
+    return false;
+}
+
+// ----------------------------------------------------------------------------
+// SharedMemoryIngest::close
+// ----------------------------------------------------------------------------
+//
+// Description: Unmaps the segment and releases the wrapped arrays
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: The image data returned by image() becomes empty
+//
+// ----------------------------------------------------------------------------
+void SharedMemoryIngest::close()
+{
+    // Detach the arrays first so nothing keeps pointing into unmapped memory,
+    // then hand the slot back to the producer
+    for (auto& array : this->arrays) {
+        array->Initialize();
+    }
+    this->arrays.clear();
+    if (this->image_data) {
+        this->image_data->Initialize();
+    }
+    if (this->header != nullptr && this->bound_slot < kShmMaxSlots) {
+        this->header->reader_slots.fetch_and(~(1U << this->bound_slot));
+    }
+    this->bound_slot = kShmMaxSlots;
+
+#if defined(_WIN32)
+    if (this->mapping != nullptr) {
+        UnmapViewOfFile(this->mapping);
+    }
+    if (this->file_mapping != nullptr) {
+        CloseHandle(this->file_mapping);
+        this->file_mapping = nullptr;
+    }
+#else
+    if (this->mapping != nullptr) {
+        munmap(this->mapping, this->mapping_size);
+    }
+    if (this->descriptor >= 0) {
+        ::close(this->descriptor);
+        this->descriptor = -1;
+    }
+#endif
+
+    this->mapping = nullptr;
+    this->mapping_size = 0;
+    this->header = nullptr;
+    this->last_sequence = 0;
+}
+
+// ----------------------------------------------------------------------------
+// SharedMemoryIngest::poll
+// ----------------------------------------------------------------------------
+//
+// Description: Reads the sequence counter and, if the producer published a
+//              new generation, takes its slot over from the producer (see
+//              SharedMemoryLayout.h) and re-points the arrays at it. The
+//              check is a couple of atomic loads, so it is cheap enough to
+//              call from a GUI timer.
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: true if a new generation is now exposed
+//
+// Side Effects: Bumps the MTime of the image data and its arrays
+//
+// ----------------------------------------------------------------------------
+bool SharedMemoryIngest::poll()
+{
+    if (this->header == nullptr) {
+        return false;
+    }
+
+    const std::uint64_t sequence = this->header->sequence.load();
+    if ((sequence & 1U) != 0 || sequence == this->last_sequence) {
+        // Either nothing new or the producer is publishing right now
+        return false;
+    }
+    if (!this->acquireGeneration(sequence)) {
+        // The producer moved on meanwhile, try again on the next poll
+        return false;
+    }
+    this->image_data->Modified();
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// SharedMemoryIngest::publishedRange
+// ----------------------------------------------------------------------------
+//
+// Description: Returns the value range the producer published with the
+//              exposed generation of the active scalars (the first field),
+//              which saves scanning the payload
+//
+// Inputs: None
+//
+// Outputs:
+// - range: Minimum and maximum of the first component
+//
+// Returns: false if the producer did not publish a range, true otherwise
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool SharedMemoryIngest::publishedRange(double range[2]) const
+{
+    if (this->header == nullptr || this->bound_slot >= kShmMaxSlots) {
+        return false;
+    }
+
+    // The slot is ours until the next generation, so is its range
+    const double* published = this->header->fields[0].range[this->bound_slot];
+    if (!(published[0] < published[1])) {
+        return false;
+    }
+    range[0] = published[0];
+    range[1] = published[1];
+
+    return true;
+}
+
+
+// ============================================================================
+// Private Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// SharedMemoryIngest::validateHeader
+// ----------------------------------------------------------------------------
+//
+// Description: Checks the header and makes sure every payload slot lies
+//              inside the mapping and is suitably aligned
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: true if the segment can be wrapped safely
+//
+// Side Effects: Sets the error message on failure
+//
+// ----------------------------------------------------------------------------
+bool SharedMemoryIngest::validateHeader()
+{
+    if (this->mapping_size < sizeof(ShmSegmentHeader)) {
+        this->error = "Shared memory segment is smaller than its header";
+        return false;
+    }
+    if (std::memcmp(this->header->magic, kShmMagic, sizeof(kShmMagic)) != 0) {
+        this->error = "Shared memory segment has an invalid magic number";
+        return false;
+    }
+    if (this->header->version != kShmVersion) {
+        this->error = "Unsupported shared memory layout version "
+            + std::to_string(this->header->version);
+        return false;
+    }
+    if (this->header->field_count == 0
+        || this->header->field_count > kShmMaxFields) {
+        this->error = "Shared memory segment has an invalid field count";
+        return false;
+    }
+    if (this->header->slot_count == 0
+        || this->header->slot_count > kShmMaxSlots) {
+        this->error = "Shared memory segment has an invalid slot count";
+        return false;
+    }
+
+    std::uint64_t point_count = 1;
+    for (int i = 0; i < 3; ++i) {
+        if (this->header->dimensions[i] <= 0) {
+            this->error = "Shared memory segment has invalid dimensions";
+            return false;
+        }
+        point_count *= static_cast<std::uint64_t>(this->header->dimensions[i]);
+    }
+
+    for (std::uint32_t i = 0; i < this->header->field_count; ++i) {
+        const ShmFieldDescriptor& field = this->header->fields[i];
+        const std::size_t value_size = scalarSize(field.scalar_type);
+        if (value_size == 0 || field.components == 0) {
+            this->error = "Field " + std::to_string(i)
+                + " has an unsupported type";
+            return false;
+        }
+        const std::uint64_t bytes = point_count * field.components
+            * value_size;
+        for (std::uint32_t slot = 0; slot < this->header->slot_count; ++slot) {
+            const std::uint64_t offset = field.offset[slot];
+            if (offset % value_size != 0
+                || offset < sizeof(ShmSegmentHeader)
+                || offset + bytes > this->mapping_size) {
+                this->error = "Field " + std::to_string(i)
+                    + " payload lies outside the segment";
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// SharedMemoryIngest::acquireGeneration
+// ----------------------------------------------------------------------------
+//
+// Description: The consumer side of the slot handshake. Marks the active
+//              slot as read, checks that the generation did not change
+//              meanwhile (so the producer saw the mark before it could pick
+//              the slot for writing), points the arrays at the slot and
+//              releases the slot read before.
+//
+// Inputs:
+// - sequence: Even sequence number read just before
+//
+// Outputs: None
+//
+// Returns: true if the generation is now exposed, false if the producer
+//          published another one meanwhile
+//
+// Side Effects: Writes reader_slots and reader_sequence of the header
+//
+// ----------------------------------------------------------------------------
+bool SharedMemoryIngest::acquireGeneration(std::uint64_t sequence)
+{
+    const std::uint32_t slot = this->header->active_slot.load();
+    if (slot >= this->header->slot_count) {
+        return false;
+    }
+
+    const std::uint32_t previous = this->bound_slot;
+    if (slot != previous) {
+        this->header->reader_slots.fetch_or(1U << slot);
+    }
+    if (this->header->sequence.load() != sequence) {
+        if (slot != previous) {
+            this->header->reader_slots.fetch_and(~(1U << slot));
+        }
+        return false;
+    }
+
+    this->bindSlot(slot);
+    if (previous < kShmMaxSlots && previous != slot) {
+        this->header->reader_slots.fetch_and(~(1U << previous));
+    }
+    this->header->reader_sequence.store(sequence);
+    this->last_sequence = sequence;
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// SharedMemoryIngest::bindSlot
+// ----------------------------------------------------------------------------
+//
+// Description: Points every array at the payload of the given slot
+//
+// Inputs:
+// - slot: Payload slot index, already validated against slot_count
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Bumps the MTime of every array
+//
+// ----------------------------------------------------------------------------
+void SharedMemoryIngest::bindSlot(std::uint32_t slot)
+{
+    auto base = static_cast<char*>(this->mapping);
+    const vtkIdType point_count = this->image_data->GetNumberOfPoints();
+
+    for (std::size_t i = 0; i < this->arrays.size(); ++i) {
+        const ShmFieldDescriptor& field = this->header->fields[i];
+        void* payload = base + field.offset[slot];
+        const vtkIdType value_count = point_count * field.components;
+        if (field.scalar_type == kShmFloat32) {
+            wrapPayload<float>(this->arrays[i], payload, value_count);
+        } else {
+            wrapPayload<double>(this->arrays[i], payload, value_count);
+        }
+    }
+
+    this->bound_slot = slot;
+}
@@ -0,0 +1,151 @@
+// ============================================================================
+// SharedMemoryIngest.h - Zero-copy access to live simulation data
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * SharedMemoryIngest.h: created.
+// * SharedMemoryIngest.h: reports the slots it reads to the producer.
+// * SharedMemoryIngest.h: added the value range published by the producer.
+//
+// ============================================================================
+
+
+#ifndef SharedMemoryIngest_H
+#define SharedMemoryIngest_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// "C" system headers
+
+// Standard Library headers
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// External libraries headers
+#include <vtkDataArray.h>
+#include <vtkImageData.h>
+#include <vtkSmartPointer.h>
+
+// Project headers
+#include "SharedMemoryLayout.h"
+
+
+// ============================================================================
+// Class Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// SharedMemoryIngest
+// ----------------------------------------------------------------------------
+//
+// Description: Maps a live-data shared memory segment (see
+//              SharedMemoryLayout.h) and exposes it as a vtkImageData whose
+//              point data arrays are vtkAOSDataArrayTemplate instances
+//              pointing directly into the mapped memory. Nothing is copied; a
+//              new generation only re-points the arrays and bumps their
+//              MTime. The slot the arrays point at is marked in the
+//              reader_slots of the header, so the producer leaves it alone
+//              until a later generation is picked up.
+//
+// Properties:
+// - name: Name of the shared memory segment
+// - image: The vtkImageData wrapping the segment
+// - arrays: One array per field, in segment order
+// - last_sequence: Sequence number of the generation currently exposed
+// - bound_slot: Slot the arrays point at, kShmMaxSlots if none
+//
+// Methods:
+// - open: Maps the segment and builds the image data
+// - close: Unmaps the segment
+// - poll: Checks the sequence counter and picks up a new generation
+// - image: Returns the wrapped image data
+// - generation: Returns the sequence number of the exposed generation
+// - publishedRange: Returns the range of the active scalars, if published
+// - lastError: Returns a description of the last failure
+//
+// Example usage:
+//   SharedMemoryIngest ingest;
+//   if (!ingest.open("simulation")) {
+//       std::cerr << ingest.lastError() << "\n";
+//   }
+//   mapper->SetInputData(ingest.image());
+//   ...
+//   if (ingest.poll()) {
+//       render_window->Render();
+//   }
+//
+// ----------------------------------------------------------------------------
+class SharedMemoryIngest
+{
+public:
+    // Constructor/Destructor
+    SharedMemoryIngest();
+    ~SharedMemoryIngest();
+
+    SharedMemoryIngest(const SharedMemoryIngest&) = delete;
+    SharedMemoryIngest& operator=(const SharedMemoryIngest&) = delete;
+
+    bool open(const std::string& name);  // Maps the segment
+    void close();  // Unmaps the segment
+    bool poll();  // Returns true if a new generation was picked up
+    bool isOpen() const { return this->header != nullptr; }
+
+    vtkImageData* image() const { return this->image_data; }
+    std::uint64_t generation() const { return this->last_sequence; }
+    bool publishedRange(double range[2]) const;  // Of the exposed slot
+    const std::string& name() const { return this->segment_name; }
+    const std::string& lastError() const { return this->error; }
+
+private:
+    bool validateHeader();  // Checks magic, version and payload bounds
+    bool acquireGeneration(
+        std::uint64_t sequence
+        );  // Takes the active slot from the producer, false if it moved on
+    void bindSlot(std::uint32_t slot);  // Points the arrays at a slot
+
+    std::string segment_name;
+    std::string error;
+
+    // Platform mapping handles
+    void* mapping;
+    std::size_t mapping_size;
+#if defined(_WIN32)
+    void* file_mapping;
+#else
+    int descriptor;
+#endif
+
+    ShmSegmentHeader* header;
+    std::uint64_t last_sequence;
+    std::uint32_t bound_slot;
+
+    vtkSmartPointer<vtkImageData> image_data;
+    std::vector<vtkSmartPointer<vtkDataArray>> arrays;
+};
+
+#endif  // SharedMemoryIngest_H
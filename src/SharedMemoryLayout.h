@@ -0,0 +1,193 @@
+// ============================================================================
+// SharedMemoryLayout.h - Binary layout of the live-data shared memory segment
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * SharedMemoryLayout.h: created.
+// * SharedMemoryLayout.h: version 2, the consumer reports the slots it
+//   reads so the producer never overwrites a displayed payload.
+// * SharedMemoryLayout.h: producers publish the value range of each slot.
+// * SharedMemoryLayout.h: active_slot is atomic, it is read while written.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// This header deliberately depends on the C++ Standard Library only, so that
+// simulation codes (producers) can include it without pulling in VTK or Qt.
+//
+// A segment starts with a ShmSegmentHeader, followed by the field payloads at
+// the byte offsets recorded in the field descriptors. Every field has up to
+// kShmMaxSlots payload slots. The producer fills a free slot, then publishes
+// it using the sequence counter as a seqlock:
+//
+//   header->sequence.fetch_add(1);              // odd: update in progress
+//   header->active_slot.store(written_slot);
+//   header->sequence.fetch_add(1);              // even: new generation
+//
+// The consumer never copies payloads, it points VTK arrays straight at them
+// and renders from them until it picks up a later generation. The seqlock
+// only covers the header, so the payloads are protected by a handshake: the
+// consumer sets the bit of every slot it reads in reader_slots, and the
+// producer only writes into a slot that is neither active_slot nor in
+// reader_slots. Producer, before filling the next generation:
+//
+//   const std::uint32_t busy = header->reader_slots.load()
+//       | (1U << header->active_slot.load());
+//   written_slot = first slot whose bit is not in busy;
+//
+// If every slot is busy, wait briefly and look again. The consumer holds two
+// slots only for the instant of switching from one generation to the next:
+//
+//   header->reader_slots.fetch_or(1U << new_slot);  // announce
+//   if (header->sequence.load() != sequence_read_with_new_slot) {
+//       header->reader_slots.fetch_and(~(1U << new_slot));  // stale, retry
+//   } else {
+//       bind new_slot;
+//       header->reader_slots.fetch_and(~(1U << old_slot));  // release
+//       header->reader_sequence.store(sequence_read_with_new_slot);
+//   }
+//
+// The sequence re-check after the announcement guarantees that the producer
+// either sees the bit or has not yet published the generation that would
+// free the slot for writing. All accesses are sequentially consistent. With
+// three slots the producer waits at most for one consumer retry: while the
+// consumer holds one slot and announces another that has just gone stale,
+// and the producer has already published the third, every slot is busy
+// until the consumer clears the stale bit again. The consumer maps the segment
+// read-write for the handshake fields; it never writes anything else.
+// Single slot segments have no free slot: their producer writes the active
+// slot in place and the consumer may show torn frames.
+//
+// ============================================================================
+
+
+#ifndef SharedMemoryLayout_H
+#define SharedMemoryLayout_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// "C" system headers
+
+// Standard Library headers
+#include <atomic>
+#include <cstdint>
+
+
+// ============================================================================
+// Global constants section
+// ============================================================================
+
+constexpr char kShmMagic[8] = {'Q', 'T', 'V', 'T', 'K', 'S', 'H', 'M'};
+constexpr std::uint32_t kShmVersion = 2;
+constexpr std::uint32_t kShmMaxFields = 16;
+constexpr std::uint32_t kShmMaxSlots = 3;
+constexpr std::uint32_t kShmFieldNameLength = 32;
+
+// Scalar type codes used by the producer. The values match the VTK type
+// constants (VTK_FLOAT, VTK_DOUBLE) so they can be passed through unchanged.
+constexpr std::uint32_t kShmFloat32 = 10;
+constexpr std::uint32_t kShmFloat64 = 11;
+
+
+// ============================================================================
+// Structure Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// ShmFieldDescriptor
+// ----------------------------------------------------------------------------
+//
+// Description: Describes a single point data field stored in the segment
+//
+// Properties:
+// - name: Zero terminated field name
+// - scalar_type: One of kShmFloat32 or kShmFloat64
+// - components: Number of components per tuple (1 for scalars, 3 for vectors)
+// - offset: Byte offset of each payload slot from the start of the segment
+// - range: Minimum and maximum of the first component in each slot, written
+//          with the payload before it is published. A minimum not below
+//          the maximum (zeroes included) means not computed; the consumer
+//          then scans the payload itself, at a throttled rate.
+//
+// ----------------------------------------------------------------------------
+struct ShmFieldDescriptor {
+    char          name[kShmFieldNameLength];
+    std::uint32_t scalar_type;
+    std::uint32_t components;
+    std::uint64_t offset[kShmMaxSlots];
+    double        range[kShmMaxSlots][2];
+};
+
+// ----------------------------------------------------------------------------
+// ShmSegmentHeader
+// ----------------------------------------------------------------------------
+//
+// Description: Header at the start of every live-data segment
+//
+// Properties:
+// - magic: Must equal kShmMagic
+// - version: Must equal kShmVersion
+// - field_count: Number of valid entries in fields
+// - slot_count: Number of payload slots per field (1 to 3, 3 recommended)
+// - sequence: Generation counter, odd while the producer is publishing
+// - active_slot: Slot holding the most recently published generation,
+//                atomic as the consumer reads it while the producer writes
+// - reader_slots: Bit mask of the slots the consumer reads, written by the
+//                 consumer only; the producer must not write these slots
+// - reader_sequence: Generation the consumer shows, written by the
+//                    consumer only
+// - dimensions: Number of grid points along each axis
+// - origin: World coordinates of the first grid point
+// - spacing: Distance between grid points along each axis
+// - fields: Field descriptors
+//
+// ----------------------------------------------------------------------------
+struct ShmSegmentHeader {
+    char                       magic[8];
+    std::uint32_t              version;
+    std::uint32_t              field_count;
+    std::uint32_t              slot_count;
+    std::atomic<std::uint32_t> active_slot;
+    std::atomic<std::uint64_t> sequence;
+    std::atomic<std::uint32_t> reader_slots;
+    std::uint32_t              reserved_reader;
+    std::atomic<std::uint64_t> reader_sequence;
+    std::int32_t               dimensions[3];
+    std::int32_t               reserved;
+    double                     origin[3];
+    double                     spacing[3];
+    ShmFieldDescriptor         fields[kShmMaxFields];
+};
+
+static_assert(
+    std::atomic<std::uint64_t>::is_always_lock_free
+        && std::atomic<std::uint32_t>::is_always_lock_free,
+    "The shared memory sequence counter and handshake must be lock free"
+    );
+
+#endif  // SharedMemoryLayout_H
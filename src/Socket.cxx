@@ -0,0 +1,707 @@
+// ============================================================================
+// Socket.cxx - Implementation of the Socket class
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * Socket.cxx: created.
+// * Socket.cxx: listenLocal only replaces socket files.
+// * Socket.cxx: receiveLine caps the line length at kMaxLineLength.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header -------------------------------------------------------------
+#include "Socket.h"
+
+// "C" system headers ---------------------------------------------------------
+#if defined(_WIN32)
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#include <afunix.h>
+#else
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+// Standard Library headers ---------------------------------------------------
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+
+
+// ============================================================================
+// Local helpers section
+// ============================================================================
+
+namespace {
+
+#if defined(_WIN32)
+const Socket::Handle kInvalidHandle = INVALID_SOCKET;
+
+// Winsock has to be initialized once per process before any socket call
+bool initializeSockets()
+{
+    static const bool initialized = []() {
+        WSADATA data;
+        return WSAStartup(MAKEWORD(2, 2), &data) == 0;
+    }();
+
+    return initialized;
+}
+
+void closeHandle(Socket::Handle handle)
+{
+    closesocket(handle);
+}
+
+const int kSendFlags = 0;
+#else
+const Socket::Handle kInvalidHandle = -1;
+
+bool initializeSockets()
+{
+    return true;
+}
+
+void closeHandle(Socket::Handle handle)
+{
+    ::close(handle);
+}
+
+// Never raise SIGPIPE when a client goes away, report an error instead
+#if defined(MSG_NOSIGNAL)
+const int kSendFlags = MSG_NOSIGNAL;
+#else
+const int kSendFlags = 0;
+#endif
+#endif
+
+void setError(std::string* error, const std::string& message)
+{
+    if (error != nullptr) {
+        *error = message;
+    }
+}
+
+// Removes a socket file left behind at path by an earlier listener. Any
+// other kind of file is kept and refused, so a mistyped path never deletes
+// user data.
+bool removeStaleSocket(const std::string& path, std::string* error)
+{
+#if defined(_WIN32)
+    // Unix domain socket files are reparse points on Windows
+    const DWORD attributes = GetFileAttributesA(path.c_str());
+    if (attributes == INVALID_FILE_ATTRIBUTES) {
+        return true;
+    }
+    const bool is_socket = (attributes & FILE_ATTRIBUTE_REPARSE_POINT) != 0
+        && (attributes & FILE_ATTRIBUTE_DIRECTORY) == 0;
+#else
+    struct stat status;
+    if (::lstat(path.c_str(), &status) != 0) {
+        return true;
+    }
+    const bool is_socket = S_ISSOCK(status.st_mode);
+#endif
+    if (!is_socket) {
+        setError(error, path + ": path exists and is not a socket");
+        return false;
+    }
+    if (std::remove(path.c_str()) != 0) {
+        setError(error, "Cannot remove the stale socket " + path);
+        return false;
+    }
+
+    return true;
+}
+
+// Frames are latency sensitive, do not let Nagle hold back small writes
+void disableNagle(Socket::Handle handle)
+{
+    int flag = 1;
+    setsockopt(
+        handle,
+        IPPROTO_TCP,
+        TCP_NODELAY,
+        reinterpret_cast<const char*>(&flag),
+        sizeof(flag)
+        );
+}
+
+bool makeLocalAddress(
+    const std::string& path,
+    sockaddr_un& address,
+    std::string* error
+    )
+{
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(address.sun_path)) {
+        setError(error, "Socket path is too long: " + path);
+        return false;
+    }
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+
+    return true;
+}
+
+}  // namespace
+
+
+// ============================================================================
+// Constructor/Destructor Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Socket::Socket
+// ----------------------------------------------------------------------------
+//
+// Description: Constructors
+//
+// Inputs:
+// - native_handle: An already connected or listening socket to take over
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+Socket::Socket() : handle(kInvalidHandle)
+{
+}
+
+Socket::Socket(Handle native_handle) : handle(native_handle)
+{
+}
+
+Socket::Socket(Socket&& other) noexcept
+    : handle(other.handle),
+      pending(std::move(other.pending))
+{
+    other.handle = kInvalidHandle;
+}
+
+Socket& Socket::operator=(Socket&& other) noexcept
+{
+    if (this != &other) {
+        this->close();
+        this->handle = other.handle;
+        this->pending = std::move(other.pending);
+        other.handle = kInvalidHandle;
+    }
+
+    return *this;
+}
+
+// ----------------------------------------------------------------------------
+// Socket::~Socket
+// ----------------------------------------------------------------------------
+//
+// Description: Destructor
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Closes the socket
+//
+// ----------------------------------------------------------------------------
+Socket::~Socket()
+{
+    this->close();
+}
+
+
+// ============================================================================
+// Factory Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Socket::listenTcp
+// ----------------------------------------------------------------------------
+//
+// Description: Creates a TCP listener bound to the loopback interface only,
+//              so the server is never exposed beyond the local machine
+//
+// Inputs:
+// - port: Port to listen on
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: The listening socket, invalid on failure
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+Socket Socket::listenTcp(std::uint16_t port, std::string* error)
+{
+    if (!initializeSockets()) {
+        setError(error, "Cannot initialize the socket library");
+        return Socket();
+    }
+
+    Socket listener(::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP));
+    if (!listener.isValid()) {
+        setError(error, "Cannot create a TCP socket");
+        return Socket();
+    }
+
+    int reuse = 1;
+    setsockopt(
+        listener.handle,
+        SOL_SOCKET,
+        SO_REUSEADDR,
+        reinterpret_cast<const char*>(&reuse),
+        sizeof(reuse)
+        );
+
+    sockaddr_in address;
+    std::memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    if (::bind(
+            listener.handle,
+            reinterpret_cast<sockaddr*>(&address),
+            sizeof(address)
+            ) != 0
+        || ::listen(listener.handle, SOMAXCONN) != 0) {
+        setError(error, "Cannot listen on port " + std::to_string(port));
+        return Socket();
+    }
+
+    return listener;
+}
+
+// ----------------------------------------------------------------------------
+// Socket::listenLocal
+// ----------------------------------------------------------------------------
+//
+// Description: Creates a Unix domain socket listener. A stale socket file
+//              left behind by a previous run is removed first; any other
+//              file at path is left alone and the call fails.
+//
+// Inputs:
+// - path: File system path of the socket
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: The listening socket, invalid on failure
+//
+// Side Effects: Creates the socket file, the caller removes it when done
+//
+// ----------------------------------------------------------------------------
+Socket Socket::listenLocal(const std::string& path, std::string* error)
+{
+    if (!initializeSockets()) {
+        setError(error, "Cannot initialize the socket library");
+        return Socket();
+    }
+
+    sockaddr_un address;
+    if (!makeLocalAddress(path, address, error)) {
+        return Socket();
+    }
+
+    Socket listener(::socket(AF_UNIX, SOCK_STREAM, 0));
+    if (!listener.isValid()) {
+        setError(error, "Cannot create a Unix domain socket");
+        return Socket();
+    }
+
+    if (!removeStaleSocket(path, error)) {
+        return Socket();
+    }
+    if (::bind(
+            listener.handle,
+            reinterpret_cast<sockaddr*>(&address),
+            sizeof(address)
+            ) != 0
+        || ::listen(listener.handle, SOMAXCONN) != 0) {
+        setError(error, "Cannot listen on " + path);
+        return Socket();
+    }
+
+    return listener;
+}
+
+// ----------------------------------------------------------------------------
+// Socket::connectTcp
+// ----------------------------------------------------------------------------
+//
+// Description: Connects to a TCP listener
+//
+// Inputs:
+// - host: Host name or address
+// - port: Port number
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: The connected socket, invalid on failure
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+Socket Socket::connectTcp(
+    const std::string& host,
+    std::uint16_t port,
+    std::string* error
+    )
+{
+    if (!initializeSockets()) {
+        setError(error, "Cannot initialize the socket library");
+        return Socket();
+    }
+
+    addrinfo hints;
+    std::memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+
+    addrinfo* results = nullptr;
+    const std::string service = std::to_string(port);
+    if (getaddrinfo(host.c_str(), service.c_str(), &hints, &results) != 0) {
+        setError(error, "Cannot resolve host " + host);
+        return Socket();
+    }
+
+    Socket link;
+    for (addrinfo* entry = results; entry != nullptr; entry = entry->ai_next) {
+        Socket candidate(::socket(
+            entry->ai_family,
+            entry->ai_socktype,
+            entry->ai_protocol
+            ));
+        if (candidate.isValid()
+            && ::connect(
+                candidate.handle,
+                entry->ai_addr,
+                static_cast<int>(entry->ai_addrlen)
+                ) == 0) {
+            link = std::move(candidate);
+            break;
+        }
+    }
+    freeaddrinfo(results);
+
+    if (!link.isValid()) {
+        setError(
+            error,
+            "Cannot connect to " + host + ":" + std::to_string(port)
+            );
+        return Socket();
+    }
+    disableNagle(link.handle);
+
+    return link;
+}
+
+// ----------------------------------------------------------------------------
+// Socket::connectLocal
+// ----------------------------------------------------------------------------
+//
+// Description: Connects to a Unix domain socket listener
+//
+// Inputs:
+// - path: File system path of the socket
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: The connected socket, invalid on failure
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+Socket Socket::connectLocal(const std::string& path, std::string* error)
+{
+    if (!initializeSockets()) {
+        setError(error, "Cannot initialize the socket library");
+        return Socket();
+    }
+
+    sockaddr_un address;
+    if (!makeLocalAddress(path, address, error)) {
+        return Socket();
+    }
+
+    Socket link(::socket(AF_UNIX, SOCK_STREAM, 0));
+    if (!link.isValid()
+        || ::connect(
+            link.handle,
+            reinterpret_cast<sockaddr*>(&address),
+            sizeof(address)
+            ) != 0) {
+        setError(error, "Cannot connect to " + path);
+        return Socket();
+    }
+
+    return link;
+}
+
+
+// ============================================================================
+// Public Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Socket::accept
+// ----------------------------------------------------------------------------
+//
+// Description: Blocks until a client connects
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: The connected socket, invalid if the listener was shut down
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+Socket Socket::accept() const
+{
+    Socket link(::accept(this->handle, nullptr, nullptr));
+    if (link.isValid()) {
+        // Harmless on Unix domain sockets, where the option is rejected
+        disableNagle(link.handle);
+    }
+
+    return link;
+}
+
+// ----------------------------------------------------------------------------
+// Socket::sendAll
+// ----------------------------------------------------------------------------
+//
+// Description: Sends the whole buffer, retrying on partial writes
+//
+// Inputs:
+// - data: Bytes to send
+// - size: Number of bytes to send
+//
+// Outputs: None
+//
+// Returns: false if the link failed
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool Socket::sendAll(const void* data, std::size_t size)
+{
+    auto cursor = static_cast<const char*>(data);
+    while (size > 0) {
+        const int chunk = static_cast<int>(
+            size > (1U << 30) ? (1U << 30) : size
+            );
+        const auto sent = ::send(this->handle, cursor, chunk, kSendFlags);
+        if (sent <= 0) {
+            return false;
+        }
+        cursor += sent;
+        size -= static_cast<std::size_t>(sent);
+    }
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Socket::receiveAll
+// ----------------------------------------------------------------------------
+//
+// Description: Receives exactly size bytes, consuming any bytes already
+//              buffered by receiveLine first
+//
+// Inputs:
+// - size: Number of bytes to receive
+//
+// Outputs:
+// - data: Destination buffer
+//
+// Returns: false if the link was closed before all bytes arrived
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool Socket::receiveAll(void* data, std::size_t size)
+{
+    auto cursor = static_cast<char*>(data);
+
+    const std::size_t buffered = std::min(size, this->pending.size());
+    if (buffered > 0) {
+        std::memcpy(cursor, this->pending.data(), buffered);
+        this->pending.erase(0, buffered);
+        cursor += buffered;
+        size -= buffered;
+    }
+
+    while (size > 0) {
+        const int chunk = static_cast<int>(
+            size > (1U << 30) ? (1U << 30) : size
+            );
+        const auto received = ::recv(this->handle, cursor, chunk, 0);
+        if (received <= 0) {
+            return false;
+        }
+        cursor += received;
+        size -= static_cast<std::size_t>(received);
+    }
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Socket::receiveLine
+// ----------------------------------------------------------------------------
+//
+// Description: Receives one line of text
+//
+// Inputs: None
+//
+// Outputs:
+// - line: The line without its "\n" or "\r\n" terminator
+//
+// Returns: false if the link was closed before a full line arrived, or the
+//          line is longer than kMaxLineLength
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool Socket::receiveLine(std::string& line)
+{
+    char chunk[512];
+
+    std::size_t end = this->pending.find('\n');
+    while (end == std::string::npos) {
+        // A peer that never ends its line must not exhaust memory
+        if (this->pending.size() > kMaxLineLength) {
+            this->pending.clear();
+            return false;
+        }
+        const auto received = ::recv(this->handle, chunk, sizeof(chunk), 0);
+        if (received <= 0) {
+            return false;
+        }
+        this->pending.append(chunk, static_cast<std::size_t>(received));
+        end = this->pending.find('\n');
+    }
+
+    line.assign(this->pending, 0, end);
+    this->pending.erase(0, end + 1);
+    if (!line.empty() && line.back() == '\r') {
+        line.pop_back();
+    }
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Socket::shutdown
+// ----------------------------------------------------------------------------
+//
+// Description: Disables sends and receives. Threads blocked in accept or
+//              receive on this socket return with an error.
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void Socket::shutdown()
+{
+    if (this->isValid()) {
+#if defined(_WIN32)
+        ::shutdown(this->handle, SD_BOTH);
+#else
+        ::shutdown(this->handle, SHUT_RDWR);
+#endif
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Socket::close
+// ----------------------------------------------------------------------------
+//
+// Description: Releases the socket
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void Socket::close()
+{
+    if (this->isValid()) {
+        closeHandle(this->handle);
+        this->handle = kInvalidHandle;
+    }
+    this->pending.clear();
+}
+
+// ----------------------------------------------------------------------------
+// Socket::isValid
+// ----------------------------------------------------------------------------
+//
+// Description: Tells whether the socket holds a native handle
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: true if the socket is usable
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool Socket::isValid() const
+{
+    return this->handle != kInvalidHandle;
+}
@@ -0,0 +1,139 @@
+// ============================================================================
+// Socket.h - Minimal portable stream socket for local links
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * Socket.h: created.
+// * Socket.h: added kMaxLineLength.
+//
+// ============================================================================
+
+
+#ifndef Socket_H
+#define Socket_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// "C" system headers
+
+// Standard Library headers
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+
+// ============================================================================
+// Class Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Socket
+// ----------------------------------------------------------------------------
+//
+// Description: A thin RAII wrapper around a BSD/Winsock stream socket. Only
+//              what the local frame streaming needs is provided: loopback TCP
+//              and Unix domain listeners, blocking sends and receives, and
+//              line oriented reads for text commands.
+//
+// Properties:
+// - handle: Native socket handle
+// - pending: Bytes received past the last line returned by receiveLine
+//
+// Methods:
+// - listenTcp: Creates a listener bound to the loopback interface
+// - listenLocal: Creates a Unix domain socket listener
+// - connectTcp: Connects to a TCP listener
+// - connectLocal: Connects to a Unix domain socket listener
+// - accept: Waits for an incoming connection
+// - sendAll: Sends a whole buffer
+// - receiveAll: Receives exactly the requested number of bytes
+// - receiveLine: Receives one newline terminated line, of at most
+//                kMaxLineLength bytes
+// - shutdown: Disables further sends and receives, unblocking other threads
+// - close: Releases the socket
+//
+// Example usage:
+//   std::string error;
+//   Socket listener = Socket::listenTcp(8000, &error);
+//   Socket link = listener.accept();
+//   std::string line;
+//   while (link.receiveLine(line)) {
+//       ...
+//   }
+//
+// ----------------------------------------------------------------------------
+class Socket
+{
+public:
+#if defined(_WIN32)
+    using Handle = std::uintptr_t;
+#else
+    using Handle = int;
+#endif
+
+    // Longest line receiveLine accepts, the link fails beyond it
+    static constexpr std::size_t kMaxLineLength = 64 * 1024;
+
+    // Constructor/Destructor
+    Socket();
+    explicit Socket(Handle native_handle);
+    ~Socket();
+
+    Socket(const Socket&) = delete;
+    Socket& operator=(const Socket&) = delete;
+    Socket(Socket&& other) noexcept;
+    Socket& operator=(Socket&& other) noexcept;
+
+    static Socket listenTcp(std::uint16_t port, std::string* error = nullptr);
+    static Socket listenLocal(
+        const std::string& path,
+        std::string* error = nullptr
+        );
+    static Socket connectTcp(
+        const std::string& host,
+        std::uint16_t port,
+        std::string* error = nullptr
+        );
+    static Socket connectLocal(
+        const std::string& path,
+        std::string* error = nullptr
+        );
+
+    Socket accept() const;  // Returns an invalid socket on failure
+    bool sendAll(const void* data, std::size_t size);
+    bool receiveAll(void* data, std::size_t size);
+    bool receiveLine(std::string& line);  // Strips the line terminator
+    void shutdown();
+    void close();
+
+    bool isValid() const;
+
+private:
+    Handle handle;
+    std::string pending;
+};
+
+#endif  // Socket_H
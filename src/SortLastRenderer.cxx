@@ -0,0 +1,796 @@
+// ============================================================================
+// SortLastRenderer.cxx - Mesh partitions rendered on threads, depth composited
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * SortLastRenderer.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header -------------------------------------------------------------
+#include "SortLastRenderer.h"
+#include "Scene.h"
+
+// Standard Library headers ---------------------------------------------------
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <numeric>
+
+// External libraries headers -------------------------------------------------
+
+// VTK headers
+#include <vtkActor.h>
+#include <vtkIdList.h>
+#include <vtkPolyDataMapper.h>
+#include <vtkSMPTools.h>
+#include <vtkType.h>
+
+
+// ============================================================================
+// Local helpers section
+// ============================================================================
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Pixels of one direct-send strip, the unit of work handed to a thread
+constexpr std::size_t kStripPixels = 16384;
+
+double secondsSince(Clock::time_point start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// Keeps the nearer pixel of two layers over a range of pixels. The output
+// may be one of the layers.
+void mergeSpan(
+    const DepthLayer& a,
+    const DepthLayer& b,
+    std::size_t first,
+    std::size_t last,
+    unsigned char* rgba,
+    float* depth
+    )
+{
+    for (std::size_t px = first; px < last; ++px) {
+        const DepthLayer& nearer = b.depth[px] < a.depth[px] ? b : a;
+        std::uint32_t color;
+        std::memcpy(&color, nearer.rgba + 4 * px, sizeof(color));
+        std::memcpy(rgba + 4 * px, &color, sizeof(color));
+        if (depth) {
+            depth[px] = nearer.depth[px];
+        }
+    }
+}
+
+// Every thread merges its strips from all the layers
+void directSend(
+    const std::vector<DepthLayer>& layers,
+    std::size_t pixels,
+    unsigned char* rgba,
+    float* depth
+    )
+{
+    const std::size_t strips = std::max<std::size_t>(
+        1,
+        (pixels + kStripPixels - 1) / kStripPixels
+        );
+    vtkSMPTools::For(0, static_cast<vtkIdType>(strips), 1,
+        [&](vtkIdType begin, vtkIdType end) {
+            for (vtkIdType strip = begin; strip < end; ++strip) {
+                const std::size_t first = pixels * strip / strips;
+                const std::size_t last = pixels * (strip + 1) / strips;
+                for (std::size_t px = first; px < last; ++px) {
+                    std::size_t nearest = 0;
+                    for (std::size_t i = 1; i < layers.size(); ++i) {
+                        if (layers[i].depth[px]
+                            < layers[nearest].depth[px]) {
+                            nearest = i;
+                        }
+                    }
+                    std::memcpy(
+                        rgba + 4 * px,
+                        layers[nearest].rgba + 4 * px,
+                        4
+                        );
+                    if (depth) {
+                        depth[px] = layers[nearest].depth[px];
+                    }
+                }
+            }
+        });
+}
+
+// Pairs of ranks swap halves of their regions for log2(ranks) rounds, then
+// every rank copies the region it ends up owning to the output
+void binarySwap(
+    const std::vector<DepthLayer>& layers,
+    std::size_t pixels,
+    std::vector<FrameBuffer>& scratch,
+    unsigned char* rgba,
+    float* depth
+    )
+{
+    std::size_t ranks = 1;
+    while (2 * ranks <= layers.size()) {
+        ranks *= 2;
+    }
+    if (scratch.size() < ranks) {
+        scratch.resize(ranks);
+    }
+    for (std::size_t rank = 0; rank < ranks; ++rank) {
+        if (scratch[rank].rgba.size() < 4 * pixels) {
+            scratch[rank].rgba.resize(4 * pixels);
+        }
+        if (scratch[rank].depth.size() < pixels) {
+            scratch[rank].depth.resize(pixels);
+        }
+    }
+    const auto working = [&scratch](std::size_t rank) {
+        DepthLayer layer;
+        layer.rgba = scratch[rank].rgba.data();
+        layer.depth = scratch[rank].depth.data();
+        return layer;
+    };
+
+    // Fold the layers beyond the power of two onto the first ones
+    std::vector<DepthLayer> current(layers.begin(), layers.begin() + ranks);
+    const std::size_t extra = layers.size() - ranks;
+    vtkSMPTools::For(0, static_cast<vtkIdType>(extra), 1,
+        [&](vtkIdType begin, vtkIdType end) {
+            for (vtkIdType rank = begin; rank < end; ++rank) {
+                mergeSpan(
+                    current[rank],
+                    layers[ranks + rank],
+                    0,
+                    pixels,
+                    scratch[rank].rgba.data(),
+                    scratch[rank].depth.data()
+                    );
+            }
+        });
+    for (std::size_t rank = 0; rank < extra; ++rank) {
+        current[rank] = working(rank);
+    }
+
+    // Partners hold the same region; each writes only the half it keeps
+    // and reads only the half the other keeps, so a round needs no locks
+    std::vector<std::size_t> first(ranks, 0);
+    std::vector<std::size_t> last(ranks, pixels);
+    for (std::size_t bit = 1; bit < ranks; bit *= 2) {
+        vtkSMPTools::For(0, static_cast<vtkIdType>(ranks), 1,
+            [&](vtkIdType begin, vtkIdType end) {
+                for (vtkIdType rank = begin; rank < end; ++rank) {
+                    const std::size_t half = (first[rank] + last[rank]) / 2;
+                    const bool upper = (rank & bit) != 0;
+                    mergeSpan(
+                        current[rank],
+                        current[rank ^ bit],
+                        upper ? half : first[rank],
+                        upper ? last[rank] : half,
+                        scratch[rank].rgba.data(),
+                        scratch[rank].depth.data()
+                        );
+                }
+            });
+        for (std::size_t rank = 0; rank < ranks; ++rank) {
+            const std::size_t half = (first[rank] + last[rank]) / 2;
+            if ((rank & bit) != 0) {
+                first[rank] = half;
+            } else {
+                last[rank] = half;
+            }
+            current[rank] = working(rank);
+        }
+    }
+
+    vtkSMPTools::For(0, static_cast<vtkIdType>(ranks), 1,
+        [&](vtkIdType begin, vtkIdType end) {
+            for (vtkIdType rank = begin; rank < end; ++rank) {
+                std::memcpy(
+                    rgba + 4 * first[rank],
+                    current[rank].rgba + 4 * first[rank],
+                    4 * (last[rank] - first[rank])
+                    );
+                if (depth) {
+                    std::memcpy(
+                        depth + first[rank],
+                        current[rank].depth + first[rank],
+                        sizeof(float) * (last[rank] - first[rank])
+                        );
+                }
+            }
+        });
+}
+
+}  // namespace
+
+
+// ============================================================================
+// Structure Definitions Section
+// ============================================================================
+
+// The shared state of one worker: what it renders and what it rendered
+struct SortLastRenderer::Partition {
+    std::thread thread;
+    vtkSmartPointer<vtkPolyData> piece;
+    FrameView frame;
+    bool success = false;
+    std::string error;
+};
+
+
+// ============================================================================
+// Function Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// compositeMethodName
+// ----------------------------------------------------------------------------
+//
+// Description: Returns the name of a compositing method
+//
+// Inputs:
+// - method: The method
+//
+// Outputs: None
+//
+// Returns: "direct-send" or "binary-swap"
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+const char* compositeMethodName(CompositeMethod method)
+{
+    switch (method) {
+        case CompositeMethod::DirectSend:
+            return "direct-send";
+        default:
+            return "binary-swap";
+    }
+}
+
+// ----------------------------------------------------------------------------
+// parseCompositeMethod
+// ----------------------------------------------------------------------------
+//
+// Description: Parses the name of a compositing method
+//
+// Inputs:
+// - name: "direct-send", "binary-swap", "direct" or "binary"
+//
+// Outputs:
+// - method: The method, if the name is known
+//
+// Returns: Whether the name is known
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool parseCompositeMethod(const std::string& name, CompositeMethod* method)
+{
+    if (name == "direct-send" || name == "direct") {
+        *method = CompositeMethod::DirectSend;
+    } else if (name == "binary-swap" || name == "binary") {
+        *method = CompositeMethod::BinarySwap;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// partitionMesh
+// ----------------------------------------------------------------------------
+//
+// Description: Splits the cells of a mesh into spatially compact pieces
+//
+// Inputs:
+// - mesh: The mesh
+// - parts: Pieces wanted
+//
+// Outputs: None
+//
+// Returns: The pieces, min(parts, cells) of them, none for an empty mesh
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+std::vector<vtkSmartPointer<vtkPolyData>> partitionMesh(
+    vtkPolyData* mesh,
+    int parts
+    )
+{
+    std::vector<vtkSmartPointer<vtkPolyData>> pieces;
+    if (mesh == nullptr || mesh->GetNumberOfCells() == 0 || parts < 1) {
+        return pieces;
+    }
+
+    const vtkIdType cells = mesh->GetNumberOfCells();
+    std::vector<double> centers(3 * static_cast<std::size_t>(cells));
+    for (vtkIdType id = 0; id < cells; ++id) {
+        double bounds[6];
+        mesh->GetCellBounds(id, bounds);
+        for (int axis = 0; axis < 3; ++axis) {
+            centers[3 * id + axis] =
+                0.5 * (bounds[2 * axis] + bounds[2 * axis + 1]);
+        }
+    }
+
+    // Median splits along the longest axis of the centers, with the
+    // pieces divided between the halves in proportion to their cells
+    std::vector<vtkIdType> order(cells);
+    std::iota(order.begin(), order.end(), vtkIdType(0));
+    std::vector<std::pair<std::size_t, std::size_t>> ranges;
+    std::function<void(std::size_t, std::size_t, vtkIdType)> split =
+        [&](std::size_t first, std::size_t last, vtkIdType count) {
+            if (count <= 1) {
+                ranges.emplace_back(first, last);
+                return;
+            }
+
+            double extent[6] = {
+                VTK_DOUBLE_MAX, VTK_DOUBLE_MIN, VTK_DOUBLE_MAX,
+                VTK_DOUBLE_MIN, VTK_DOUBLE_MAX, VTK_DOUBLE_MIN
+            };
+            for (std::size_t i = first; i < last; ++i) {
+                for (int axis = 0; axis < 3; ++axis) {
+                    const double center = centers[3 * order[i] + axis];
+                    extent[2 * axis] = std::min(extent[2 * axis], center);
+                    extent[2 * axis + 1] =
+                        std::max(extent[2 * axis + 1], center);
+                }
+            }
+            int axis = 0;
+            for (int a = 1; a < 3; ++a) {
+                if (extent[2 * a + 1] - extent[2 * a]
+                    > extent[2 * axis + 1] - extent[2 * axis]) {
+                    axis = a;
+                }
+            }
+
+            const vtkIdType left = count / 2;
+            const std::size_t middle = first + (last - first) * left / count;
+            std::nth_element(
+                order.begin() + first,
+                order.begin() + middle,
+                order.begin() + last,
+                [&centers, axis](vtkIdType a, vtkIdType b) {
+                    return centers[3 * a + axis] < centers[3 * b + axis];
+                }
+                );
+            split(first, middle, left);
+            split(middle, last, count - left);
+        };
+    split(0, order.size(), std::min<vtkIdType>(parts, cells));
+
+    auto ids = vtkSmartPointer<vtkIdList>::New();
+    for (const auto& range : ranges) {
+        const std::size_t count = range.second - range.first;
+        ids->SetNumberOfIds(static_cast<vtkIdType>(count));
+        for (std::size_t i = 0; i < count; ++i) {
+            ids->SetId(static_cast<vtkIdType>(i), order[range.first + i]);
+        }
+        auto piece = vtkSmartPointer<vtkPolyData>::New();
+        piece->CopyCells(mesh, ids);
+        pieces.push_back(piece);
+    }
+
+    return pieces;
+}
+
+// ----------------------------------------------------------------------------
+// compositeLayers
+// ----------------------------------------------------------------------------
+//
+// Description: Merges images keeping the nearest pixel of every position
+//              (see the declaration)
+//
+// Inputs:
+// - layers: The images, all of pixels pixels
+// - pixels: Pixels per image
+// - method: Direct-send or binary-swap
+//
+// Outputs:
+// - scratch: Working images of binary-swap, kept to be reused
+// - rgba: The merged pixels
+// - depth: Their depth, if not null
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void compositeLayers(
+    const std::vector<DepthLayer>& layers,
+    std::size_t pixels,
+    CompositeMethod method,
+    std::vector<FrameBuffer>& scratch,
+    unsigned char* rgba,
+    float* depth
+    )
+{
+    if (layers.empty() || pixels == 0) {
+        return;
+    }
+
+    if (method == CompositeMethod::DirectSend) {
+        directSend(layers, pixels, rgba, depth);
+    } else {
+        binarySwap(layers, pixels, scratch, rgba, depth);
+    }
+}
+
+
+// ============================================================================
+// SortLastRenderer Constructor/Destructor Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// SortLastRenderer::SortLastRenderer
+// ----------------------------------------------------------------------------
+//
+// Description: Constructor. Starts the worker threads; each creates its
+//              offscreen scene on its first frame.
+//
+// Inputs:
+// - partitions: Number of partitions and threads, 0 for one per core
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Starts the worker threads
+//
+// ----------------------------------------------------------------------------
+SortLastRenderer::SortLastRenderer(int partitions)
+    : mesh_bounds{0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+      request_size{0, 0},
+      background{0.0, 0.0, 0.0}
+{
+    if (partitions <= 0) {
+        partitions = static_cast<int>(std::thread::hardware_concurrency());
+    }
+    partitions = std::max(1, partitions);
+
+    this->composite = vtkSmartPointer<vtkImageData>::New();
+    this->request_camera = vtkSmartPointer<vtkCamera>::New();
+    for (int i = 0; i < partitions; ++i) {
+        this->partitions.push_back(std::make_unique<Partition>());
+    }
+    for (int i = 0; i < partitions; ++i) {
+        this->partitions[i]->thread = std::thread(
+            &SortLastRenderer::workerLoop,
+            this,
+            i
+            );
+    }
+}
+
+// ----------------------------------------------------------------------------
+// SortLastRenderer::~SortLastRenderer
+// ----------------------------------------------------------------------------
+//
+// Description: Destructor
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Stops and joins the worker threads, which release their
+//               OpenGL contexts
+//
+// ----------------------------------------------------------------------------
+SortLastRenderer::~SortLastRenderer()
+{
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->stopping = true;
+    }
+    this->work_ready.notify_all();
+    for (auto& partition : this->partitions) {
+        partition->thread.join();
+    }
+}
+
+
+// ============================================================================
+// SortLastRenderer Public Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// SortLastRenderer::setMesh
+// ----------------------------------------------------------------------------
+//
+// Description: Partitions a mesh among the workers, replacing the previous
+//              one. Workers pick their piece up on the next frame.
+//
+// Inputs:
+// - mesh: The mesh, null to render nothing
+// - surface: Surface property of the mesh, null for the default
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void SortLastRenderer::setMesh(vtkPolyData* mesh, vtkProperty* surface)
+{
+    std::vector<vtkSmartPointer<vtkPolyData>> pieces = partitionMesh(
+        mesh,
+        this->partitionCount()
+        );
+    for (std::size_t i = 0; i < this->partitions.size(); ++i) {
+        this->partitions[i]->piece = i < pieces.size()
+            ? pieces[i]
+            : vtkSmartPointer<vtkPolyData>::New();
+    }
+
+    if (mesh != nullptr) {
+        mesh->GetBounds(this->mesh_bounds);
+    }
+    this->property = vtkSmartPointer<vtkProperty>::New();
+    if (surface != nullptr) {
+        this->property->DeepCopy(surface);
+    }
+    ++this->mesh_generation;
+}
+
+// ----------------------------------------------------------------------------
+// SortLastRenderer::setBackground
+// ----------------------------------------------------------------------------
+//
+// Description: Sets the background color, shown where no partition draws
+//
+// Inputs:
+// - rgb: The color, components in the range 0 to 1
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void SortLastRenderer::setBackground(const double rgb[3])
+{
+    std::copy(rgb, rgb + 3, this->background);
+}
+
+// ----------------------------------------------------------------------------
+// SortLastRenderer::render
+// ----------------------------------------------------------------------------
+//
+// Description: Renders every partition on its worker with a copy of the
+//              camera, waits for all of them and composites their color
+//              and depth into the output image
+//
+// Inputs:
+// - camera: The camera to render with
+// - width, height: Frame size in pixels
+//
+// Outputs:
+// - stats: What was done, if not null
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false if there is no mesh or a partition
+//          failed to render or read back
+//
+// Side Effects: Modifies the output image
+//
+// ----------------------------------------------------------------------------
+bool SortLastRenderer::render(
+    vtkCamera* camera,
+    int width,
+    int height,
+    SortLastStats* stats,
+    std::string* error
+    )
+{
+    if (this->mesh_generation == 0 || width <= 0 || height <= 0) {
+        if (error) {
+            *error = "No mesh to render";
+        }
+        return false;
+    }
+
+    const auto started = Clock::now();
+    this->request_camera->DeepCopy(camera);
+    this->request_size[0] = width;
+    this->request_size[1] = height;
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->active_workers = this->partitions.size();
+        ++this->batch;
+    }
+    this->work_ready.notify_all();
+    {
+        std::unique_lock<std::mutex> lock(this->mutex);
+        this->work_done.wait(lock, [this]() {
+            return this->active_workers == 0;
+        });
+    }
+    const double render_seconds = secondsSince(started);
+
+    std::vector<DepthLayer> layers;
+    for (const auto& partition : this->partitions) {
+        const FrameView& frame = partition->frame;
+        if (!partition->success) {
+            if (error) {
+                *error = partition->error;
+            }
+            return false;
+        }
+        if (frame.width != width || frame.height != height) {
+            if (error) {
+                *error = "A partition was rendered at the wrong size";
+            }
+            return false;
+        }
+        DepthLayer layer;
+        layer.rgba = frame.rgba;
+        layer.depth = frame.depth;
+        layers.push_back(layer);
+    }
+
+    int dimensions[3];
+    this->composite->GetDimensions(dimensions);
+    if (dimensions[0] != width || dimensions[1] != height
+        || this->composite->GetNumberOfScalarComponents() != 4) {
+        this->composite->SetDimensions(width, height, 1);
+        this->composite->AllocateScalars(VTK_UNSIGNED_CHAR, 4);
+    }
+
+    const auto composite_started = Clock::now();
+    compositeLayers(
+        layers,
+        static_cast<std::size_t>(width) * static_cast<std::size_t>(height),
+        this->composite_method,
+        this->scratch,
+        static_cast<unsigned char*>(this->composite->GetScalarPointer())
+        );
+    this->composite->Modified();
+
+    if (stats) {
+        stats->partitions = this->partitionCount();
+        stats->render_seconds = render_seconds;
+        stats->composite_seconds = secondsSince(composite_started);
+        stats->seconds = secondsSince(started);
+    }
+
+    return true;
+}
+
+
+// ============================================================================
+// SortLastRenderer Private Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// SortLastRenderer::workerLoop
+// ----------------------------------------------------------------------------
+//
+// Description: Body of a worker thread. Waits for a frame, renders its
+//              partition and reads the color and depth back. The offscreen
+//              scene is created on the first frame and reused for every
+//              later one, so the OpenGL context and the uploaded piece stay
+//              with the thread.
+//
+// Inputs:
+// - index: Index of the worker and of its partition
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void SortLastRenderer::workerLoop(int index)
+{
+    Partition& partition = *this->partitions[index];
+    std::unique_ptr<OffscreenScene> scene;
+    std::unique_ptr<FrameReadback> readback;
+    vtkSmartPointer<vtkPolyDataMapper> mapper;
+    vtkSmartPointer<vtkActor> actor;
+    auto camera = vtkSmartPointer<vtkCamera>::New();
+    std::uint64_t seen_batch = 0;
+    std::uint64_t seen_mesh = 0;
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            this->work_ready.wait(lock, [this, seen_batch]() {
+                return this->stopping || this->batch != seen_batch;
+            });
+            if (this->stopping) {
+                break;
+            }
+            seen_batch = this->batch;
+        }
+
+        const int width = this->request_size[0];
+        const int height = this->request_size[1];
+        if (!scene) {
+            scene = std::make_unique<OffscreenScene>(width, height);
+            readback = std::make_unique<FrameReadback>(
+                scene->renderWindow(),
+                1
+                );
+            mapper = vtkSmartPointer<vtkPolyDataMapper>::New();
+            actor = vtkSmartPointer<vtkActor>::New();
+            actor->SetMapper(mapper);
+            scene->renderer()->AddActor(actor);
+            scene->renderer()->SetActiveCamera(camera);
+        } else {
+            scene->setSize(width, height);
+        }
+        if (seen_mesh != this->mesh_generation) {
+            mapper->SetInputData(partition.piece);
+            actor->GetProperty()->DeepCopy(this->property);
+            seen_mesh = this->mesh_generation;
+        }
+
+        // Every partition clips to the whole mesh, so depths compare
+        double bounds[6];
+        std::copy(this->mesh_bounds, this->mesh_bounds + 6, bounds);
+        camera->DeepCopy(this->request_camera);
+        scene->renderer()->SetBackground(this->background);
+        scene->renderer()->ResetCameraClippingRange(bounds);
+
+        partition.error.clear();
+        partition.success = readback->render(
+            &partition.frame,
+            true,
+            &partition.error
+            );
+
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            if (--this->active_workers == 0) {
+                this->work_done.notify_all();
+            }
+        }
+    }
+
+    // The context goes with the thread that made it current
+    partition.frame.release();
+    readback.reset();
+    actor = nullptr;
+    mapper = nullptr;
+    scene.reset();
+}
@@ -0,0 +1,277 @@
+// ============================================================================
+// SortLastRenderer.h - Mesh partitions rendered on threads, depth composited
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * SortLastRenderer.h: created.
+//
+// ============================================================================
+
+
+#ifndef SortLastRenderer_H
+#define SortLastRenderer_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Standard Library headers
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// External libraries headers
+#include <vtkCamera.h>
+#include <vtkImageData.h>
+#include <vtkPolyData.h>
+#include <vtkProperty.h>
+#include <vtkSmartPointer.h>
+
+// Project headers
+#include "FrameReadback.h"
+
+
+// ============================================================================
+// Enumerations Section
+// ============================================================================
+
+// How the color and depth images of the partitions are combined
+enum class CompositeMethod {
+    DirectSend,  // Every thread merges one strip from all images
+    BinarySwap  // Pairs of threads swap halves of their regions each round
+};
+
+
+// ============================================================================
+// Structure Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// DepthLayer
+// ----------------------------------------------------------------------------
+//
+// Description: One image to composite, as pointers into memory it does not
+//              own
+//
+// Properties:
+// - rgba: RGBA pixels
+// - depth: Depth of the pixels, smaller is nearer
+//
+// ----------------------------------------------------------------------------
+struct DepthLayer {
+    const unsigned char* rgba = nullptr;
+    const float* depth = nullptr;
+};
+
+// ----------------------------------------------------------------------------
+// SortLastStats
+// ----------------------------------------------------------------------------
+//
+// Description: What SortLastRenderer::render did
+//
+// Properties:
+// - partitions: Partitions rendered
+// - render_seconds: Time until the slowest partition was read back
+// - composite_seconds: Time spent compositing
+// - seconds: Wall clock time of the frame
+//
+// ----------------------------------------------------------------------------
+struct SortLastStats {
+    int partitions = 0;
+    double render_seconds = 0.0;
+    double composite_seconds = 0.0;
+    double seconds = 0.0;
+};
+
+
+// ============================================================================
+// Function Declarations Section
+// ============================================================================
+
+// Returns "direct-send" or "binary-swap"
+const char* compositeMethodName(CompositeMethod method);
+
+// Parses a method name, also accepting "direct" and "binary"
+bool parseCompositeMethod(
+    const std::string& name,
+    CompositeMethod* method
+    );
+
+// Splits the cells of a mesh into parts pieces of about the same cell
+// count, by recursive median splits of the cell centers along the longest
+// axis, so pieces are spatially compact. Points and their data are copied
+// into each piece. Returns fewer pieces if the mesh has fewer cells.
+std::vector<vtkSmartPointer<vtkPolyData>> partitionMesh(
+    vtkPolyData* mesh,
+    int parts
+    );
+
+// ----------------------------------------------------------------------------
+// compositeLayers
+// ----------------------------------------------------------------------------
+//
+// Description: Merges images of the same size, keeping the nearest pixel
+//              of every position (sort-last compositing), over the cores.
+//              Direct-send gives every thread one strip of the frame to
+//              merge from all images. Binary-swap pairs threads in
+//              log2(n) rounds in which each keeps half of its region and
+//              merges the partner's half of it, then gathers the regions;
+//              image counts other than a power of two are first folded
+//              onto the power of two below. Both give the same frame.
+//
+// Inputs:
+// - layers: The images, all of pixels pixels
+// - pixels: Pixels per image
+// - method: Direct-send or binary-swap
+//
+// Outputs:
+// - scratch: Working images of binary-swap, kept to be reused
+// - rgba: The merged pixels
+// - depth: Their depth, if not null
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void compositeLayers(
+    const std::vector<DepthLayer>& layers,
+    std::size_t pixels,
+    CompositeMethod method,
+    std::vector<FrameBuffer>& scratch,
+    unsigned char* rgba,
+    float* depth = nullptr
+    );
+
+
+// ============================================================================
+// Class Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// SortLastRenderer
+// ----------------------------------------------------------------------------
+//
+// Description: Sort-last parallel rendering of a large mesh. The mesh is
+//              partitioned spatially (partitionMesh) and every partition is
+//              rendered by its own worker thread, owning an OffscreenScene
+//              and with it an OpenGL context, so software OpenGL renders
+//              on all cores instead of one. Every frame the workers render
+//              their partition with a copy of the same camera, clipped to
+//              the bounds of the whole mesh so the depths agree, and read
+//              color and depth back (FrameReadback); compositeLayers then
+//              merges the images into the output image, which the caller
+//              shows, e.g. as the background texture of its view.
+//
+// Properties:
+// - partitions: One per worker: the thread, its piece and its last frame
+// - scratch: Working images of the compositing
+// - composite: The merged frame
+// - composite_method: Compositing method
+// - mesh_bounds: Bounds of the whole mesh
+// - property: Surface property of every partition
+// - request_camera: Camera of the frame being rendered
+// - request_size: Size of the frame being rendered
+// - background: Background color of the partitions
+// - mesh_generation: Counts the meshes set, so workers pick new pieces up
+// - active_workers, batch, stopping: Batch hand-off, guarded by mutex
+//
+// Methods:
+// - setMesh: Partitions a mesh among the workers
+// - setMethod, method: Sets and returns the compositing method
+// - setBackground: Sets the background color
+// - render: Renders all partitions for a camera and composites them
+// - output: Returns the composited RGBA image
+// - partitionCount: Returns the number of partitions
+//
+// Example usage:
+//   SortLastRenderer sort_last(16);
+//   sort_last.setMesh(mesh, actor->GetProperty());
+//   if (sort_last.render(renderer->GetActiveCamera(), 1920, 1080)) {
+//       texture->SetInputData(sort_last.output());
+//   }
+//
+// ----------------------------------------------------------------------------
+class SortLastRenderer
+{
+public:
+    // Constructor/Destructor
+    explicit SortLastRenderer(int partitions = 0);  // 0: one per core
+    ~SortLastRenderer();
+
+    SortLastRenderer(const SortLastRenderer&) = delete;
+    SortLastRenderer& operator=(const SortLastRenderer&) = delete;
+
+    void setMesh(vtkPolyData* mesh, vtkProperty* surface = nullptr);
+    void setMethod(CompositeMethod method) { this->composite_method = method; }
+    CompositeMethod method() const { return this->composite_method; }
+    void setBackground(const double rgb[3]);
+
+    bool render(
+        vtkCamera* camera,
+        int width,
+        int height,
+        SortLastStats* stats = nullptr,
+        std::string* error = nullptr
+        );  // Waits for every partition
+    vtkImageData* output() const { return this->composite; }
+    int partitionCount() const
+    {
+        return static_cast<int>(this->partitions.size());
+    }
+
+private:
+    struct Partition;
+
+    void workerLoop(int index);
+
+    std::vector<std::unique_ptr<Partition>> partitions;
+    std::vector<FrameBuffer> scratch;
+    vtkSmartPointer<vtkImageData> composite;
+    CompositeMethod composite_method = CompositeMethod::BinarySwap;
+
+    // Read by the workers while a batch runs, written between batches
+    double mesh_bounds[6];
+    vtkSmartPointer<vtkProperty> property;
+    vtkSmartPointer<vtkCamera> request_camera;
+    int request_size[2];
+    double background[3];
+    std::uint64_t mesh_generation = 0;
+
+    // Guarded by mutex
+    std::mutex mutex;
+    std::condition_variable work_ready;
+    std::condition_variable work_done;
+    std::size_t active_workers = 0;
+    std::uint64_t batch = 0;
+    bool stopping = false;
+};
+
+#endif  // SortLastRenderer_H
@@ -0,0 +1,147 @@
+// ============================================================================
+// SpscRing.h - Bounded lock-free single producer, single consumer queue
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * SpscRing.h: created.
+//
+// ============================================================================
+
+
+#ifndef SpscRing_H
+#define SpscRing_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Standard Library headers
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+
+// ============================================================================
+// Class Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// SpscRing
+// ----------------------------------------------------------------------------
+//
+// Description: A fixed ring of preallocated slots passed from one producer
+//              thread to one consumer thread without locks. The producer
+//              fills the slot at the head in place and publishes it, the
+//              consumer reads the slot at the tail in place and releases
+//              it, so large payloads (frames) are never copied and their
+//              buffers are reused. Neither side blocks: a null slot means
+//              the ring is full (producer) or empty (consumer), and the
+//              caller decides whether to wait.
+//
+// Properties:
+// - slots: capacity + 1 slots, one always stays free
+// - head: Next slot the producer fills
+// - tail: Next slot the consumer reads
+//
+// Methods:
+// - producerSlot: Slot to fill, null when the ring is full
+// - publish: Hands the filled slot to the consumer
+// - consumerSlot: Oldest published slot, null when the ring is empty
+// - release: Returns the read slot to the producer
+// - capacity: Number of slots that can be in flight
+//
+// Example usage:
+//   SpscRing<RawFrame> ring(4);
+//   // Producer thread
+//   while ((frame = ring.producerSlot()) == nullptr) {
+//       std::this_thread::yield();
+//   }
+//   render(*frame);
+//   ring.publish();
+//   // Consumer thread
+//   if (RawFrame* frame = ring.consumerSlot()) {
+//       encode(*frame);
+//       ring.release();
+//   }
+//
+// ----------------------------------------------------------------------------
+template <typename T>
+class SpscRing
+{
+public:
+    // Constructor/Destructor
+    explicit SpscRing(std::size_t capacity)
+        : slots(capacity + 1), head(0), tail(0)
+    {
+    }
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    T* producerSlot()
+    {
+        const std::size_t current = this->head.load(std::memory_order_relaxed);
+        const std::size_t oldest = this->tail.load(std::memory_order_acquire);
+        if (this->next(current) == oldest) {
+            return nullptr;
+        }
+        return &this->slots[current];
+    }
+
+    void publish()
+    {
+        const std::size_t current = this->head.load(std::memory_order_relaxed);
+        this->head.store(this->next(current), std::memory_order_release);
+    }
+
+    T* consumerSlot()
+    {
+        const std::size_t current = this->tail.load(std::memory_order_relaxed);
+        if (current == this->head.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+        return &this->slots[current];
+    }
+
+    void release()
+    {
+        const std::size_t current = this->tail.load(std::memory_order_relaxed);
+        this->tail.store(this->next(current), std::memory_order_release);
+    }
+
+    std::size_t capacity() const { return this->slots.size() - 1; }
+
+private:
+    std::size_t next(std::size_t index) const
+    {
+        return index + 1 == this->slots.size() ? 0 : index + 1;
+    }
+
+    std::vector<T> slots;
+    // Producer and consumer indices on separate cache lines
+    alignas(64) std::atomic<std::size_t> head;
+    alignas(64) std::atomic<std::size_t> tail;
+};
+
+#endif  // SpscRing_H
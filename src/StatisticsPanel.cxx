@@ -0,0 +1,233 @@
+// ============================================================================
+// StatisticsPanel.cxx - Histogram and statistics panel of the viewer
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * StatisticsPanel.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header -------------------------------------------------------------
+#include "StatisticsPanel.h"
+
+// Standard Library headers ---------------------------------------------------
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// External libraries headers -------------------------------------------------
+
+// Qt headers
+#include <QPainter>
+#include <QVBoxLayout>
+
+
+// ============================================================================
+// Local helpers section
+// ============================================================================
+
+// Draws a histogram with a log scaled count axis, merging bins down to one
+// column per pixel. Small bins of a wide histogram (16 bit images have 65536)
+// stay visible because a column shows the largest bin it covers.
+class HistogramView : public QWidget
+{
+public:
+    explicit HistogramView(QWidget* parent = nullptr)
+        : QWidget(parent)
+    {
+        this->setMinimumSize(200, 120);
+        this->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Expanding);
+    }
+
+    void setHistogram(const std::vector<std::uint64_t>& bins)
+    {
+        this->bins = bins;
+        this->update();
+    }
+
+protected:
+    void paintEvent(QPaintEvent*) override
+    {
+        QPainter painter(this);
+        painter.fillRect(this->rect(), this->palette().base());
+        const int width = this->width();
+        const int height = this->height();
+        if (this->bins.empty() || width <= 0 || height <= 0) {
+            return;
+        }
+
+        std::vector<std::uint64_t> columns(width, 0);
+        for (std::size_t bin = 0; bin < this->bins.size(); ++bin) {
+            const std::size_t column = bin * width / this->bins.size();
+            columns[column] = std::max(columns[column], this->bins[bin]);
+        }
+        const double top = std::log1p(double(
+            *std::max_element(columns.begin(), columns.end())
+            ));
+        if (top <= 0.0) {
+            return;
+        }
+
+        painter.setPen(this->palette().color(QPalette::Highlight));
+        for (int column = 0; column < width; ++column) {
+            const int bar = static_cast<int>(
+                height * std::log1p(double(columns[column])) / top
+                );
+            if (bar > 0) {
+                painter.drawLine(column, height - 1, column, height - bar);
+            }
+        }
+    }
+
+private:
+    std::vector<std::uint64_t> bins;
+};
+
+
+// ============================================================================
+// Constructor/Destructor Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// StatisticsPanel::StatisticsPanel
+// ----------------------------------------------------------------------------
+//
+// Description: Constructor
+//
+// Inputs:
+// - parent: Parent widget
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+StatisticsPanel::StatisticsPanel(QWidget* parent)
+    : QWidget(parent)
+{
+    this->title = new QLabel(this);
+    this->histogram = new HistogramView(this);
+    this->summary = new QLabel(this);
+    this->summary->setTextInteractionFlags(Qt::TextSelectableByMouse);
+    this->progress = new QProgressBar(this);
+    this->auto_button = new QPushButton(tr("Auto Window/Level"), this);
+    this->auto_button->setToolTip(
+        tr("Window the volume from the 1st to the 99th percentile")
+        );
+    connect(
+        this->auto_button,
+        &QPushButton::clicked,
+        this,
+        &StatisticsPanel::autoWindowLevelRequested
+        );
+
+    auto layout = new QVBoxLayout(this);
+    layout->addWidget(this->title);
+    layout->addWidget(this->histogram, 1);
+    layout->addWidget(this->summary);
+    layout->addWidget(this->progress);
+    layout->addWidget(this->auto_button);
+
+    this->clear();
+}
+
+
+// ============================================================================
+// Public Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// StatisticsPanel::setStatistics
+// ----------------------------------------------------------------------------
+//
+// Description: Shows the statistics of a volume, those of the bricks
+//              counted so far while the pass runs
+//
+// Inputs:
+// - name: Name of the volume
+// - stats: The statistics
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Repaints the panel
+//
+// ----------------------------------------------------------------------------
+void StatisticsPanel::setStatistics(
+    const QString& name,
+    const ImageStatistics& stats
+    )
+{
+    this->title->setText(name);
+    this->histogram->setHistogram(stats.histogram);
+    this->summary->setText(
+        tr("Values: %1\nRange: %2 to %3\nMean: %4, deviation: %5\n"
+           "Percentiles 1/50/99: %6 / %7 / %8")
+        .arg(stats.count)
+        .arg(stats.minimum, 0, 'g', 6)
+        .arg(stats.maximum, 0, 'g', 6)
+        .arg(stats.mean, 0, 'g', 6)
+        .arg(stats.deviation, 0, 'g', 6)
+        .arg(stats.percentile(0.01), 0, 'g', 6)
+        .arg(stats.percentile(0.5), 0, 'g', 6)
+        .arg(stats.percentile(0.99), 0, 'g', 6)
+        );
+    this->progress->setRange(0, static_cast<int>(stats.bricks_total));
+    this->progress->setValue(static_cast<int>(stats.bricks_done));
+    this->progress->setVisible(!stats.complete());
+    this->auto_button->setEnabled(stats.count > 0);
+}
+
+// ----------------------------------------------------------------------------
+// StatisticsPanel::clear
+// ----------------------------------------------------------------------------
+//
+// Description: Shows that no volume is open
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Repaints the panel
+//
+// ----------------------------------------------------------------------------
+void StatisticsPanel::clear()
+{
+    this->title->setText(tr("No volume"));
+    this->histogram->setHistogram({});
+    this->summary->clear();
+    this->progress->hide();
+    this->auto_button->setEnabled(false);
+}
@@ -0,0 +1,108 @@
+// ============================================================================
+// StatisticsPanel.h - Histogram and statistics panel of the viewer
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * StatisticsPanel.h: created.
+//
+// ============================================================================
+
+
+#ifndef StatisticsPanel_H
+#define StatisticsPanel_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// External libraries headers
+#include <QLabel>
+#include <QPointer>
+#include <QProgressBar>
+#include <QPushButton>
+#include <QWidget>
+
+// Project headers
+#include "ImageStatistics.h"
+
+
+// Forward class declarations
+class HistogramView;
+
+
+// ============================================================================
+// Class Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// StatisticsPanel
+// ----------------------------------------------------------------------------
+//
+// Description: Shows the histogram (log scaled), range, mean, deviation and
+//              percentiles of a volume as they stream in from an
+//              ImageStatisticsEngine, with the progress of the pass
+//
+// Properties:
+// - title: Name of the volume
+// - histogram: Draws the histogram
+// - summary: Range, mean, deviation and percentiles
+// - progress: Bricks counted so far
+// - auto_button: Requests the auto window/level
+//
+// Methods:
+// - setStatistics: Shows the statistics of a volume, partial or final
+// - clear: Shows that no volume is open
+//
+// Signals:
+// - autoWindowLevelRequested: The auto window/level button was clicked
+//
+// Example usage:
+//   auto panel = new StatisticsPanel();
+//   panel->setStatistics("head.mhd", stats);
+//
+// ----------------------------------------------------------------------------
+class StatisticsPanel : public QWidget
+{
+  Q_OBJECT
+public:
+    // Constructor/Destructor
+    explicit StatisticsPanel(QWidget* parent = nullptr);
+    ~StatisticsPanel() override = default;
+
+    void setStatistics(const QString& name, const ImageStatistics& stats);
+    void clear();
+
+Q_SIGNALS:
+    void autoWindowLevelRequested();
+
+private:
+    QPointer<QLabel> title;
+    QPointer<HistogramView> histogram;
+    QPointer<QLabel> summary;
+    QPointer<QProgressBar> progress;
+    QPointer<QPushButton> auto_button;
+};
+
+#endif  // StatisticsPanel_H
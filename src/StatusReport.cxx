@@ -0,0 +1,253 @@
+// ============================================================================
+// StatusReport.cxx - Implementation of the StatusReport class
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * StatusReport.cxx: created.
+//
+// ============================================================================
+
+
+#define _USE_MATH_DEFINES
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header -------------------------------------------------------------
+#include "StatusReport.h"
+
+// "C" system headers ---------------------------------------------------------
+
+// Standard Library headers ---------------------------------------------------
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+
+// ============================================================================
+// Local helpers section
+// ============================================================================
+
+namespace {
+
+// UTF-8 encoded degree sign
+const char* const kDegree = "\xC2\xB0";
+
+// Formats an angle the way the status bar always did: width 6, 1 decimal
+std::string formatValue(double value)
+{
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%6.1f", value);
+    return buffer;
+}
+
+}  // namespace
+
+
+// ============================================================================
+// Function Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// cameraStatus
+// ----------------------------------------------------------------------------
+//
+// Description: Reads the orientation of the camera
+//
+// Inputs:
+// - camera: The camera to read
+//
+// Outputs: None
+//
+// Returns: Azimuth, elevation, roll and distance of the camera
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+CameraStatus cameraStatus(vtkCamera* camera)
+{
+    CameraStatus status;
+    if (camera == nullptr) {
+        return status;
+    }
+
+    // Calculate the azimuth and elevation of the camera
+    const double* projection = camera->GetDirectionOfProjection();
+    status.azimuth = asin(- projection[1]) * 180.0 / M_PI;
+    status.elevation = acos(
+        - projection[2] / cos(status.azimuth * M_PI / 180.0)
+        ) * 180.0 / M_PI;
+    status.roll = camera->GetRoll();
+    status.distance = camera->GetDistance();
+
+    return status;
+}
+
+
+// ============================================================================
+// Constructor/Destructor Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// StatusReport::StatusReport
+// ----------------------------------------------------------------------------
+//
+// Description: Constructor
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+StatusReport::StatusReport()
+    : has_camera(false)
+{
+}
+
+
+// ============================================================================
+// Public Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// StatusReport::setCamera
+// ----------------------------------------------------------------------------
+//
+// Description: Sets the camera orientation shown at the start of the line
+//
+// Inputs:
+// - status: The camera orientation
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void StatusReport::setCamera(const CameraStatus& status)
+{
+    this->camera = status;
+    this->has_camera = true;
+}
+
+// ----------------------------------------------------------------------------
+// StatusReport::setField
+// ----------------------------------------------------------------------------
+//
+// Description: Adds a named field, or replaces the value of an existing one
+//              in place
+//
+// Inputs:
+// - name: Field name, e.g. "Generation"
+// - value: Field value
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void StatusReport::setField(const std::string& name, const std::string& value)
+{
+    for (auto& field : this->fields) {
+        if (field.first == name) {
+            field.second = value;
+            return;
+        }
+    }
+    this->fields.emplace_back(name, value);
+}
+
+// ----------------------------------------------------------------------------
+// StatusReport::removeField
+// ----------------------------------------------------------------------------
+//
+// Description: Removes a named field, if present
+//
+// Inputs:
+// - name: Field name
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+void StatusReport::removeField(const std::string& name)
+{
+    this->fields.erase(
+        std::remove_if(
+            this->fields.begin(),
+            this->fields.end(),
+            [&name](const auto& field) { return field.first == name; }
+            ),
+        this->fields.end()
+        );
+}
+
+// ----------------------------------------------------------------------------
+// StatusReport::text
+// ----------------------------------------------------------------------------
+//
+// Description: Formats the status line, e.g. "Camera azimuth:   30.0° / ...
+//              | Generation: 42"
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: The UTF-8 encoded status line
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+std::string StatusReport::text() const
+{
+    std::string line;
+    if (this->has_camera) {
+        line = "Camera azimuth: " + formatValue(this->camera.azimuth)
+            + kDegree + " / elevation: "
+            + formatValue(this->camera.elevation) + kDegree
+            + " / roll: " + formatValue(this->camera.roll) + kDegree
+            + " / distance: " + formatValue(this->camera.distance);
+    }
+
+    for (const auto& field : this->fields) {
+        if (!line.empty()) {
+            line += " | ";
+        }
+        line += field.first + ": " + field.second;
+    }
+
+    return line;
+}
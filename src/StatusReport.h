@@ -0,0 +1,131 @@
+// ============================================================================
+// StatusReport.h - Builds the status line shown by the viewer
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * StatusReport.h: created.
+//
+// ============================================================================
+
+
+#ifndef StatusReport_H
+#define StatusReport_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// "C" system headers
+
+// Standard Library headers
+#include <string>
+#include <utility>
+#include <vector>
+
+// External libraries headers
+#include <vtkCamera.h>
+
+
+// ============================================================================
+// Structure Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// CameraStatus
+// ----------------------------------------------------------------------------
+//
+// Description: Camera orientation as shown to the user
+//
+// Properties:
+// - azimuth: Azimuth of the direction of projection, in degrees
+// - elevation: Elevation of the direction of projection, in degrees
+// - roll: Camera roll, in degrees
+// - distance: Distance from the camera to the focal point
+//
+// ----------------------------------------------------------------------------
+struct CameraStatus {
+    double azimuth = 0.0;
+    double elevation = 0.0;
+    double roll = 0.0;
+    double distance = 0.0;
+};
+
+
+// ============================================================================
+// Function Declarations Section
+// ============================================================================
+
+// Reads the orientation of the camera
+CameraStatus cameraStatus(vtkCamera* camera);
+
+
+// ============================================================================
+// Class Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// StatusReport
+// ----------------------------------------------------------------------------
+//
+// Description: Collects what the viewer reports to the user, the camera
+//              orientation followed by named fields, and formats it as one
+//              UTF-8 line. The GUI shows the line in the status bar,
+//              headless tools print it.
+//
+// Properties:
+// - camera: Last camera orientation
+// - has_camera: Whether a camera orientation was set
+// - fields: Named fields in insertion order
+//
+// Methods:
+// - setCamera: Sets the camera orientation
+// - setField: Adds or replaces a named field
+// - removeField: Removes a named field
+// - text: Returns the formatted status line
+//
+// Example usage:
+//   StatusReport report;
+//   report.setCamera(cameraStatus(renderer->GetActiveCamera()));
+//   report.setField("Generation", "42");
+//   std::cout << report.text() << "\n";
+//
+// ----------------------------------------------------------------------------
+class StatusReport
+{
+public:
+    // Constructor/Destructor
+    StatusReport();
+
+    void setCamera(const CameraStatus& status);
+    void setField(const std::string& name, const std::string& value);
+    void removeField(const std::string& name);
+    std::string text() const;
+
+private:
+    CameraStatus camera;
+    bool has_camera;
+    std::vector<std::pair<std::string, std::string>> fields;
+};
+
+#endif  // StatusReport_H
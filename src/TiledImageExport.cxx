@@ -0,0 +1,1005 @@
+// ============================================================================
+// TiledImageExport.cxx - Implementation of the tiled image export
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * TiledImageExport.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header -------------------------------------------------------------
+#include "TiledImageExport.h"
+
+// "C" system headers ---------------------------------------------------------
+
+// Standard Library headers ---------------------------------------------------
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <future>
+#include <limits>
+
+// External libraries headers -------------------------------------------------
+
+// VTK headers
+#include <vtkCamera.h>
+#include <vtkImageData.h>
+#include <vtkMath.h>
+#include <vtkPointData.h>
+#include <vtkRenderer.h>
+#include <vtkRendererCollection.h>
+#include <vtkSMPTools.h>
+#include <vtkSmartPointer.h>
+#include <vtkUnsignedCharArray.h>
+#include <vtkWindowToImageFilter.h>
+#include <vtk_zlib.h>
+
+
+// ============================================================================
+// Define namespace aliases
+// ============================================================================
+
+namespace fs = std::filesystem;
+
+
+// ============================================================================
+// Local helpers section
+// ============================================================================
+
+namespace {
+
+const unsigned char kPngSignature[8] = {
+    0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'
+};
+
+// TIFF field types
+const std::uint16_t kTiffShort = 3;
+const std::uint16_t kTiffLong = 4;
+
+void putU16LE(std::vector<unsigned char>& out, std::uint16_t value)
+{
+    out.push_back(static_cast<unsigned char>(value));
+    out.push_back(static_cast<unsigned char>(value >> 8));
+}
+
+void putU32LE(std::vector<unsigned char>& out, std::uint32_t value)
+{
+    for (int shift = 0; shift < 32; shift += 8) {
+        out.push_back(static_cast<unsigned char>(value >> shift));
+    }
+}
+
+void putU32BE(std::vector<unsigned char>& out, std::uint32_t value)
+{
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        out.push_back(static_cast<unsigned char>(value >> shift));
+    }
+}
+
+// One TIFF directory entry. Values that fit in four bytes are stored in
+// place, SHORTs left-justified.
+void putTiffEntry(
+    std::vector<unsigned char>& out,
+    std::uint16_t tag,
+    std::uint16_t type,
+    std::uint32_t count,
+    std::uint32_t value
+    )
+{
+    putU16LE(out, tag);
+    putU16LE(out, type);
+    putU32LE(out, count);
+    if (type == kTiffShort && count == 1) {
+        putU16LE(out, static_cast<std::uint16_t>(value));
+        putU16LE(out, 0);
+    } else {
+        putU32LE(out, value);
+    }
+}
+
+// Deflates data into out. Raw streams (PNG blocks) end with a sync flush
+// unless they are the last part of the image, zlib streams (TIFF strips)
+// are complete.
+bool deflateBlock(
+    const std::vector<unsigned char>& data,
+    int level,
+    bool raw,
+    bool finish,
+    std::vector<unsigned char>& out
+    )
+{
+    z_stream stream;
+    std::memset(&stream, 0, sizeof(stream));
+    if (deflateInit2(
+            &stream,
+            level,
+            Z_DEFLATED,
+            raw ? -MAX_WBITS : MAX_WBITS,
+            8,
+            Z_DEFAULT_STRATEGY
+            ) != Z_OK) {
+        return false;
+    }
+
+    out.resize(deflateBound(&stream, static_cast<uLong>(data.size())) + 64);
+    stream.next_in = const_cast<Bytef*>(data.data());
+    stream.avail_in = static_cast<uInt>(data.size());
+    stream.next_out = out.data();
+    stream.avail_out = static_cast<uInt>(out.size());
+    const int result = deflate(&stream, finish ? Z_FINISH : Z_SYNC_FLUSH);
+    const bool ok = stream.avail_in == 0
+        && (finish ? result == Z_STREAM_END : result == Z_OK);
+    out.resize(stream.total_out);
+    deflateEnd(&stream);
+
+    return ok;
+}
+
+// Narrows the camera to one tile of a width x height image whose full view
+// is the one of base. The tile spans tile_width x tile_height pixels from
+// (left, top), image coordinates grow right and down.
+void setTileCamera(
+    vtkCamera* camera,
+    vtkCamera* base,
+    int width,
+    int height,
+    int left,
+    int top,
+    int tile_width,
+    int tile_height
+    )
+{
+    camera->DeepCopy(base);
+
+    // Offset of the tile center from the view center, in pixels, y up
+    const double* center = base->GetWindowCenter();
+    const double dx = left + 0.5 * tile_width - 0.5 * width
+        + 0.5 * width * center[0];
+    const double dy = 0.5 * height - (top + 0.5 * tile_height)
+        + 0.5 * height * center[1];
+    camera->SetWindowCenter(dx / (0.5 * tile_width), dy / (0.5 * tile_height));
+
+    if (base->GetParallelProjection()) {
+        camera->SetParallelScale(
+            base->GetParallelScale() * tile_height / height
+            );
+    } else {
+        const double fraction = base->GetUseHorizontalViewAngle()
+            ? double(tile_width) / width
+            : double(tile_height) / height;
+        const double half = vtkMath::RadiansFromDegrees(
+            0.5 * base->GetViewAngle()
+            );
+        camera->SetViewAngle(
+            2.0 * vtkMath::DegreesFromRadians(
+                std::atan(std::tan(half) * fraction)
+                )
+            );
+    }
+}
+
+}  // namespace
+
+
+// ============================================================================
+// Function Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// imageFormatFromPath
+// ----------------------------------------------------------------------------
+//
+// Description: Chooses the image format by file extension
+//
+// Inputs:
+// - path: The image file
+//
+// Outputs:
+// - format: The format
+// - error: Description of the failure, if not null
+//
+// Returns: true if the extension is known
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool imageFormatFromPath(
+    const std::string& path,
+    ImageFormat* format,
+    std::string* error
+    )
+{
+    std::string extension = fs::path(path).extension().string();
+    std::transform(
+        extension.begin(),
+        extension.end(),
+        extension.begin(),
+        [](unsigned char c) { return static_cast<char>(std::tolower(c)); }
+        );
+
+    if (extension == ".png") {
+        *format = ImageFormat::Png;
+    } else if (extension == ".tif" || extension == ".tiff") {
+        *format = ImageFormat::Tiff;
+    } else {
+        if (error != nullptr) {
+            *error = "No image writer for '" + path + "' (use .png or .tif)";
+        }
+        return false;
+    }
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// exportTiledImage
+// ----------------------------------------------------------------------------
+//
+// Description: Renders the window tile by tile and streams the image to a
+//              file (see the declaration)
+//
+// Inputs:
+// - window: The render window
+// - path: Output file
+// - options: Image size and compression
+//
+// Outputs:
+// - stats: What was done, if not null
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: Renders the window once per tile, and once more with the
+//               restored cameras
+//
+// ----------------------------------------------------------------------------
+bool exportTiledImage(
+    vtkRenderWindow* window,
+    const std::string& path,
+    const TiledExportOptions& options,
+    TiledExportStats* stats,
+    std::string* error
+    )
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    if (window == nullptr || options.width <= 0 || options.height <= 0) {
+        if (error != nullptr) {
+            *error = "Invalid export image size";
+        }
+        return false;
+    }
+    ImageFormat format;
+    if (!imageFormatFromPath(path, &format, error)) {
+        return false;
+    }
+    const int tile_width = window->GetSize()[0];
+    const int tile_height = window->GetSize()[1];
+    if (tile_width <= 0 || tile_height <= 0) {
+        if (error != nullptr) {
+            *error = "The render window has no size";
+        }
+        return false;
+    }
+
+    StreamingImageWriter writer;
+    if (!writer.open(
+            path,
+            format,
+            options.width,
+            options.height,
+            options.compression_level,
+            error
+            )) {
+        return false;
+    }
+
+    // Every camera once, with the state to restore
+    std::vector<vtkCamera*> cameras;
+    std::vector<vtkSmartPointer<vtkCamera>> saved;
+    vtkRendererCollection* renderers = window->GetRenderers();
+    vtkCollectionSimpleIterator iterator;
+    renderers->InitTraversal(iterator);
+    while (vtkRenderer* renderer = renderers->GetNextRenderer(iterator)) {
+        vtkCamera* camera = renderer->GetActiveCamera();
+        if (std::find(cameras.begin(), cameras.end(), camera)
+            != cameras.end()) {
+            continue;
+        }
+        cameras.push_back(camera);
+        saved.push_back(vtkSmartPointer<vtkCamera>::New());
+        saved.back()->DeepCopy(camera);
+    }
+
+    // The magnification is done by the tile cameras, so the grabber reads
+    // single window-sized frames
+    auto grabber = vtkSmartPointer<vtkWindowToImageFilter>::New();
+    grabber->SetInput(window);
+    grabber->SetInputBufferTypeToRGB();
+    grabber->ReadFrontBufferOff();
+    grabber->ShouldRerenderOff();
+
+    const int columns = (options.width + tile_width - 1) / tile_width;
+    const int rows = (options.height + tile_height - 1) / tile_height;
+    const std::size_t row_bytes = std::size_t(options.width) * 3;
+
+    // Two bands: one is encoded and written while the other renders
+    std::vector<unsigned char> bands[2];
+    bands[0].resize(row_bytes * tile_height);
+    bands[1].resize(row_bytes * tile_height);
+    std::future<bool> writing;
+    std::string write_error;
+    TiledExportStats result;
+    bool ok = true;
+
+    for (int band = 0; band < rows && ok; ++band) {
+        std::vector<unsigned char>& buffer = bands[band % 2];
+        const int top = band * tile_height;
+        const int band_rows = std::min(tile_height, options.height - top);
+
+        for (int column = 0; column < columns; ++column) {
+            const int left = column * tile_width;
+            const int tile_columns =
+                std::min(tile_width, options.width - left);
+            for (std::size_t i = 0; i < cameras.size(); ++i) {
+                setTileCamera(
+                    cameras[i],
+                    saved[i],
+                    options.width,
+                    options.height,
+                    left,
+                    top,
+                    tile_width,
+                    tile_height
+                    );
+            }
+            window->Render();
+            grabber->Modified();
+            grabber->Update();
+
+            vtkImageData* image = grabber->GetOutput();
+            auto pixels = vtkUnsignedCharArray::SafeDownCast(
+                image->GetPointData()->GetScalars()
+                );
+            int dimensions[3];
+            image->GetDimensions(dimensions);
+            if (pixels == nullptr
+                || dimensions[0] < tile_width
+                || dimensions[1] < tile_height) {
+                write_error = "Failed to read the rendered tile back";
+                ok = false;
+                break;
+            }
+
+            // Captured rows run bottom to top
+            const unsigned char* source = pixels->GetPointer(0);
+            for (int r = 0; r < band_rows; ++r) {
+                std::memcpy(
+                    buffer.data() + r * row_bytes + std::size_t(left) * 3,
+                    source + std::size_t(tile_height - 1 - r)
+                        * dimensions[0] * 3,
+                    std::size_t(tile_columns) * 3
+                    );
+            }
+            ++result.tiles;
+        }
+        if (!ok) {
+            break;
+        }
+
+        if (writing.valid() && !writing.get()) {
+            ok = false;
+            break;
+        }
+        writing = std::async(
+            std::launch::async,
+            [&writer, &buffer, band_rows, &write_error]() {
+                return writer.writeRows(
+                    buffer.data(),
+                    band_rows,
+                    &write_error
+                    );
+            }
+            );
+        ++result.bands;
+    }
+    if (writing.valid() && !writing.get()) {
+        ok = false;
+    }
+
+    for (std::size_t i = 0; i < cameras.size(); ++i) {
+        cameras[i]->DeepCopy(saved[i]);
+    }
+    window->Render();
+
+    if (!ok) {
+        if (error != nullptr) {
+            *error = write_error;
+        }
+        return false;
+    }
+    if (!writer.close(error)) {
+        return false;
+    }
+
+    result.bytes_written = writer.bytesWritten();
+    result.seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start
+        ).count();
+    if (stats != nullptr) {
+        *stats = result;
+    }
+
+    return true;
+}
+
+
+// ============================================================================
+// StreamingImageWriter Public Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// StreamingImageWriter::open
+// ----------------------------------------------------------------------------
+//
+// Description: Creates the file and writes the header
+//
+// Inputs:
+// - path: Output file
+// - format: PNG or TIFF
+// - width, height: Image size in pixels
+// - level: Deflate level, 1 to 9
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: Creates or truncates the file
+//
+// ----------------------------------------------------------------------------
+bool StreamingImageWriter::open(
+    const std::string& path,
+    ImageFormat format,
+    int width,
+    int height,
+    int level,
+    std::string* error
+    )
+{
+    if (width <= 0 || height <= 0) {
+        if (error != nullptr) {
+            *error = "Invalid image size";
+        }
+        return false;
+    }
+
+    // Strip offsets are 32-bit in classic TIFF. Deflate can grow data a
+    // little, so leave headroom.
+    const std::uint64_t raw_size = std::uint64_t(width) * height * 3;
+    if (format == ImageFormat::Tiff && raw_size > 0xF0000000ull) {
+        if (error != nullptr) {
+            *error = "Image too large for TIFF, export to PNG instead";
+        }
+        return false;
+    }
+
+    this->file.open(path, std::ios::binary | std::ios::trunc);
+    if (!this->file) {
+        if (error != nullptr) {
+            *error = "Cannot create '" + path + "'";
+        }
+        return false;
+    }
+
+    this->format = format;
+    this->width = width;
+    this->height = height;
+    this->level = std::min(9, std::max(1, level));
+    this->rows_written = 0;
+    this->bytes_written = 0;
+    this->pending.clear();
+    this->previous_row.assign(std::size_t(width) * 3, 0);
+    this->adler = adler32(0L, Z_NULL, 0);
+    this->strip_offsets.clear();
+    this->strip_sizes.clear();
+
+    std::vector<unsigned char> header;
+    if (format == ImageFormat::Png) {
+        this->file.write(
+            reinterpret_cast<const char*>(kPngSignature),
+            sizeof(kPngSignature)
+            );
+        this->bytes_written += sizeof(kPngSignature);
+
+        putU32BE(header, static_cast<std::uint32_t>(width));
+        putU32BE(header, static_cast<std::uint32_t>(height));
+        header.push_back(8);  // Bit depth
+        header.push_back(2);  // RGB
+        header.push_back(0);  // Deflate
+        header.push_back(0);  // Adaptive filtering
+        header.push_back(0);  // No interlace
+        this->writeChunk("IHDR", header);
+
+        // The zlib header opens the stream the blocks are part of
+        this->writeChunk("IDAT", {0x78, 0x9C});
+    } else {
+        // Little endian, the directory offset is patched by close
+        header = {'I', 'I', 42, 0};
+        putU32LE(header, 0);
+        this->file.write(
+            reinterpret_cast<const char*>(header.data()),
+            static_cast<std::streamsize>(header.size())
+            );
+        this->bytes_written += header.size();
+    }
+
+    if (!this->file) {
+        if (error != nullptr) {
+            *error = "Failed to write '" + path + "'";
+        }
+        return false;
+    }
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// StreamingImageWriter::writeRows
+// ----------------------------------------------------------------------------
+//
+// Description: Appends rows to the image. Complete blocks are encoded and
+//              written right away, the rest waits for the next call.
+//
+// Inputs:
+// - rgb: Tightly packed RGB rows, top to bottom
+// - rows: Number of rows
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: Writes to the file
+//
+// ----------------------------------------------------------------------------
+bool StreamingImageWriter::writeRows(
+    const unsigned char* rgb,
+    int rows,
+    std::string* error
+    )
+{
+    const std::size_t row_bytes = std::size_t(this->width) * 3;
+    const int pending_rows =
+        static_cast<int>(this->pending.size() / row_bytes);
+    if (!this->file.is_open()
+        || rows < 0
+        || this->rows_written + pending_rows + rows > this->height) {
+        if (error != nullptr) {
+            *error = "Rows written past the end of the image";
+        }
+        return false;
+    }
+
+    // Top up a partial block first
+    int used = 0;
+    if (pending_rows > 0) {
+        used = std::min(kBlockRows - pending_rows, rows);
+        this->pending.insert(
+            this->pending.end(),
+            rgb,
+            rgb + used * row_bytes
+            );
+        if (pending_rows + used == kBlockRows) {
+            if (!this->encodeBlocks(
+                    this->pending.data(), kBlockRows, false, error
+                    )) {
+                return false;
+            }
+            this->pending.clear();
+        }
+    }
+
+    const int whole = (rows - used) / kBlockRows * kBlockRows;
+    if (whole > 0
+        && !this->encodeBlocks(rgb + used * row_bytes, whole, false, error)) {
+        return false;
+    }
+    used += whole;
+
+    this->pending.insert(
+        this->pending.end(),
+        rgb + used * row_bytes,
+        rgb + rows * row_bytes
+        );
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// StreamingImageWriter::close
+// ----------------------------------------------------------------------------
+//
+// Description: Encodes the remaining rows and finishes the file
+//
+// Inputs: None
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: true if the complete image was written
+//
+// Side Effects: Closes the file
+//
+// ----------------------------------------------------------------------------
+bool StreamingImageWriter::close(std::string* error)
+{
+    if (!this->file.is_open()) {
+        return true;
+    }
+
+    const std::size_t row_bytes = std::size_t(this->width) * 3;
+    const int rows = static_cast<int>(this->pending.size() / row_bytes);
+    bool ok = this->encodeBlocks(this->pending.data(), rows, true, error);
+    this->pending.clear();
+
+    if (ok && this->rows_written != this->height) {
+        if (error != nullptr) {
+            *error = "Image incomplete: "
+                + std::to_string(this->rows_written) + " of "
+                + std::to_string(this->height) + " rows written";
+        }
+        ok = false;
+    }
+    if (ok && this->format == ImageFormat::Png) {
+        ok = this->writeChunk("IEND", {});
+    }
+    if (ok && this->format == ImageFormat::Tiff) {
+        ok = this->writeTiffDirectory(error);
+    }
+
+    this->file.close();
+    if (ok && !this->file) {
+        if (error != nullptr) {
+            *error = "Failed to finish the image file";
+        }
+        ok = false;
+    }
+
+    return ok;
+}
+
+
+// ============================================================================
+// StreamingImageWriter Private Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// StreamingImageWriter::encodeBlocks
+// ----------------------------------------------------------------------------
+//
+// Description: Filters and deflates rows in blocks of kBlockRows on all
+//              cores, then writes the blocks in order. PNG rows use the Up
+//              filter, TIFF rows horizontal differencing (predictor 2).
+//
+// Inputs:
+// - rgb: Tightly packed RGB rows, top to bottom
+// - rows: Number of rows, a multiple of kBlockRows unless last
+// - last: These are the last rows of the image
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: Writes to the file
+//
+// ----------------------------------------------------------------------------
+bool StreamingImageWriter::encodeBlocks(
+    const unsigned char* rgb,
+    int rows,
+    bool last,
+    std::string* error
+    )
+{
+    const std::size_t row_bytes = std::size_t(this->width) * 3;
+    const bool png = this->format == ImageFormat::Png;
+    const int block_count = (rows + kBlockRows - 1) / kBlockRows;
+
+    std::vector<std::vector<unsigned char>> encoded(block_count);
+    std::vector<uLong> checksums(block_count, 0);
+    std::vector<std::size_t> filtered_sizes(block_count, 0);
+    std::atomic<bool> failed(false);
+
+    vtkSMPTools::For(0, block_count, 1, [&](vtkIdType begin, vtkIdType end) {
+        std::vector<unsigned char> filtered;
+        for (vtkIdType b = begin; b < end; ++b) {
+            const int first = static_cast<int>(b) * kBlockRows;
+            const int count = std::min(kBlockRows, rows - first);
+            const unsigned char* block = rgb + first * row_bytes;
+
+            if (png) {
+                // Filter type byte, then each byte minus the one above
+                filtered.resize(count * (row_bytes + 1));
+                for (int r = 0; r < count; ++r) {
+                    const unsigned char* row = block + r * row_bytes;
+                    const unsigned char* above = first + r == 0
+                        ? this->previous_row.data()
+                        : row - row_bytes;
+                    unsigned char* out = filtered.data() + r * (row_bytes + 1);
+                    out[0] = 2;
+                    for (std::size_t i = 0; i < row_bytes; ++i) {
+                        out[i + 1] =
+                            static_cast<unsigned char>(row[i] - above[i]);
+                    }
+                }
+                checksums[b] = adler32(
+                    adler32(0L, Z_NULL, 0),
+                    filtered.data(),
+                    static_cast<uInt>(filtered.size())
+                    );
+            } else {
+                // Each sample minus the same sample of the pixel to the left
+                filtered.resize(count * row_bytes);
+                for (int r = 0; r < count; ++r) {
+                    const unsigned char* row = block + r * row_bytes;
+                    unsigned char* out = filtered.data() + r * row_bytes;
+                    std::copy(row, row + 3, out);
+                    for (std::size_t i = 3; i < row_bytes; ++i) {
+                        out[i] =
+                            static_cast<unsigned char>(row[i] - row[i - 3]);
+                    }
+                }
+            }
+            filtered_sizes[b] = filtered.size();
+
+            const bool finish = !png || (last && b == block_count - 1);
+            if (!deflateBlock(
+                    filtered, this->level, png, finish, encoded[b]
+                    )) {
+                failed = true;
+            }
+        }
+    });
+
+    if (failed) {
+        if (error != nullptr) {
+            *error = "Image compression failed";
+        }
+        return false;
+    }
+
+    for (int b = 0; b < block_count; ++b) {
+        if (png) {
+            this->adler = adler32_combine(
+                this->adler,
+                checksums[b],
+                static_cast<z_off_t>(filtered_sizes[b])
+                );
+            this->writeChunk("IDAT", encoded[b]);
+        } else {
+            if (this->bytes_written + encoded[b].size()
+                > std::numeric_limits<std::uint32_t>::max()) {
+                if (error != nullptr) {
+                    *error = "TIFF file would exceed 4 GiB";
+                }
+                return false;
+            }
+            this->strip_offsets.push_back(
+                static_cast<std::uint32_t>(this->bytes_written)
+                );
+            this->strip_sizes.push_back(
+                static_cast<std::uint32_t>(encoded[b].size())
+                );
+            this->file.write(
+                reinterpret_cast<const char*>(encoded[b].data()),
+                static_cast<std::streamsize>(encoded[b].size())
+                );
+            this->bytes_written += encoded[b].size();
+        }
+    }
+
+    if (png && last) {
+        // An empty final deflate block if the image ended on a block
+        // boundary, then the checksum of the whole stream
+        std::vector<unsigned char> tail;
+        if (block_count == 0) {
+            tail = {0x03, 0x00};
+        }
+        putU32BE(tail, static_cast<std::uint32_t>(this->adler));
+        this->writeChunk("IDAT", tail);
+    }
+
+    if (rows > 0) {
+        const unsigned char* last_row = rgb + (rows - 1) * row_bytes;
+        std::copy(last_row, last_row + row_bytes, this->previous_row.begin());
+    }
+    this->rows_written += rows;
+
+    if (!this->file) {
+        if (error != nullptr) {
+            *error = "Failed to write the image file";
+        }
+        return false;
+    }
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// StreamingImageWriter::writeChunk
+// ----------------------------------------------------------------------------
+//
+// Description: Writes a PNG chunk: length, type, data and CRC
+//
+// Inputs:
+// - type: Four letter chunk type
+// - data: Chunk data
+//
+// Outputs: None
+//
+// Returns: true if the file is still good
+//
+// Side Effects: Writes to the file
+//
+// ----------------------------------------------------------------------------
+bool StreamingImageWriter::writeChunk(
+    const char* type,
+    const std::vector<unsigned char>& data
+    )
+{
+    std::vector<unsigned char> framing;
+    putU32BE(framing, static_cast<std::uint32_t>(data.size()));
+    framing.insert(framing.end(), type, type + 4);
+    this->file.write(
+        reinterpret_cast<const char*>(framing.data()),
+        static_cast<std::streamsize>(framing.size())
+        );
+    this->file.write(
+        reinterpret_cast<const char*>(data.data()),
+        static_cast<std::streamsize>(data.size())
+        );
+
+    uLong crc = crc32(0L, Z_NULL, 0);
+    crc = crc32(crc, reinterpret_cast<const Bytef*>(type), 4);
+    if (!data.empty()) {
+        // A null buffer would reset the CRC
+        crc = crc32(crc, data.data(), static_cast<uInt>(data.size()));
+    }
+    framing.clear();
+    putU32BE(framing, static_cast<std::uint32_t>(crc));
+    this->file.write(reinterpret_cast<const char*>(framing.data()), 4);
+
+    this->bytes_written += 12 + data.size();
+
+    return static_cast<bool>(this->file);
+}
+
+// ----------------------------------------------------------------------------
+// StreamingImageWriter::writeTiffDirectory
+// ----------------------------------------------------------------------------
+//
+// Description: Writes the image file directory after the strips and points
+//              the header at it
+//
+// Inputs: None
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: Writes to the file
+//
+// ----------------------------------------------------------------------------
+bool StreamingImageWriter::writeTiffDirectory(std::string* error)
+{
+    const std::uint16_t kEntries = 11;
+    const std::uint32_t strips =
+        static_cast<std::uint32_t>(this->strip_offsets.size());
+
+    // The directory starts on a word boundary, values that do not fit in
+    // the entries follow it
+    std::vector<unsigned char> directory;
+    if (this->bytes_written % 2 != 0) {
+        directory.push_back(0);
+    }
+    const std::uint64_t start = this->bytes_written + directory.size();
+    const std::uint64_t bits_at = start + 2 + kEntries * 12 + 4;
+    const std::uint64_t offsets_at = bits_at + 8;
+    const std::uint64_t sizes_at = offsets_at + 4 * std::uint64_t(strips);
+    if (sizes_at + 4 * std::uint64_t(strips)
+        > std::numeric_limits<std::uint32_t>::max()) {
+        if (error != nullptr) {
+            *error = "TIFF file would exceed 4 GiB";
+        }
+        return false;
+    }
+
+    putU16LE(directory, kEntries);
+    putTiffEntry(directory, 256, kTiffLong, 1, this->width);
+    putTiffEntry(directory, 257, kTiffLong, 1, this->height);
+    putTiffEntry(
+        directory, 258, kTiffShort, 3, static_cast<std::uint32_t>(bits_at)
+        );
+    putTiffEntry(directory, 259, kTiffShort, 1, 8);  // Deflate
+    putTiffEntry(directory, 262, kTiffShort, 1, 2);  // RGB
+    putTiffEntry(
+        directory, 273, kTiffLong, strips,
+        strips == 1
+            ? this->strip_offsets.front()
+            : static_cast<std::uint32_t>(offsets_at)
+        );
+    putTiffEntry(directory, 277, kTiffShort, 1, 3);  // Samples per pixel
+    putTiffEntry(directory, 278, kTiffLong, 1, kBlockRows);
+    putTiffEntry(
+        directory, 279, kTiffLong, strips,
+        strips == 1
+            ? this->strip_sizes.front()
+            : static_cast<std::uint32_t>(sizes_at)
+        );
+    putTiffEntry(directory, 284, kTiffShort, 1, 1);  // Interleaved
+    putTiffEntry(directory, 317, kTiffShort, 1, 2);  // Horizontal predictor
+    putU32LE(directory, 0);  // No further directories
+
+    for (int i = 0; i < 3; ++i) {
+        putU16LE(directory, 8);
+    }
+    putU16LE(directory, 0);
+    for (std::uint32_t offset : this->strip_offsets) {
+        putU32LE(directory, offset);
+    }
+    for (std::uint32_t size : this->strip_sizes) {
+        putU32LE(directory, size);
+    }
+
+    this->file.write(
+        reinterpret_cast<const char*>(directory.data()),
+        static_cast<std::streamsize>(directory.size())
+        );
+    this->bytes_written += directory.size();
+
+    std::vector<unsigned char> offset;
+    putU32LE(offset, static_cast<std::uint32_t>(start));
+    this->file.seekp(4);
+    this->file.write(reinterpret_cast<const char*>(offset.data()), 4);
+
+    if (!this->file) {
+        if (error != nullptr) {
+            *error = "Failed to write the TIFF directory";
+        }
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,247 @@
+// ============================================================================
+// TiledImageExport.h - High resolution image export through tiled rendering
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * TiledImageExport.h: created.
+//
+// ============================================================================
+
+
+#ifndef TiledImageExport_H
+#define TiledImageExport_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Standard Library headers
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// External libraries headers
+#include <vtkRenderWindow.h>
+
+
+// ============================================================================
+// Enumerations Section
+// ============================================================================
+
+// File formats written by StreamingImageWriter
+enum class ImageFormat {
+    Png,
+    Tiff
+};
+
+
+// ============================================================================
+// Structure Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// TiledExportOptions
+// ----------------------------------------------------------------------------
+//
+// Description: What exportTiledImage renders
+//
+// Properties:
+// - width, height: Size of the exported image in pixels
+// - compression_level: Deflate level, 1 (fast) to 9 (small)
+//
+// ----------------------------------------------------------------------------
+struct TiledExportOptions {
+    int width = 0;
+    int height = 0;
+    int compression_level = 6;
+};
+
+// ----------------------------------------------------------------------------
+// TiledExportStats
+// ----------------------------------------------------------------------------
+//
+// Description: What exportTiledImage did
+//
+// Properties:
+// - tiles: Tiles rendered
+// - bands: Rows of tiles, each encoded and written while the next renders
+// - bytes_written: Size of the file
+// - seconds: Wall clock time of the export
+//
+// ----------------------------------------------------------------------------
+struct TiledExportStats {
+    int tiles = 0;
+    int bands = 0;
+    std::uint64_t bytes_written = 0;
+    double seconds = 0.0;
+};
+
+
+// ============================================================================
+// Function Declarations Section
+// ============================================================================
+
+// Returns the format matching the file extension (.png, .tif, .tiff). Sets
+// error and returns false for anything else.
+bool imageFormatFromPath(
+    const std::string& path,
+    ImageFormat* format,
+    std::string* error = nullptr
+    );
+
+// ----------------------------------------------------------------------------
+// exportTiledImage
+// ----------------------------------------------------------------------------
+//
+// Description: Renders the window contents at an arbitrary resolution and
+//              streams it to a PNG or TIFF file. The image is cut into tiles
+//              of the window size; for every tile the cameras are narrowed
+//              to the tile's part of the view (window center and view angle
+//              or parallel scale) and the window is rendered and read back.
+//              Only one row of tiles is held in memory: while it is encoded
+//              on all cores and written, the next row renders. The cameras
+//              are restored afterwards.
+//              Renderers are assumed to cover the whole window, as they do
+//              in the viewer and in OffscreenScene.
+//
+// Inputs:
+// - window: The render window, onscreen or offscreen
+// - path: Output file, the extension selects the format
+// - options: Image size and compression
+//
+// Outputs:
+// - stats: What was done, if not null
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: Renders the window once per tile
+//
+// ----------------------------------------------------------------------------
+bool exportTiledImage(
+    vtkRenderWindow* window,
+    const std::string& path,
+    const TiledExportOptions& options,
+    TiledExportStats* stats = nullptr,
+    std::string* error = nullptr
+    );
+
+
+// ============================================================================
+// Class Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// StreamingImageWriter
+// ----------------------------------------------------------------------------
+//
+// Description: Writes an 8-bit RGB image to PNG or TIFF row by row, without
+//              holding the image in memory. Rows are gathered into blocks
+//              of kBlockRows that are filtered and deflated independently
+//              on all cores, then written in order: for PNG the blocks are
+//              parts of one deflate stream (flushed to byte boundaries, the
+//              Adler-32 checksums combined), for TIFF every block is a strip
+//              with horizontal prediction. Classic TIFF limits the file to
+//              4 GiB; PNG has no such limit.
+//
+// Properties:
+// - file: The output file
+// - format, width, height: Image layout
+// - level: Deflate level
+// - rows_written: Rows handed to the encoder so far
+// - pending: Rows waiting for a full block
+// - previous_row: Last encoded row, the PNG Up filter reference
+// - adler: Running Adler-32 of the PNG image data
+// - strip_offsets, strip_sizes: Where the TIFF strips are
+//
+// Methods:
+// - open: Creates the file and writes the header
+// - writeRows: Appends rows, top to bottom
+// - close: Flushes the last rows and finishes the file
+// - bytesWritten: Size of the file so far
+//
+// Example usage:
+//   StreamingImageWriter writer;
+//   writer.open("poster.png", ImageFormat::Png, 16384, 16384, 6, &error);
+//   while (...) {
+//       writer.writeRows(band.data(), band_rows, &error);
+//   }
+//   writer.close(&error);
+//
+// ----------------------------------------------------------------------------
+class StreamingImageWriter
+{
+public:
+    static constexpr int kBlockRows = 64;
+
+    // Constructor/Destructor
+    StreamingImageWriter() = default;
+    ~StreamingImageWriter() = default;
+
+    StreamingImageWriter(const StreamingImageWriter&) = delete;
+    StreamingImageWriter& operator=(const StreamingImageWriter&) = delete;
+
+    bool open(
+        const std::string& path,
+        ImageFormat format,
+        int width,
+        int height,
+        int level = 6,
+        std::string* error = nullptr
+        );
+    bool writeRows(
+        const unsigned char* rgb,
+        int rows,
+        std::string* error = nullptr
+        );  // Tightly packed RGB rows, top to bottom
+    bool close(std::string* error = nullptr);
+
+    std::uint64_t bytesWritten() const { return this->bytes_written; }
+
+private:
+    bool encodeBlocks(
+        const unsigned char* rgb,
+        int rows,
+        bool last,
+        std::string* error
+        );
+    bool writeChunk(const char* type, const std::vector<unsigned char>& data);
+    bool writeTiffDirectory(std::string* error);
+
+    std::ofstream file;
+    ImageFormat format = ImageFormat::Png;
+    int width = 0;
+    int height = 0;
+    int level = 6;
+    int rows_written = 0;
+    std::uint64_t bytes_written = 0;
+    std::vector<unsigned char> pending;
+    std::vector<unsigned char> previous_row;
+    std::uint32_t adler = 1;
+    std::vector<std::uint32_t> strip_offsets;
+    std::vector<std::uint32_t> strip_sizes;
+};
+
+#endif  // TiledImageExport_H
@@ -0,0 +1,971 @@
+// ============================================================================
+// VideoExport.cxx - Implementation of the animation export
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * VideoExport.cxx: created.
+// * VideoExport.cxx: the render and encoder threads sleep on a condition
+//   variable instead of spinning while the ring is full or empty.
+// * VideoExport.cxx: PNG frame names are no longer printf format strings,
+//   only one %d or %0Nd is substituted.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header -------------------------------------------------------------
+#include "VideoExport.h"
+#include "MeshPreprocessor.h"
+#include "SpscRing.h"
+#include "TiledImageExport.h"
+
+// "C" system headers ---------------------------------------------------------
+
+// Standard Library headers ---------------------------------------------------
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <filesystem>
+#include <future>
+#include <mutex>
+#include <thread>
+
+// External libraries headers -------------------------------------------------
+
+// VTK headers
+#include <vtkCamera.h>
+#include <vtkPointData.h>
+#include <vtkRendererCollection.h>
+#include <vtkSMPTools.h>
+#if defined(QTVTK_HAVE_FFMPEG)
+#include <vtkFFMPEGWriter.h>
+#endif
+
+
+// ============================================================================
+// Define namespace aliases
+// ============================================================================
+
+namespace fs = std::filesystem;
+
+
+// ============================================================================
+// Local helpers section
+// ============================================================================
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double secondsSince(Clock::time_point start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// BT.601 studio range conversion of one pixel
+inline unsigned char lumaOf(const unsigned char* rgb)
+{
+    return static_cast<unsigned char>(
+        ((66 * rgb[0] + 129 * rgb[1] + 25 * rgb[2] + 128) >> 8) + 16
+        );
+}
+
+inline void chromaOf(
+    const int sum[3],
+    int count,
+    unsigned char* u,
+    unsigned char* v
+    )
+{
+    const int r = sum[0] / count;
+    const int g = sum[1] / count;
+    const int b = sum[2] / count;
+    *u = static_cast<unsigned char>(
+        ((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128
+        );
+    *v = static_cast<unsigned char>(
+        ((112 * r - 94 * g - 18 * b + 128) >> 8) + 128
+        );
+}
+
+// Puts one side of a ring to sleep until the other side made progress. The
+// ring itself stays lock-free; the mutex only orders a wait against the
+// notification of the change it waits for, so no wakeup is lost.
+class RingSignal
+{
+public:
+    template <typename Ready>
+    void wait(Ready ready)
+    {
+        std::unique_lock<std::mutex> lock(this->mutex);
+        this->condition.wait(lock, ready);
+    }
+
+    void notify()
+    {
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+        }
+        this->condition.notify_all();
+    }
+
+private:
+    std::mutex mutex;
+    std::condition_variable condition;
+};
+
+// Splits a PNG frame name pattern around its frame number field, "%d" or
+// "%0Nd". A pattern without a field gets "_%05d" after the file stem. Any
+// other use of '%' is rejected, the pattern is never handed to printf.
+bool splitFramePattern(
+    const std::string& path,
+    std::string* prefix,
+    int* digits,
+    std::string* suffix
+    )
+{
+    const std::size_t field = path.find('%');
+    if (field == std::string::npos) {
+        const fs::path file(path);
+        *prefix = (file.parent_path() / file.stem()).string() + "_";
+        *digits = 5;
+        *suffix = file.extension().string();
+        return true;
+    }
+
+    std::size_t end = field + 1;
+    int width = 0;
+    if (end < path.size() && path[end] == '0') {
+        ++end;
+        const std::size_t first = end;
+        while (end < path.size() && std::isdigit(
+                   static_cast<unsigned char>(path[end])
+                   )) {
+            width = 10 * width + (path[end++] - '0');
+            if (width > 20) {
+                return false;
+            }
+        }
+        if (end == first) {
+            return false;
+        }
+    }
+    if (end == path.size() || path[end] != 'd'
+        || path.find('%', end) != std::string::npos) {
+        return false;
+    }
+
+    *prefix = path.substr(0, field);
+    *digits = width;
+    *suffix = path.substr(end + 1);
+    return true;
+}
+
+}  // namespace
+
+
+// ============================================================================
+// Function Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// videoFormatFromPath
+// ----------------------------------------------------------------------------
+//
+// Description: Chooses the video format by file extension
+//
+// Inputs:
+// - path: The video file
+//
+// Outputs:
+// - format: The format
+// - error: Description of the failure, if not null
+//
+// Returns: true if the format can be written by this build
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool videoFormatFromPath(
+    const std::string& path,
+    VideoFormat* format,
+    std::string* error
+    )
+{
+    std::string extension = fs::path(path).extension().string();
+    std::transform(
+        extension.begin(),
+        extension.end(),
+        extension.begin(),
+        [](unsigned char c) { return static_cast<char>(std::tolower(c)); }
+        );
+
+    if (extension == ".y4m") {
+        *format = VideoFormat::Y4m;
+    } else if (extension == ".png") {
+        *format = VideoFormat::PngSequence;
+    } else if (extension == ".mp4"
+               || extension == ".avi"
+               || extension == ".mkv"
+               || extension == ".mov") {
+        if (!VideoWriter::ffmpegAvailable()) {
+            if (error != nullptr) {
+                *error = "VTK was built without FFmpeg, export to .y4m or "
+                    ".png instead";
+            }
+            return false;
+        }
+        *format = VideoFormat::Ffmpeg;
+    } else {
+        if (error != nullptr) {
+            *error = "No video writer for '" + path
+                + "' (use .y4m, .png or an FFmpeg container)";
+        }
+        return false;
+    }
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// orbitAnimation
+// ----------------------------------------------------------------------------
+//
+// Description: Returns an animation that orbits the active camera. Frames
+//              are placed absolutely from the starting camera, so rounding
+//              does not accumulate.
+//
+// Inputs:
+// - renderer: The renderer whose camera orbits
+// - frame_count: Frames of the full orbit
+// - degrees: Angle of the full orbit
+//
+// Outputs: None
+//
+// Returns: The animation
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+VideoAnimation orbitAnimation(
+    vtkRenderer* renderer,
+    int frame_count,
+    double degrees
+    )
+{
+    auto base = vtkSmartPointer<vtkCamera>::New();
+    base->DeepCopy(renderer->GetActiveCamera());
+    const double step = degrees / std::max(1, frame_count);
+    vtkSmartPointer<vtkRenderer> target(renderer);
+
+    return [target, base, step](int frame) {
+        vtkCamera* camera = target->GetActiveCamera();
+        camera->DeepCopy(base);
+        camera->Azimuth(step * frame);
+        target->ResetCameraClippingRange();
+        return true;
+    };
+}
+
+// ----------------------------------------------------------------------------
+// meshSeriesAnimation
+// ----------------------------------------------------------------------------
+//
+// Description: Returns an animation that plays back a sequence of mesh
+//              files. The mesh of the next frame is read on a worker thread
+//              while the current one renders.
+//
+// Inputs:
+// - mapper: Mapper the meshes are shown with
+// - paths: Mesh files, one per frame
+//
+// Outputs: None
+//
+// Returns: The animation. It stops at the end of the sequence or at the
+//          first file that cannot be read.
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+VideoAnimation meshSeriesAnimation(
+    vtkPolyDataMapper* mapper,
+    const std::vector<std::string>& paths
+    )
+{
+    struct Playback {
+        vtkSmartPointer<vtkPolyDataMapper> mapper;
+        std::vector<std::string> paths;
+        std::future<vtkSmartPointer<vtkPolyData>> next;
+    };
+    auto playback = std::make_shared<Playback>();
+    playback->mapper = mapper;
+    playback->paths = paths;
+
+    auto read = [](const std::string& path) { return readMesh(path); };
+
+    return [playback, read](int frame) {
+        if (frame < 0
+            || frame >= static_cast<int>(playback->paths.size())) {
+            return false;
+        }
+
+        vtkSmartPointer<vtkPolyData> mesh = playback->next.valid()
+            ? playback->next.get()
+            : read(playback->paths[frame]);
+        if (frame + 1 < static_cast<int>(playback->paths.size())) {
+            playback->next = std::async(
+                std::launch::async, read, playback->paths[frame + 1]
+                );
+        }
+        if (!mesh) {
+            return false;
+        }
+
+        playback->mapper->SetInputData(mesh);
+        return true;
+    };
+}
+
+// ----------------------------------------------------------------------------
+// exportVideo
+// ----------------------------------------------------------------------------
+//
+// Description: Renders an animation and writes it as a video, rendering
+//              and encoding on separate threads (see the declaration)
+//
+// Inputs:
+// - window: The render window
+// - path: Output file
+// - frame_count: Number of frames
+// - animate: Sets the scene up for each frame
+// - options: Frame rate, queue depth and bit rate
+//
+// Outputs:
+// - stats: What was done, if not null
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: Renders the window once per frame, and once more with the
+//               restored cameras
+//
+// ----------------------------------------------------------------------------
+bool exportVideo(
+    vtkRenderWindow* window,
+    const std::string& path,
+    int frame_count,
+    const VideoAnimation& animate,
+    const VideoExportOptions& options,
+    VideoExportStats* stats,
+    std::string* error
+    )
+{
+    const auto start = Clock::now();
+
+    if (window == nullptr || frame_count <= 0 || !animate) {
+        if (error != nullptr) {
+            *error = "Nothing to export";
+        }
+        return false;
+    }
+    VideoFormat format;
+    if (!videoFormatFromPath(path, &format, error)) {
+        return false;
+    }
+    const int width = window->GetSize()[0];
+    const int height = window->GetSize()[1];
+
+    VideoWriter writer;
+    if (!writer.open(
+            path,
+            format,
+            width,
+            height,
+            options.fps,
+            options.bit_rate,
+            error
+            )) {
+        return false;
+    }
+
+    // Every camera once, with the state to restore
+    std::vector<vtkCamera*> cameras;
+    std::vector<vtkSmartPointer<vtkCamera>> saved;
+    vtkRendererCollection* renderers = window->GetRenderers();
+    vtkCollectionSimpleIterator iterator;
+    renderers->InitTraversal(iterator);
+    while (vtkRenderer* renderer = renderers->GetNextRenderer(iterator)) {
+        vtkCamera* camera = renderer->GetActiveCamera();
+        if (std::find(cameras.begin(), cameras.end(), camera)
+            != cameras.end()) {
+            continue;
+        }
+        cameras.push_back(camera);
+        saved.push_back(vtkSmartPointer<vtkCamera>::New());
+        saved.back()->DeepCopy(camera);
+    }
+
+    SpscRing<RawFrame> ring(std::max(1, options.queue_frames));
+    RingSignal progress;
+    std::atomic<bool> rendering_done(false);
+    std::atomic<bool> encoding_failed(false);
+    std::string encode_error;
+    VideoExportStats result;
+
+    // The encoder drains the ring until rendering is done and the ring empty
+    std::thread encoder([&]() {
+        for (;;) {
+            RawFrame* frame = ring.consumerSlot();
+            if (frame == nullptr) {
+                progress.wait([&]() {
+                    return ring.consumerSlot() != nullptr
+                        || rendering_done.load(std::memory_order_acquire);
+                });
+                frame = ring.consumerSlot();
+                if (frame == nullptr) {
+                    break;
+                }
+            }
+
+            const auto encode_start = Clock::now();
+            const bool written = writer.write(*frame, &encode_error);
+            result.encode_seconds += secondsSince(encode_start);
+            ring.release();
+            if (!written) {
+                encoding_failed = true;
+                progress.notify();
+                break;
+            }
+            progress.notify();
+            ++result.frames;
+        }
+    });
+
+    // Frames are read straight into the ring slots
+    auto readback = vtkSmartPointer<vtkUnsignedCharArray>::New();
+    readback->SetNumberOfComponents(3);
+    const std::size_t frame_bytes = std::size_t(width) * height * 3;
+    double render_seconds = 0.0;
+    double stalled_seconds = 0.0;
+
+    for (int i = 0; i < frame_count && !encoding_failed; ++i) {
+        const auto render_start = Clock::now();
+        if (!animate(i)) {
+            break;
+        }
+        window->Render();
+
+        // Wait for the encoder only once the frame is rendered
+        const auto stall_start = Clock::now();
+        RawFrame* frame = nullptr;
+        progress.wait([&]() {
+            frame = ring.producerSlot();
+            return frame != nullptr || encoding_failed;
+        });
+        const double stalled = secondsSince(stall_start);
+        stalled_seconds += stalled;
+        if (frame == nullptr) {
+            break;
+        }
+
+        frame->id = static_cast<std::uint64_t>(i);
+        frame->width = width;
+        frame->height = height;
+        frame->rgb.resize(frame_bytes);
+        readback->SetArray(
+            frame->rgb.data(),
+            static_cast<vtkIdType>(frame_bytes),
+            1
+            );
+        window->GetPixelData(0, 0, width - 1, height - 1, 0, readback);
+        if (readback->GetPointer(0) != frame->rgb.data()) {
+            // The window reallocated the array, its size did not match
+            const unsigned char* data = readback->GetPointer(0);
+            const std::size_t count = std::min<std::size_t>(
+                frame_bytes,
+                static_cast<std::size_t>(readback->GetNumberOfValues())
+                );
+            std::copy(data, data + count, frame->rgb.begin());
+        }
+        ring.publish();
+        progress.notify();
+        render_seconds += secondsSince(render_start) - stalled;
+    }
+
+    rendering_done.store(true, std::memory_order_release);
+    progress.notify();
+    encoder.join();
+
+    for (std::size_t i = 0; i < cameras.size(); ++i) {
+        cameras[i]->DeepCopy(saved[i]);
+    }
+    window->Render();
+
+    if (encoding_failed) {
+        writer.close();
+        if (error != nullptr) {
+            *error = encode_error;
+        }
+        return false;
+    }
+    if (!writer.close(error)) {
+        return false;
+    }
+
+    result.seconds = secondsSince(start);
+    result.render_seconds = render_seconds;
+    result.stalled_seconds = stalled_seconds;
+    if (stats != nullptr) {
+        *stats = result;
+    }
+
+    return true;
+}
+
+
+// ============================================================================
+// VideoWriter Constructor/Destructor Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// VideoWriter::VideoWriter
+// ----------------------------------------------------------------------------
+//
+// Description: Constructor
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+VideoWriter::VideoWriter()
+    : format(VideoFormat::Y4m),
+      frame_digits(0),
+      width(0),
+      height(0),
+      frames_written(0),
+      file(nullptr)
+{
+}
+
+// ----------------------------------------------------------------------------
+// VideoWriter::~VideoWriter
+// ----------------------------------------------------------------------------
+//
+// Description: Destructor
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: None
+//
+// Side Effects: Closes the file if still open
+//
+// ----------------------------------------------------------------------------
+VideoWriter::~VideoWriter()
+{
+    this->close();
+}
+
+
+// ============================================================================
+// VideoWriter Public Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// VideoWriter::open
+// ----------------------------------------------------------------------------
+//
+// Description: Creates the output and writes its header
+//
+// Inputs:
+// - path: Output file, or the PNG file name pattern: one frame number
+//         field, "%d" or "%0Nd" as in "frame_%05d.png", otherwise the
+//         frame number is appended to the file stem
+// - format: Output format
+// - width, height: Frame size in pixels
+// - fps: Frame rate
+// - bit_rate: FFmpeg bit rate, 0 for the default
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: Creates the file
+//
+// ----------------------------------------------------------------------------
+bool VideoWriter::open(
+    const std::string& path,
+    VideoFormat format,
+    int width,
+    int height,
+    double fps,
+    int bit_rate,
+    std::string* error
+    )
+{
+    this->close();
+    if (width <= 0 || height <= 0 || fps <= 0.0) {
+        if (error != nullptr) {
+            *error = "Invalid video frame size or rate";
+        }
+        return false;
+    }
+
+    this->format = format;
+    this->path = path;
+    this->width = width;
+    this->height = height;
+    this->frames_written = 0;
+
+    switch (format) {
+    case VideoFormat::Y4m: {
+        this->file = std::fopen(path.c_str(), "wb");
+        if (this->file == nullptr) {
+            break;
+        }
+        const long rate = std::lround(fps * 1000.0);
+        std::fprintf(
+            this->file,
+            "YUV4MPEG2 W%d H%d F%ld:1000 Ip A1:1 C420jpeg\n",
+            width,
+            height,
+            rate
+            );
+        const std::size_t chroma =
+            std::size_t((width + 1) / 2) * ((height + 1) / 2);
+        this->planes.resize(std::size_t(width) * height + 2 * chroma);
+        return std::ferror(this->file) == 0;
+    }
+    case VideoFormat::PngSequence: {
+        if (!splitFramePattern(
+                path,
+                &this->frame_prefix,
+                &this->frame_digits,
+                &this->frame_suffix
+                )) {
+            if (error != nullptr) {
+                *error = "Invalid frame file name '" + path
+                    + "' (use one %d or %0Nd field)";
+            }
+            return false;
+        }
+
+        // Fail now rather than at the first frame
+        std::error_code ignored;
+        const fs::path directory = fs::path(this->framePath(0)).parent_path();
+        if (!directory.empty()) {
+            fs::create_directories(directory, ignored);
+        }
+        if (directory.empty() || fs::is_directory(directory)) {
+            this->flipped.resize(std::size_t(width) * height * 3);
+            return true;
+        }
+        break;
+    }
+    case VideoFormat::Ffmpeg: {
+#if defined(QTVTK_HAVE_FFMPEG)
+        this->image = vtkSmartPointer<vtkImageData>::New();
+        this->image->SetDimensions(width, height, 1);
+        this->pixels = vtkSmartPointer<vtkUnsignedCharArray>::New();
+        this->pixels->SetNumberOfComponents(3);
+        this->image->GetPointData()->SetScalars(this->pixels);
+
+        auto writer = vtkSmartPointer<vtkFFMPEGWriter>::New();
+        writer->SetInputData(this->image);
+        writer->SetFileName(path.c_str());
+        writer->SetRate(std::max(1, static_cast<int>(std::lround(fps))));
+        if (bit_rate > 0) {
+            writer->SetBitRate(bit_rate);
+        }
+        this->ffmpeg = writer;
+        return true;
+#else
+        (void)bit_rate;
+        if (error != nullptr) {
+            *error = "VTK was built without FFmpeg";
+        }
+        return false;
+#endif
+    }
+    }
+
+    if (error != nullptr) {
+        *error = "Cannot create '" + path + "'";
+    }
+    return false;
+}
+
+// ----------------------------------------------------------------------------
+// VideoWriter::write
+// ----------------------------------------------------------------------------
+//
+// Description: Appends one frame
+//
+// Inputs:
+// - frame: The frame, of the size given to open
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: Writes to the output
+//
+// ----------------------------------------------------------------------------
+bool VideoWriter::write(const RawFrame& frame, std::string* error)
+{
+    const std::size_t row_bytes = std::size_t(this->width) * 3;
+    if (frame.width != this->width
+        || frame.height != this->height
+        || frame.rgb.size() < row_bytes * this->height) {
+        if (error != nullptr) {
+            *error = "Video frame size changed";
+        }
+        return false;
+    }
+
+    bool ok = false;
+    switch (this->format) {
+    case VideoFormat::Y4m: {
+        if (this->file == nullptr) {
+            break;
+        }
+
+        // Luma per pixel and chroma per 2 x 2 block, rows flipped to top
+        // to bottom; one task converts two luma rows
+        const int w = this->width;
+        const int h = this->height;
+        const int chroma_width = (w + 1) / 2;
+        const int chroma_height = (h + 1) / 2;
+        unsigned char* luma = this->planes.data();
+        unsigned char* u = luma + std::size_t(w) * h;
+        unsigned char* v = u + std::size_t(chroma_width) * chroma_height;
+        const unsigned char* rgb = frame.rgb.data();
+
+        auto convert = [&](vtkIdType begin, vtkIdType end) {
+            for (vtkIdType cy = begin; cy < end; ++cy) {
+                const int rows = std::min(2, h - 2 * int(cy));
+                for (int cx = 0; cx < chroma_width; ++cx) {
+                    const int columns = std::min(2, w - 2 * cx);
+                    int sum[3] = {0, 0, 0};
+                    for (int dy = 0; dy < rows; ++dy) {
+                        const int y = 2 * int(cy) + dy;
+                        const unsigned char* source =
+                            rgb + std::size_t(h - 1 - y) * row_bytes;
+                        for (int dx = 0; dx < columns; ++dx) {
+                            const int x = 2 * cx + dx;
+                            const unsigned char* pixel = source + 3 * x;
+                            luma[std::size_t(y) * w + x] = lumaOf(pixel);
+                            sum[0] += pixel[0];
+                            sum[1] += pixel[1];
+                            sum[2] += pixel[2];
+                        }
+                    }
+                    const std::size_t index =
+                        std::size_t(cy) * chroma_width + cx;
+                    chromaOf(sum, rows * columns, &u[index], &v[index]);
+                }
+            }
+        };
+        vtkSMPTools::For(0, chroma_height, convert);
+
+        std::fputs("FRAME\n", this->file);
+        ok = std::fwrite(
+            this->planes.data(), 1, this->planes.size(), this->file
+            ) == this->planes.size();
+        break;
+    }
+    case VideoFormat::PngSequence: {
+        for (int y = 0; y < this->height; ++y) {
+            const unsigned char* source = frame.rgb.data()
+                + std::size_t(this->height - 1 - y) * row_bytes;
+            std::copy(
+                source,
+                source + row_bytes,
+                this->flipped.begin() + std::size_t(y) * row_bytes
+                );
+        }
+
+        StreamingImageWriter png;
+        const std::string frame_path = this->framePath(this->frames_written);
+        ok = png.open(
+                frame_path,
+                ImageFormat::Png,
+                this->width,
+                this->height,
+                6,
+                error
+                )
+            && png.writeRows(this->flipped.data(), this->height, error)
+            && png.close(error);
+        if (!ok) {
+            return false;
+        }
+        break;
+    }
+    case VideoFormat::Ffmpeg: {
+#if defined(QTVTK_HAVE_FFMPEG)
+        auto writer = vtkFFMPEGWriter::SafeDownCast(this->ffmpeg);
+        if (writer == nullptr) {
+            break;
+        }
+        this->pixels->SetArray(
+            const_cast<unsigned char*>(frame.rgb.data()),
+            static_cast<vtkIdType>(row_bytes * this->height),
+            1
+            );
+        this->pixels->Modified();
+        this->image->Modified();
+        if (this->frames_written == 0) {
+            writer->Start();
+        }
+        writer->Write();
+        ok = writer->GetError() == 0;
+#endif
+        break;
+    }
+    }
+
+    if (!ok) {
+        if (error != nullptr) {
+            *error = "Failed to write frame "
+                + std::to_string(this->frames_written) + " to '"
+                + this->path + "'";
+        }
+        return false;
+    }
+
+    ++this->frames_written;
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// VideoWriter::close
+// ----------------------------------------------------------------------------
+//
+// Description: Finishes the output. Closing a writer that is not open does
+//              nothing.
+//
+// Inputs: None
+//
+// Outputs:
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: Closes the file
+//
+// ----------------------------------------------------------------------------
+bool VideoWriter::close(std::string* error)
+{
+    bool ok = true;
+    if (this->file != nullptr) {
+        ok = std::fclose(this->file) == 0;
+        this->file = nullptr;
+    }
+
+#if defined(QTVTK_HAVE_FFMPEG)
+    auto writer = vtkFFMPEGWriter::SafeDownCast(this->ffmpeg);
+    if (writer != nullptr && this->frames_written > 0) {
+        writer->End();
+        ok = ok && writer->GetError() == 0;
+    }
+#endif
+    this->ffmpeg = nullptr;
+    this->image = nullptr;
+    this->pixels = nullptr;
+
+    if (!ok && error != nullptr) {
+        *error = "Failed to finish '" + this->path + "'";
+    }
+    return ok;
+}
+
+// ----------------------------------------------------------------------------
+// VideoWriter::ffmpegAvailable
+// ----------------------------------------------------------------------------
+//
+// Description: Tells whether this build can write FFmpeg videos
+//
+// Inputs: None
+//
+// Outputs: None
+//
+// Returns: true if VTK was built with its FFmpeg module
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool VideoWriter::ffmpegAvailable()
+{
+#if defined(QTVTK_HAVE_FFMPEG)
+    return true;
+#else
+    return false;
+#endif
+}
+
+
+// ============================================================================
+// VideoWriter Private Methods Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// VideoWriter::framePath
+// ----------------------------------------------------------------------------
+//
+// Description: Returns the file name of a PNG frame
+//
+// Inputs:
+// - index: Frame number, from 0
+//
+// Outputs: None
+//
+// Returns: The path pattern with the frame number filled in, zero padded
+//          to the field width
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+std::string VideoWriter::framePath(int index) const
+{
+    std::string number = std::to_string(index);
+    if (number.size() < static_cast<std::size_t>(this->frame_digits)) {
+        number.insert(0, this->frame_digits - number.size(), '0');
+    }
+    return this->frame_prefix + number + this->frame_suffix;
+}
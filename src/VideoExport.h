@@ -0,0 +1,273 @@
+// ============================================================================
+// VideoExport.h - Animation export with rendering and encoding overlapped
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * VideoExport.h: created.
+// * VideoExport.h: the PNG frame name pattern is split once when opening.
+//
+// ============================================================================
+
+
+#ifndef VideoExport_H
+#define VideoExport_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Standard Library headers
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+// External libraries headers
+#include <vtkAlgorithm.h>
+#include <vtkImageData.h>
+#include <vtkPolyDataMapper.h>
+#include <vtkRenderWindow.h>
+#include <vtkRenderer.h>
+#include <vtkSmartPointer.h>
+#include <vtkUnsignedCharArray.h>
+
+// Project headers
+#include "FrameEncoder.h"
+
+
+// ============================================================================
+// Enumerations Section
+// ============================================================================
+
+// Containers written by VideoWriter
+enum class VideoFormat {
+    Ffmpeg,  // Any container FFmpeg knows, if VTK was built with it
+    Y4m,  // Uncompressed YUV 4:2:0 stream, readable by FFmpeg and players
+    PngSequence  // One PNG file per frame
+};
+
+
+// ============================================================================
+// Structure Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// VideoExportOptions
+// ----------------------------------------------------------------------------
+//
+// Description: How exportVideo renders and encodes
+//
+// Properties:
+// - fps: Frame rate of the video
+// - queue_frames: Frames that may wait for the encoder. Rendering runs
+//                 ahead of encoding by at most this many frames.
+// - bit_rate: Target bit rate of FFmpeg videos in bits per second, 0 for
+//             the FFmpeg default
+//
+// ----------------------------------------------------------------------------
+struct VideoExportOptions {
+    double fps = 30.0;
+    int queue_frames = 8;
+    int bit_rate = 0;
+};
+
+// ----------------------------------------------------------------------------
+// VideoExportStats
+// ----------------------------------------------------------------------------
+//
+// Description: What exportVideo did
+//
+// Properties:
+// - frames: Frames written
+// - seconds: Wall clock time of the export
+// - render_seconds: Time spent rendering and reading frames back
+// - encode_seconds: Time the encoder thread spent encoding and writing
+// - stalled_seconds: Time rendering waited for a free queue slot
+//
+// ----------------------------------------------------------------------------
+struct VideoExportStats {
+    int frames = 0;
+    double seconds = 0.0;
+    double render_seconds = 0.0;
+    double encode_seconds = 0.0;
+    double stalled_seconds = 0.0;
+};
+
+
+// ============================================================================
+// Function Declarations Section
+// ============================================================================
+
+// Sets the scene up for a frame, in frame order. Returning false stops the
+// export early; the frames rendered so far are kept.
+using VideoAnimation = std::function<bool(int frame)>;
+
+// Returns the video format matching the file extension: .y4m, .png (a
+// numbered sequence) or an FFmpeg container (.mp4, .avi, .mkv, .mov).
+// Sets error and returns false for anything else, or for FFmpeg containers
+// when VTK was built without FFmpeg.
+bool videoFormatFromPath(
+    const std::string& path,
+    VideoFormat* format,
+    std::string* error = nullptr
+    );
+
+// Turns the active camera of the renderer a full circle (or degrees) about
+// the view up vector over frame_count frames, starting from its current
+// position.
+VideoAnimation orbitAnimation(
+    vtkRenderer* renderer,
+    int frame_count,
+    double degrees = 360.0
+    );
+
+// Shows the meshes one per frame, read into mapper (time-series playback
+// of a mesh sequence such as solver output).
+VideoAnimation meshSeriesAnimation(
+    vtkPolyDataMapper* mapper,
+    const std::vector<std::string>& paths
+    );
+
+// ----------------------------------------------------------------------------
+// exportVideo
+// ----------------------------------------------------------------------------
+//
+// Description: Renders frame_count frames of an animation and writes them
+//              as a video. The calling thread animates, renders and reads
+//              every frame straight into a slot of a bounded lock-free ring
+//              (SpscRing); an encoder thread takes the frames from the ring
+//              and encodes them, so rendering frame n + 1 overlaps encoding
+//              frame n. Frame buffers are preallocated and reused. The
+//              cameras of the window are restored afterwards.
+//
+// Inputs:
+// - window: The render window, onscreen or offscreen, at the video size
+// - path: Output file, the extension selects the format (see
+//         videoFormatFromPath)
+// - frame_count: Number of frames
+// - animate: Sets the scene up for each frame
+// - options: Frame rate, queue depth and bit rate
+//
+// Outputs:
+// - stats: What was done, if not null
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: Renders the window once per frame
+//
+// ----------------------------------------------------------------------------
+bool exportVideo(
+    vtkRenderWindow* window,
+    const std::string& path,
+    int frame_count,
+    const VideoAnimation& animate,
+    const VideoExportOptions& options = VideoExportOptions(),
+    VideoExportStats* stats = nullptr,
+    std::string* error = nullptr
+    );
+
+
+// ============================================================================
+// Class Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// VideoWriter
+// ----------------------------------------------------------------------------
+//
+// Description: Writes RawFrames, all of one size, to a video file or an
+//              image sequence. Y4M frames are converted to YUV 4:2:0 on all
+//              cores; PNG frames go through StreamingImageWriter, which
+//              compresses on all cores; FFmpeg frames go to vtkFFMPEGWriter
+//              when VTK was built with it (QTVTK_HAVE_FFMPEG).
+//
+// Properties:
+// - format: Output format
+// - path: File name, or the pattern of PNG file names
+// - width, height: Frame size
+// - frames_written: Frames written so far
+// - file: The Y4M stream
+// - planes: YUV planes of the current Y4M frame
+// - flipped: Top to bottom rows of the current PNG frame
+// - image, pixels: Image data wrapping the current FFmpeg frame
+// - ffmpeg: The FFmpeg writer, a vtkGenericMovieWriter
+//
+// Methods:
+// - open: Creates the file and writes the header
+// - write: Appends one frame
+// - close: Finishes the file
+//
+// Example usage:
+//   VideoWriter writer;
+//   writer.open("orbit.y4m", VideoFormat::Y4m, 1920, 1080, 30.0, 0, &error);
+//   writer.write(frame, &error);
+//   writer.close(&error);
+//
+// ----------------------------------------------------------------------------
+class VideoWriter
+{
+public:
+    // Constructor/Destructor
+    VideoWriter();
+    ~VideoWriter();
+
+    VideoWriter(const VideoWriter&) = delete;
+    VideoWriter& operator=(const VideoWriter&) = delete;
+
+    bool open(
+        const std::string& path,
+        VideoFormat format,
+        int width,
+        int height,
+        double fps,
+        int bit_rate = 0,
+        std::string* error = nullptr
+        );
+    bool write(const RawFrame& frame, std::string* error = nullptr);
+    bool close(std::string* error = nullptr);
+
+    static bool ffmpegAvailable();
+
+private:
+    std::string framePath(int index) const;  // Name of a PNG frame
+
+    VideoFormat format;
+    std::string path;
+    std::string frame_prefix;  // PNG frame name before the frame number
+    std::string frame_suffix;  // PNG frame name after the frame number
+    int frame_digits;  // Zero padded width of the frame number
+    int width;
+    int height;
+    int frames_written;
+    std::FILE* file;
+    std::vector<unsigned char> planes;
+    std::vector<unsigned char> flipped;
+    vtkSmartPointer<vtkImageData> image;
+    vtkSmartPointer<vtkUnsignedCharArray> pixels;
+    vtkSmartPointer<vtkAlgorithm> ffmpeg;
+};
+
+#endif  // VideoExport_H
@@ -0,0 +1,463 @@
+// ============================================================================
+// VolumePyramid.cxx - Multi-resolution pyramids of volume images
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * VolumePyramid.cxx: created.
+// * VolumePyramid.cxx: levels are written with compressed chunks.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header -------------------------------------------------------------
+#include "VolumePyramid.h"
+
+// Standard Library headers ---------------------------------------------------
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <type_traits>
+
+// External libraries headers -------------------------------------------------
+
+// VTK headers
+#include <vtkDataArray.h>
+#include <vtkPointData.h>
+#include <vtkSMPTools.h>
+#include <vtkSmartPointer.h>
+
+
+// ============================================================================
+// Local helpers section
+// ============================================================================
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Output rows per tile of the parallel traversal
+const int kTileRows = 16;
+
+// Name of the manifest listing the levels of a pyramid
+const char* const kPyramidManifest = "pyramid.txt";
+
+// Combines the eight voxels of a block
+template <typename T, PyramidReduction R>
+inline T reduceBlock(const T values[8])
+{
+    if constexpr (R == PyramidReduction::Minimum) {
+        return *std::min_element(values, values + 8);
+    } else if constexpr (R == PyramidReduction::Maximum) {
+        return *std::max_element(values, values + 8);
+    } else {
+        double sum = 0.0;
+        for (int index = 0; index < 8; ++index) {
+            sum += static_cast<double>(values[index]);
+        }
+        if constexpr (std::is_integral<T>::value) {
+            return static_cast<T>(std::floor(sum * 0.125 + 0.5));
+        } else {
+            return static_cast<T>(sum * 0.125);
+        }
+    }
+}
+
+// Reduces the output rows [first_row, last_row) of output slice z. An axis
+// that is not halved reads the same input index twice.
+template <typename T, PyramidReduction R>
+void reduceRows(
+    const T* input,
+    const int input_dims[3],
+    T* output,
+    const int output_dims[3],
+    const bool halved[3],
+    int components,
+    int z,
+    int first_row,
+    int last_row
+    )
+{
+    const std::size_t input_row = std::size_t(input_dims[0]) * components;
+    const std::size_t input_slice = input_row * input_dims[1];
+    const std::size_t output_row = std::size_t(output_dims[0]) * components;
+    const std::size_t output_slice = output_row * output_dims[1];
+
+    auto source = [&](int axis, int index, int offset) {
+        return halved[axis]
+            ? std::min(2 * index + offset, input_dims[axis] - 1)
+            : index;
+    };
+
+    const int z0 = source(2, z, 0);
+    const int z1 = source(2, z, 1);
+    for (int y = first_row; y < last_row; ++y) {
+        const int y0 = source(1, y, 0);
+        const int y1 = source(1, y, 1);
+        const T* rows[4] = {
+            input + z0 * input_slice + y0 * input_row,
+            input + z0 * input_slice + y1 * input_row,
+            input + z1 * input_slice + y0 * input_row,
+            input + z1 * input_slice + y1 * input_row
+        };
+        T* target = output + z * output_slice + y * output_row;
+        for (int x = 0; x < output_dims[0]; ++x) {
+            const std::size_t x0 = std::size_t(source(0, x, 0)) * components;
+            const std::size_t x1 = std::size_t(source(0, x, 1)) * components;
+            for (int component = 0; component < components; ++component) {
+                const T values[8] = {
+                    rows[0][x0 + component], rows[0][x1 + component],
+                    rows[1][x0 + component], rows[1][x1 + component],
+                    rows[2][x0 + component], rows[2][x1 + component],
+                    rows[3][x0 + component], rows[3][x1 + component]
+                };
+                *target++ = reduceBlock<T, R>(values);
+            }
+        }
+    }
+}
+
+// Reduces a whole image, tiles of rows spread over cores
+template <typename T, PyramidReduction R>
+void reduceImage(
+    const T* input,
+    const int input_dims[3],
+    T* output,
+    const int output_dims[3],
+    const bool halved[3],
+    int components
+    )
+{
+    const int tiles_per_slice = (output_dims[1] + kTileRows - 1) / kTileRows;
+    const vtkIdType tiles = vtkIdType(tiles_per_slice) * output_dims[2];
+    vtkSMPTools::For(0, tiles, 1, [&](vtkIdType begin, vtkIdType end) {
+        for (vtkIdType tile = begin; tile < end; ++tile) {
+            const int z = static_cast<int>(tile / tiles_per_slice);
+            const int first_row =
+                static_cast<int>(tile % tiles_per_slice) * kTileRows;
+            reduceRows<T, R>(
+                input,
+                input_dims,
+                output,
+                output_dims,
+                halved,
+                components,
+                z,
+                first_row,
+                std::min(first_row + kTileRows, output_dims[1])
+                );
+        }
+    });
+}
+
+template <typename T>
+void reduceImage(
+    const T* input,
+    const int input_dims[3],
+    T* output,
+    const int output_dims[3],
+    const bool halved[3],
+    int components,
+    PyramidReduction reduction
+    )
+{
+    switch (reduction) {
+        case PyramidReduction::Minimum:
+            reduceImage<T, PyramidReduction::Minimum>(
+                input, input_dims, output, output_dims, halved, components
+                );
+            break;
+        case PyramidReduction::Maximum:
+            reduceImage<T, PyramidReduction::Maximum>(
+                input, input_dims, output, output_dims, halved, components
+                );
+            break;
+        default:
+            reduceImage<T, PyramidReduction::Average>(
+                input, input_dims, output, output_dims, halved, components
+                );
+            break;
+    }
+}
+
+double secondsSince(Clock::time_point start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+}  // namespace
+
+
+// ============================================================================
+// Function Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// pyramidReductionName
+// ----------------------------------------------------------------------------
+//
+// Description: Returns the name of a reduction
+//
+// Inputs:
+// - reduction: The reduction
+//
+// Outputs: None
+//
+// Returns: "average", "minimum" or "maximum"
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+const char* pyramidReductionName(PyramidReduction reduction)
+{
+    switch (reduction) {
+        case PyramidReduction::Minimum:
+            return "minimum";
+        case PyramidReduction::Maximum:
+            return "maximum";
+        default:
+            return "average";
+    }
+}
+
+// ----------------------------------------------------------------------------
+// parsePyramidReduction
+// ----------------------------------------------------------------------------
+//
+// Description: Parses the name of a reduction
+//
+// Inputs:
+// - name: "average", "minimum", "maximum", "avg", "min" or "max"
+//
+// Outputs:
+// - reduction: The reduction, if the name is known
+//
+// Returns: Whether the name is known
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool parsePyramidReduction(
+    const std::string& name,
+    PyramidReduction* reduction
+    )
+{
+    if (name == "average" || name == "avg") {
+        *reduction = PyramidReduction::Average;
+    } else if (name == "minimum" || name == "min") {
+        *reduction = PyramidReduction::Minimum;
+    } else if (name == "maximum" || name == "max") {
+        *reduction = PyramidReduction::Maximum;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// downsampleVolume
+// ----------------------------------------------------------------------------
+//
+// Description: Halves an image along every axis longer than one voxel
+//
+// Inputs:
+// - input: The image
+// - reduction: How voxels are combined
+//
+// Outputs:
+// - output: The downsampled image
+//
+// Returns: false if the input has no scalars, true otherwise
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool downsampleVolume(
+    vtkImageData* input,
+    PyramidReduction reduction,
+    vtkImageData* output
+    )
+{
+    vtkDataArray* scalars = input != nullptr
+        ? input->GetPointData()->GetScalars()
+        : nullptr;
+    if (scalars == nullptr || output == nullptr) {
+        return false;
+    }
+
+    int input_dims[3];
+    int output_dims[3];
+    bool halved[3];
+    double origin[3];
+    double spacing[3];
+    input->GetDimensions(input_dims);
+    const int* extent = input->GetExtent();
+    const double* input_origin = input->GetOrigin();
+    const double* input_spacing = input->GetSpacing();
+    for (int axis = 0; axis < 3; ++axis) {
+        halved[axis] = input_dims[axis] > 1;
+        output_dims[axis] = halved[axis]
+            ? (input_dims[axis] + 1) / 2
+            : input_dims[axis];
+        spacing[axis] = input_spacing[axis] * (halved[axis] ? 2.0 : 1.0);
+        origin[axis] = input_origin[axis]
+            + input_spacing[axis] * (extent[2 * axis]
+                                     + (halved[axis] ? 0.5 : 0.0));
+    }
+
+    const int components = scalars->GetNumberOfComponents();
+    output->SetExtent(
+        0, output_dims[0] - 1,
+        0, output_dims[1] - 1,
+        0, output_dims[2] - 1
+        );
+    output->SetOrigin(origin);
+    output->SetSpacing(spacing);
+    output->AllocateScalars(scalars->GetDataType(), components);
+    output->GetPointData()->GetScalars()->SetName(scalars->GetName());
+
+    void* target = output->GetScalarPointer();
+    switch (scalars->GetDataType()) {
+        vtkTemplateMacro(reduceImage(
+            static_cast<const VTK_TT*>(scalars->GetVoidPointer(0)),
+            input_dims,
+            static_cast<VTK_TT*>(target),
+            output_dims,
+            halved,
+            components,
+            reduction
+            ));
+        default:
+            return false;
+    }
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// buildVolumePyramid
+// ----------------------------------------------------------------------------
+//
+// Description: Builds the pyramid of an image, writing each level before
+//              the next one is reduced from it
+//
+// Inputs:
+// - image: The full resolution image
+// - directory: Output directory, created if needed
+// - options: How the levels are built and stored
+//
+// Outputs:
+// - stats: What was done, if not null
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: Writes the level files and the manifest
+//
+// ----------------------------------------------------------------------------
+bool buildVolumePyramid(
+    vtkImageData* image,
+    const std::string& directory,
+    const PyramidOptions& options,
+    PyramidStats* stats,
+    std::string* error
+    )
+{
+    const auto started = Clock::now();
+    std::error_code code;
+    std::filesystem::create_directories(directory, code);
+    if (code) {
+        if (error != nullptr) {
+            *error = "Cannot create '" + directory + "': " + code.message();
+        }
+        return false;
+    }
+
+    PyramidStats counts;
+    std::ofstream manifest(
+        (std::filesystem::path(directory) / kPyramidManifest).string()
+        );
+    manifest << "# QtVTKFramework volume pyramid\n"
+        << "reduction " << pyramidReductionName(options.reduction) << "\n"
+        << "chunk-size " << options.chunk_size << "\n";
+
+    ChunkedWriteOptions write_options;
+    write_options.chunk_size = options.chunk_size;
+    vtkSmartPointer<vtkImageData> level = image;
+    counts.reduce_seconds.push_back(0.0);
+    for (int index = 0; ; ++index) {
+        const std::string name = "level_" + std::to_string(index) + ".qvc";
+        const std::string path =
+            (std::filesystem::path(directory) / name).string();
+        const auto write_started = Clock::now();
+        if (!writeChunkedVolume(level, path, write_options, nullptr, error)) {
+            return false;
+        }
+        counts.write_seconds.push_back(secondsSince(write_started));
+        counts.bytes += std::filesystem::file_size(path, code);
+
+        int dims[3];
+        level->GetDimensions(dims);
+        counts.dimensions.push_back({dims[0], dims[1], dims[2]});
+        manifest << "level " << index << " " << dims[0] << " " << dims[1]
+            << " " << dims[2] << " " << name << "\n";
+
+        const int longest = std::max({dims[0], dims[1], dims[2]});
+        if ((options.levels > 0 && index + 1 >= options.levels)
+            || longest <= std::max(1, options.min_size)) {
+            break;
+        }
+
+        const auto reduce_started = Clock::now();
+        auto next = vtkSmartPointer<vtkImageData>::New();
+        if (!downsampleVolume(level, options.reduction, next)) {
+            if (error != nullptr) {
+                *error = "Cannot downsample level " + std::to_string(index);
+            }
+            return false;
+        }
+        counts.reduce_seconds.push_back(secondsSince(reduce_started));
+        level = next;
+    }
+
+    manifest.close();
+    if (!manifest) {
+        if (error != nullptr) {
+            *error = "Cannot write the manifest in '" + directory + "'";
+        }
+        return false;
+    }
+    counts.seconds = secondsSince(started);
+    if (stats != nullptr) {
+        *stats = counts;
+    }
+
+    return true;
+}
@@ -0,0 +1,189 @@
+// ============================================================================
+// VolumePyramid.h - Multi-resolution pyramids of volume images
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This file is part of QtVTKFramework.
+//
+// QtVTKFramework is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// QtVTKFramework is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// QtVTKFramework. If not, see <https://www.gnu.org/licenses/>.
+// ============================================================================
+
+
+
+// ============================================================================
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * VolumePyramid.h: created.
+//
+// ============================================================================
+
+
+#ifndef VolumePyramid_H
+#define VolumePyramid_H
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Standard Library headers
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// External libraries headers
+#include <vtkImageData.h>
+
+// Project headers
+#include "ChunkedVolume.h"
+
+
+// ============================================================================
+// Enumerations Section
+// ============================================================================
+
+// How the 2 x 2 x 2 voxels under a voxel of the next level are combined
+enum class PyramidReduction {
+    Average,  // Smooth data, e.g. CT and MR intensities
+    Minimum,  // Keeps dark thin features, e.g. vessels on MIP
+    Maximum   // Keeps bright thin features, and labels seen from outside
+};
+
+
+// ============================================================================
+// Structure Definitions Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// PyramidOptions
+// ----------------------------------------------------------------------------
+//
+// Description: How buildVolumePyramid builds and stores the levels
+//
+// Properties:
+// - reduction: How voxels are combined
+// - levels: Most levels to build including the full resolution, 0 for as
+//           many as it takes to get every axis down to min_size
+// - min_size: Voxels along the longest axis of the coarsest level
+// - chunk_size: Edge length of the chunks of the level files
+//
+// ----------------------------------------------------------------------------
+struct PyramidOptions {
+    PyramidReduction reduction = PyramidReduction::Average;
+    int levels = 0;
+    int min_size = 32;
+    int chunk_size = kDefaultChunkSize;
+};
+
+// ----------------------------------------------------------------------------
+// PyramidStats
+// ----------------------------------------------------------------------------
+//
+// Description: What buildVolumePyramid did
+//
+// Properties:
+// - dimensions: Voxels along each axis, per level
+// - reduce_seconds: Time spent downsampling, per level (0 for level 0)
+// - write_seconds: Time spent writing, per level
+// - bytes: Size of the level files
+// - seconds: Wall clock time of the whole build
+//
+// ----------------------------------------------------------------------------
+struct PyramidStats {
+    std::vector<std::vector<int>> dimensions;
+    std::vector<double> reduce_seconds;
+    std::vector<double> write_seconds;
+    std::uint64_t bytes = 0;
+    double seconds = 0.0;
+};
+
+
+// ============================================================================
+// Function Declarations Section
+// ============================================================================
+
+// Returns "average", "minimum" or "maximum"
+const char* pyramidReductionName(PyramidReduction reduction);
+
+// Parses a reduction name, also accepting "avg", "min" and "max"
+bool parsePyramidReduction(
+    const std::string& name,
+    PyramidReduction* reduction
+    );
+
+// ----------------------------------------------------------------------------
+// downsampleVolume
+// ----------------------------------------------------------------------------
+//
+// Description: Halves an image along every axis longer than one voxel,
+//              combining each 2 x 2 x 2 block of voxels (2 x 2 for a single
+//              slice) into one. Odd sizes round up; the last voxel of an odd
+//              axis is repeated to fill its block. The output is traversed
+//              in tiles of rows, each streaming its four input rows front
+//              to back, and tiles are spread over cores with vtkSMPTools.
+//              Every component and every VTK scalar type is reduced, sums
+//              are taken in double.
+//
+// Inputs:
+// - input: The image
+// - reduction: How voxels are combined
+//
+// Outputs:
+// - output: The downsampled image, extent from 0, with the spacing doubled
+//           and the origin at the center of the first block
+//
+// Returns: false if the input has no scalars, true otherwise
+//
+// Side Effects: None
+//
+// ----------------------------------------------------------------------------
+bool downsampleVolume(
+    vtkImageData* input,
+    PyramidReduction reduction,
+    vtkImageData* output
+    );
+
+// ----------------------------------------------------------------------------
+// buildVolumePyramid
+// ----------------------------------------------------------------------------
+//
+// Description: Builds the multi-resolution pyramid of an image and writes
+//              it to a directory: level_<n>.qvc, the chunked volume file of
+//              each level from the full resolution (level 0) down, and
+//              pyramid.txt, which lists them. Only two levels are in memory
+//              at a time.
+//
+// Inputs:
+// - image: The full resolution image
+// - directory: Output directory, created if needed
+// - options: How the levels are built and stored
+//
+// Outputs:
+// - stats: What was done, if not null
+// - error: Description of the failure, if not null
+//
+// Returns: true on success, false otherwise
+//
+// Side Effects: Writes the level files and the manifest
+//
+// ----------------------------------------------------------------------------
+bool buildVolumePyramid(
+    vtkImageData* image,
+    const std::string& directory,
+    const PyramidOptions& options = PyramidOptions(),
+    PyramidStats* stats = nullptr,
+    std::string* error = nullptr
+    );
+
+#endif  // VolumePyramid_H
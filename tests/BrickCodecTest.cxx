@@ -0,0 +1,197 @@
+// ============================================================================
+// BrickCodecTest - Unit tests of the brick compression codec
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// Encodes smooth and noisy bricks of every element size and decodes them
+// back, byte for byte. Empty bricks, truncated payloads and payloads of the
+// wrong size are covered too.
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * BrickCodecTest.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header
+#include "BrickCodec.h"
+
+// "C" system headers
+
+// Standard Library headers
+#include <cstddef>  // required by size_t
+#include <cstdint>  // required by uint8_t
+#include <cstring>  // required by memcpy
+#include <random>   // required by mt19937
+#include <string>   // required by to_string
+#include <vector>   // self explanatory ...
+
+// External libraries headers
+#include <gtest/gtest.h>
+
+
+// ============================================================================
+// Local helpers section
+// ============================================================================
+
+namespace {
+
+// A brick of count elements of element_size bytes. Smooth bricks ramp
+// slowly per component and compress; noisy bricks do not.
+std::vector<std::uint8_t> makeBrick(
+    std::size_t count,
+    int element_size,
+    int components,
+    bool smooth
+    )
+{
+    std::vector<std::uint8_t> brick(count * std::size_t(element_size));
+    std::mt19937_64 random(count * 31 + element_size * 7 + components);
+    for (std::size_t i = 0; i < count; ++i) {
+        const std::uint64_t value = smooth
+            ? std::uint64_t(i / components) / 16 + (i % components) * 1000
+            : random();
+        std::memcpy(
+            brick.data() + i * element_size, &value, element_size
+            );
+    }
+    return brick;
+}
+
+// Encodes a brick and decodes the payload, returns the decoded bytes
+std::vector<std::uint8_t> roundTrip(
+    const std::vector<std::uint8_t>& brick,
+    int element_size,
+    int components,
+    BrickCodec* codec
+    )
+{
+    const std::size_t count = brick.size() / std::size_t(element_size);
+    std::vector<std::uint8_t> payload;
+    *codec = encodeBrick(
+        brick.data(), count, element_size, components, payload
+        );
+
+    std::vector<std::uint8_t> decoded(brick.size(), 0xcd);
+    EXPECT_TRUE(decodeBrick(
+        *codec,
+        payload.data(),
+        payload.size(),
+        count,
+        element_size,
+        components,
+        decoded.data()
+        ));
+    return decoded;
+}
+
+}  // namespace
+
+
+// ============================================================================
+// Tests section
+// ============================================================================
+
+TEST(BrickCodec, RoundTripsEveryElementSize)
+{
+    for (int element_size : {1, 2, 4, 8}) {
+        for (int components : {1, 3}) {
+            for (bool smooth : {true, false}) {
+                SCOPED_TRACE(
+                    "element_size " + std::to_string(element_size)
+                    + ", components " + std::to_string(components)
+                    + (smooth ? ", smooth" : ", noisy")
+                    );
+                const auto brick = makeBrick(
+                    32 * 32 * 32 * components, element_size, components,
+                    smooth
+                    );
+                BrickCodec codec;
+                EXPECT_EQ(
+                    roundTrip(brick, element_size, components, &codec),
+                    brick
+                    );
+                if (smooth) {
+                    EXPECT_NE(codec, BrickCodec::Raw);
+                }
+            }
+        }
+    }
+}
+
+TEST(BrickCodec, RoundTripsShortBricks)
+{
+    // Bricks at the edge of a volume can be a few voxels
+    for (std::size_t count : {1u, 2u, 3u, 7u}) {
+        SCOPED_TRACE("count " + std::to_string(count));
+        const auto brick = makeBrick(count, 2, 1, true);
+        BrickCodec codec;
+        EXPECT_EQ(roundTrip(brick, 2, 1, &codec), brick);
+    }
+}
+
+TEST(BrickCodec, EmptyBrickIsRaw)
+{
+    std::vector<std::uint8_t> payload = {1, 2, 3};
+    EXPECT_EQ(encodeBrick(nullptr, 0, 2, 1, payload), BrickCodec::Raw);
+    EXPECT_TRUE(payload.empty());
+
+    EXPECT_TRUE(decodeBrick(BrickCodec::Raw, nullptr, 0, 0, 2, 1, nullptr));
+}
+
+TEST(BrickCodec, RejectsPayloadOfWrongSize)
+{
+    const auto brick = makeBrick(1000, 2, 1, false);
+    std::vector<std::uint8_t> decoded(brick.size());
+    EXPECT_FALSE(decodeBrick(
+        BrickCodec::Raw, brick.data(), brick.size() - 1, 1000, 2, 1,
+        decoded.data()
+        ));
+}
+
+TEST(BrickCodec, RejectsTruncatedPayload)
+{
+    const auto brick = makeBrick(4096, 2, 1, true);
+    std::vector<std::uint8_t> payload;
+    const BrickCodec codec = encodeBrick(brick.data(), 4096, 2, 1, payload);
+    ASSERT_NE(codec, BrickCodec::Raw);
+
+    std::vector<std::uint8_t> decoded(brick.size());
+    EXPECT_FALSE(decodeBrick(
+        codec, payload.data(), payload.size() / 2, 4096, 2, 1,
+        decoded.data()
+        ));
+}
+
+TEST(BrickCodec, RejectsUnknownCodec)
+{
+    const auto brick = makeBrick(16, 1, 1, true);
+    std::vector<std::uint8_t> decoded(brick.size());
+    EXPECT_FALSE(decodeBrick(
+        static_cast<BrickCodec>(7), brick.data(), brick.size(), 16, 1, 1,
+        decoded.data()
+        ));
+}
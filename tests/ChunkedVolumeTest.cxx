@@ -0,0 +1,260 @@
+// ============================================================================
+// ChunkedVolumeTest - Unit tests of the chunked volume file format
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// Writes a volume whose extent does not start at zero and is not a multiple
+// of the chunk size, raw and compressed, maps it with ChunkedVolumeReader
+// and reads sub-regions across chunk boundaries back voxel by voxel.
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * ChunkedVolumeTest.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header
+#include "ChunkedVolume.h"
+
+// "C" system headers
+
+// Standard Library headers
+#include <algorithm>     // required by replace
+#include <cstdint>       // required by uint8_t, uint16_t
+#include <filesystem>    // Used for the temporary files
+#include <string>        // self explanatory ...
+#include <system_error>  // required by error_code
+#include <vector>        // self explanatory ...
+
+// External libraries headers
+#include <gtest/gtest.h>
+#include <vtkImageData.h>
+#include <vtkNew.h>
+#include <vtkType.h>
+
+
+// ============================================================================
+// Define namespace aliases
+// ============================================================================
+
+namespace fs = std::filesystem;
+
+
+// ============================================================================
+// Local helpers section
+// ============================================================================
+
+namespace {
+
+// Extent of the test volume, 70 x 50 x 40 voxels
+const int kExtent[6] = {10, 79, -5, 44, 0, 39};
+
+// Value of the voxel at an index. Voxels a chunk apart differ.
+std::uint16_t voxelValue(int i, int j, int k, int component)
+{
+    return static_cast<std::uint16_t>(
+        (i - kExtent[0]) + 70 * (j - kExtent[2]) + 3500 * (k % 9)
+        + 30000 * component
+        );
+}
+
+// Writes the test volume to a temporary file per test, removed at the end
+class ChunkedVolumeTest : public ::testing::TestWithParam<bool>
+{
+protected:
+    void SetUp() override
+    {
+        // Parameterized test names hold slashes
+        const auto* test =
+            ::testing::UnitTest::GetInstance()->current_test_info();
+        std::string name = std::string("qtvtk_") + test->test_suite_name()
+            + "_" + test->name() + ".qvc";
+        std::replace(name.begin(), name.end(), '/', '_');
+        this->path = (fs::temp_directory_path() / name).string();
+
+        vtkNew<vtkImageData> image;
+        image->SetExtent(
+            kExtent[0], kExtent[1], kExtent[2], kExtent[3], kExtent[4],
+            kExtent[5]
+            );
+        image->SetOrigin(-1.5, 2.0, 0.25);
+        image->SetSpacing(0.5, 0.75, 2.0);
+        image->AllocateScalars(VTK_UNSIGNED_SHORT, 2);
+        for (int k = kExtent[4]; k <= kExtent[5]; ++k) {
+            for (int j = kExtent[2]; j <= kExtent[3]; ++j) {
+                for (int i = kExtent[0]; i <= kExtent[1]; ++i) {
+                    auto* voxel = static_cast<std::uint16_t*>(
+                        image->GetScalarPointer(i, j, k)
+                        );
+                    voxel[0] = voxelValue(i, j, k, 0);
+                    voxel[1] = voxelValue(i, j, k, 1);
+                }
+            }
+        }
+
+        ChunkedWriteOptions options;
+        options.chunk_size = 16;
+        options.compress = GetParam();
+        std::string error;
+        ASSERT_TRUE(writeChunkedVolume(
+            image, this->path, options, &this->stats, &error
+            )) << error;
+    }
+
+    void TearDown() override
+    {
+        std::error_code ignored;
+        fs::remove(this->path, ignored);
+    }
+
+    // Checks every voxel of an image read from the file
+    static void expectVoxels(vtkImageData* image)
+    {
+        const int* extent = image->GetExtent();
+        for (int k = extent[4]; k <= extent[5]; ++k) {
+            for (int j = extent[2]; j <= extent[3]; ++j) {
+                for (int i = extent[0]; i <= extent[1]; ++i) {
+                    const auto* voxel = static_cast<const std::uint16_t*>(
+                        image->GetScalarPointer(i, j, k)
+                        );
+                    ASSERT_EQ(voxel[0], voxelValue(i, j, k, 0))
+                        << "at " << i << ", " << j << ", " << k;
+                    ASSERT_EQ(voxel[1], voxelValue(i, j, k, 1))
+                        << "at " << i << ", " << j << ", " << k;
+                }
+            }
+        }
+    }
+
+    std::string path;
+    ChunkedWriteStats stats;
+};
+
+}  // namespace
+
+
+// ============================================================================
+// Tests section
+// ============================================================================
+
+TEST_P(ChunkedVolumeTest, HeaderDescribesTheVolume)
+{
+    EXPECT_TRUE(isChunkedVolumeFile(this->path));
+
+    ChunkedVolumeReader reader;
+    ASSERT_TRUE(reader.open(this->path)) << reader.lastError();
+    for (int i = 0; i < 6; ++i) {
+        EXPECT_EQ(reader.extent()[i], kExtent[i]);
+    }
+    EXPECT_EQ(reader.origin()[0], -1.5);
+    EXPECT_EQ(reader.spacing()[2], 2.0);
+    EXPECT_EQ(reader.scalarType(), VTK_UNSIGNED_SHORT);
+    EXPECT_EQ(reader.components(), 2);
+    EXPECT_EQ(reader.chunkSize(), 16);
+
+    // 5 x 4 x 3 chunks, the last of each axis partial
+    EXPECT_EQ(reader.chunkCount(), 60u);
+    EXPECT_EQ(this->stats.chunks, 60u);
+    EXPECT_EQ(reader.uncompressedBytes(), 70u * 50u * 40u * 2u * 2u);
+    if (GetParam()) {
+        EXPECT_LT(reader.storedBytes(), reader.uncompressedBytes());
+    }
+}
+
+TEST_P(ChunkedVolumeTest, ReadsSubRegion)
+{
+    ChunkedVolumeReader reader;
+    ASSERT_TRUE(reader.open(this->path)) << reader.lastError();
+
+    // Spans chunk boundaries on every axis
+    const int region[6] = {23, 61, 8, 30, 14, 33};
+    vtkNew<vtkImageData> image;
+    std::string error;
+    ASSERT_TRUE(reader.readRegion(region, image, &error)) << error;
+
+    for (int i = 0; i < 6; ++i) {
+        EXPECT_EQ(image->GetExtent()[i], region[i]);
+    }
+    EXPECT_EQ(image->GetOrigin()[1], 2.0);
+    EXPECT_EQ(image->GetSpacing()[0], 0.5);
+    EXPECT_EQ(image->GetNumberOfScalarComponents(), 2);
+    expectVoxels(image);
+}
+
+TEST_P(ChunkedVolumeTest, ReadsWholeVolume)
+{
+    ChunkedVolumeReader reader;
+    ASSERT_TRUE(reader.open(this->path)) << reader.lastError();
+
+    vtkNew<vtkImageData> image;
+    std::string error;
+    ASSERT_TRUE(reader.readRegion(kExtent, image, &error)) << error;
+    expectVoxels(image);
+}
+
+TEST_P(ChunkedVolumeTest, ClampsRegionToTheVolume)
+{
+    ChunkedVolumeReader reader;
+    ASSERT_TRUE(reader.open(this->path)) << reader.lastError();
+
+    const int region[6] = {70, 200, -50, 0, 35, 39};
+    const int clamped[6] = {70, 79, -5, 0, 35, 39};
+    vtkNew<vtkImageData> image;
+    std::string error;
+    ASSERT_TRUE(reader.readRegion(region, image, &error)) << error;
+    for (int i = 0; i < 6; ++i) {
+        EXPECT_EQ(image->GetExtent()[i], clamped[i]);
+    }
+    expectVoxels(image);
+
+    const int outside[6] = {80, 90, 0, 10, 0, 10};
+    EXPECT_FALSE(reader.readRegion(outside, image, &error));
+}
+
+TEST_P(ChunkedVolumeTest, ReadsSingleChunk)
+{
+    ChunkedVolumeReader reader;
+    ASSERT_TRUE(reader.open(this->path)) << reader.lastError();
+
+    // The last chunk is partial on every axis
+    std::vector<std::uint8_t> voxels;
+    int extent[6];
+    std::string error;
+    ASSERT_TRUE(reader.readChunk(59, voxels, extent, &error)) << error;
+    const int expected[6] = {74, 79, 43, 44, 32, 39};
+    for (int i = 0; i < 6; ++i) {
+        EXPECT_EQ(extent[i], expected[i]);
+    }
+    EXPECT_EQ(voxels.size(), 6u * 2u * 8u * 2u * 2u);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    RawAndCompressed,
+    ChunkedVolumeTest,
+    ::testing::Values(false, true),
+    [](const ::testing::TestParamInfo<bool>& info) {
+        return std::string(info.param ? "Compressed" : "Raw");
+    });
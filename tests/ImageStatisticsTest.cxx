@@ -0,0 +1,215 @@
+// ============================================================================
+// ImageStatisticsTest - Unit tests of the parallel image statistics
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// Compares computeImageStatistics against a plain serial pass over the same
+// values. The images hold more than one slab, so the result is merged from
+// several threads and rounds. 16-bit images get one bin per value and must
+// match exactly; float images are binned over their range and their
+// percentiles must fall within one bin of the sorted values.
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * ImageStatisticsTest.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header
+#include "ImageStatistics.h"
+
+// "C" system headers
+
+// Standard Library headers
+#include <algorithm>  // required by sort, min, max
+#include <cmath>      // required by ceil, sqrt
+#include <cstddef>    // required by size_t
+#include <cstdint>    // required by uint16_t, uint64_t
+#include <random>     // required by mt19937
+#include <utility>    // required by move
+#include <vector>     // self explanatory ...
+
+// External libraries headers
+#include <gtest/gtest.h>
+#include <vtkImageData.h>
+#include <vtkNew.h>
+#include <vtkType.h>
+
+
+// ============================================================================
+// Local helpers section
+// ============================================================================
+
+namespace {
+
+// Fractions the percentiles are checked at
+const double kFractions[] = {0.0, 0.001, 0.01, 0.25, 0.5, 0.9, 0.99, 1.0};
+
+// Statistics of a run of values, the plain way
+struct Reference {
+    std::vector<double> sorted;
+    double mean = 0.0;
+    double deviation = 0.0;
+
+    explicit Reference(std::vector<double> values)
+        : sorted(std::move(values))
+    {
+        std::sort(this->sorted.begin(), this->sorted.end());
+        for (double value : this->sorted) {
+            this->mean += value;
+        }
+        this->mean /= double(this->sorted.size());
+        for (double value : this->sorted) {
+            this->deviation += (value - this->mean) * (value - this->mean);
+        }
+        this->deviation = std::sqrt(
+            this->deviation / double(this->sorted.size())
+            );
+    }
+
+    // The value a fraction of the values lie at or below
+    double at(double fraction) const
+    {
+        const double size = double(this->sorted.size());
+        const double rank = std::max(std::ceil(fraction * size), 1.0);
+        return this->sorted[std::size_t(rank) - 1];
+    }
+};
+
+}  // namespace
+
+
+// ============================================================================
+// Tests section
+// ============================================================================
+
+TEST(ImageStatistics, ShortImageMatchesSerialPass)
+{
+    // 1.5 million voxels, two slabs
+    vtkNew<vtkImageData> image;
+    image->SetDimensions(128, 128, 96);
+    image->AllocateScalars(VTK_UNSIGNED_SHORT, 1);
+    auto* voxels = static_cast<std::uint16_t*>(image->GetScalarPointer());
+    const std::size_t count = 128 * 128 * 96;
+
+    // Skewed values, so low and high percentiles are far apart
+    std::mt19937 random(42);
+    std::gamma_distribution<double> gamma(2.0, 300.0);
+    std::vector<double> values(count);
+    std::vector<std::uint64_t> histogram(65536, 0);
+    for (std::size_t i = 0; i < count; ++i) {
+        voxels[i] = static_cast<std::uint16_t>(
+            std::min(100.0 + gamma(random), 65535.0)
+            );
+        values[i] = voxels[i];
+        ++histogram[voxels[i]];
+    }
+    const Reference reference(values);
+
+    int reports = 0;
+    const ImageStatistics stats = computeImageStatistics(
+        image,
+        [&reports](const ImageStatistics&) { ++reports; }
+        );
+
+    EXPECT_TRUE(stats.complete());
+    EXPECT_GT(reports, 0);
+    EXPECT_EQ(stats.count, count);
+    EXPECT_EQ(stats.minimum, reference.sorted.front());
+    EXPECT_EQ(stats.maximum, reference.sorted.back());
+    EXPECT_NEAR(stats.mean, reference.mean, 1e-9 * reference.mean);
+    EXPECT_NEAR(
+        stats.deviation, reference.deviation, 1e-9 * reference.deviation
+        );
+    EXPECT_EQ(stats.lower, 0.0);
+    EXPECT_EQ(stats.histogram, histogram);
+
+    // One bin per value: the percentile lies within the bin of the value
+    for (double fraction : kFractions) {
+        SCOPED_TRACE(fraction);
+        const double expected = reference.at(fraction);
+        EXPECT_GE(stats.percentile(fraction), expected);
+        EXPECT_LE(stats.percentile(fraction), expected + 1.0);
+    }
+}
+
+TEST(ImageStatistics, FloatImageMatchesSerialPass)
+{
+    // Two components, only the first is counted
+    vtkNew<vtkImageData> image;
+    image->SetDimensions(160, 100, 80);
+    image->AllocateScalars(VTK_FLOAT, 2);
+    auto* voxels = static_cast<float*>(image->GetScalarPointer());
+    const std::size_t count = 160 * 100 * 80;
+
+    std::mt19937 random(7);
+    std::normal_distribution<float> normal(-3.0f, 25.0f);
+    std::vector<double> values(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        voxels[2 * i] = normal(random);
+        voxels[2 * i + 1] = 1.0e6f;
+        values[i] = voxels[2 * i];
+    }
+    const Reference reference(values);
+
+    const ImageStatistics stats = computeImageStatistics(image);
+
+    EXPECT_TRUE(stats.complete());
+    EXPECT_EQ(stats.count, count);
+    EXPECT_EQ(stats.minimum, reference.sorted.front());
+    EXPECT_EQ(stats.maximum, reference.sorted.back());
+    EXPECT_NEAR(stats.mean, reference.mean, 1e-9 * reference.deviation);
+    EXPECT_NEAR(
+        stats.deviation, reference.deviation, 1e-9 * reference.deviation
+        );
+
+    std::uint64_t binned = 0;
+    for (std::uint64_t in_bin : stats.histogram) {
+        binned += in_bin;
+    }
+    EXPECT_EQ(binned, count);
+    ASSERT_FALSE(stats.histogram.empty());
+
+    // Bins spread over the range: the percentile lies within the bin of
+    // the value, give or take rounding at the bin edges
+    const double width = 1.001 * (stats.upper - stats.lower)
+        / double(stats.histogram.size());
+    for (double fraction : kFractions) {
+        SCOPED_TRACE(fraction);
+        EXPECT_NEAR(
+            stats.percentile(fraction), reference.at(fraction), width
+            );
+    }
+}
+
+TEST(ImageStatistics, EmptyImageHasNoValues)
+{
+    vtkNew<vtkImageData> image;
+    const ImageStatistics stats = computeImageStatistics(image);
+
+    EXPECT_EQ(stats.count, 0u);
+    EXPECT_EQ(stats.percentile(0.5), stats.minimum);
+}
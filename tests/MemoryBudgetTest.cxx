@@ -0,0 +1,176 @@
+// ============================================================================
+// MemoryBudgetTest - Unit tests of the dataset memory budget
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// Checks the order MemoryBudget::enforce evicts in: datasets rendered in the
+// last frame last, derived before primary data, and otherwise the least
+// recently used first. Entries are sized by functions, so the numbers are
+// exact; props are marked through a renderer that is never drawn.
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * MemoryBudgetTest.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header
+#include "MemoryBudget.h"
+
+// "C" system headers
+
+// Standard Library headers
+#include <cstdint>  // required by uint64_t
+#include <string>   // self explanatory ...
+#include <vector>   // self explanatory ...
+
+// External libraries headers
+#include <gtest/gtest.h>
+#include <vtkActor.h>
+#include <vtkNew.h>
+#include <vtkRenderer.h>
+
+
+// ============================================================================
+// Local helpers section
+// ============================================================================
+
+namespace {
+
+// Budget whose eviction handlers log the labels they were called for
+class MemoryBudgetTest : public ::testing::Test
+{
+protected:
+    MemoryBudgetTest() : budget(100) {}
+
+    std::uint64_t add(
+        const std::string& label,
+        std::uint64_t bytes,
+        CacheTier tier,
+        vtkProp* prop = nullptr
+        )
+    {
+        return this->budget.trackSized(
+            [bytes]() { return bytes; },
+            tier,
+            [this, label]() { this->evicted.push_back(label); },
+            label,
+            prop
+            );
+    }
+
+    MemoryBudget budget;
+    std::vector<std::string> evicted;
+};
+
+}  // namespace
+
+
+// ============================================================================
+// Tests section
+// ============================================================================
+
+TEST_F(MemoryBudgetTest, UnlimitedBudgetEvictsNothing)
+{
+    this->budget.setBudget(0);
+    this->add("a", 1000, CacheTier::Primary);
+    this->add("b", 1000, CacheTier::Derived);
+
+    EXPECT_TRUE(this->budget.enforce(1000).empty());
+    EXPECT_TRUE(this->evicted.empty());
+    EXPECT_EQ(this->budget.usage(), 2000u);
+}
+
+TEST_F(MemoryBudgetTest, EvictsOnlyUntilTheIncomingDataFits)
+{
+    this->add("a", 40, CacheTier::Primary);
+    this->add("b", 40, CacheTier::Primary);
+
+    EXPECT_TRUE(this->budget.enforce(20).empty());
+    EXPECT_EQ(this->budget.enforce(40), std::vector<std::string>{"a"});
+    EXPECT_EQ(this->evicted, std::vector<std::string>{"a"});
+    EXPECT_EQ(this->budget.usage(), 40u);
+    EXPECT_EQ(this->budget.entryCount(), 1u);
+}
+
+TEST_F(MemoryBudgetTest, EvictsDerivedBeforePrimary)
+{
+    this->add("primary", 30, CacheTier::Primary);
+    this->add("derived", 30, CacheTier::Derived);
+    this->add("newer primary", 30, CacheTier::Primary);
+
+    EXPECT_EQ(
+        this->budget.enforce(70),
+        (std::vector<std::string>{"derived", "primary"})
+        );
+    EXPECT_EQ(this->evicted, (std::vector<std::string>{"derived", "primary"}));
+}
+
+TEST_F(MemoryBudgetTest, EvictsLeastRecentlyUsedFirst)
+{
+    vtkNew<vtkRenderer> renderer;
+    const std::uint64_t a = this->add("a", 30, CacheTier::Primary);
+    this->add("b", 30, CacheTier::Primary);
+    const std::uint64_t c = this->add("c", 30, CacheTier::Primary);
+
+    // Frames go by, c and then a are used again
+    this->budget.markRendered(renderer);
+    this->budget.touch(c);
+    this->budget.markRendered(renderer);
+    this->budget.touch(a);
+    this->budget.markRendered(renderer);
+
+    EXPECT_EQ(
+        this->budget.enforce(100),
+        (std::vector<std::string>{"b", "c", "a"})
+        );
+}
+
+TEST_F(MemoryBudgetTest, EvictsRenderedDataLast)
+{
+    vtkNew<vtkRenderer> renderer;
+    vtkNew<vtkActor> shown;
+    vtkNew<vtkActor> hidden;
+    vtkNew<vtkActor> removed;
+    hidden->VisibilityOff();
+    renderer->AddActor(shown);
+    renderer->AddActor(hidden);
+
+    this->add("shown derived", 25, CacheTier::Derived, shown);
+    this->add("hidden derived", 25, CacheTier::Derived, hidden);
+    this->add("removed derived", 25, CacheTier::Derived, removed);
+    this->add("primary", 25, CacheTier::Primary);
+    this->budget.markRendered(renderer);
+
+    // Only the visible prop in the renderer counts as used, so the derived
+    // data it shows goes after even the primary data
+    EXPECT_EQ(
+        this->budget.enforce(100),
+        (std::vector<std::string>{
+            "hidden derived", "removed derived", "primary", "shown derived"
+            })
+        );
+}
@@ -0,0 +1,111 @@
+// ============================================================================
+// ParameterSweepTest - Unit tests of the parameter sweep option parsers
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// Checks the value lists, value ranges and image size lists the sweep
+// command line options take, and that malformed ones are rejected.
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * ParameterSweepTest.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header
+#include "ParameterSweep.h"
+
+// "C" system headers
+
+// Standard Library headers
+#include <string>   // self explanatory ...
+#include <utility>  // required by pair
+#include <vector>   // self explanatory ...
+
+// External libraries headers
+#include <gtest/gtest.h>
+
+
+// ============================================================================
+// Tests section
+// ============================================================================
+
+TEST(ParameterSweep, ParsesValueList)
+{
+    std::vector<double> values;
+    ASSERT_TRUE(parseSweepValues("0,45.5,-90,1e2", &values));
+    EXPECT_EQ(values, (std::vector<double>{0.0, 45.5, -90.0, 100.0}));
+
+    ASSERT_TRUE(parseSweepValues("30", &values));
+    EXPECT_EQ(values, std::vector<double>{30.0});
+}
+
+TEST(ParameterSweep, ParsesValueRange)
+{
+    std::vector<double> values;
+    ASSERT_TRUE(parseSweepValues("0:90:4", &values));
+    EXPECT_EQ(values, (std::vector<double>{0.0, 30.0, 60.0, 90.0}));
+
+    ASSERT_TRUE(parseSweepValues("10:-10:3", &values));
+    EXPECT_EQ(values, (std::vector<double>{10.0, 0.0, -10.0}));
+
+    // A single step is the first value
+    ASSERT_TRUE(parseSweepValues("15:90:1", &values));
+    EXPECT_EQ(values, std::vector<double>{15.0});
+}
+
+TEST(ParameterSweep, RejectsMalformedValues)
+{
+    for (const char* text : {
+        "", "abc", "1,,2", "1,x", "10deg", "0:90", "0:90:0", "0:90:-2",
+        "0:90:2.5", "0:90:x", "a:90:3", "0:90:3:4"
+        }) {
+        SCOPED_TRACE(text);
+        std::vector<double> values = {1.0};
+        EXPECT_FALSE(parseSweepValues(text, &values));
+    }
+}
+
+TEST(ParameterSweep, ParsesSizes)
+{
+    std::vector<std::pair<int, int>> sizes;
+    ASSERT_TRUE(parseSweepSizes("800x600,1920x1080,1x1", &sizes));
+    EXPECT_EQ(sizes, (std::vector<std::pair<int, int>>{
+        {800, 600}, {1920, 1080}, {1, 1}
+        }));
+}
+
+TEST(ParameterSweep, RejectsMalformedSizes)
+{
+    for (const char* text : {
+        "", "800", "800x", "x600", "800X600", "800*600", "800x600x3",
+        "0x600", "800x-1", "800x600,,640x480", "800x600px"
+        }) {
+        SCOPED_TRACE(text);
+        std::vector<std::pair<int, int>> sizes;
+        EXPECT_FALSE(parseSweepSizes(text, &sizes));
+    }
+}
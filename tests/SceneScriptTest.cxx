@@ -0,0 +1,149 @@
+// ============================================================================
+// SceneScriptTest - Unit tests of the scene description parser
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// Feeds SceneScript::parse one malformed scene per parse error and checks
+// the message and the line it names. A well formed scene parses.
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * SceneScriptTest.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header
+#include "SceneScript.h"
+
+// "C" system headers
+
+// Standard Library headers
+#include <string>  // self explanatory ...
+
+// External libraries headers
+#include <gtest/gtest.h>
+
+
+// ============================================================================
+// Local helpers section
+// ============================================================================
+
+namespace {
+
+// A malformed scene and the error parse reports for it
+struct ParseFailure {
+    const char* text;
+    const char* error;
+};
+
+const ParseFailure kParseFailures[] = {
+    {"light sun", "scene:1: unknown statement light"},
+    {"reader mesh file=\"my mesh.ply",
+        "scene:1: unterminated quote"},
+    {"source", "scene:1: source needs a name"},
+    {"source type=cone", "scene:1: source needs a name"},
+    {"source a type=cone\nsource a type=sphere",
+        "scene:2: a is already declared"},
+    {"camera azimuth=10\ncamera zoom=2", "scene:2: camera given twice"},
+    {"output image=a.png\noutput video=a.mp4",
+        "scene:2: output given twice"},
+    {"source a type=cone radius", "scene:1: expected key=value, got radius"},
+    {"source a type=cone =2", "scene:1: expected key=value, got =2"},
+    {"source a radius=2", "scene:1: source needs a type"},
+    {"source a type=torus", "scene:1: unknown source type torus"},
+    {"source a type=cone\nfilter f type=blur input=a",
+        "scene:2: unknown filter type blur"},
+    {"source a type=cone colour=red",
+        "scene:1: unknown parameter colour of source"},
+    {"source a type=cone\nfilter f type=shrink input=a radius=2",
+        "scene:2: unknown parameter radius of filter"},
+    {"reader r path=a.ply", "scene:1: unknown parameter path of reader"},
+    {"reader r", "scene:1: reader needs a file"},
+    {"background colour=white",
+        "scene:1: unknown parameter colour of background"},
+    {"camera input=a", "scene:1: unknown parameter input of camera"},
+    {"output images=a.png", "scene:1: unknown parameter images of output"},
+    {"source a type=cone\nfilter f type=shrink",
+        "scene:2: filter needs an input"},
+    {"source a type=cone\nactor b color=red",
+        "scene:2: actor needs an input"},
+    {"actor b input=a",
+        "scene:1: a is not a source, reader or filter declared before"},
+    {"actor b input=a\nsource a type=cone",
+        "scene:1: a is not a source, reader or filter declared before"},
+    {"source a type=cone\nactor b input=a\nactor c input=b",
+        "scene:3: b is not a source, reader or filter declared before"},
+    {"# A comment\n\nsource a type=cone # trailing\nsource b type=torus",
+        "scene:4: unknown source type torus"}
+};
+
+}  // namespace
+
+
+// ============================================================================
+// Tests section
+// ============================================================================
+
+TEST(SceneScript, ParsesWellFormedScene)
+{
+    const std::string text =
+        "# Two views of a cone\n"
+        "set res=32\n"
+        "source cone type=cone resolution=${res} height=2\n"
+        "filter smooth type=smooth input=cone iterations=10\n"
+        "reader mesh file=\"my mesh.ply\"\n"
+        "actor a input=smooth color=tomato opacity=0.5\n"
+        "actor b input=mesh\n"
+        "camera azimuth=30 elevation=15\n"
+        "background color=0.1,0.1,0.2\n"
+        "output image=cone.png size=640x480\n";
+
+    SceneScript script;
+    std::string error;
+    EXPECT_TRUE(script.parse(text, "scene", "", &error)) << error;
+    EXPECT_TRUE(script.hasOutput());
+}
+
+TEST(SceneScript, ReportsParseErrors)
+{
+    for (const ParseFailure& failure : kParseFailures) {
+        SCOPED_TRACE(failure.text);
+        SceneScript script;
+        std::string error;
+        EXPECT_FALSE(script.parse(failure.text, "scene", "", &error));
+        EXPECT_EQ(error, failure.error);
+    }
+}
+
+TEST(SceneScript, FailedParseDropsEarlierScene)
+{
+    SceneScript script;
+    ASSERT_TRUE(script.parse("output image=a.png", "scene"));
+    ASSERT_TRUE(script.hasOutput());
+
+    EXPECT_FALSE(script.parse("output image=a.png frame=3", "scene"));
+    EXPECT_FALSE(script.hasOutput());
+}
@@ -0,0 +1,239 @@
+// ============================================================================
+// TiledImageExportTest - Unit tests of the streaming PNG and TIFF writer
+//
+//  Copyright (C) <yyyy> <Author Name> <author@mail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// Streams an image whose height is not a multiple of the writer's block of
+// rows through StreamingImageWriter, in batches that do not line up with
+// the blocks either, and decodes the file with VTK's PNG and TIFF readers,
+// i.e. with libpng and zlib and with libtiff. Every pixel must come back.
+//
+// 2026-10-19 Ljubomir Kurij <ljubomir_kurij@protonmail.com>
+//
+// * TiledImageExportTest.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers include section
+// ============================================================================
+
+// Related header
+#include "TiledImageExport.h"
+
+// "C" system headers
+
+// Standard Library headers
+#include <algorithm>     // required by replace
+#include <cstddef>       // required by size_t
+#include <filesystem>    // Used for the temporary files
+#include <string>        // self explanatory ...
+#include <system_error>  // required by error_code
+#include <vector>        // self explanatory ...
+
+// External libraries headers
+#include <gtest/gtest.h>
+#include <vtkImageData.h>
+#include <vtkImageReader2.h>
+#include <vtkNew.h>
+#include <vtkPNGReader.h>
+#include <vtkSmartPointer.h>
+#include <vtkTIFFReader.h>
+
+
+// ============================================================================
+// Define namespace aliases
+// ============================================================================
+
+namespace fs = std::filesystem;
+
+
+// ============================================================================
+// Local helpers section
+// ============================================================================
+
+namespace {
+
+// Image size: two whole blocks of rows and a partial one
+const int kWidth = 37;
+const int kHeight = 2 * StreamingImageWriter::kBlockRows + 22;
+
+// Rows handed to the writer per call, summing to kHeight
+const int kBatches[] = {5, 70, kHeight - 75};
+
+// Color of a pixel, row 0 at the top. Varies along both axes, so every
+// PNG row filter gets used.
+void pixel(int x, int y, unsigned char rgb[3])
+{
+    rgb[0] = static_cast<unsigned char>(x * 5 + y);
+    rgb[1] = static_cast<unsigned char>(y * 3);
+    rgb[2] = static_cast<unsigned char>(x ^ y);
+}
+
+// Writes and reads back one image per test, removed at the end
+class StreamingImageWriterTest : public ::testing::TestWithParam<ImageFormat>
+{
+protected:
+    void SetUp() override
+    {
+        // Parameterized test names hold slashes
+        const auto* test =
+            ::testing::UnitTest::GetInstance()->current_test_info();
+        std::string name = std::string("qtvtk_") + test->test_suite_name()
+            + "_" + test->name()
+            + (GetParam() == ImageFormat::Png ? ".png" : ".tif");
+        std::replace(name.begin(), name.end(), '/', '_');
+        this->path = (fs::temp_directory_path() / name).string();
+    }
+
+    void TearDown() override
+    {
+        std::error_code ignored;
+        fs::remove(this->path, ignored);
+    }
+
+    // Top to bottom rows of the test image
+    static std::vector<unsigned char> makeRows()
+    {
+        std::vector<unsigned char> rgb(std::size_t(kWidth) * kHeight * 3);
+        for (int y = 0; y < kHeight; ++y) {
+            for (int x = 0; x < kWidth; ++x) {
+                pixel(x, y, &rgb[(std::size_t(y) * kWidth + x) * 3]);
+            }
+        }
+        return rgb;
+    }
+
+    // Decodes the file with the VTK reader of its format
+    vtkSmartPointer<vtkImageData> decode() const
+    {
+        vtkSmartPointer<vtkImageReader2> reader;
+        if (GetParam() == ImageFormat::Png) {
+            reader = vtkSmartPointer<vtkPNGReader>::New();
+        } else {
+            reader = vtkSmartPointer<vtkTIFFReader>::New();
+        }
+        EXPECT_TRUE(reader->CanReadFile(this->path.c_str()));
+        reader->SetFileName(this->path.c_str());
+        reader->Update();
+        return reader->GetOutput();
+    }
+
+    std::string path;
+};
+
+}  // namespace
+
+
+// ============================================================================
+// Tests section
+// ============================================================================
+
+TEST_P(StreamingImageWriterTest, DecodesToTheRowsWritten)
+{
+    ASSERT_NE(kHeight % StreamingImageWriter::kBlockRows, 0);
+
+    const std::vector<unsigned char> rgb = makeRows();
+    const std::size_t row_bytes = std::size_t(kWidth) * 3;
+
+    StreamingImageWriter writer;
+    std::string error;
+    ASSERT_TRUE(writer.open(
+        this->path, GetParam(), kWidth, kHeight, 6, &error
+        )) << error;
+    int row = 0;
+    for (int rows : kBatches) {
+        ASSERT_TRUE(writer.writeRows(&rgb[row * row_bytes], rows, &error))
+            << error;
+        row += rows;
+    }
+    ASSERT_TRUE(writer.close(&error)) << error;
+    EXPECT_EQ(writer.bytesWritten(), fs::file_size(this->path));
+
+    vtkSmartPointer<vtkImageData> image = this->decode();
+    const int* dimensions = image->GetDimensions();
+    ASSERT_EQ(dimensions[0], kWidth);
+    ASSERT_EQ(dimensions[1], kHeight);
+    ASSERT_EQ(image->GetNumberOfScalarComponents(), 3);
+
+    // VTK puts row 0 at the bottom
+    for (int y = 0; y < kHeight; ++y) {
+        for (int x = 0; x < kWidth; ++x) {
+            unsigned char expected[3];
+            pixel(x, y, expected);
+            const auto* actual = static_cast<const unsigned char*>(
+                image->GetScalarPointer(x, kHeight - 1 - y, 0)
+                );
+            for (int c = 0; c < 3; ++c) {
+                ASSERT_EQ(actual[c], expected[c])
+                    << "at " << x << ", " << y << ", channel " << c;
+            }
+        }
+    }
+}
+
+TEST_P(StreamingImageWriterTest, RejectsRowsPastTheEnd)
+{
+    const std::vector<unsigned char> rgb = makeRows();
+
+    StreamingImageWriter writer;
+    ASSERT_TRUE(writer.open(this->path, GetParam(), kWidth, kHeight));
+    ASSERT_TRUE(writer.writeRows(rgb.data(), kHeight - 1));
+    std::string error;
+    EXPECT_FALSE(writer.writeRows(rgb.data(), 2, &error));
+    EXPECT_FALSE(error.empty());
+}
+
+TEST_P(StreamingImageWriterTest, RejectsIncompleteImage)
+{
+    const std::vector<unsigned char> rgb = makeRows();
+
+    StreamingImageWriter writer;
+    ASSERT_TRUE(writer.open(this->path, GetParam(), kWidth, kHeight));
+    ASSERT_TRUE(writer.writeRows(rgb.data(), kHeight / 2));
+    std::string error;
+    EXPECT_FALSE(writer.close(&error));
+    EXPECT_FALSE(error.empty());
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    PngAndTiff,
+    StreamingImageWriterTest,
+    ::testing::Values(ImageFormat::Png, ImageFormat::Tiff),
+    [](const ::testing::TestParamInfo<ImageFormat>& info) {
+        return std::string(info.param == ImageFormat::Png ? "Png" : "Tiff");
+    });
+
+TEST(ImageFormat, FollowsTheExtension)
+{
+    ImageFormat format = ImageFormat::Tiff;
+    EXPECT_TRUE(imageFormatFromPath("shots/frame.PNG", &format));
+    EXPECT_EQ(format, ImageFormat::Png);
+    EXPECT_TRUE(imageFormatFromPath("poster.tiff", &format));
+    EXPECT_EQ(format, ImageFormat::Tiff);
+    EXPECT_TRUE(imageFormatFromPath("poster.tif", &format));
+    EXPECT_EQ(format, ImageFormat::Tiff);
+
+    std::string error;
+    EXPECT_FALSE(imageFormatFromPath("poster.jpg", &format, &error));
+    EXPECT_FALSE(error.empty());
+}